@@ -53,6 +53,7 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/framework/vulkan/vkShaderToSpirV.cpp \
 	external/vulkancts/framework/vulkan/vkSpirVAsm.cpp \
 	external/vulkancts/framework/vulkan/vkSpirVProgram.cpp \
+	external/vulkancts/framework/vulkan/vkStagingRing.cpp \
 	external/vulkancts/framework/vulkan/vkStrUtil.cpp \
 	external/vulkancts/framework/vulkan/vkTypeUtil.cpp \
 	external/vulkancts/framework/vulkan/vkWsiPlatform.cpp \
@@ -195,6 +196,9 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/modules/vulkan/multiview/vktMultiViewRenderUtil.cpp \
 	external/vulkancts/modules/vulkan/multiview/vktMultiViewTests.cpp \
 	external/vulkancts/modules/vulkan/pch.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceApiTests.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceTestUtil.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceTests.cpp \
 	external/vulkancts/modules/vulkan/pipeline/vktPipelineBlendOperationAdvancedTests.cpp \
 	external/vulkancts/modules/vulkan/pipeline/vktPipelineBlendTests.cpp \
 	external/vulkancts/modules/vulkan/pipeline/vktPipelineCacheTests.cpp \
@@ -475,6 +479,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuAstcUtil.cpp \
 	framework/common/tcuBilinearImageCompare.cpp \
 	framework/common/tcuCPUWarmup.cpp \
+	framework/common/tcuCalibration.cpp \
 	framework/common/tcuCommandLine.cpp \
 	framework/common/tcuCompressedTexture.cpp \
 	framework/common/tcuDefs.cpp \
@@ -513,6 +518,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuTexture.cpp \
 	framework/common/tcuTextureUtil.cpp \
 	framework/common/tcuThreadUtil.cpp \
+	framework/common/tcuTrace.cpp \
 	framework/common/tcuWaiverUtil.cpp \
 	framework/delibs/debase/deDefs.c \
 	framework/delibs/debase/deFloat16.c \
@@ -587,6 +593,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/deutil/deDynamicLibrary.c \
 	framework/delibs/deutil/deFile.c \
 	framework/delibs/deutil/deProcess.c \
+	framework/delibs/deutil/deSharedRing.c \
 	framework/delibs/deutil/deSocket.c \
 	framework/delibs/deutil/deTimer.c \
 	framework/delibs/deutil/deTimerTest.c \
@@ -610,6 +617,7 @@ LOCAL_SRC_FILES := \
 	framework/egl/wrapper/eglwLibrary.cpp \
 	framework/egl/wrapper/eglwWrapper.cpp \
 	framework/opengl/gluCallLogWrapper.cpp \
+	framework/opengl/gluCallTrace.cpp \
 	framework/opengl/gluContextFactory.cpp \
 	framework/opengl/gluContextInfo.cpp \
 	framework/opengl/gluDefs.cpp \
@@ -660,6 +668,7 @@ LOCAL_SRC_FILES := \
 	framework/platform/android/tcuAndroidUtil.cpp \
 	framework/platform/android/tcuAndroidWindow.cpp \
 	framework/platform/android/tcuTestLogParserJNI.cpp \
+	framework/qphelper/qpAsyncWriter.c \
 	framework/qphelper/qpCrashHandler.c \
 	framework/qphelper/qpDebugOut.c \
 	framework/qphelper/qpInfo.c \
@@ -1107,7 +1116,6 @@ LOCAL_SRC_FILES := \
 	modules/glshared/glsAttributeLocationTests.cpp \
 	modules/glshared/glsBufferTestUtil.cpp \
 	modules/glshared/glsBuiltinPrecisionTests.cpp \
-	modules/glshared/glsCalibration.cpp \
 	modules/glshared/glsDrawTest.cpp \
 	modules/glshared/glsFboCompletenessTests.cpp \
 	modules/glshared/glsFboUtil.cpp \
@@ -1177,6 +1185,7 @@ LOCAL_C_INCLUDES := \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/modifiers \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/multiview \
 	$(deqp_dir)/external/vulkancts/modules/vulkan \
+	$(deqp_dir)/external/vulkancts/modules/vulkan/performance \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/pipeline \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/postmortem \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/protected_memory \
@@ -124,6 +124,7 @@ Message* readMessage (de::Socket& socket)
 	switch (type)
 	{
 		case MESSAGETYPE_HELLO:					return new HelloMessage(&messageBuf[0], (int)messageBuf.size());
+		case MESSAGETYPE_CAPABILITIES:			return new CapabilitiesMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_TEST:					return new TestMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_LOG_DATA:		return new ProcessLogDataMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_INFO:					return new InfoMessage(&messageBuf[0], (int)messageBuf.size());
@@ -204,6 +205,10 @@ void Client::run (void)
 				printf("  HelloMessage\n");
 				break;
 
+			case MESSAGETYPE_CAPABILITIES:
+				printf("  CapabilitiesMessage: 0x%x\n", static_cast<CapabilitiesMessage*>(msg.get())->capabilities);
+				break;
+
 			case MESSAGETYPE_KEEPALIVE:
 			{
 				printf("  KeepAliveMessage\n");
@@ -36,16 +36,18 @@
 namespace opt
 {
 
-DE_DECLARE_COMMAND_LINE_OPT(Port,		int);
-DE_DECLARE_COMMAND_LINE_OPT(SingleExec,	bool);
+DE_DECLARE_COMMAND_LINE_OPT(Port,			int);
+DE_DECLARE_COMMAND_LINE_OPT(SingleExec,		bool);
+DE_DECLARE_COMMAND_LINE_OPT(SharedMemLog,	bool);
 
 void registerOptions (de::cmdline::Parser& parser)
 {
 	using de::cmdline::Option;
 	using de::cmdline::NamedValue;
 
-	parser << Option<Port>		("p", "port",	"Port", "50016")
-		   << Option<SingleExec>("s", "single",	"Kill execserver after first session");
+	parser << Option<Port>			("p",		"port",		"Port", "50016")
+		   << Option<SingleExec>	("s",		"single",	"Kill execserver after first session")
+		   << Option<SharedMemLog>	(DE_NULL,	"shm-log",	"Receive test log through shared memory instead of log file");
 }
 
 }
@@ -75,6 +77,10 @@ int main (int argc, const char* const* argv)
 		}
 	}
 
+#if (DE_OS != DE_OS_WIN32)
+	testProcess.setUseSharedMemoryLog(cmdLine.getOption<opt::SharedMemLog>());
+#endif
+
 	try
 	{
 		const xs::ExecutionServer::RunMode	runMode		= cmdLine.getOption<opt::SingleExec>()
@@ -105,6 +105,17 @@ void readBytes (de::Socket& socket, vector<deUint8>& dst, size_t numBytes)
 	}
 }
 
+// Compressed data messages are passed to the test as is.
+class CompressedDataMessage : public Message
+{
+public:
+	std::vector<deUint8>	data;
+
+							CompressedDataMessage	(MessageType type_, const deUint8* data_, size_t dataSize) : Message(type_), data(data_, data_+dataSize) {}
+
+	void					write					(std::vector<deUint8>& buf) const { DE_UNREF(buf); XS_FAIL("Not supported"); }
+};
+
 Message* readMessage (de::Socket& socket)
 {
 	// Header.
@@ -130,11 +141,14 @@ Message* readMessage (de::Socket& socket)
 	switch (type)
 	{
 		case MESSAGETYPE_HELLO:					return new HelloMessage(&messageBuf[0], (int)messageBuf.size());
+		case MESSAGETYPE_CAPABILITIES:			return new CapabilitiesMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_TEST:					return new TestMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_LOG_DATA:		return new ProcessLogDataMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_INFO:					return new InfoMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_LAUNCH_FAILED:	return new ProcessLaunchFailedMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_FINISHED:		return new ProcessFinishedMessage(&messageBuf[0], (int)messageBuf.size());
+		case MESSAGETYPE_COMPRESSED_LOG_DATA:
+		case MESSAGETYPE_COMPRESSED_INFO:		return new CompressedDataMessage(type, &messageBuf[0], messageBuf.size());
 		default:
 			XS_FAIL("Unknown message");
 	}
@@ -361,6 +375,30 @@ public:
 	{
 		xs::HelloMessage msg;
 		sendMessage(socket, (const xs::Message&)msg);
+
+		readCapabilities(socket);
+	}
+
+	//! Waits for the CAPABILITIES reply to HELLO.
+	static int readCapabilities (de::Socket& socket)
+	{
+		const int		timeout		= 1000; // 1s.
+		TestClock		clock;
+
+		for (;;)
+		{
+			if (clock.getMilliseconds() > timeout)
+				XS_FAIL("Didn't receive CAPABILITIES");
+
+			ScopedMsgPtr msg(readMessage(socket));
+
+			if (msg->type == MESSAGETYPE_CAPABILITIES)
+				return static_cast<const CapabilitiesMessage*>(msg.get())->capabilities;
+			else if (msg->type == MESSAGETYPE_KEEPALIVE)
+				continue;
+			else
+				XS_FAIL("Invalid message");
+		}
 	}
 
 	void runProgram (void) { /* nothing */ }
@@ -614,6 +652,120 @@ public:
 	}
 };
 
+class CompressedLogDataTest : public TestCase
+{
+public:
+	enum
+	{
+		NUM_LINES = 1000
+	};
+
+	CompressedLogDataTest (TestContext& testCtx)
+		: TestCase(testCtx, "compressed-logdata")
+	{
+	}
+
+	static std::string getLine (int lineNdx)
+	{
+		return "<Text>Line " + de::toString(lineNdx) + " of repetitive log data</Text>\n";
+	}
+
+	void runClient (de::Socket& socket)
+	{
+		xs::ExecuteBinaryMessage execMsg;
+		execMsg.name		= m_testCtx.testerPath;
+		execMsg.params		= "--program=compressed-logdata";
+		execMsg.caseList	= "";
+		execMsg.workDir		= "";
+
+		sendMessage(socket, HelloMessage());
+
+		if ((HelloTest::readCapabilities(socket) & SERVER_CAPABILITY_COMPRESSION_DEFLATE) == 0)
+			XS_FAIL("Server doesn't advertise deflate compression");
+
+		sendMessage(socket, SetCompressionMessage(COMPRESSION_DEFLATE));
+		sendMessage(socket, execMsg);
+
+		const int			timeout		= 10000; // 10s.
+		TestClock			clock;
+
+		bool				gotProcessStarted	= false;
+		bool				gotProcessFinished	= false;
+		size_t				compressedSize		= 0;
+		StreamDecompressor	decompressor;
+		vector<deUint8>		receivedData;
+
+		for (;;)
+		{
+			if (clock.getMilliseconds() > timeout)
+				break;
+
+			ScopedMsgPtr msg(readMessage(socket));
+
+			if (msg->type == MESSAGETYPE_PROCESS_STARTED)
+				gotProcessStarted = true;
+			else if (msg->type == MESSAGETYPE_PROCESS_LAUNCH_FAILED)
+				XS_FAIL("Got PROCESS_LAUNCH_FAILED");
+			else if (gotProcessStarted && msg->type == MESSAGETYPE_COMPRESSED_LOG_DATA)
+			{
+				const vector<deUint8>& data = static_cast<const CompressedDataMessage*>(msg.get())->data;
+				decompressor.decompress(&data[0], data.size(), receivedData);
+				compressedSize += data.size();
+			}
+			else if (gotProcessStarted && msg->type == MESSAGETYPE_PROCESS_FINISHED)
+			{
+				gotProcessFinished = true;
+				break;
+			}
+			else if (msg->type == MESSAGETYPE_KEEPALIVE || msg->type == MESSAGETYPE_COMPRESSED_INFO)
+				continue;
+			else if (msg->type == MESSAGETYPE_PROCESS_LOG_DATA)
+				XS_FAIL("Got uncompressed log data");
+			else
+				XS_FAIL("Invalid message");
+		}
+
+		if (!gotProcessStarted)
+			XS_FAIL("Did't get PROCESS_STARTED message");
+
+		if (!gotProcessFinished)
+			XS_FAIL("Did't get PROCESS_FINISHED message");
+
+		std::string expected;
+		for (int lineNdx = 0; lineNdx < NUM_LINES; lineNdx++)
+			expected += getLine(lineNdx);
+
+		if (std::string(receivedData.begin(), receivedData.end()) != expected)
+		{
+			printf("  received: %d bytes\n  expected: %d bytes\n", (int)receivedData.size(), (int)expected.size());
+			XS_FAIL("Log data doesn't match");
+		}
+
+		printf("  Received %d bytes of log data in %d bytes\n", (int)receivedData.size(), (int)compressedSize);
+	}
+
+	void runProgram (void)
+	{
+		deFile* file = deFile_create(m_testCtx.logFileName.c_str(), DE_FILEMODE_OPEN|DE_FILEMODE_CREATE|DE_FILEMODE_TRUNCATE|DE_FILEMODE_WRITE);
+		XS_CHECK(file);
+
+		// Write in two halves so that data is split into several messages.
+		for (int lineNdx = 0; lineNdx < NUM_LINES; lineNdx++)
+		{
+			const std::string	line		= getLine(lineNdx);
+			deInt64				numWritten	= 0;
+
+			XS_CHECK(deFile_write(file, line.c_str(), (deInt64)line.length(), &numWritten) == DE_FILERESULT_SUCCESS);
+			XS_CHECK(numWritten == (deInt64)line.length());
+
+			if (lineNdx == NUM_LINES/2)
+				deSleep(500);
+		}
+
+		deFile_destroy(file);
+	}
+};
+
 class BigLogDataTest : public TestCase
 {
 public:
@@ -896,6 +1048,7 @@ void runExecServerTests (int argc, const char* const* argv)
 	testCases.push_back(new SimpleExecTest(testCtx));
 	testCases.push_back(new InfoTest(testCtx));
 	testCases.push_back(new LogDataTest(testCtx));
+	testCases.push_back(new CompressedLogDataTest(testCtx));
 	testCases.push_back(new KeepAliveTest(testCtx));
 	testCases.push_back(new BigLogDataTest(testCtx));
 
@@ -46,6 +46,8 @@ enum
 	LOG_BUFFER_BLOCK_SIZE		= 1024,
 	LOG_BUFFER_NUM_BLOCKS		= 512,
 
+	LOG_SHARED_RING_SIZE		= 4*1024*1024,
+
 	INFO_BUFFER_BLOCK_SIZE		= 64,
 	INFO_BUFFER_NUM_BLOCKS		= 128,
 
@@ -267,6 +267,17 @@ void ExecutionRequestHandler::processMessage (MessageType type, const deUint8* d
 			DBG_PRINT(("HelloMessage: version = %d\n", msg.version));
 			if (msg.version != PROTOCOL_VERSION)
 				throw ProtocolError("Unsupported protocol version");
+
+			// Advertise optional features; clients must not use them before seeing this reply.
+			{
+				vector<deUint8> buf;
+				CapabilitiesMessage(SERVER_CAPABILITY_COMPRESSION_DEFLATE).write(buf);
+
+				if (m_bufferOut.getNumFree() < (int)buf.size())
+					throw ProtocolError("No space in send buffer for CAPABILITIES");
+
+				m_bufferOut.pushFront(&buf[0], (int)buf.size());
+			}
 			break;
 		}
 
@@ -302,6 +313,14 @@ void ExecutionRequestHandler::processMessage (MessageType type, const deUint8* d
 			break;
 		}
 
+		case MESSAGETYPE_SET_COMPRESSION:
+		{
+			SetCompressionMessage msg(data, dataSize);
+			DBG_PRINT(("SetCompressionMessage: %d\n", (int)msg.mode));
+			getTestDriver()->setCompression(msg.mode);
+			break;
+		}
+
 		default:
 			throw ProtocolError("Unsupported message");
 	}
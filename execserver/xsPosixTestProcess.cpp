@@ -24,9 +24,11 @@
 #include "xsPosixTestProcess.hpp"
 #include "deFilePath.hpp"
 #include "deClock.h"
+#include "deString.h"
 
 #include <string.h>
 #include <stdio.h>
+#include <unistd.h>
 
 using std::string;
 using std::vector;
@@ -171,6 +173,8 @@ void PipeReader::stop (void)
 PosixTestProcess::PosixTestProcess (void)
 	: m_process				(DE_NULL)
 	, m_processStartTime	(0)
+	, m_useSharedMemoryLog	(false)
+	, m_logRing				(DE_NULL)
 	, m_infoBuffer			(INFO_BUFFER_BLOCK_SIZE, INFO_BUFFER_NUM_BLOCKS)
 	, m_stdOutReader		(&m_infoBuffer)
 	, m_stdErrReader		(&m_infoBuffer)
@@ -181,6 +185,9 @@ PosixTestProcess::PosixTestProcess (void)
 PosixTestProcess::~PosixTestProcess (void)
 {
 	delete m_process;
+
+	if (m_logRing)
+		deSharedRing_destroy(m_logRing);
 }
 
 void PosixTestProcess::start (const char* name, const char* params, const char* workingDir, const char* caseList)
@@ -203,6 +210,23 @@ void PosixTestProcess::start (const char* name, const char* params, const char*
 	string cmdLine = de::FilePath(name).isAbsolutePath() ? name : de::FilePath::join(workingDir, name).getPath();
 	cmdLine += string(" --deqp-log-filename=") + logFilePath.getBaseName();
 
+	// Log file is still used if the test process can't attach to the ring.
+	if (m_useSharedMemoryLog)
+	{
+		static int	ringNdx		= 0;
+		char		ringName[64];
+
+		DE_ASSERT(!m_logRing);
+
+		deSprintf(ringName, sizeof(ringName), "/deqp-xs-%d-%d", (int)getpid(), ringNdx++);
+		m_logRing = deSharedRing_create(ringName, LOG_SHARED_RING_SIZE);
+
+		if (m_logRing)
+			cmdLine += string(" --deqp-log-shm=") + ringName;
+		else
+			printf("PosixTestProcess::start(): Failed to create shared memory log, using log file\n");
+	}
+
 	if (hasCaseList)
 		cmdLine += " --deqp-stdin-caselist";
 
@@ -220,6 +244,13 @@ void PosixTestProcess::start (const char* name, const char* params, const char*
 	{
 		delete m_process;
 		m_process = DE_NULL;
+
+		if (m_logRing)
+		{
+			deSharedRing_destroy(m_logRing);
+			m_logRing = DE_NULL;
+		}
+
 		throw TestProcessException(e.what());
 	}
 
@@ -293,6 +324,12 @@ void PosixTestProcess::cleanup (void)
 		delete m_process;
 		m_process = DE_NULL;
 	}
+
+	if (m_logRing)
+	{
+		deSharedRing_destroy(m_logRing);
+		m_logRing = DE_NULL;
+	}
 }
 
 bool PosixTestProcess::isRunning (void)
@@ -313,6 +350,20 @@ int PosixTestProcess::getExitCode (void) const
 
 int PosixTestProcess::readTestLog (deUint8* dst, int numBytes)
 {
+	// Ring is read directly, there is no need for a reader thread or polling the file.
+	if (m_logRing && !m_logReader.isRunning() && deSharedRing_isProducerAttached(m_logRing))
+	{
+		const int numRead = (int)deSharedRing_read(m_logRing, dst, (size_t)numBytes);
+
+		if (numRead > 0 || !deSharedRing_isAbandoned(m_logRing))
+			return numRead;
+
+		// Test process gave up on the ring and continues the log in the log file.
+		deSharedRing_destroy(m_logRing);
+		m_logRing			= DE_NULL;
+		m_processStartTime	= deGetMicroseconds();
+	}
+
 	if (!m_logReader.isRunning())
 	{
 		if (deGetMicroseconds() - m_processStartTime > LOG_FILE_TIMEOUT*1000)
@@ -28,6 +28,7 @@
 #include "xsPosixFileReader.hpp"
 #include "deProcess.hpp"
 #include "deThread.hpp"
+#include "deSharedRing.h"
 
 #include <vector>
 #include <string>
@@ -89,6 +90,9 @@ public:
 	virtual int				readTestLog				(deUint8* dst, int numBytes);
 	virtual int				readInfoLog				(deUint8* dst, int numBytes) { return m_infoBuffer.tryRead(numBytes, dst); }
 
+	//! Pass test log through shared memory instead of log file, when supported.
+	void					setUseSharedMemoryLog	(bool enabled) { m_useSharedMemoryLog = enabled; }
+
 private:
 							PosixTestProcess		(const PosixTestProcess& other);
 	PosixTestProcess&		operator=				(const PosixTestProcess& other);
@@ -96,6 +100,8 @@ private:
 	de::Process*			m_process;
 	deUint64				m_processStartTime;		//!< Used for determining log file timeout.
 	std::string				m_logFileName;
+	bool					m_useSharedMemoryLog;
+	deSharedRing*			m_logRing;				//!< Non-null if test process was asked to log into shared memory.
 	ThreadedByteBuffer		m_infoBuffer;
 
 	// Threads.
@@ -23,6 +23,8 @@
 
 #include "xsProtocol.hpp"
 
+#include <zlib.h>
+
 using std::string;
 using std::vector;
 
@@ -174,6 +176,20 @@ void HelloMessage::write (vector<deUint8>& buf) const
 	writer.put(version);
 }
 
+CapabilitiesMessage::CapabilitiesMessage (const deUint8* data, size_t dataSize)
+	: Message(MESSAGETYPE_CAPABILITIES)
+{
+	MessageParser parser(data, dataSize);
+	capabilities = parser.get<int>();
+	parser.assumEnd();
+}
+
+void CapabilitiesMessage::write (vector<deUint8>& buf) const
+{
+	MessageWriter writer(type, buf);
+	writer.put(capabilities);
+}
+
 TestMessage::TestMessage (const deUint8* data, size_t dataSize)
 	: Message(MESSAGETYPE_TEST)
 {
@@ -208,6 +224,20 @@ void ExecuteBinaryMessage::write (vector<deUint8>& buf) const
 	writer.put(caseList.c_str());
 }
 
+SetCompressionMessage::SetCompressionMessage (const deUint8* data, size_t dataSize)
+	: Message(MESSAGETYPE_SET_COMPRESSION)
+{
+	MessageParser parser(data, dataSize);
+	mode = (CompressionMode)parser.get<int>();
+	parser.assumEnd();
+}
+
+void SetCompressionMessage::write (vector<deUint8>& buf) const
+{
+	MessageWriter writer(type, buf);
+	writer.put((int)mode);
+}
+
 ProcessLogDataMessage::ProcessLogDataMessage (const deUint8* data, size_t dataSize)
 	: Message(MESSAGETYPE_PROCESS_LOG_DATA)
 {
@@ -264,4 +294,108 @@ void InfoMessage::write (vector<deUint8>& buf) const
 	writer.put(info.c_str());
 }
 
+// StreamCompressor
+
+StreamCompressor::StreamCompressor (void)
+	: m_stream(new z_stream)
+{
+	deMemset(m_stream, 0, sizeof(z_stream));
+
+	if (deflateInit(m_stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+	{
+		delete m_stream;
+		XS_FAIL("Failed to initialize compressor");
+	}
+}
+
+StreamCompressor::~StreamCompressor (void)
+{
+	deflateEnd(m_stream);
+	delete m_stream;
+}
+
+void StreamCompressor::reset (void)
+{
+	XS_CHECK(deflateReset(m_stream) == Z_OK);
+}
+
+size_t StreamCompressor::getMaxCompressedSize (size_t srcSize) const
+{
+	// \note Bound doesn't include the empty stored block emitted by Z_SYNC_FLUSH.
+	return (size_t)deflateBound(m_stream, (uLong)srcSize) + 16;
+}
+
+void StreamCompressor::compress (const deUint8* src, size_t srcSize, vector<deUint8>& dst)
+{
+	const size_t	dstStart	= dst.size();
+	const size_t	maxDstSize	= getMaxCompressedSize(srcSize);
+
+	DE_ASSERT(srcSize > 0);
+
+	dst.resize(dstStart + maxDstSize);
+
+	m_stream->next_in	= (Bytef*)src;
+	m_stream->avail_in	= (uInt)srcSize;
+	m_stream->next_out	= &dst[dstStart];
+	m_stream->avail_out	= (uInt)maxDstSize;
+
+	// Output is complete only if there is still room left after the flush.
+	XS_CHECK_MSG(deflate(m_stream, Z_SYNC_FLUSH) == Z_OK && m_stream->avail_in == 0 && m_stream->avail_out > 0, "Compression failed");
+
+	dst.resize(dstStart + maxDstSize - m_stream->avail_out);
+}
+
+// StreamDecompressor
+
+StreamDecompressor::StreamDecompressor (void)
+	: m_stream(new z_stream)
+{
+	deMemset(m_stream, 0, sizeof(z_stream));
+
+	if (inflateInit(m_stream) != Z_OK)
+	{
+		delete m_stream;
+		XS_FAIL("Failed to initialize decompressor");
+	}
+}
+
+StreamDecompressor::~StreamDecompressor (void)
+{
+	inflateEnd(m_stream);
+	delete m_stream;
+}
+
+void StreamDecompressor::reset (void)
+{
+	XS_CHECK(inflateReset(m_stream) == Z_OK);
+}
+
+void StreamDecompressor::decompress (const deUint8* src, size_t srcSize, vector<deUint8>& dst)
+{
+	size_t dstPos = dst.size();
+
+	m_stream->next_in	= (Bytef*)src;
+	m_stream->avail_in	= (uInt)srcSize;
+	m_stream->avail_out	= 0;
+
+	// Keep going until all input is consumed and inflate stops filling the output.
+	while (m_stream->avail_in > 0 || m_stream->avail_out == 0)
+	{
+		const size_t	growSize	= de::max<size_t>(srcSize*4, 4096);
+		int				result;
+
+		dst.resize(dstPos + growSize);
+
+		m_stream->next_out	= &dst[dstPos];
+		m_stream->avail_out	= (uInt)growSize;
+
+		result = inflate(m_stream, Z_SYNC_FLUSH);
+		XS_CHECK_MSG(result == Z_OK || result == Z_BUF_ERROR, "Invalid compressed data");
+
+		dstPos += growSize - m_stream->avail_out;
+	}
+
+	dst.resize(dstPos);
+}
+
 } // xs
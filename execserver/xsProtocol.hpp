@@ -29,6 +29,8 @@
 #include <string>
 #include <vector>
 
+struct z_stream_s;
+
 namespace xs
 {
 
@@ -42,6 +44,19 @@ enum
 	KEEPALIVE_TIMEOUT			= 30000,
 };
 
+enum CompressionMode
+{
+	COMPRESSION_NONE					= 0,	//!< Log and info data sent as plain text (default).
+	COMPRESSION_DEFLATE					= 1,	//!< Log and info data sent as streaming deflate, flushed at each message.
+
+	COMPRESSION_LAST
+};
+
+enum ServerCapability
+{
+	SERVER_CAPABILITY_COMPRESSION_DEFLATE	= (1<<0),	//!< SET_COMPRESSION with COMPRESSION_DEFLATE is supported.
+};
+
 enum MessageType
 {
 	MESSAGETYPE_NONE					= 0,	//!< Not valid.
@@ -51,6 +66,7 @@ enum MessageType
 	MESSAGETYPE_TEST					= 101,	//!< Debug only
 	MESSAGETYPE_EXECUTE_BINARY			= 111,	//!< Request execution of a test package binary.
 	MESSAGETYPE_STOP_EXECUTION			= 112,	//!< Request cancellation of the currently executing binary.
+	MESSAGETYPE_SET_COMPRESSION			= 113,	//!< Request compression of log and info data for subsequently started binaries.
 
 	// Responses (from ExecServer to Client)
 	MESSAGETYPE_PROCESS_STARTED			= 200,	//!< Requested process has started.
@@ -58,6 +74,9 @@ enum MessageType
 	MESSAGETYPE_PROCESS_FINISHED		= 202,	//!< Requested process has finished (for any reason).
 	MESSAGETYPE_PROCESS_LOG_DATA		= 203,	//!< Unprocessed log data from TestResults.qpa.
 	MESSAGETYPE_INFO					= 204,	//!< Generic info message from ExecServer (for debugging purposes).
+	MESSAGETYPE_COMPRESSED_LOG_DATA		= 205,	//!< PROCESS_LOG_DATA compressed with the mode set by SET_COMPRESSION.
+	MESSAGETYPE_COMPRESSED_INFO			= 206,	//!< INFO compressed with the mode set by SET_COMPRESSION.
+	MESSAGETYPE_CAPABILITIES			= 207,	//!< Reply to HELLO, lists optional features (ServerCapability bits). Older servers don't send it.
 
 	MESSAGETYPE_KEEPALIVE				= 102	//!< Keep-alive packet
 };
@@ -112,6 +131,18 @@ public:
 	void			write			(std::vector<deUint8>& buf) const;
 };
 
+class CapabilitiesMessage : public Message
+{
+public:
+	int				capabilities;	//!< Combination of ServerCapability bits.
+
+					CapabilitiesMessage		(const deUint8* data, size_t dataSize);
+					CapabilitiesMessage		(int capabilities_) : Message(MESSAGETYPE_CAPABILITIES), capabilities(capabilities_) {}
+					~CapabilitiesMessage	(void) {}
+
+	void			write					(std::vector<deUint8>& buf) const;
+};
+
 class ExecuteBinaryMessage : public Message
 {
 public:
@@ -127,6 +158,18 @@ public:
 	void			write			(std::vector<deUint8>& buf) const;
 };
 
+class SetCompressionMessage : public Message
+{
+public:
+	CompressionMode	mode;
+
+					SetCompressionMessage	(const deUint8* data, size_t dataSize);
+					SetCompressionMessage	(CompressionMode mode_) : Message(MESSAGETYPE_SET_COMPRESSION), mode(mode_) {}
+					~SetCompressionMessage	(void) {}
+
+	void			write					(std::vector<deUint8>& buf) const;
+};
+
 class ProcessLogDataMessage : public Message
 {
 public:
@@ -185,6 +228,52 @@ public:
 	void			write			(std::vector<deUint8>& buf) const;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Streaming deflate compressor for log and info data.
+ *
+ * Each call produces a self-contained chunk that can be decompressed as
+ * soon as it has been received, while the history is shared across calls
+ * so repetitive log content compresses well even in small messages.
+ *//*--------------------------------------------------------------------*/
+class StreamCompressor
+{
+public:
+							StreamCompressor		(void);
+							~StreamCompressor		(void);
+
+	void					reset					(void);
+
+	//! Upper bound for the size of a compressed chunk for srcSize bytes of input.
+	size_t					getMaxCompressedSize	(size_t srcSize) const;
+
+	//! Compress and flush data, output is appended to dst.
+	void					compress				(const deUint8* src, size_t srcSize, std::vector<deUint8>& dst);
+
+private:
+							StreamCompressor		(const StreamCompressor& other);
+	StreamCompressor&		operator=				(const StreamCompressor& other);
+
+	z_stream_s*				m_stream;
+};
+
+class StreamDecompressor
+{
+public:
+							StreamDecompressor		(void);
+							~StreamDecompressor		(void);
+
+	void					reset					(void);
+
+	//! Decompress a chunk produced by StreamCompressor, output is appended to dst.
+	void					decompress				(const deUint8* src, size_t srcSize, std::vector<deUint8>& dst);
+
+private:
+							StreamDecompressor		(const StreamDecompressor& other);
+	StreamDecompressor&		operator=				(const StreamDecompressor& other);
+
+	z_stream_s*				m_stream;
+};
+
 } // xs
 
 #endif // _XSPROTOCOL_HPP
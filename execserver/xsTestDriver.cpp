@@ -46,6 +46,8 @@ TestDriver::TestDriver (xs::TestProcess* testProcess)
 	, m_process				(testProcess)
 	, m_lastProcessDataTime	(0)
 	, m_dataMsgTmpBuf		(SEND_RECV_TMP_BUFFER_SIZE)
+	, m_requestedCompression(COMPRESSION_NONE)
+	, m_compression			(COMPRESSION_NONE)
 {
 }
 
@@ -58,11 +60,17 @@ void TestDriver::reset (void)
 {
 	m_process->cleanup();
 
-	m_state = STATE_NOT_STARTED;
+	m_state					= STATE_NOT_STARTED;
+	m_requestedCompression	= COMPRESSION_NONE;
 }
 
 void TestDriver::startProcess (const char* name, const char* params, const char* workingDir, const char* caseList)
 {
+	// Compression streams start afresh with each process, as does the client.
+	m_compression = m_requestedCompression;
+	m_logCompressor.reset();
+	m_infoCompressor.reset();
+
 	try
 	{
 		m_process->start(name, params, workingDir, caseList);
@@ -81,6 +89,14 @@ void TestDriver::stopProcess (void)
 	m_process->terminate();
 }
 
+void TestDriver::setCompression (CompressionMode mode)
+{
+	if (mode != COMPRESSION_NONE && mode != COMPRESSION_DEFLATE)
+		throw ProtocolError("Unsupported compression mode");
+
+	m_requestedCompression = mode;
+}
+
 bool TestDriver::poll (ByteBuffer& messageBuffer)
 {
 	switch (m_state)
@@ -191,6 +207,9 @@ bool TestDriver::pollInfo (ByteBuffer& messageBuffer)
 
 bool TestDriver::pollBuffer (ByteBuffer& messageBuffer, MessageType msgType)
 {
+	if (m_compression != COMPRESSION_NONE)
+		return pollBufferCompressed(messageBuffer, msgType);
+
 	const int minBytesAvailable = MESSAGE_HEADER_SIZE + MIN_MSG_PAYLOAD_SIZE;
 
 	if (messageBuffer.getNumFree() < minBytesAvailable)
@@ -224,6 +243,46 @@ bool TestDriver::pollBuffer (ByteBuffer& messageBuffer, MessageType msgType)
 	return true;
 }
 
+bool TestDriver::pollBufferCompressed (ByteBuffer& messageBuffer, MessageType msgType)
+{
+	const bool			isLog				= msgType == MESSAGETYPE_PROCESS_LOG_DATA;
+	StreamCompressor&	compressor			= isLog ? m_logCompressor : m_infoCompressor;
+	const int			minBytesAvailable	= MESSAGE_HEADER_SIZE + MIN_MSG_PAYLOAD_SIZE;
+
+	DE_ASSERT(m_compression == COMPRESSION_DEFLATE);
+
+	if (messageBuffer.getNumFree() < minBytesAvailable)
+		return false; // Not enough space in message buffer.
+
+	// Read only as much as is guaranteed to fit in message buffer after compression.
+	const size_t	maxPayloadSize	= (size_t)messageBuffer.getNumFree() - MESSAGE_HEADER_SIZE;
+	const size_t	overhead		= compressor.getMaxCompressedSize(maxPayloadSize) - maxPayloadSize;
+
+	if (maxPayloadSize <= overhead)
+		return false;
+
+	const int		maxReadSize		= (int)de::min(m_dataMsgTmpBuf.size(), maxPayloadSize - overhead);
+	const int		numRead			= isLog ? m_process->readTestLog(&m_dataMsgTmpBuf[0], maxReadSize)
+											: m_process->readInfoLog(&m_dataMsgTmpBuf[0], maxReadSize);
+
+	if (numRead <= 0)
+		return false; // Didn't get any data.
+
+	m_compressedMsgTmpBuf.resize(MESSAGE_HEADER_SIZE);
+	compressor.compress(&m_dataMsgTmpBuf[0], (size_t)numRead, m_compressedMsgTmpBuf);
+
+	const int		msgSize			= (int)m_compressedMsgTmpBuf.size();
+
+	DE_ASSERT(msgSize <= messageBuffer.getNumFree());
+
+	Message::writeHeader(isLog ? MESSAGETYPE_COMPRESSED_LOG_DATA : MESSAGETYPE_COMPRESSED_INFO, msgSize, &m_compressedMsgTmpBuf[0], MESSAGE_HEADER_SIZE);
+	messageBuffer.pushFront(&m_compressedMsgTmpBuf[0], msgSize);
+
+	DBG_PRINT(("  wrote %d bytes of compressed %s data (%d bytes uncompressed)\n", msgSize, isLog ? "log" : "info", numRead));
+
+	return true;
+}
+
 bool TestDriver::writeMessage (ByteBuffer& messageBuffer, const Message& message)
 {
 	vector<deUint8> buf;
@@ -43,6 +43,8 @@ public:
 	void					startProcess		(const char* name, const char* params, const char* workingDir, const char* caseList);
 	void					stopProcess			(void);
 
+	void					setCompression		(CompressionMode mode);
+
 	bool					poll				(ByteBuffer& messageBuffer);
 
 private:
@@ -61,6 +63,7 @@ private:
 	bool					pollLogFile			(ByteBuffer& messageBuffer);
 	bool					pollInfo			(ByteBuffer& messageBuffer);
 	bool					pollBuffer			(ByteBuffer& messageBuffer, MessageType msgType);
+	bool					pollBufferCompressed	(ByteBuffer& messageBuffer, MessageType msgType);
 
 	bool					writeMessage		(ByteBuffer& messageBuffer, const Message& message);
 
@@ -73,6 +76,12 @@ private:
 	deUint64				m_lastProcessDataTime;
 
 	std::vector<deUint8>	m_dataMsgTmpBuf;
+
+	CompressionMode			m_requestedCompression;	//!< Takes effect when next process is started.
+	CompressionMode			m_compression;
+	StreamCompressor		m_logCompressor;
+	StreamCompressor		m_infoCompressor;
+	std::vector<deUint8>	m_compressedMsgTmpBuf;
 };
 
 } // xs
@@ -69,6 +69,7 @@ DE_DECLARE_COMMAND_LINE_OPT(ContinueFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(TestLogFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(InfoLogFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(Summary,		bool);
+DE_DECLARE_COMMAND_LINE_OPT(Compress,		bool);
 
 // TargetConfiguration
 DE_DECLARE_COMMAND_LINE_OPT(BinaryName,		string);
@@ -105,6 +106,7 @@ void registerOptions (de::cmdline::Parser& parser)
 		   << Option<TestLogFile>	("o",		"out",			"Output test log filename.",											"TestLog.qpa")
 		   << Option<InfoLogFile>	("i",		"info",			"Output info log filename.",											"InfoLog.txt")
 		   << Option<Summary>		(DE_NULL,	"summary",		"Print summary after running tests.",									s_yesNo, "yes")
+		   << Option<Compress>		(DE_NULL,	"compress",		"Request compressed log data from a remote ExecServer.",				s_yesNo, "no")
 		   << Option<BinaryName>	("b",		"binaryname",	"Test binary path. Relative to working directory.",						"<Unused>")
 		   << Option<WorkingDir>	("wd",		"workdir",		"Working directory for the test execution.",							".")
 		   << Option<CmdLineArgs>	(DE_NULL,	"cmdline",		"Additional command line arguments for the test binary.",				"");
@@ -123,6 +125,7 @@ struct CommandLine
 	CommandLine (void)
 		: port		(0)
 		, summary	(false)
+		, compress	(false)
 	{
 	}
 
@@ -137,6 +140,7 @@ struct CommandLine
 	string					outFile;
 	string					infoFile;
 	bool					summary;
+	bool					compress;
 };
 
 bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -201,6 +205,7 @@ bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
 	cmdLine.outFile					= opts.getOption<opt::TestLogFile>();
 	cmdLine.infoFile				= opts.getOption<opt::InfoLogFile>();
 	cmdLine.summary					= opts.getOption<opt::Summary>();
+	cmdLine.compress				= opts.getOption<opt::Compress>();
 	cmdLine.targetCfg.binaryName	= opts.getOption<opt::BinaryName>();
 	cmdLine.targetCfg.workingDir	= opts.getOption<opt::WorkingDir>();
 	cmdLine.targetCfg.cmdLineArgs	= opts.getOption<opt::CmdLineArgs>();
@@ -486,6 +491,9 @@ xe::CommLink* createCommLink (const CommandLine& cmdLine)
 		{
 			std::string error;
 
+			if (cmdLine.compress)
+				link->setCompression(xs::COMPRESSION_DEFLATE);
+
 			link->connect(address);
 			return link;
 		}
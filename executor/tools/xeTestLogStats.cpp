@@ -0,0 +1,317 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Report slowest cases and largest regressions from test logs.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeTestLogParser.hpp"
+#include "xeTestResultParser.hpp"
+#include "deString.h"
+
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <limits>
+
+using std::vector;
+using std::string;
+using std::map;
+
+struct CommandLine
+{
+	CommandLine (void)
+		: valueName	("TestDuration")
+		, numCases	(20)
+	{
+	}
+
+	string			filename;
+	string			baselineFilename;
+	string			valueName;
+	int				numCases;
+};
+
+struct CaseValue
+{
+	string				casePath;
+	xe::TestStatusCode	statusCode;
+	double				value;
+};
+
+static bool findValueByName (const xe::ri::List& items, const string& name, double& dst)
+{
+	for (int ndx = 0; ndx < items.getNumItems(); ndx++)
+	{
+		const xe::ri::Item& item = items.getItem(ndx);
+
+		if (item.getType() == xe::ri::TYPE_SECTION)
+		{
+			if (findValueByName(static_cast<const xe::ri::Section&>(item).items, name, dst))
+				return true;
+		}
+		else if (item.getType() == xe::ri::TYPE_NUMBER)
+		{
+			const xe::ri::Number& number = static_cast<const xe::ri::Number&>(item);
+
+			if (number.name != name)
+				continue;
+
+			if (number.value.getType() == xe::ri::NumericValue::NUMVALTYPE_INT64)
+				dst = (double)number.value.getInt64();
+			else if (number.value.getType() == xe::ri::NumericValue::NUMVALTYPE_FLOAT64)
+				dst = number.value.getFloat64();
+			else
+				continue;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+class ValueParser : public xe::TestLogHandler
+{
+public:
+	ValueParser (const string& valueName, vector<CaseValue>& dst)
+		: m_valueName	(valueName)
+		, m_dst			(dst)
+	{
+	}
+
+	void setSessionInfo (const xe::SessionInfo&)
+	{
+		// Ignored.
+	}
+
+	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
+	{
+		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
+	}
+
+	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
+	{
+		// Ignored.
+	}
+
+	void testCaseResultComplete (const xe::TestCaseResultPtr& caseData)
+	{
+		xe::TestCaseResult					fullResult;
+		xe::TestResultParser::ParseResult	parseResult;
+		CaseValue							caseValue;
+
+		if (caseData->getDataSize() == 0)
+			return;
+
+		m_testResultParser.init(&fullResult);
+		parseResult = m_testResultParser.parse(caseData->getData(), caseData->getDataSize());
+
+		if (parseResult == xe::TestResultParser::PARSERESULT_ERROR)
+			return;
+
+		caseValue.casePath		= caseData->getTestCasePath();
+		caseValue.statusCode	= caseData->getStatusCode() != xe::TESTSTATUSCODE_LAST ? caseData->getStatusCode() : fullResult.statusCode;
+		caseValue.value			= 0.0;
+
+		if (findValueByName(fullResult.resultItems, m_valueName, caseValue.value))
+			m_dst.push_back(caseValue);
+	}
+
+private:
+	const string			m_valueName;
+	vector<CaseValue>&		m_dst;
+	xe::TestResultParser	m_testResultParser;
+};
+
+static void readLogFile (vector<CaseValue>& dst, const string& valueName, const char* filename)
+{
+	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
+	ValueParser			resultHandler	(valueName, dst);
+	xe::TestLogParser	parser			(&resultHandler);
+	deUint8				buf				[1024];
+	int					numRead			= 0;
+
+	if (!in.good())
+		throw std::runtime_error(string("Failed to open '") + filename + "'");
+
+	for (;;)
+	{
+		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
+		numRead = (int)in.gcount();
+
+		if (numRead <= 0)
+			break;
+
+		parser.parse(&buf[0], numRead);
+	}
+
+	in.close();
+}
+
+static bool compareValueDesc (const CaseValue& a, const CaseValue& b)
+{
+	return a.value > b.value;
+}
+
+struct Regression
+{
+	string	casePath;
+	double	baseline;
+	double	current;
+};
+
+static bool compareRegressionDesc (const Regression& a, const Regression& b)
+{
+	return (a.current - a.baseline) > (b.current - b.baseline);
+}
+
+static void printSlowestCases (const CommandLine& cmdLine, vector<CaseValue>& values, std::ostream& dst)
+{
+	const size_t numCases = std::min(values.size(), (size_t)cmdLine.numCases);
+
+	std::partial_sort(values.begin(), values.begin() + numCases, values.end(), compareValueDesc);
+
+	dst << "CasePath,StatusCode," << cmdLine.valueName << "\n";
+
+	for (size_t ndx = 0; ndx < numCases; ndx++)
+		dst << values[ndx].casePath << "," << xe::getTestStatusCodeName(values[ndx].statusCode) << "," << values[ndx].value << "\n";
+}
+
+static void printRegressions (const CommandLine& cmdLine, const vector<CaseValue>& values, const vector<CaseValue>& baselineValues, std::ostream& dst)
+{
+	map<string, double>	baselineByPath;
+	vector<Regression>	regressions;
+
+	for (vector<CaseValue>::const_iterator value = baselineValues.begin(); value != baselineValues.end(); ++value)
+		baselineByPath[value->casePath] = value->value;
+
+	for (vector<CaseValue>::const_iterator value = values.begin(); value != values.end(); ++value)
+	{
+		const map<string, double>::const_iterator baseline = baselineByPath.find(value->casePath);
+
+		if (baseline != baselineByPath.end())
+		{
+			const Regression regression = { value->casePath, baseline->second, value->value };
+			regressions.push_back(regression);
+		}
+	}
+
+	{
+		const size_t numCases = std::min(regressions.size(), (size_t)cmdLine.numCases);
+
+		std::partial_sort(regressions.begin(), regressions.begin() + numCases, regressions.end(), compareRegressionDesc);
+
+		dst << "CasePath,Baseline,Current,Difference,Ratio\n";
+
+		for (size_t ndx = 0; ndx < numCases; ndx++)
+		{
+			const Regression& regression = regressions[ndx];
+
+			dst << regression.casePath << "," << regression.baseline << "," << regression.current << "," << (regression.current - regression.baseline) << ",";
+
+			if (regression.baseline > 0.0)
+				dst << (regression.current / regression.baseline);
+
+			dst << "\n";
+		}
+	}
+}
+
+static void printHelp (const char* binName)
+{
+	printf("%s: [options] [log] [[baseline log]]\n", binName);
+	printf(" Lists the cases with the largest value, or with a baseline log the cases\n");
+	printf(" with the largest increase over the baseline.\n");
+	printf(" --value=name     Name of the logged value (default: TestDuration)\n");
+	printf("                  For example InitTime, IterateTime, ProgramBuildTime, QueueSubmits\n");
+	printf(" --cases=N|all    Number of cases to list (default: 20). Use all to write\n");
+	printf("                  a history file for --deqp-fraction-history-file\n");
+}
+
+static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
+{
+	for (int argNdx = 1; argNdx < argc; argNdx++)
+	{
+		const char* arg = argv[argNdx];
+
+		if (deStringBeginsWith(arg, "--value="))
+			cmdLine.valueName = arg + 8;
+		else if (deStringEqual(arg, "--cases=all"))
+			cmdLine.numCases = std::numeric_limits<int>::max();
+		else if (deStringBeginsWith(arg, "--cases="))
+			cmdLine.numCases = atoi(arg + 8);
+		else if (!deStringBeginsWith(arg, "--"))
+		{
+			if (cmdLine.filename.empty())
+				cmdLine.filename = arg;
+			else if (cmdLine.baselineFilename.empty())
+				cmdLine.baselineFilename = arg;
+			else
+				return false;
+		}
+		else
+			return false;
+	}
+
+	if (cmdLine.filename.empty() || cmdLine.valueName.empty() || cmdLine.numCases <= 0)
+		return false;
+
+	return true;
+}
+
+int main (int argc, const char* const* argv)
+{
+	try
+	{
+		CommandLine			cmdLine;
+		vector<CaseValue>	values;
+
+		if (!parseCommandLine(cmdLine, argc, argv))
+		{
+			printHelp(argv[0]);
+			return -1;
+		}
+
+		readLogFile(values, cmdLine.valueName, cmdLine.filename.c_str());
+
+		if (cmdLine.baselineFilename.empty())
+			printSlowestCases(cmdLine, values, std::cout);
+		else
+		{
+			vector<CaseValue> baselineValues;
+
+			readLogFile(baselineValues, cmdLine.valueName, cmdLine.baselineFilename.c_str());
+			printRegressions(cmdLine, values, baselineValues, std::cout);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		printf("FATAL ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return 0;
+}
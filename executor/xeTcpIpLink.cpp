@@ -32,7 +32,10 @@ namespace xe
 enum
 {
 	SEND_BUFFER_BLOCK_SIZE		= 1024,
-	SEND_BUFFER_NUM_BLOCKS		= 64
+	SEND_BUFFER_NUM_BLOCKS		= 64,
+
+	CAPABILITIES_TIMEOUT		= 1000,	//!< Time (ms) to wait for reply to HELLO. Old servers don't reply at all.
+	CAPABILITIES_POLL_INTERVAL	= 10
 };
 
 // Utilities for writing messages out.
@@ -66,18 +69,36 @@ static void writeExecuteBinary (de::BlockBuffer<deUint8>& dst, const char* name,
 	dst.flush();
 }
 
+static void writeHello (de::BlockBuffer<deUint8>& dst)
+{
+	std::vector<deUint8> buf;
+	xs::HelloMessage().write(buf);
+	dst.write((int)buf.size(), &buf[0]);
+	dst.flush();
+}
+
 static void writeStopExecution (de::BlockBuffer<deUint8>& dst)
 {
 	writeMessageHeader(dst, xs::MESSAGETYPE_STOP_EXECUTION, xs::MESSAGE_HEADER_SIZE);
 	dst.flush();
 }
 
+static void writeSetCompression (de::BlockBuffer<deUint8>& dst, xs::CompressionMode mode)
+{
+	std::vector<deUint8> buf;
+	xs::SetCompressionMessage(mode).write(buf);
+	dst.write((int)buf.size(), &buf[0]);
+	dst.flush();
+}
+
 // TcpIpLinkState
 
 TcpIpLinkState::TcpIpLinkState (CommLinkState initialState, const char* initialErr)
 	: m_state					(initialState)
 	, m_error					(initialErr)
 	, m_lastKeepaliveReceived	(0)
+	, m_capabilitiesReceived	(false)
+	, m_capabilities			(0)
 	, m_stateChangedCallback	(DE_NULL)
 	, m_testLogDataCallback		(DE_NULL)
 	, m_infoLogDataCallback		(DE_NULL)
@@ -173,6 +194,27 @@ deUint64 TcpIpLinkState::getLastKeepaliveRecevied (void) const
 	return m_lastKeepaliveReceived;
 }
 
+void TcpIpLinkState::onCapabilitiesReceived (int capabilities)
+{
+	de::ScopedLock lock(m_lock);
+	m_capabilities			= capabilities;
+	m_capabilitiesReceived	= true;
+}
+
+void TcpIpLinkState::clearCapabilities (void)
+{
+	de::ScopedLock lock(m_lock);
+	m_capabilities			= 0;
+	m_capabilitiesReceived	= false;
+}
+
+bool TcpIpLinkState::getCapabilities (int& capabilities) const
+{
+	de::ScopedLock lock(m_lock);
+	capabilities = m_capabilities;
+	return m_capabilitiesReceived;
+}
+
 // TcpIpSendThread
 
 TcpIpSendThread::TcpIpSendThread (de::Socket& socket, TcpIpLinkState& state)
@@ -367,8 +409,20 @@ void TcpIpRecvThread::handleMessage (xs::MessageType messageType, const deUint8*
 			m_state.onKeepaliveReceived();
 			break;
 
+		case xs::MESSAGETYPE_CAPABILITIES:
+		{
+			xs::CapabilitiesMessage msg(data, dataSize);
+			m_state.onCapabilitiesReceived(msg.capabilities);
+			break;
+		}
+
 		case xs::MESSAGETYPE_PROCESS_STARTED:
 			XE_CHECK_MSG(m_state.getState() == COMMLINKSTATE_TEST_PROCESS_LAUNCHING, "Unexpected PROCESS_STARTED message");
+
+			// Server starts new compression streams for each process.
+			m_logDecompressor.reset();
+			m_infoDecompressor.reset();
+
 			m_state.setState(COMMLINKSTATE_TEST_PROCESS_RUNNING);
 			break;
 
@@ -404,6 +458,29 @@ void TcpIpRecvThread::handleMessage (xs::MessageType messageType, const deUint8*
 				m_state.onInfoLogData(&data[0], dataSize);
 			break;
 
+		case xs::MESSAGETYPE_COMPRESSED_LOG_DATA:
+		case xs::MESSAGETYPE_COMPRESSED_INFO:
+			XE_CHECK_MSG(dataSize > 0, "Empty compressed data message");
+
+			m_decompressedBuf.clear();
+
+			if (messageType == xs::MESSAGETYPE_COMPRESSED_LOG_DATA)
+			{
+				XE_CHECK_MSG(m_state.getState() == COMMLINKSTATE_TEST_PROCESS_RUNNING, "Unexpected COMPRESSED_LOG_DATA message");
+				m_logDecompressor.decompress(data, dataSize, m_decompressedBuf);
+
+				if (!m_decompressedBuf.empty())
+					m_state.onTestLogData(&m_decompressedBuf[0], m_decompressedBuf.size());
+			}
+			else
+			{
+				m_infoDecompressor.decompress(data, dataSize, m_decompressedBuf);
+
+				if (!m_decompressedBuf.empty())
+					m_state.onInfoLogData(&m_decompressedBuf[0], m_decompressedBuf.size());
+			}
+			break;
+
 		default:
 			XE_FAIL("Unknown message");
 	}
@@ -416,6 +493,8 @@ TcpIpLink::TcpIpLink (void)
 	, m_sendThread		(m_socket, m_state)
 	, m_recvThread		(m_socket, m_state)
 	, m_keepaliveTimer	(DE_NULL)
+	, m_compression		(xs::COMPRESSION_NONE)
+	, m_compressionPending	(false)
 {
 	m_keepaliveTimer = deTimer_create(keepaliveTimerCallback, this);
 	XE_CHECK(m_keepaliveTimer);
@@ -469,12 +548,22 @@ void TcpIpLink::connect (const de::SocketAddress& address)
 		// Clear error and set state to ready.
 		m_state.setState(COMMLINKSTATE_READY, "");
 		m_state.onKeepaliveReceived();
+		m_state.clearCapabilities();
+		m_compressionPending = false;
 
 		// Launch threads.
 		m_sendThread.start();
 		m_recvThread.start();
 
 		XE_CHECK(deTimer_scheduleInterval(m_keepaliveTimer, xs::KEEPALIVE_SEND_INTERVAL));
+
+		// \note Server keeps plain data messages unless asked, so nothing is sent by default.
+		//		 Otherwise ask for capabilities first; SET_COMPRESSION is sent in negotiateCompression().
+		if (m_compression != xs::COMPRESSION_NONE)
+		{
+			writeHello(m_sendThread.getBuffer());
+			m_compressionPending = true;
+		}
 	}
 	catch (const std::exception& e)
 	{
@@ -550,10 +639,31 @@ void TcpIpLink::startTestProcess (const char* name, const char* params, const ch
 {
 	XE_CHECK(m_state.getState() == COMMLINKSTATE_READY);
 
+	if (m_compressionPending)
+		negotiateCompression();
+
 	m_state.setState(COMMLINKSTATE_TEST_PROCESS_LAUNCHING);
 	writeExecuteBinary(m_sendThread.getBuffer(), name, params, workingDir, caseList);
 }
 
+void TcpIpLink::negotiateCompression (void)
+{
+	const deUint64	startTime		= deGetMicroseconds();
+	int				capabilities	= 0;
+	bool			received		= false;
+
+	// \note Servers that predate CAPABILITIES accept HELLO silently, in which case data stays uncompressed.
+	while (!(received = m_state.getCapabilities(capabilities)) &&
+		   deGetMicroseconds()-startTime < (deUint64)CAPABILITIES_TIMEOUT*1000 &&
+		   m_state.getState() == COMMLINKSTATE_READY)
+		deSleep(CAPABILITIES_POLL_INTERVAL);
+
+	m_compressionPending = false;
+
+	if (received && m_compression == xs::COMPRESSION_DEFLATE && (capabilities & xs::SERVER_CAPABILITY_COMPRESSION_DEFLATE) != 0)
+		writeSetCompression(m_sendThread.getBuffer(), m_compression);
+}
+
 void TcpIpLink::stopTestProcess (void)
 {
 	XE_CHECK(m_state.getState() != COMMLINKSTATE_ERROR);
@@ -55,6 +55,10 @@ public:
 	void						onKeepaliveReceived			(void);
 	deUint64					getLastKeepaliveRecevied	(void) const;
 
+	void						onCapabilitiesReceived		(int capabilities);
+	void						clearCapabilities			(void);
+	bool						getCapabilities				(int& capabilities) const;
+
 private:
 	mutable de::Mutex					m_lock;
 	volatile CommLinkState				m_state;
@@ -62,6 +66,9 @@ private:
 
 	volatile deUint64					m_lastKeepaliveReceived;
 
+	volatile bool						m_capabilitiesReceived;
+	volatile int						m_capabilities;
+
 	volatile CommLink::StateChangedFunc	m_stateChangedCallback;
 	volatile CommLink::LogDataFunc		m_testLogDataCallback;
 	volatile CommLink::LogDataFunc		m_infoLogDataCallback;
@@ -112,6 +119,10 @@ private:
 	std::vector<deUint8>		m_curMsgBuf;
 	size_t						m_curMsgPos;
 
+	xs::StreamDecompressor		m_logDecompressor;
+	xs::StreamDecompressor		m_infoDecompressor;
+	std::vector<deUint8>		m_decompressedBuf;
+
 	bool						m_isRunning;
 };
 
@@ -125,6 +136,9 @@ public:
 	void						connect					(const de::SocketAddress& address);
 	void						disconnect				(void);
 
+	//! Request compressed log and info data, takes effect on next connect(). Falls back to plain data if server doesn't advertise the mode.
+	void						setCompression			(xs::CompressionMode mode) { m_compression = mode; }
+
 	// CommLink API
 	void						reset					(void);
 
@@ -138,6 +152,7 @@ public:
 
 private:
 	void						closeConnection			(void);
+	void						negotiateCompression	(void);
 
 	static void					keepaliveTimerCallback	(void* ptr);
 
@@ -148,6 +163,9 @@ private:
 	TcpIpRecvThread				m_recvThread;
 
 	deTimer*					m_keepaliveTimer;
+
+	xs::CompressionMode			m_compression;
+	bool						m_compressionPending;	//!< HELLO sent, SET_COMPRESSION not yet resolved.
 };
 
 } // xe
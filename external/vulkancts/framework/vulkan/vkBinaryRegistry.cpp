@@ -599,13 +599,19 @@ ProgramBinary* BinaryRegistryReader::loadProgram (const ProgramIdentifier& id) c
 			{
 				de::UniquePtr<tcu::Resource>	progRes		(m_archive.getResource(fullPath.c_str()));
 				const int						progSize	= progRes->getSize();
-				vector<deUint8>					bytes		(progSize);
 
-				TCU_CHECK_INTERNAL(!bytes.empty());
+				TCU_CHECK_INTERNAL(progSize > 0);
 
-				progRes->read(&bytes[0], progSize);
+				if (const deUint8* const progData = progRes->getData())
+					return new ProgramBinary(vk::PROGRAM_FORMAT_SPIRV, (size_t)progSize, progData);
 
-				return new ProgramBinary(vk::PROGRAM_FORMAT_SPIRV, bytes.size(), &bytes[0]);
+				{
+					vector<deUint8>	bytes	(progSize);
+
+					progRes->read(&bytes[0], progSize);
+
+					return new ProgramBinary(vk::PROGRAM_FORMAT_SPIRV, bytes.size(), &bytes[0]);
+				}
 			}
 			catch (const tcu::ResourceError& e)
 			{
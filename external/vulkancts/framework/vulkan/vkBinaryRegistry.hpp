@@ -105,7 +105,7 @@ public:
 									LazyResource		(de::MovePtr<tcu::Resource> resource);
 
 	const Element&					operator[]			(size_t ndx);
-	size_t							size				(void) const { return m_elements.size();	}
+	size_t							size				(void) const { return m_numElements;	}
 
 private:
 	enum
@@ -119,6 +119,7 @@ private:
 	void							makePageResident	(size_t pageNdx);
 
 	de::UniquePtr<tcu::Resource>	m_resource;
+	size_t							m_numElements;
 
 	std::vector<Element>			m_elements;
 	std::vector<bool>				m_isPageResident;
@@ -126,7 +127,8 @@ private:
 
 template<typename Element>
 LazyResource<Element>::LazyResource (de::MovePtr<tcu::Resource> resource)
-	: m_resource(resource)
+	: m_resource	(resource)
+	, m_numElements	(0)
 {
 	const size_t	resSize		= m_resource->getSize();
 	const size_t	numElements	= resSize/sizeof(Element);
@@ -134,8 +136,14 @@ LazyResource<Element>::LazyResource (de::MovePtr<tcu::Resource> resource)
 
 	TCU_CHECK_INTERNAL(numElements*sizeof(Element) == resSize);
 
-	m_elements.resize(numElements);
-	m_isPageResident.resize(numPages, false);
+	m_numElements = numElements;
+
+	// Memory-resident resources are accessed in place, no need for a paged copy
+	if (!m_resource->getData())
+	{
+		m_elements.resize(numElements);
+		m_isPageResident.resize(numPages, false);
+	}
 }
 
 template<typename Element>
@@ -143,9 +151,13 @@ const Element& LazyResource<Element>::operator[] (size_t ndx)
 {
 	const size_t pageNdx = getPageForElement(ndx);
 
-	if (ndx >= m_elements.size())
+	if (ndx >= m_numElements)
 		throw std::out_of_range("");
 
+	// Memory-resident resources are accessed directly without paging
+	if (const deUint8* const data = m_resource->getData())
+		return reinterpret_cast<const Element*>(data)[ndx];
+
 	if (!isPageResident(pageNdx))
 		makePageResident(pageNdx);
 
@@ -25,6 +25,7 @@
 #include "vkDefs.hpp"
 #include "vkRefUtil.hpp"
 #include "vkTypeUtil.hpp"
+#include "tcuTrace.hpp"
 
 namespace vk
 {
@@ -205,6 +206,8 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 							const bool				useDeviceGroups,
 							const deUint32			deviceMask)
 {
+	TCU_TRACE_SCOPE("vk::submitCommandsAndWait");
+
 	const Unique<VkFence>	fence					(createFence(vk, device));
 
 	VkDeviceGroupSubmitInfo	deviceGroupSubmitInfo	=
@@ -236,4 +239,49 @@ void submitCommandsAndWait (const DeviceInterface&	vk,
 	VK_CHECK(vk.waitForFences(device, 1u, &fence.get(), DE_TRUE, ~0ull));
 }
 
+// SubmitBatch
+
+void SubmitBatch::addWaitSemaphore (VkSemaphore semaphore, VkPipelineStageFlags dstStageMask)
+{
+	m_waitSemaphores.push_back(semaphore);
+	m_waitDstStageMasks.push_back(dstStageMask);
+}
+
+void SubmitBatch::clear (void)
+{
+	m_commandBuffers.clear();
+	m_waitSemaphores.clear();
+	m_waitDstStageMasks.clear();
+}
+
+void SubmitBatch::submit (const DeviceInterface& vk, const VkQueue queue, const VkFence fence)
+{
+	const VkSubmitInfo		submitInfo	=
+	{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,													// VkStructureType				sType;
+		DE_NULL,																		// const void*					pNext;
+		(deUint32)m_waitSemaphores.size(),												// deUint32						waitSemaphoreCount;
+		m_waitSemaphores.empty() ? DE_NULL : &m_waitSemaphores[0],						// const VkSemaphore*			pWaitSemaphores;
+		m_waitDstStageMasks.empty() ? DE_NULL : &m_waitDstStageMasks[0],				// const VkPipelineStageFlags*	pWaitDstStageMask;
+		(deUint32)m_commandBuffers.size(),												// deUint32						commandBufferCount;
+		m_commandBuffers.empty() ? DE_NULL : &m_commandBuffers[0],						// const VkCommandBuffer*		pCommandBuffers;
+		0u,																				// deUint32						signalSemaphoreCount;
+		DE_NULL,																		// const VkSemaphore*			pSignalSemaphores;
+	};
+
+	VK_CHECK(vk.queueSubmit(queue, 1u, &submitInfo, fence));
+
+	clear();
+}
+
+void SubmitBatch::submitAndWait (const DeviceInterface& vk, const VkDevice device, const VkQueue queue)
+{
+	TCU_TRACE_SCOPE("vk::SubmitBatch::submitAndWait");
+
+	const Unique<VkFence>	fence	(createFence(vk, device));
+
+	submit(vk, queue, *fence);
+	VK_CHECK(vk.waitForFences(device, 1u, &fence.get(), DE_TRUE, ~0ull));
+}
+
 } // vk
@@ -26,6 +26,8 @@
 #include "vkDefs.hpp"
 #include "tcuVector.hpp"
 
+#include <vector>
+
 namespace vk
 {
 
@@ -117,6 +119,42 @@ void submitCommandsAndWait	(const DeviceInterface&	vk,
 							 const bool				useDeviceGroups = false,
 							 const deUint32			deviceMask = 1u);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Collects command buffers for a single queue submission
+ *
+ * Command buffers added to the batch are submitted in order with one
+ * vkQueueSubmit and waited for with a single fence. Recording e.g. upload,
+ * draw and readback into separate command buffers and submitting them as
+ * one batch avoids a submit and CPU wait per step. Submission order keeps
+ * the usual pipeline barriers between steps valid across command buffer
+ * boundaries, so no semaphores are needed within the batch.
+ *
+ * submit() leaves waiting to the caller, e.g. when the fence also guards
+ * staging memory from a StagingRing.
+ *
+ * The batch doesn't own the command buffers or semaphores; they must stay
+ * alive until the submission has completed.
+ *//*--------------------------------------------------------------------*/
+class SubmitBatch
+{
+public:
+											SubmitBatch			(void) {}
+
+	void									addCommandBuffer	(VkCommandBuffer commandBuffer) { m_commandBuffers.push_back(commandBuffer); }
+	void									addWaitSemaphore	(VkSemaphore semaphore, VkPipelineStageFlags dstStageMask);
+
+	bool									isEmpty				(void) const { return m_commandBuffers.empty() && m_waitSemaphores.empty(); }
+	void									clear				(void);
+
+	void									submit				(const DeviceInterface& vk, const VkQueue queue, const VkFence fence);
+	void									submitAndWait		(const DeviceInterface& vk, const VkDevice device, const VkQueue queue);
+
+private:
+	std::vector<VkCommandBuffer>			m_commandBuffers;
+	std::vector<VkSemaphore>				m_waitSemaphores;
+	std::vector<VkPipelineStageFlags>		m_waitDstStageMasks;
+};
+
 } // vk
 
 #endif // _VKCMDUTIL_HPP
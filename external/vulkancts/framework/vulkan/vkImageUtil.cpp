@@ -3925,39 +3925,20 @@ void copyBufferToImage (const DeviceInterface&					vk,
 {
 	Move<VkCommandPool>		cmdPool		= createCommandPool(vk, device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, queueFamilyIndex);
 	Move<VkCommandBuffer>	cmdBuffer	= allocateCommandBuffer(vk, device, *cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
-	Move<VkFence>			fence		= createFence(vk, device);
+	SubmitBatch				batch;
 
-	const VkCommandBufferBeginInfo cmdBufferBeginInfo =
-	{
-		VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,	// VkStructureType					sType;
-		DE_NULL,										// const void*						pNext;
-		VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,	// VkCommandBufferUsageFlags		flags;
-		(const VkCommandBufferInheritanceInfo*)DE_NULL,
-	};
-
-	VK_CHECK(vk.beginCommandBuffer(*cmdBuffer, &cmdBufferBeginInfo));
+	beginCommandBuffer(vk, *cmdBuffer);
 	copyBufferToImage(vk, *cmdBuffer, buffer, bufferSize, copyRegions, imageAspectFlags, mipLevels, arrayLayers, destImage, destImageLayout, destImageDstStageFlags);
-	VK_CHECK(vk.endCommandBuffer(*cmdBuffer));
+	endCommandBuffer(vk, *cmdBuffer);
 
-	const VkPipelineStageFlags pipelineStageFlags = VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT;
+	if (waitSemaphore)
+		batch.addWaitSemaphore(*waitSemaphore, VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT);
 
-	const VkSubmitInfo submitInfo =
-	{
-		VK_STRUCTURE_TYPE_SUBMIT_INFO,	// VkStructureType				sType;
-		DE_NULL,						// const void*					pNext;
-		waitSemaphore ? 1u : 0u,		// deUint32						waitSemaphoreCount;
-		waitSemaphore,					// const VkSemaphore*			pWaitSemaphores;
-		&pipelineStageFlags,			// const VkPipelineStageFlags*	pWaitDstStageMask;
-		1u,								// deUint32						commandBufferCount;
-		&cmdBuffer.get(),				// const VkCommandBuffer*		pCommandBuffers;
-		0u,								// deUint32						signalSemaphoreCount;
-		DE_NULL							// const VkSemaphore*			pSignalSemaphores;
-	};
+	batch.addCommandBuffer(*cmdBuffer);
 
 	try
 	{
-		VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, *fence));
-		VK_CHECK(vk.waitForFences(device, 1, &fence.get(), true, ~(0ull) /* infinity */));
+		batch.submitAndWait(vk, device, queue);
 	}
 	catch (...)
 	{
@@ -3966,6 +3947,26 @@ void copyBufferToImage (const DeviceInterface&					vk,
 	}
 }
 
+void copyBufferToImage (const DeviceInterface&					vk,
+						StagingRing&							stagingRing,
+						const StagingRing::Region&				srcRegion,
+						const std::vector<VkBufferImageCopy>&	copyRegions,
+						VkImageAspectFlags						imageAspectFlags,
+						deUint32								mipLevels,
+						deUint32								arrayLayers,
+						VkImage									destImage,
+						VkImageLayout							destImageLayout,
+						VkPipelineStageFlags					destImageDstStageFlags)
+{
+	std::vector<VkBufferImageCopy> ringCopyRegions (copyRegions);
+
+	for (size_t ndx = 0; ndx < ringCopyRegions.size(); ++ndx)
+		ringCopyRegions[ndx].bufferOffset += srcRegion.offset;
+
+	// Buffer barrier covers whole buffer, other regions in it are only accessed by the transfers of the same batch.
+	copyBufferToImage(vk, stagingRing.getCommandBuffer(), srcRegion.buffer, VK_WHOLE_SIZE, ringCopyRegions, imageAspectFlags, mipLevels, arrayLayers, destImage, destImageLayout, destImageDstStageFlags);
+}
+
 void copyImageToBuffer (const DeviceInterface&	vk,
 						VkCommandBuffer			cmdBuffer,
 						VkImage					image,
@@ -3975,7 +3976,8 @@ void copyImageToBuffer (const DeviceInterface&	vk,
 						VkImageLayout			oldLayout,
 						deUint32				numLayers,
 						VkImageAspectFlags		barrierAspect,
-						VkImageAspectFlags		copyAspect)
+						VkImageAspectFlags		copyAspect,
+						VkDeviceSize			bufferOffset)
 {
 	const VkImageMemoryBarrier	imageBarrier	=
 	{
@@ -4004,7 +4006,7 @@ void copyImageToBuffer (const DeviceInterface&	vk,
 
 	const VkBufferImageCopy			region		=
 	{
-		0ull,										// VkDeviceSize					bufferOffset;
+		bufferOffset,								// VkDeviceSize					bufferOffset;
 		0u,											// deUint32						bufferRowLength;
 		0u,											// deUint32						bufferImageHeight;
 		subresource,								// VkImageSubresourceLayers		imageSubresource;
@@ -4023,7 +4025,7 @@ void copyImageToBuffer (const DeviceInterface&	vk,
 		VK_QUEUE_FAMILY_IGNORED,					// deUint32			srcQueueFamilyIndex;
 		VK_QUEUE_FAMILY_IGNORED,					// deUint32			dstQueueFamilyIndex;
 		buffer,										// VkBuffer			buffer;
-		0ull,										// VkDeviceSize		offset;
+		bufferOffset,								// VkDeviceSize		offset;
 		VK_WHOLE_SIZE								// VkDeviceSize		size;
 	};
 
@@ -27,6 +27,7 @@
 
 #include "vkDefs.hpp"
 #include "vkMemUtil.hpp"
+#include "vkStagingRing.hpp"
 #include "tcuTexture.hpp"
 #include "tcuCompressedTexture.hpp"
 #include "deSharedPtr.hpp"
@@ -227,6 +228,23 @@ void	copyBufferToImage						(const DeviceInterface&							vk,
 												 VkImageLayout									destImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
 												 VkPipelineStageFlags							destImageDstStageFlags = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
 
+/*--------------------------------------------------------------------*//*!
+ * Records a copy from a staging ring region into an image in the current
+ * batch of the ring. Buffer offsets in copyRegions are relative to the
+ * region. Image contents are defined once stagingRing.submitAndWait()
+ * returns.
+*//*--------------------------------------------------------------------*/
+void	copyBufferToImage						(const DeviceInterface&							vk,
+												 StagingRing&									stagingRing,
+												 const StagingRing::Region&						srcRegion,
+												 const std::vector<VkBufferImageCopy>&			copyRegions,
+												 VkImageAspectFlags								imageAspectFlags,
+												 deUint32										mipLevels,
+												 deUint32										arrayLayers,
+												 VkImage										destImage,
+												 VkImageLayout									destImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+												 VkPipelineStageFlags							destImageDstStageFlags = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+
 /*--------------------------------------------------------------------*//*!
  * Copies image data into a buffer. The buffer is expected to be
  * read by the host.
@@ -240,7 +258,8 @@ void	copyImageToBuffer						(const DeviceInterface&							vk,
 												 vk::VkImageLayout								oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
 												 deUint32										numLayers = 1u,
 												 VkImageAspectFlags								barrierAspect = VK_IMAGE_ASPECT_COLOR_BIT,
-												 VkImageAspectFlags								copyAspect = VK_IMAGE_ASPECT_COLOR_BIT);
+												 VkImageAspectFlags								copyAspect = VK_IMAGE_ASPECT_COLOR_BIT,
+												 VkDeviceSize									bufferOffset = 0ull);
 
 /*--------------------------------------------------------------------*//*!
  * Clear a color image
@@ -51,7 +51,8 @@ Move<VkPipeline> makeGraphicsPipeline(const DeviceInterface&						vk,
 									  const VkPipelineMultisampleStateCreateInfo*	multisampleStateCreateInfo,
 									  const VkPipelineDepthStencilStateCreateInfo*	depthStencilStateCreateInfo,
 									  const VkPipelineColorBlendStateCreateInfo*	colorBlendStateCreateInfo,
-									  const VkPipelineDynamicStateCreateInfo*		dynamicStateCreateInfo)
+									  const VkPipelineDynamicStateCreateInfo*		dynamicStateCreateInfo,
+									  const VkPipelineCache							pipelineCache)
 {
 	const VkBool32									disableRasterization				= (fragmentShaderModule == DE_NULL);
 	const bool										hasTessellation						= (tessellationControlShaderModule != DE_NULL || tessellationEvalShaderModule != DE_NULL);
@@ -282,7 +283,7 @@ Move<VkPipeline> makeGraphicsPipeline(const DeviceInterface&						vk,
 		0																										// deInt32                                          basePipelineIndex;
 	};
 
-	return createGraphicsPipeline(vk, device, DE_NULL, &pipelineCreateInfo);
+	return createGraphicsPipeline(vk, device, pipelineCache, &pipelineCreateInfo);
 }
 
 Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
@@ -303,7 +304,8 @@ Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
 									   const VkPipelineMultisampleStateCreateInfo*		multisampleStateCreateInfo,
 									   const VkPipelineDepthStencilStateCreateInfo*		depthStencilStateCreateInfo,
 									   const VkPipelineColorBlendStateCreateInfo*		colorBlendStateCreateInfo,
-									   const VkPipelineDynamicStateCreateInfo*			dynamicStateCreateInfo)
+									   const VkPipelineDynamicStateCreateInfo*			dynamicStateCreateInfo,
+									   const VkPipelineCache							pipelineCache)
 {
 	VkPipelineShaderStageCreateInfo					stageCreateInfo		=
 	{
@@ -375,7 +377,7 @@ Move<VkPipeline> makeGraphicsPipeline (const DeviceInterface&							vk,
 		0													// deInt32                                          basePipelineIndex;
 	};
 
-	return createGraphicsPipeline(vk, device, DE_NULL, &pipelineCreateInfo);
+	return createGraphicsPipeline(vk, device, pipelineCache, &pipelineCreateInfo);
 }
 
 Move<VkRenderPass> makeRenderPass (const DeviceInterface&				vk,
@@ -37,6 +37,7 @@
 #include "deInt32.h"
 
 #include "tcuCommandLine.hpp"
+#include "tcuTrace.hpp"
 
 #include <map>
 
@@ -421,6 +422,8 @@ void getBuildOptions (std::string& shaderstring, const ShaderBuildOptions& build
 
 ProgramBinary* buildProgram (const GlslSource& program, glu::ShaderProgramInfo* buildInfo, const tcu::CommandLine& commandLine)
 {
+	TCU_TRACE_SCOPE("vk::buildProgram");
+
 	const SpirvVersion	spirvVersion		= program.buildOptions.targetVersion;
 	const bool			validateBinary		= VALIDATE_BINARIES;
 	vector<deUint32>	binary;
@@ -506,6 +509,8 @@ ProgramBinary* buildProgram (const GlslSource& program, glu::ShaderProgramInfo*
 
 ProgramBinary* buildProgram (const HlslSource& program, glu::ShaderProgramInfo* buildInfo, const tcu::CommandLine& commandLine)
 {
+	TCU_TRACE_SCOPE("vk::buildProgram");
+
 	const SpirvVersion	spirvVersion		= program.buildOptions.targetVersion;
 	const bool			validateBinary		= VALIDATE_BINARIES;
 	vector<deUint32>	binary;
@@ -591,6 +596,8 @@ ProgramBinary* buildProgram (const HlslSource& program, glu::ShaderProgramInfo*
 
 ProgramBinary* assembleProgram (const SpirVAsmSource& program, SpirVProgramInfo* buildInfo, const tcu::CommandLine& commandLine)
 {
+	TCU_TRACE_SCOPE("vk::assembleProgram");
+
 	const SpirvVersion	spirvVersion		= program.buildOptions.targetVersion;
 	const bool			validateBinary		= VALIDATE_BINARIES;
 	vector<deUint32>	binary;
@@ -0,0 +1,230 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2020 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Persistent host-visible staging buffer ring
+ *//*--------------------------------------------------------------------*/
+
+#include "vkStagingRing.hpp"
+#include "vkRefUtil.hpp"
+#include "vkQueryUtil.hpp"
+#include "vkCmdUtil.hpp"
+
+namespace vk
+{
+
+namespace
+{
+
+VkBufferCreateInfo makeStagingBufferCreateInfo (VkDeviceSize size)
+{
+	const VkBufferCreateInfo bufferParams =
+	{
+		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,								// VkStructureType		sType;
+		DE_NULL,															// const void*			pNext;
+		0u,																	// VkBufferCreateFlags	flags;
+		size,																// VkDeviceSize			size;
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,	// VkBufferUsageFlags	usage;
+		VK_SHARING_MODE_EXCLUSIVE,											// VkSharingMode		sharingMode;
+		0u,																	// deUint32				queueFamilyIndexCount;
+		DE_NULL																// const deUint32*		pQueueFamilyIndices;
+	};
+
+	return bufferParams;
+}
+
+Move<VkBuffer> createStagingBuffer (const DeviceInterface& vk, VkDevice device, VkDeviceSize size)
+{
+	const VkBufferCreateInfo bufferParams = makeStagingBufferCreateInfo(size);
+
+	return createBuffer(vk, device, &bufferParams);
+}
+
+de::MovePtr<Allocation> allocateAndBind (const DeviceInterface& vk, VkDevice device, Allocator& allocator, VkBuffer buffer)
+{
+	de::MovePtr<Allocation> allocation = allocator.allocate(getBufferMemoryRequirements(vk, device, buffer), MemoryRequirement::HostVisible);
+
+	VK_CHECK(vk.bindBufferMemory(device, buffer, allocation->getMemory(), allocation->getOffset()));
+
+	return allocation;
+}
+
+inline bool rangesOverlap (VkDeviceSize aBegin, VkDeviceSize aEnd, VkDeviceSize bBegin, VkDeviceSize bEnd)
+{
+	return aBegin < bEnd && bBegin < aEnd;
+}
+
+} // anonymous
+
+StagingRing::StagingRing (const DeviceInterface&	vk,
+						  VkDevice					device,
+						  VkQueue					queue,
+						  deUint32					queueFamilyIndex,
+						  Allocator&				allocator,
+						  VkDeviceSize				size)
+	: m_vk			(vk)
+	, m_device		(device)
+	, m_queue		(queue)
+	, m_allocator	(allocator)
+	, m_size		(size)
+	, m_buffer		(createStagingBuffer(vk, device, size))
+	, m_allocation	(allocateAndBind(vk, device, allocator, *m_buffer))
+	, m_cmdPool		(createCommandPool(vk, device, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, queueFamilyIndex))
+	, m_cmdBuffer	(allocateCommandBuffer(vk, device, *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))
+	, m_fence		(createFence(vk, device))
+	, m_recording	(false)
+	, m_head		(0u)
+{
+}
+
+StagingRing::~StagingRing (void)
+{
+}
+
+bool StagingRing::isRangeFree (const Range& range) const
+{
+	const Batch* const batches[] = { &m_current, &m_completed };
+
+	for (int batchNdx = 0; batchNdx < DE_LENGTH_OF_ARRAY(batches); ++batchNdx)
+	{
+		for (size_t ndx = 0; ndx < batches[batchNdx]->ranges.size(); ++ndx)
+		{
+			if (rangesOverlap(range.begin, range.end, batches[batchNdx]->ranges[ndx].begin, batches[batchNdx]->ranges[ndx].end))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+StagingRing::Region StagingRing::allocateDedicated (VkDeviceSize size)
+{
+	const BufferSp	buffer	(new BufferWithMemory(m_vk, m_device, m_allocator, makeStagingBufferCreateInfo(size), MemoryRequirement::HostVisible));
+	const Region	region	=
+	{
+		**buffer,
+		0u,
+		size,
+		buffer->getAllocation().getHostPtr()
+	};
+
+	m_current.dedicatedBuffers.push_back(buffer);
+
+	return region;
+}
+
+StagingRing::Region StagingRing::allocate (VkDeviceSize size, VkDeviceSize alignment)
+{
+	DE_ASSERT(size > 0 && alignment > 0);
+
+	if (size <= m_size)
+	{
+		// Candidate at current head, wrapping to start of ring if it doesn't fit before the end
+		VkDeviceSize	begin	= ((m_head + alignment - 1u) / alignment) * alignment;
+
+		if (begin + size > m_size)
+			begin = 0u;
+
+		{
+			const Range candidate (begin, begin + size);
+
+			if (isRangeFree(candidate))
+			{
+				const Region region =
+				{
+					*m_buffer,
+					candidate.begin,
+					size,
+					(deUint8*)m_allocation->getHostPtr() + candidate.begin
+				};
+
+				m_current.ranges.push_back(candidate);
+				m_head = candidate.end;
+
+				return region;
+			}
+		}
+	}
+
+	// Too large for the ring, or ring is in use by this and the previous batch
+	return allocateDedicated(size);
+}
+
+VkCommandBuffer StagingRing::getCommandBuffer (void)
+{
+	if (!m_recording)
+	{
+		beginCommandBuffer(m_vk, *m_cmdBuffer);
+		m_recording = true;
+	}
+
+	return *m_cmdBuffer;
+}
+
+void StagingRing::submitAndWait (void)
+{
+	if (m_recording)
+	{
+		SubmitBatch batch;
+
+		endCommandBuffer(m_vk, *m_cmdBuffer);
+		m_recording = false;
+
+		flushAlloc(m_vk, m_device, *m_allocation);
+
+		for (size_t ndx = 0; ndx < m_current.dedicatedBuffers.size(); ++ndx)
+			flushAlloc(m_vk, m_device, m_current.dedicatedBuffers[ndx]->getAllocation());
+
+		batch.addCommandBuffer(*m_cmdBuffer);
+		batch.submit(m_vk, m_queue, *m_fence);
+
+		VK_CHECK(m_vk.waitForFences(m_device, 1u, &m_fence.get(), VK_TRUE, ~0ull));
+		VK_CHECK(m_vk.resetFences(m_device, 1u, &m_fence.get()));
+		VK_CHECK(m_vk.resetCommandBuffer(*m_cmdBuffer, 0u));
+
+		invalidateAlloc(m_vk, m_device, *m_allocation);
+
+		for (size_t ndx = 0; ndx < m_current.dedicatedBuffers.size(); ++ndx)
+			invalidateAlloc(m_vk, m_device, m_current.dedicatedBuffers[ndx]->getAllocation());
+	}
+
+	// Regions of the previous batch are released, this batch stays readable until the next submit
+	m_completed.ranges.swap(m_current.ranges);
+	m_completed.dedicatedBuffers.swap(m_current.dedicatedBuffers);
+	m_current.ranges.clear();
+	m_current.dedicatedBuffers.clear();
+}
+
+void StagingRing::reset (void)
+{
+	if (m_recording)
+	{
+		// Commands may refer to resources that no longer exist, never submit them
+		VK_CHECK(m_vk.resetCommandBuffer(*m_cmdBuffer, 0u));
+		m_recording = false;
+	}
+
+	m_head = 0u;
+	m_current.ranges.clear();
+	m_current.dedicatedBuffers.clear();
+	m_completed.ranges.clear();
+	m_completed.dedicatedBuffers.clear();
+}
+
+} // vk
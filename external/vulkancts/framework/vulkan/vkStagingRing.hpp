@@ -0,0 +1,139 @@
+#ifndef _VKSTAGINGRING_HPP
+#define _VKSTAGINGRING_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2020 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Persistent host-visible staging buffer ring
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkMemUtil.hpp"
+#include "vkRef.hpp"
+#include "vkBufferWithMemory.hpp"
+#include "deSharedPtr.hpp"
+#include "deUniquePtr.hpp"
+
+#include <vector>
+
+namespace vk
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Ring of persistently mapped staging memory for transfers
+ *
+ * Upload and readback helpers sub-allocate their staging space from one
+ * host-visible buffer and record their copies into a command buffer owned
+ * by the ring, instead of creating a buffer, memory and command buffer for
+ * every transfer.
+ *
+ * Transfers are batched until submitAndWait(), which flushes the staging
+ * memory, submits the recorded commands, waits for them and invalidates
+ * the staging memory, so one flush and one invalidate cover any number of
+ * copies.
+ *
+ * Data for uploads must be written to a region before the batch it was
+ * allocated in is submitted. Readback data is available in a region after
+ * submitAndWait() and stays valid until the next submitAndWait(). Regions
+ * that don't fit in the ring get a dedicated buffer with the same
+ * lifetime.
+ *
+ * \note All work using the ring must have completed before it is destroyed.
+ *//*--------------------------------------------------------------------*/
+class StagingRing
+{
+public:
+	struct Region
+	{
+		VkBuffer		buffer;
+		VkDeviceSize	offset;
+		VkDeviceSize	size;
+		void*			hostPtr;
+	};
+
+	enum
+	{
+		DEFAULT_SIZE	= 4 * 1024 * 1024
+	};
+
+											StagingRing			(const DeviceInterface&	vk,
+																 VkDevice				device,
+																 VkQueue				queue,
+																 deUint32				queueFamilyIndex,
+																 Allocator&				allocator,
+																 VkDeviceSize			size = (VkDeviceSize)DEFAULT_SIZE);
+											~StagingRing		(void);
+
+	VkDeviceSize							getSize				(void) const { return m_size; }
+
+	//! Allocate staging space for a transfer in the current batch.
+	Region									allocate			(VkDeviceSize size, VkDeviceSize alignment);
+
+	//! Command buffer of the current batch, recording begins on first use.
+	VkCommandBuffer							getCommandBuffer	(void);
+
+	//! Submit current batch and wait for it to complete.
+	void									submitAndWait		(void);
+
+	//! Drop an unsubmitted batch and release all regions, including dedicated buffers.
+	void									reset				(void);
+
+private:
+											StagingRing			(const StagingRing&);
+	StagingRing&							operator=			(const StagingRing&);
+
+	typedef de::SharedPtr<BufferWithMemory> BufferSp;
+
+	struct Range
+	{
+		VkDeviceSize	begin;
+		VkDeviceSize	end;
+
+		Range (VkDeviceSize begin_, VkDeviceSize end_) : begin(begin_), end(end_) {}
+	};
+
+	struct Batch
+	{
+		std::vector<Range>		ranges;
+		std::vector<BufferSp>	dedicatedBuffers;
+	};
+
+	bool									isRangeFree			(const Range& range) const;
+	Region									allocateDedicated	(VkDeviceSize size);
+
+	const DeviceInterface&					m_vk;
+	const VkDevice							m_device;
+	const VkQueue							m_queue;
+	Allocator&								m_allocator;
+	const VkDeviceSize						m_size;
+	const Unique<VkBuffer>					m_buffer;
+	const de::UniquePtr<Allocation>			m_allocation;
+	const Unique<VkCommandPool>				m_cmdPool;
+	const Unique<VkCommandBuffer>			m_cmdBuffer;
+	const Unique<VkFence>					m_fence;
+
+	bool									m_recording;
+	VkDeviceSize							m_head;
+	Batch									m_current;		//!< Allocated for the batch being recorded
+	Batch									m_completed;	//!< Readback data of the last submitted batch
+};
+
+} // vk
+
+#endif // _VKSTAGINGRING_HPP
@@ -223,18 +223,27 @@ amber::Result Delegate::LoadBufferData (const std::string			file_name,
 	const de::FilePath				filePath	= de::FilePath(m_path).join(file_name);
 	de::UniquePtr<tcu::Resource>	file		(archive.getResource(filePath.getPath()));
 	int								numBytes	= file->getSize();
-	std::vector<deUint8>			bytes		(numBytes);
+	std::vector<deUint8>			bytes;
+	const deUint8*					data		= file->getData();
 
 	if (file_type == amber::BufferDataFileType::kPng)
 		return amber::Result("Amber PNG loading unimplemented");
 
-	file->read(bytes.data(), numBytes);
-
-	if (bytes.empty())
+	if (numBytes <= 0)
 		return amber::Result("Failed to load buffer data " + file_name);
 
-	for (deUint8 byte : bytes)
+	if (!data)
+	{
+		bytes.resize(numBytes);
+		file->read(bytes.data(), numBytes);
+		data = bytes.data();
+	}
+
+	buffer->values.reserve(buffer->values.size() + (size_t)numBytes);
+
+	for (int ndx = 0; ndx < numBytes; ++ndx)
 	{
+		const deUint8 byte = data[ndx];
 		amber::Value value;
 		value.SetIntValue(static_cast<deUint64>(byte));
 		buffer->values.push_back(value);
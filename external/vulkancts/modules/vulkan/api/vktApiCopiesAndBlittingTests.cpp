@@ -2885,6 +2885,28 @@ tcu::Vec4 getFloatOrFixedPointFormatThreshold (const tcu::TextureFormat& format)
 	}
 }
 
+//! Texel a clamp-to-edge nearest lookup takes at a normalized coordinate, before any error bounds are applied.
+tcu::IVec3 getNearestTexelCoord (const tcu::ConstPixelBufferAccess& source, const tcu::Vec3& normCoord)
+{
+	return tcu::IVec3(de::clamp(deFloorFloatToInt32(normCoord.x() * (float)source.getWidth()),	0, source.getWidth() - 1),
+					  de::clamp(deFloorFloatToInt32(normCoord.y() * (float)source.getHeight()),	0, source.getHeight() - 1),
+					  de::clamp(deFloorFloatToInt32(normCoord.z() * (float)source.getDepth()),	0, source.getDepth() - 1));
+}
+
+tcu::Vec4 getNearestTexel (const tcu::ConstPixelBufferAccess& source, const tcu::Vec3& normCoord)
+{
+	const tcu::IVec3 coord = getNearestTexelCoord(source, normCoord);
+
+	return source.getPixel(coord.x(), coord.y(), coord.z());
+}
+
+tcu::IVec4 getNearestTexelInt (const tcu::ConstPixelBufferAccess& source, const tcu::Vec3& normCoord)
+{
+	const tcu::IVec3 coord = getNearestTexelCoord(source, normCoord);
+
+	return source.getPixelInt(coord.x(), coord.y(), coord.z());
+}
+
 bool floatNearestBlitCompare (const tcu::ConstPixelBufferAccess&	source,
 							  const tcu::ConstPixelBufferAccess&	result,
 							  const tcu::PixelBufferAccess&			errorMask,
@@ -2928,6 +2950,15 @@ bool floatNearestBlitCompare (const tcu::ConstPixelBufferAccess&	source,
 			if (c.isSRGB)
 				dstColor = tcu::sRGBToLinear(dstColor);
 
+			// The texel at the exact coordinate is always one of the candidates the verifier tries
+			{
+				const tcu::Vec4 srcColor = getNearestTexel(c.source, srcNormCoord);
+				const tcu::Vec4 refColor = tcu::isSRGB(c.source.getFormat()) ? tcu::sRGBToLinear(srcColor) : srcColor;
+
+				if (tcu::boolAll(tcu::logicalOr(tcu::lessThanEqual(tcu::abs(refColor - dstColor), c.precision.colorThreshold), tcu::logicalNot(c.precision.colorMask))))
+					return true;
+			}
+
 			return tcu::isLevel3DLookupResultValid(c.source, c.sampler, lookupScaleDontCare, c.precision, srcNormCoord, dstColor);
 		}
 	} loop;
@@ -2984,6 +3015,14 @@ bool intNearestBlitCompare (const tcu::ConstPixelBufferAccess&	source,
 			const tcu::TexLookupScaleMode	lookupScaleDontCare	= tcu::TEX_LOOKUP_SCALE_MINIFY;
 			const tcu::IVec4				dstColor			= c.result.getPixelInt(x, y, z);
 
+			// The texel at the exact coordinate is always one of the candidates the verifier tries
+			{
+				const tcu::IVec4 refColor = getNearestTexelInt(c.source, srcNormCoord);
+
+				if (tcu::boolAll(tcu::logicalOr(tcu::lessThanEqual(tcu::absDiff(refColor, dstColor).asUint(), c.precision.colorThreshold), tcu::logicalNot(c.precision.colorMask))))
+					return true;
+			}
+
 			return tcu::isLevel3DLookupResultValid(c.source, c.sampler, lookupScaleDontCare, c.precision, srcNormCoord, dstColor);
 		}
 	} loop;
@@ -3151,10 +3190,98 @@ void scaleFromWholeSrcBuffer (const tcu::PixelBufferAccess& dst, const tcu::Cons
 	}
 }
 
+// Formats for which converting a texel to Vec4 and back reproduces the original bits.
+bool isTexelRoundTripExact (const tcu::TextureFormat& format)
+{
+	if (tcu::isSRGB(format) || tcu::isCombinedDepthStencilType(format.type))
+		return false;
+
+	switch (format.type)
+	{
+		case tcu::TextureFormat::UNORM_INT8:
+		case tcu::TextureFormat::UNORM_INT16:
+		case tcu::TextureFormat::UNSIGNED_INT8:
+		case tcu::TextureFormat::UNSIGNED_INT16:
+		case tcu::TextureFormat::SIGNED_INT8:
+		case tcu::TextureFormat::SIGNED_INT16:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+//! Nearest-filtered blit() without per-texel sampler dispatch.
+void blitNearest (const tcu::PixelBufferAccess& dst, const tcu::ConstPixelBufferAccess& src, const MirrorMode mirrorMode)
+{
+	const tcu::Sampler	sampler		(tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE,
+									 tcu::Sampler::NEAREST, tcu::Sampler::NEAREST, 0.0f, false);
+
+	const float			sX			= (float)src.getWidth() / (float)dst.getWidth();
+	const float			sY			= (float)src.getHeight() / (float)dst.getHeight();
+	const float			sZ			= (float)src.getDepth() / (float)dst.getDepth();
+
+	const int			xOffset		= (mirrorMode & MIRROR_MODE_X) ? dst.getWidth() - 1 : 0;
+	const int			yOffset		= (mirrorMode & MIRROR_MODE_Y) ? dst.getHeight() - 1 : 0;
+	const int			zOffset		= (mirrorMode & MIRROR_MODE_Z) ? dst.getDepth() - 1 : 0;
+
+	const int			xScale		= (mirrorMode & MIRROR_MODE_X) ? -1 : 1;
+	const int			yScale		= (mirrorMode & MIRROR_MODE_Y) ? -1 : 1;
+	const int			zScale		= (mirrorMode & MIRROR_MODE_Z) ? -1 : 1;
+
+	const int			pixelSize	= dst.getFormat().getPixelSize();
+	const bool			copyTexels	= src.getFormat() == dst.getFormat() && isTexelRoundTripExact(dst.getFormat());
+	const bool			reuseTexels	= !tcu::isCombinedDepthStencilType(dst.getFormat().type) && dst.getPixelPitch() == pixelSize;
+
+	// Source texel selected by the sampler along each axis: floor of the unnormalized coordinate, clamped to edge
+	std::vector<int>	srcX		(dst.getWidth());
+	std::vector<int>	srcY		(dst.getHeight());
+	std::vector<int>	srcZ		(dst.getDepth());
+
+	for (int x = 0; x < dst.getWidth(); ++x)
+		srcX[x] = de::clamp(deFloorFloatToInt32(((float)x + 0.5f) * sX), 0, src.getWidth() - 1);
+	for (int y = 0; y < dst.getHeight(); ++y)
+		srcY[y] = de::clamp(deFloorFloatToInt32(((float)y + 0.5f) * sY), 0, src.getHeight() - 1);
+	for (int z = 0; z < dst.getDepth(); ++z)
+		srcZ[z] = de::clamp(deFloorFloatToInt32(((float)z + 0.5f) * sZ), 0, src.getDepth() - 1);
+
+	for (int z = 0; z < dst.getDepth(); ++z)
+	for (int y = 0; y < dst.getHeight(); ++y)
+	{
+		const int dstY = y * yScale + yOffset;
+		const int dstZ = z * zScale + zOffset;
+
+		// Rows sampling the same source row are identical, copy the previous one
+		if (reuseTexels && y > 0 && srcY[y] == srcY[y - 1])
+		{
+			deMemcpy(dst.getPixelPtr(0, dstY, dstZ), dst.getPixelPtr(0, dstY - yScale, dstZ), (size_t)(pixelSize * dst.getWidth()));
+			continue;
+		}
+
+		for (int x = 0; x < dst.getWidth(); ++x)
+		{
+			const int dstX = x * xScale + xOffset;
+
+			if (copyTexels)
+				deMemcpy(dst.getPixelPtr(dstX, dstY, dstZ), src.getPixelPtr(srcX[x], srcY[y], srcZ[z]), (size_t)pixelSize);
+			else if (reuseTexels && x > 0 && srcX[x] == srcX[x - 1])
+				deMemcpy(dst.getPixelPtr(dstX, dstY, dstZ), dst.getPixelPtr(dstX - xScale, dstY, dstZ), (size_t)pixelSize);
+			else
+				dst.setPixel(linearToSRGBIfNeeded(dst.getFormat(), src.sample3D(sampler, tcu::Sampler::NEAREST, (float)srcX[x] + 0.5f, (float)srcY[y] + 0.5f, (float)srcZ[z] + 0.5f)), dstX, dstY, dstZ);
+		}
+	}
+}
+
 void blit (const tcu::PixelBufferAccess& dst, const tcu::ConstPixelBufferAccess& src, const tcu::Sampler::FilterMode filter, const MirrorMode mirrorMode)
 {
 	DE_ASSERT(filter == tcu::Sampler::NEAREST || filter == tcu::Sampler::LINEAR || filter == tcu::Sampler::CUBIC);
 
+	if (filter == tcu::Sampler::NEAREST)
+	{
+		blitNearest(dst, src, mirrorMode);
+		return;
+	}
+
 	tcu::Sampler sampler(tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE,
 			filter, filter, 0.0f, false);
 
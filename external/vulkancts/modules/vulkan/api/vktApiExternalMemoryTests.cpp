@@ -166,10 +166,8 @@ std::vector<deUint8> genTestData (deUint32 seed, size_t size)
 	de::Random				rng		(seed);
 	std::vector<deUint8>	data	(size);
 
-	for (size_t ndx = 0; ndx < size; ndx++)
-	{
-		data[ndx] = rng.getUint8();
-	}
+	if (size > 0)
+		rng.fillBytes(&data[0], size);
 
 	return data;
 }
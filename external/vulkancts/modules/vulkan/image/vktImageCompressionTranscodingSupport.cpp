@@ -428,8 +428,7 @@ void BasicTranscodingTestInstance::generateData (deUint8*		toFill,
 		deUint32	seed		= (layer << 24) ^ (level << 16) ^ static_cast<deUint32>(format);
 		Random		rnd			(seed);
 
-		for (size_t i = 0; i < sizeToRnd32; i++)
-			start32[i] = rnd.getUint32();
+		rnd.fillUint32(start32, sizeToRnd32);
 	}
 
 	{
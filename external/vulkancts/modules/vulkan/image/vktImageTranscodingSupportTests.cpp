@@ -204,8 +204,7 @@ void BasicTranscodingTestInstance::generateData (deUint8* toFill, size_t size, c
 		size_t		sizeToRnd32	= sizeToRnd / sizeof(deUint32);
 		Random		rnd			(static_cast<deUint32>(format));
 
-		for (size_t i = 0; i < sizeToRnd32; i++)
-			start32[i] = rnd.getUint32();
+		rnd.fillUint32(start32, sizeToRnd32);
 	}
 
 	{
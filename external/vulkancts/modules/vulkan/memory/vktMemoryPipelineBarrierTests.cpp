@@ -663,60 +663,177 @@ void* mapMemory (const vk::DeviceInterface&	vkd,
 	return ptr;
 }
 
+// Byte level reference model of the memory contents.
+//
+// Definedness is tracked in a bitset that is updated and scanned a word at a
+// time, so defined and undefined regions can be walked as runs instead of
+// byte by byte.
 class ReferenceMemory
 {
 public:
-			ReferenceMemory	(size_t size);
+			ReferenceMemory		(size_t size);
 
-	void	set				(size_t pos, deUint8 val);
-	deUint8	get				(size_t pos) const;
-	bool	isDefined		(size_t pos) const;
+	deUint8	get					(size_t pos) const;
+	bool	isDefined			(size_t pos) const;
 
-	void	setDefined		(size_t offset, size_t size, const void* data);
-	void	setUndefined	(size_t offset, size_t size);
-	void	setData			(size_t offset, size_t size, const void* data);
+	void	setUndefined		(size_t offset, size_t size);
+	void	setData				(size_t offset, size_t size, const void* data);
+	void	xorData				(size_t offset, size_t size, const void* mask);
 
-	size_t	getSize			(void) const { return m_data.size(); }
+	// Returns end of the run of defined (or undefined) bytes starting at offset, at most end.
+	size_t	getDefinedRangeEnd	(size_t offset, size_t end) const;
+	size_t	getUndefinedRangeEnd(size_t offset, size_t end) const;
+
+	// Compare data to defined bytes in [offset, offset + size). Returns false and the first mismatching position on mismatch.
+	bool	compare				(size_t offset, size_t size, const void* data, size_t& mismatchPos) const;
+
+	size_t	getSize				(void) const { return m_data.size(); }
 
 private:
+	void	setDefinedBits		(size_t offset, size_t size, bool defined);
+	size_t	findRangeEnd		(size_t offset, size_t end, bool defined) const;
+
 	vector<deUint8>		m_data;
 	vector<deUint64>	m_defined;
 };
 
+int findFirstSetBit64 (deUint64 a)
+{
+	DE_ASSERT(a != 0);
+
+	if ((deUint32)a != 0)
+		return deCtz32((deUint32)a);
+	else
+		return 32 + deCtz32((deUint32)(a >> 32));
+}
+
 ReferenceMemory::ReferenceMemory (size_t size)
 	: m_data	(size, 0)
 	, m_defined	(size / 64 + (size % 64 == 0 ? 0 : 1), 0ull)
 {
 }
 
-void ReferenceMemory::set (size_t pos, deUint8 val)
+void ReferenceMemory::setDefinedBits (size_t offset, size_t size, bool defined)
 {
-	DE_ASSERT(pos < m_data.size());
+	size_t pos = offset;
+	size_t end = offset + size;
+
+	// Leading partial word
+	if (pos % 64 != 0 && pos < end)
+	{
+		const size_t	bitCount	= de::min<size_t>(64 - pos % 64, end - pos);
+		const deUint64	mask		= (bitCount == 64 ? ~0ull : ((0x1ull << bitCount) - 1)) << (pos % 64);
 
-	m_data[pos] = val;
-	m_defined[pos / 64] |= 0x1ull << (pos % 64);
+		if (defined)
+			m_defined[pos / 64] |= mask;
+		else
+			m_defined[pos / 64] &= ~mask;
+
+		pos += bitCount;
+	}
+
+	// Full words
+	if (end - pos >= 64)
+	{
+		const size_t wordCount = (end - pos) / 64;
+
+		std::fill(m_defined.begin() + pos / 64, m_defined.begin() + pos / 64 + wordCount, defined ? ~0ull : 0ull);
+		pos += wordCount * 64;
+	}
+
+	// Trailing partial word
+	if (pos < end)
+	{
+		const deUint64 mask = (0x1ull << (end - pos)) - 1;
+
+		if (defined)
+			m_defined[pos / 64] |= mask;
+		else
+			m_defined[pos / 64] &= ~mask;
+	}
 }
 
-void ReferenceMemory::setData (size_t offset, size_t size, const void* data_)
+void ReferenceMemory::setData (size_t offset, size_t size, const void* data)
 {
-	const deUint8* data = (const deUint8*)data_;
-
 	DE_ASSERT(offset < m_data.size());
 	DE_ASSERT(offset + size <= m_data.size());
 
-	// \todo [2016-03-09 mika] Optimize
-	for (size_t pos = 0; pos < size; pos++)
+	deMemcpy(&m_data[offset], data, size);
+	setDefinedBits(offset, size, true);
+}
+
+void ReferenceMemory::xorData (size_t offset, size_t size, const void* mask_)
+{
+	const deUint8* const mask = (const deUint8*)mask_;
+
+	DE_ASSERT(offset + size <= m_data.size());
+
+	for (size_t pos = offset; pos < offset + size; pos++)
+		m_data[pos] ^= mask[pos - offset];
+}
+
+void ReferenceMemory::setUndefined (size_t offset, size_t size)
+{
+	DE_ASSERT(offset + size <= m_data.size());
+
+	setDefinedBits(offset, size, false);
+}
+
+size_t ReferenceMemory::findRangeEnd (size_t offset, size_t end, bool defined) const
+{
+	size_t pos = offset;
+
+	DE_ASSERT(end <= m_data.size());
+
+	while (pos < end)
 	{
-		m_data[offset + pos] = data[pos];
-		m_defined[(offset + pos) / 64] |= 0x1ull << ((offset + pos) % 64);
+		// Bits that end the run, starting from pos
+		const deUint64 stopBits = (defined ? ~m_defined[pos / 64] : m_defined[pos / 64]) >> (pos % 64);
+
+		if (stopBits != 0)
+			return de::min(end, pos + (size_t)findFirstSetBit64(stopBits));
+
+		pos += 64 - pos % 64;
 	}
+
+	return end;
 }
 
-void ReferenceMemory::setUndefined	(size_t offset, size_t size)
+size_t ReferenceMemory::getDefinedRangeEnd (size_t offset, size_t end) const
 {
-	// \todo [2016-03-09 mika] Optimize
-	for (size_t pos = 0; pos < size; pos++)
-		m_defined[(offset + pos) / 64] |= 0x1ull << ((offset + pos) % 64);
+	return findRangeEnd(offset, end, true);
+}
+
+size_t ReferenceMemory::getUndefinedRangeEnd (size_t offset, size_t end) const
+{
+	return findRangeEnd(offset, end, false);
+}
+
+bool ReferenceMemory::compare (size_t offset, size_t size, const void* data_, size_t& mismatchPos) const
+{
+	const deUint8* const	data	= (const deUint8*)data_;
+	const size_t			end		= offset + size;
+	size_t					pos		= offset;
+
+	DE_ASSERT(end <= m_data.size());
+
+	while (pos < end)
+	{
+		const size_t definedEnd = getDefinedRangeEnd(pos, end);
+
+		if (definedEnd > pos && deMemCmp(&m_data[pos], data + (pos - offset), definedEnd - pos) != 0)
+		{
+			while (m_data[pos] == data[pos - offset])
+				pos++;
+
+			mismatchPos = pos;
+			return false;
+		}
+
+		pos = getUndefinedRangeEnd(definedEnd, end);
+	}
+
+	return true;
 }
 
 deUint8 ReferenceMemory::get (size_t pos) const
@@ -1388,10 +1505,8 @@ void HostMemoryAccess::execute (ExecuteContext& context)
 	{
 		de::Random		rng	(m_seed);
 		deUint8* const	ptr	= (deUint8*)context.getMapping();
-		for (size_t pos = 0; pos < m_size; ++pos)
-		{
-			ptr[pos] = rng.getUint8();
-		}
+
+		rng.fillBytes(ptr, (size_t)m_size);
 	}
 	else
 		DE_FATAL("Host memory access without read or write.");
@@ -1403,63 +1518,34 @@ void HostMemoryAccess::verify (VerifyContext& context, size_t commandIndex)
 	ReferenceMemory&		reference		= context.getReference();
 	de::Random				rng				(m_seed);
 
-	if (m_read && m_write)
+	if (m_read)
 	{
-		for (size_t pos = 0; pos < m_size; pos++)
-		{
-			const deUint8	mask	= rng.getUint8();
-			const deUint8	value	= m_readData[pos];
+		size_t mismatchPos = 0;
 
-			if (reference.isDefined(pos))
-			{
-				if (value != reference.get(pos))
-				{
-					resultCollector.fail(
-							de::toString(commandIndex) + ":" + getName()
-							+ " Result differs from reference, Expected: "
-							+ de::toString(tcu::toHex<8>(reference.get(pos)))
-							+ ", Got: "
-							+ de::toString(tcu::toHex<8>(value))
-							+ ", At offset: "
-							+ de::toString(pos));
-					break;
-				}
-
-				reference.set(pos, reference.get(pos) ^ mask);
-			}
-		}
-	}
-	else if (m_read)
-	{
-		for (size_t pos = 0; pos < m_size; pos++)
+		if (!reference.compare(0, m_size, &m_readData[0], mismatchPos))
 		{
-			const deUint8	value	= m_readData[pos];
-
-			if (reference.isDefined(pos))
-			{
-				if (value != reference.get(pos))
-				{
-					resultCollector.fail(
-							de::toString(commandIndex) + ":" + getName()
-							+ " Result differs from reference, Expected: "
-							+ de::toString(tcu::toHex<8>(reference.get(pos)))
-							+ ", Got: "
-							+ de::toString(tcu::toHex<8>(value))
-							+ ", At offset: "
-							+ de::toString(pos));
-					break;
-				}
-			}
+			resultCollector.fail(
+					de::toString(commandIndex) + ":" + getName()
+					+ " Result differs from reference, Expected: "
+					+ de::toString(tcu::toHex<8>(reference.get(mismatchPos)))
+					+ ", Got: "
+					+ de::toString(tcu::toHex<8>(m_readData[mismatchPos]))
+					+ ", At offset: "
+					+ de::toString(mismatchPos));
 		}
 	}
-	else if (m_write)
+
+	if (m_read || m_write)
 	{
-		for (size_t pos = 0; pos < m_size; pos++)
-		{
-			const deUint8	value	= rng.getUint8();
+		vector<deUint8> data (m_size);
 
-			reference.set(pos, value);
-		}
+		rng.fillBytes(&data[0], data.size());
+
+		// Read-write access xors defined bytes with the random mask, write-only access replaces all bytes
+		if (m_read && m_write)
+			reference.xorData(0, m_size, &data[0]);
+		else if (m_write)
+			reference.setData(0, m_size, &data[0]);
 	}
 	else
 		DE_FATAL("Host memory access without read or write.");
@@ -2178,15 +2264,14 @@ void FillBuffer::submit (SubmitContext& context)
 void FillBuffer::verify (VerifyContext& context, size_t)
 {
 	ReferenceMemory&	reference	= context.getReference();
+	vector<deUint8>		data		((size_t)m_bufferSize);
 
-	for (size_t ndx = 0; ndx < m_bufferSize; ndx++)
-	{
-#if (DE_ENDIANNESS == DE_LITTLE_ENDIAN)
-		reference.set(ndx, (deUint8)(0xffu & (m_value >> (8*(ndx % 4)))));
-#else
-		reference.set(ndx, (deUint8)(0xffu & (m_value >> (8*(3 - (ndx % 4))))));
-#endif
-	}
+	// \note Fill value is a host order 32-bit word, size is a multiple of 4
+	for (size_t ndx = 0; ndx < data.size(); ndx += 4)
+		deMemcpy(&data[ndx], &m_value, sizeof(deUint32));
+
+	if (!data.empty())
+		reference.setData(0, data.size(), &data[0]);
 }
 
 class UpdateBuffer : public CmdCommand
@@ -2223,8 +2308,7 @@ void UpdateBuffer::submit (SubmitContext& context)
 
 	for (size_t updated = 0; updated < m_bufferSize; updated += blockSize)
 	{
-		for (size_t ndx = 0; ndx < data.size(); ndx++)
-			data[ndx] = rng.getUint8();
+		rng.fillBytes(&data[0], data.size());
 
 		if (m_bufferSize - updated > blockSize)
 			vkd.cmdUpdateBuffer(cmd, buffer, updated, blockSize, (const deUint32*)(&data[0]));
@@ -2242,8 +2326,7 @@ void UpdateBuffer::verify (VerifyContext& context, size_t)
 
 	for (size_t updated = 0; updated < m_bufferSize; updated += blockSize)
 	{
-		for (size_t ndx = 0; ndx < data.size(); ndx++)
-			data[ndx] = rng.getUint8();
+		rng.fillBytes(&data[0], data.size());
 
 		if (m_bufferSize - updated > blockSize)
 			reference.setData(updated, blockSize, &data[0]);
@@ -2346,23 +2429,18 @@ void BufferCopyToBuffer::verify (VerifyContext& context, size_t commandIndex)
 		{
 			const deUint8* const data = (const deUint8*)ptr;
 
-			for (size_t pos = 0; pos < (size_t)m_bufferSize; pos++)
+			size_t mismatchPos = 0;
+
+			if (!reference.compare(0, (size_t)m_bufferSize, data, mismatchPos))
 			{
-				if (reference.isDefined(pos))
-				{
-					if (data[pos] != reference.get(pos))
-					{
-						resultCollector.fail(
-								de::toString(commandIndex) + ":" + getName()
-								+ " Result differs from reference, Expected: "
-								+ de::toString(tcu::toHex<8>(reference.get(pos)))
-								+ ", Got: "
-								+ de::toString(tcu::toHex<8>(data[pos]))
-								+ ", At offset: "
-								+ de::toString(pos));
-						break;
-					}
-				}
+				resultCollector.fail(
+						de::toString(commandIndex) + ":" + getName()
+						+ " Result differs from reference, Expected: "
+						+ de::toString(tcu::toHex<8>(reference.get(mismatchPos)))
+						+ ", Got: "
+						+ de::toString(tcu::toHex<8>(data[mismatchPos]))
+						+ ", At offset: "
+						+ de::toString(mismatchPos));
 			}
 		}
 
@@ -2448,9 +2526,12 @@ void BufferCopyFromBuffer::verify (VerifyContext& context, size_t)
 {
 	ReferenceMemory&	reference	(context.getReference());
 	de::Random			rng			(m_seed);
+	vector<deUint8>		data		((size_t)m_bufferSize);
+
+	for (size_t ndx = 0; ndx < data.size(); ndx++)
+		data[ndx] = rng.getUint8();
 
-	for (size_t ndx = 0; ndx < (size_t)m_bufferSize; ndx++)
-		reference.set(ndx, rng.getUint8());
+	reference.setData(0, data.size(), &data[0]);
 }
 
 class BufferCopyToImage : public CmdCommand
@@ -2673,23 +2754,18 @@ void BufferCopyToImage::verify (VerifyContext& context, size_t commandIndex)
 		{
 			const deUint8* const	data = (const deUint8*)ptr;
 
-			for (size_t pos = 0; pos < (size_t)( 4 * m_imageWidth * m_imageHeight); pos++)
+			size_t mismatchPos = 0;
+
+			if (!reference.compare(0, (size_t)( 4 * m_imageWidth * m_imageHeight), data, mismatchPos))
 			{
-				if (reference.isDefined(pos))
-				{
-					if (data[pos] != reference.get(pos))
-					{
-						resultCollector.fail(
-								de::toString(commandIndex) + ":" + getName()
-								+ " Result differs from reference, Expected: "
-								+ de::toString(tcu::toHex<8>(reference.get(pos)))
-								+ ", Got: "
-								+ de::toString(tcu::toHex<8>(data[pos]))
-								+ ", At offset: "
-								+ de::toString(pos));
-						break;
-					}
-				}
+				resultCollector.fail(
+						de::toString(commandIndex) + ":" + getName()
+						+ " Result differs from reference, Expected: "
+						+ de::toString(tcu::toHex<8>(reference.get(mismatchPos)))
+						+ ", Got: "
+						+ de::toString(tcu::toHex<8>(data[mismatchPos]))
+						+ ", At offset: "
+						+ de::toString(mismatchPos));
 			}
 		}
 
@@ -2892,11 +2968,14 @@ void BufferCopyFromImage::submit (SubmitContext& context)
 
 void BufferCopyFromImage::verify (VerifyContext& context, size_t)
 {
-	ReferenceMemory&	reference		(context.getReference());
-	de::Random			rng	(m_seed);
+	ReferenceMemory&	reference	(context.getReference());
+	de::Random			rng			(m_seed);
+	vector<deUint8>		data		((size_t)(4 * m_imageWidth * m_imageHeight));
+
+	for (size_t ndx = 0; ndx < data.size(); ndx++)
+		data[ndx] = rng.getUint8();
 
-	for (size_t ndx = 0; ndx < (size_t)(4 * m_imageWidth * m_imageHeight); ndx++)
-		reference.set(ndx, rng.getUint8());
+	reference.setData(0, data.size(), &data[0]);
 }
 
 class ImageCopyToBuffer : public CmdCommand
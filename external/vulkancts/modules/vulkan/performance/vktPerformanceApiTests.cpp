@@ -0,0 +1,387 @@
+/*-------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2020 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Vulkan API performance tests
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceApiTests.hpp"
+#include "vktPerformanceTestUtil.hpp"
+#include "vktTestCaseUtil.hpp"
+
+#include "vkBufferWithMemory.hpp"
+#include "vkBuilderUtil.hpp"
+#include "vkCmdUtil.hpp"
+#include "vkObjUtil.hpp"
+#include "vkPrograms.hpp"
+#include "vkRefUtil.hpp"
+#include "vkTypeUtil.hpp"
+
+#include "deUniquePtr.hpp"
+#include "deStringUtil.hpp"
+
+#include <vector>
+
+namespace vkt
+{
+namespace performance
+{
+namespace
+{
+
+using namespace vk;
+using de::MovePtr;
+using std::vector;
+
+// Command buffer recording
+
+class RecordCommandBufferInstance : public PerformanceTestInstance
+{
+public:
+								RecordCommandBufferInstance	(Context& context, int numCommands);
+
+protected:
+	void						runOperations				(int numOperations);
+
+private:
+	const int					m_numCommands;
+	BufferWithMemory			m_buffer;
+	Move<VkCommandPool>			m_cmdPool;
+	Move<VkCommandBuffer>		m_cmdBuffer;
+};
+
+RecordCommandBufferInstance::RecordCommandBufferInstance (Context& context, int numCommands)
+	: PerformanceTestInstance	(context, "CommandBuffers")
+	, m_numCommands				(numCommands)
+	, m_buffer					(context.getDeviceInterface(), context.getDevice(), context.getDefaultAllocator(), makeBufferCreateInfo(4u, VK_BUFFER_USAGE_TRANSFER_DST_BIT), MemoryRequirement::Any)
+	, m_cmdPool					(createCommandPool(context.getDeviceInterface(), context.getDevice(), VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, context.getUniversalQueueFamilyIndex()))
+	, m_cmdBuffer				(allocateCommandBuffer(context.getDeviceInterface(), context.getDevice(), *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))
+{
+}
+
+void RecordCommandBufferInstance::runOperations (int numOperations)
+{
+	const DeviceInterface& vk = m_context.getDeviceInterface();
+
+	for (int operationNdx = 0; operationNdx < numOperations; operationNdx++)
+	{
+		beginCommandBuffer(vk, *m_cmdBuffer);
+
+		for (int commandNdx = 0; commandNdx < m_numCommands; commandNdx++)
+			vk.cmdFillBuffer(*m_cmdBuffer, m_buffer.get(), 0u, 4u, (deUint32)commandNdx);
+
+		endCommandBuffer(vk, *m_cmdBuffer);
+	}
+}
+
+// Descriptor set updates
+
+class UpdateDescriptorSetInstance : public PerformanceTestInstance
+{
+public:
+								UpdateDescriptorSetInstance	(Context& context, int numDescriptors);
+
+protected:
+	void						runOperations				(int numOperations);
+
+private:
+	BufferWithMemory					m_buffer;
+	Move<VkDescriptorSetLayout>			m_descriptorSetLayout;
+	Move<VkDescriptorPool>				m_descriptorPool;
+	Move<VkDescriptorSet>				m_descriptorSet;
+	vector<VkDescriptorBufferInfo>		m_bufferInfos;
+};
+
+UpdateDescriptorSetInstance::UpdateDescriptorSetInstance (Context& context, int numDescriptors)
+	: PerformanceTestInstance	(context, "Updates")
+	, m_buffer					(context.getDeviceInterface(), context.getDevice(), context.getDefaultAllocator(), makeBufferCreateInfo(4u, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), MemoryRequirement::Any)
+	, m_descriptorSetLayout		(DescriptorSetLayoutBuilder()
+									.addArrayBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, (deUint32)numDescriptors, VK_SHADER_STAGE_COMPUTE_BIT)
+									.build(context.getDeviceInterface(), context.getDevice()))
+	, m_descriptorPool			(DescriptorPoolBuilder()
+									.addType(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, (deUint32)numDescriptors)
+									.build(context.getDeviceInterface(), context.getDevice(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u))
+	, m_descriptorSet			(makeDescriptorSet(context.getDeviceInterface(), context.getDevice(), *m_descriptorPool, *m_descriptorSetLayout))
+	, m_bufferInfos				(numDescriptors, makeDescriptorBufferInfo(m_buffer.get(), 0u, 4u))
+{
+}
+
+void UpdateDescriptorSetInstance::runOperations (int numOperations)
+{
+	const DeviceInterface&		vk		= m_context.getDeviceInterface();
+	const VkDevice				device	= m_context.getDevice();
+	const VkWriteDescriptorSet	write	=
+	{
+		VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// VkStructureType					sType;
+		DE_NULL,									// const void*						pNext;
+		*m_descriptorSet,							// VkDescriptorSet					dstSet;
+		0u,											// deUint32							dstBinding;
+		0u,											// deUint32							dstArrayElement;
+		(deUint32)m_bufferInfos.size(),				// deUint32							descriptorCount;
+		VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,			// VkDescriptorType					descriptorType;
+		DE_NULL,									// const VkDescriptorImageInfo*		pImageInfo;
+		&m_bufferInfos[0],							// const VkDescriptorBufferInfo*	pBufferInfo;
+		DE_NULL,									// const VkBufferView*				pTexelBufferView;
+	};
+
+	for (int operationNdx = 0; operationNdx < numOperations; operationNdx++)
+		vk.updateDescriptorSets(device, 1u, &write, 0u, DE_NULL);
+}
+
+// Pipeline creation
+
+struct ComputePrograms
+{
+	void init (SourceCollections& dst, bool) const
+	{
+		dst.glslSources.add("comp") << glu::ComputeSource(
+			"#version 310 es\n"
+			"layout(local_size_x = 1) in;\n"
+			"layout(binding = 0) buffer Output { uint values[]; } sb_out;\n"
+			"void main (void)\n"
+			"{\n"
+			"	sb_out.values[gl_GlobalInvocationID.x] = gl_GlobalInvocationID.x;\n"
+			"}\n");
+	}
+};
+
+class CreateComputePipelineInstance : public PerformanceTestInstance
+{
+public:
+								CreateComputePipelineInstance	(Context& context, bool useCache);
+
+protected:
+	void						runOperations					(int numOperations);
+
+private:
+	Move<VkDescriptorSetLayout>		m_descriptorSetLayout;
+	Move<VkPipelineLayout>			m_pipelineLayout;
+	Move<VkShaderModule>			m_shaderModule;
+	Move<VkPipelineCache>			m_pipelineCache;
+};
+
+CreateComputePipelineInstance::CreateComputePipelineInstance (Context& context, bool useCache)
+	: PerformanceTestInstance	(context, "Pipelines")
+	, m_descriptorSetLayout		(DescriptorSetLayoutBuilder()
+									.addSingleBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+									.build(context.getDeviceInterface(), context.getDevice()))
+	, m_pipelineLayout			(makePipelineLayout(context.getDeviceInterface(), context.getDevice(), *m_descriptorSetLayout))
+	, m_shaderModule			(createShaderModule(context.getDeviceInterface(), context.getDevice(), context.getBinaryCollection().get("comp"), 0u))
+{
+	if (useCache)
+	{
+		const DeviceInterface&				vk						= context.getDeviceInterface();
+		const VkDevice						device					= context.getDevice();
+		const VkPipelineCacheCreateInfo		pipelineCacheCreateInfo	=
+		{
+			VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// VkStructureType				sType;
+			DE_NULL,										// const void*					pNext;
+			0u,												// VkPipelineCacheCreateFlags	flags;
+			0u,												// deUintptr					initialDataSize;
+			DE_NULL,										// const void*					pInitialData;
+		};
+
+		m_pipelineCache = createPipelineCache(vk, device, &pipelineCacheCreateInfo);
+
+		// Warm the cache so that measured creations can hit it
+		runOperations(1);
+	}
+}
+
+void CreateComputePipelineInstance::runOperations (int numOperations)
+{
+	const DeviceInterface&					vk					= m_context.getDeviceInterface();
+	const VkDevice							device				= m_context.getDevice();
+	const VkPipelineShaderStageCreateInfo	stageCreateInfo		=
+	{
+		VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,	// VkStructureType						sType;
+		DE_NULL,												// const void*							pNext;
+		0u,														// VkPipelineShaderStageCreateFlags		flags;
+		VK_SHADER_STAGE_COMPUTE_BIT,							// VkShaderStageFlagBits				stage;
+		*m_shaderModule,										// VkShaderModule						module;
+		"main",													// const char*							pName;
+		DE_NULL,												// const VkSpecializationInfo*			pSpecializationInfo;
+	};
+	const VkComputePipelineCreateInfo		pipelineCreateInfo	=
+	{
+		VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,			// VkStructureType					sType;
+		DE_NULL,												// const void*						pNext;
+		0u,														// VkPipelineCreateFlags			flags;
+		stageCreateInfo,										// VkPipelineShaderStageCreateInfo	stage;
+		*m_pipelineLayout,										// VkPipelineLayout					layout;
+		DE_NULL,												// VkPipeline						basePipelineHandle;
+		0,														// deInt32							basePipelineIndex;
+	};
+
+	for (int operationNdx = 0; operationNdx < numOperations; operationNdx++)
+		createComputePipeline(vk, device, m_pipelineCache.get(), &pipelineCreateInfo);
+}
+
+// Buffer uploads through mapped memory
+
+class BufferUploadInstance : public PerformanceTestInstance
+{
+public:
+								BufferUploadInstance	(Context& context, int bufferSize);
+
+protected:
+	void						runOperations			(int numOperations);
+
+private:
+	const vector<deUint8>		m_data;
+	BufferWithMemory			m_buffer;
+};
+
+BufferUploadInstance::BufferUploadInstance (Context& context, int bufferSize)
+	: PerformanceTestInstance	(context, "Uploads")
+	, m_data					(bufferSize, 0xa5u)
+	, m_buffer					(context.getDeviceInterface(), context.getDevice(), context.getDefaultAllocator(), makeBufferCreateInfo((VkDeviceSize)bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT), MemoryRequirement::HostVisible)
+{
+}
+
+void BufferUploadInstance::runOperations (int numOperations)
+{
+	const DeviceInterface&	vk		= m_context.getDeviceInterface();
+	const VkDevice			device	= m_context.getDevice();
+	const Allocation&		alloc	= m_buffer.getAllocation();
+
+	for (int operationNdx = 0; operationNdx < numOperations; operationNdx++)
+	{
+		deMemcpy(alloc.getHostPtr(), &m_data[0], m_data.size());
+		flushAlloc(vk, device, alloc);
+	}
+}
+
+// Queue submission
+
+class QueueSubmitInstance : public PerformanceTestInstance
+{
+public:
+								QueueSubmitInstance		(Context& context, int numCommandBuffers);
+
+protected:
+	void						runOperations			(int numOperations);
+
+private:
+	Move<VkCommandPool>			m_cmdPool;
+	Move<VkCommandBuffer>		m_cmdBuffer;
+	vector<VkCommandBuffer>		m_submitCmdBuffers;
+};
+
+QueueSubmitInstance::QueueSubmitInstance (Context& context, int numCommandBuffers)
+	: PerformanceTestInstance	(context, "Submits")
+	, m_cmdPool					(createCommandPool(context.getDeviceInterface(), context.getDevice(), 0u, context.getUniversalQueueFamilyIndex()))
+	, m_cmdBuffer				(allocateCommandBuffer(context.getDeviceInterface(), context.getDevice(), *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))
+	, m_submitCmdBuffers		(numCommandBuffers, *m_cmdBuffer)
+{
+	// The same empty command buffer is submitted several times, possibly while still pending
+	beginCommandBuffer(context.getDeviceInterface(), *m_cmdBuffer, VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+	endCommandBuffer(context.getDeviceInterface(), *m_cmdBuffer);
+}
+
+void QueueSubmitInstance::runOperations (int numOperations)
+{
+	const DeviceInterface&	vk			= m_context.getDeviceInterface();
+	const VkQueue			queue		= m_context.getUniversalQueue();
+	const VkSubmitInfo		submitInfo	=
+	{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,				// VkStructureType				sType;
+		DE_NULL,									// const void*					pNext;
+		0u,											// deUint32						waitSemaphoreCount;
+		DE_NULL,									// const VkSemaphore*			pWaitSemaphores;
+		DE_NULL,									// const VkPipelineStageFlags*	pWaitDstStageMask;
+		(deUint32)m_submitCmdBuffers.size(),		// deUint32						commandBufferCount;
+		&m_submitCmdBuffers[0],						// const VkCommandBuffer*		pCommandBuffers;
+		0u,											// deUint32						signalSemaphoreCount;
+		DE_NULL,									// const VkSemaphore*			pSignalSemaphores;
+	};
+
+	for (int operationNdx = 0; operationNdx < numOperations; operationNdx++)
+		VK_CHECK(vk.queueSubmit(queue, 1u, &submitInfo, DE_NULL));
+
+	VK_CHECK(vk.queueWaitIdle(queue));
+}
+
+template<typename Instance, typename Arg0>
+void addPerformanceCase (tcu::TestCaseGroup* group, const std::string& name, const std::string& desc, const Arg0& arg0)
+{
+	group->addChild(new InstanceFactory1<Instance, Arg0>(group->getTestContext(), tcu::NODETYPE_PERFORMANCE, name, desc, arg0));
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createApiTests (tcu::TestContext& testCtx)
+{
+	de::MovePtr<tcu::TestCaseGroup> apiTests (new tcu::TestCaseGroup(testCtx, "api", "Vulkan API call throughput"));
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "command_buffer", "Command buffer recording"));
+		const int						numCommands[]	= { 1, 64, 1024 };
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(numCommands); ndx++)
+			addPerformanceCase<RecordCommandBufferInstance>(group.get(), "record_" + de::toString(numCommands[ndx]) + "_fill_buffer", "Record a command buffer of vkCmdFillBuffer() commands", numCommands[ndx]);
+
+		apiTests->addChild(group.release());
+	}
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	group				(new tcu::TestCaseGroup(testCtx, "descriptor", "Descriptor set updates"));
+		// 4 is the minimum maxPerStageDescriptorStorageBuffers
+		const int						numDescriptors[]	= { 1, 4 };
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(numDescriptors); ndx++)
+			addPerformanceCase<UpdateDescriptorSetInstance>(group.get(), "update_" + de::toString(numDescriptors[ndx]) + "_storage_buffer", "Write storage buffer descriptors with vkUpdateDescriptorSets()", numDescriptors[ndx]);
+
+		apiTests->addChild(group.release());
+	}
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	group	(new tcu::TestCaseGroup(testCtx, "pipeline", "Pipeline creation"));
+
+		group->addChild(new InstanceFactory1<CreateComputePipelineInstance, bool, ComputePrograms>(testCtx, tcu::NODETYPE_PERFORMANCE, "create_compute", "Create compute pipelines without a pipeline cache", ComputePrograms(), false));
+		group->addChild(new InstanceFactory1<CreateComputePipelineInstance, bool, ComputePrograms>(testCtx, tcu::NODETYPE_PERFORMANCE, "create_compute_cached", "Create compute pipelines with a warm pipeline cache", ComputePrograms(), true));
+
+		apiTests->addChild(group.release());
+	}
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "buffer", "Buffer uploads"));
+		const int						bufferSizes[]	= { 4 * 1024, 64 * 1024, 1024 * 1024 };
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(bufferSizes); ndx++)
+			addPerformanceCase<BufferUploadInstance>(group.get(), "upload_" + de::toString(bufferSizes[ndx] / 1024) + "k", "Copy data to mapped host-visible memory and flush", bufferSizes[ndx]);
+
+		apiTests->addChild(group.release());
+	}
+
+	{
+		de::MovePtr<tcu::TestCaseGroup>	group				(new tcu::TestCaseGroup(testCtx, "queue", "Queue submission"));
+		const int						numCommandBuffers[]	= { 1, 16 };
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(numCommandBuffers); ndx++)
+			addPerformanceCase<QueueSubmitInstance>(group.get(), "submit_" + de::toString(numCommandBuffers[ndx]) + "_empty", "Submit empty command buffers with vkQueueSubmit()", numCommandBuffers[ndx]);
+
+		apiTests->addChild(group.release());
+	}
+
+	return apiTests.release();
+}
+
+} // performance
+} // vkt
@@ -0,0 +1,109 @@
+/*-------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2020 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Performance test measurement utilities
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceTestUtil.hpp"
+
+#include "tcuTestLog.hpp"
+#include "tcuCPUWarmup.hpp"
+
+#include "deClock.h"
+#include "deStringUtil.hpp"
+
+namespace vkt
+{
+namespace performance
+{
+
+using tcu::TestLog;
+using tcu::TheilSenCalibrator;
+using tcu::CalibratorParameters;
+using tcu::MeasureState;
+
+PerformanceTestInstance::PerformanceTestInstance (Context& context, const std::string& operationName)
+	: TestInstance		(context)
+	, m_operationName	(operationName)
+	, m_calibrator		(CalibratorParameters(1			/* initial operations */,
+											  10		/* calibrate iteration frames */,
+											  2000.0f	/* calibrate iteration shortcut threshold (ms) */,
+											  16		/* max calibrate iterations */,
+											  10.0f		/* iteration time (ms) */,
+											  0.0f		/* no iteration time cap (ms) */,
+											  1000.0f	/* target measure duration (ms) */))
+	, m_isWarmedUp		(false)
+{
+}
+
+PerformanceTestInstance::~PerformanceTestInstance (void)
+{
+}
+
+tcu::TestStatus PerformanceTestInstance::iterate (void)
+{
+	if (!m_isWarmedUp)
+	{
+		tcu::warmupCPU();
+		m_isWarmedUp = true;
+		return tcu::TestStatus::incomplete();
+	}
+
+	const TheilSenCalibrator::State	calibratorState	= m_calibrator.getState();
+	const deUint64					startTime		= deGetMicroseconds();
+
+	// Always run the operations. This gives more stable performance behavior.
+	runOperations(m_calibrator.getCallCount());
+
+	const deUint64					iterationTime	= deGetMicroseconds() - startTime;
+
+	if (calibratorState == TheilSenCalibrator::STATE_RECOMPUTE_PARAMS)
+	{
+		m_calibrator.recomputeParameters();
+		return tcu::TestStatus::incomplete();
+	}
+	else if (calibratorState == TheilSenCalibrator::STATE_MEASURE)
+	{
+		m_calibrator.recordIteration(iterationTime);
+		return tcu::TestStatus::incomplete();
+	}
+	else
+	{
+		DE_ASSERT(calibratorState == TheilSenCalibrator::STATE_FINISHED);
+
+		const MeasureState&	measureState		= m_calibrator.getMeasureState();
+		const deUint64		totalTime			= de::max<deUint64>(measureState.getTotalTime(), 1u);
+		const deInt64		numOperations		= (deInt64)measureState.numDrawCalls * (deInt64)measureState.frameTimes.size();
+		const double		operationsPerSecond	= (double)numOperations / ((double)totalTime / 1000000.0);
+		const double		timePerOperation	= (double)totalTime / (double)de::max<deInt64>(numOperations, 1);
+		TestLog&			log					= m_context.getTestContext().getLog();
+
+		tcu::logCalibrationInfo(log, m_calibrator);
+
+		log << TestLog::Integer("NumOperations",	"Number of measured operations",	m_operationName,			QP_KEY_TAG_NONE,		numOperations)
+			<< TestLog::Float("OperationTime",		"Average time per operation",		"us",						QP_KEY_TAG_TIME,		(float)timePerOperation)
+			<< TestLog::Float("Throughput",			"Operations per second",			m_operationName + "/s",		QP_KEY_TAG_PERFORMANCE,	(float)operationsPerSecond);
+
+		return tcu::TestStatus::pass(de::floatToString((float)operationsPerSecond, 2));
+	}
+}
+
+} // performance
+} // vkt
@@ -0,0 +1,71 @@
+#ifndef _VKTPERFORMANCETESTUTIL_HPP
+#define _VKTPERFORMANCETESTUTIL_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2020 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Performance test measurement utilities
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuCalibration.hpp"
+#include "vktTestCase.hpp"
+
+#include <string>
+
+namespace vkt
+{
+namespace performance
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Throughput measurement of a repeated operation
+ *
+ * The number of operations per iteration is calibrated with
+ * tcu::TheilSenCalibrator so that one iteration takes roughly the target
+ * time, after which iterations are timed until the measurement duration
+ * is reached. The result is the operation throughput.
+ *
+ * Subclasses implement runOperations(), which must complete the given
+ * number of operations before returning, including any wait on the
+ * device. The measurement does not depend on device results, so the
+ * harness runs on any implementation, including the null driver. The
+ * vulkan-perf-null recipe of scripts/check_build_sanity.py checks this.
+ *//*--------------------------------------------------------------------*/
+class PerformanceTestInstance : public TestInstance
+{
+public:
+								PerformanceTestInstance		(Context& context, const std::string& operationName);
+	virtual						~PerformanceTestInstance	(void);
+
+	tcu::TestStatus				iterate						(void);
+
+protected:
+	virtual void				runOperations				(int numOperations) = 0;
+
+private:
+	const std::string					m_operationName;
+	tcu::TheilSenCalibrator				m_calibrator;
+	bool								m_isWarmedUp;
+};
+
+} // performance
+} // vkt
+
+#endif // _VKTPERFORMANCETESTUTIL_HPP
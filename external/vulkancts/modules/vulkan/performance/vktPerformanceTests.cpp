@@ -0,0 +1,44 @@
+/*-------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2020 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Vulkan performance tests
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceTests.hpp"
+#include "vktPerformanceApiTests.hpp"
+
+#include "deUniquePtr.hpp"
+
+namespace vkt
+{
+namespace performance
+{
+
+tcu::TestCaseGroup* createTests (tcu::TestContext& testCtx)
+{
+	de::MovePtr<tcu::TestCaseGroup> performanceTests (new tcu::TestCaseGroup(testCtx, "performance", "Performance tests"));
+
+	performanceTests->addChild(createApiTests(testCtx));
+
+	return performanceTests.release();
+}
+
+} // performance
+} // vkt
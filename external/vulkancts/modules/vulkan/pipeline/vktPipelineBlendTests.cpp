@@ -745,7 +745,9 @@ BlendTestInstance::BlendTestInstance (Context&									context,
 																		   DE_NULL,								// const VkPipelineRasterizationStateCreateInfo* rasterizationStateCreateInfo
 																		   DE_NULL,								// const VkPipelineMultisampleStateCreateInfo*   multisampleStateCreateInfo
 																		   DE_NULL,								// const VkPipelineDepthStencilStateCreateInfo*  depthStencilStateCreateInfo
-																		   &colorBlendStateParams);				// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																		   &colorBlendStateParams,				// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																		   DE_NULL,								// const VkPipelineDynamicStateCreateInfo*       dynamicStateCreateInfo
+																		   m_context.getPipelineCache());		// const VkPipelineCache                         pipelineCache
 		}
 	}
 
@@ -1335,7 +1337,9 @@ DualSourceBlendTestInstance::DualSourceBlendTestInstance (Context&									conte
 																		   DE_NULL,								// const VkPipelineRasterizationStateCreateInfo* rasterizationStateCreateInfo
 																		   DE_NULL,								// const VkPipelineMultisampleStateCreateInfo*   multisampleStateCreateInfo
 																		   DE_NULL,								// const VkPipelineDepthStencilStateCreateInfo*  depthStencilStateCreateInfo
-																		   &colorBlendStateParams);				// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																		   &colorBlendStateParams,				// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																		   DE_NULL,								// const VkPipelineDynamicStateCreateInfo*       dynamicStateCreateInfo
+																		   m_context.getPipelineCache());		// const VkPipelineCache                         pipelineCache
 		}
 	}
 
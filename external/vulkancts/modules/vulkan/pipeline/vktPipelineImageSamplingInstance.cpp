@@ -350,7 +350,6 @@ ImageSamplingInstance::ImageSamplingInstance (Context&						context,
 	const DeviceInterface&					vk						= context.getDeviceInterface();
 	const VkPhysicalDevice					physDevice				= context.getPhysicalDevice();
 	const VkDevice							vkDevice				= context.getDevice();
-	const VkQueue							queue					= context.getUniversalQueue();
 	const deUint32							queueFamilyIndex		= context.getUniversalQueueFamilyIndex();
 	SimpleAllocator							memAlloc				(vk, vkDevice, getPhysicalDeviceMemoryProperties(context.getInstanceInterface(), context.getPhysicalDevice()));
 	const VkComponentMapping				componentMappingRGBA	= { VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_B, VK_COMPONENT_SWIZZLE_A };
@@ -478,8 +477,8 @@ ImageSamplingInstance::ImageSamplingInstance (Context&						context,
 			m_imageAllocs[imgNdx] = SharedAllocPtr(new UniqueAlloc(allocateImage(vki, vk, physDevice, vkDevice, **m_images[imgNdx], MemoryRequirement::Any, memAlloc, m_allocationKind)));
 			VK_CHECK(vk.bindImageMemory(vkDevice, **m_images[imgNdx], (*m_imageAllocs[imgNdx])->getMemory(), (*m_imageAllocs[imgNdx])->getOffset()));
 
-			// Upload texture data
-			uploadTestTexture(vk, vkDevice, queue, queueFamilyIndex, memAlloc, *m_texture, **m_images[imgNdx]);
+			// Upload texture data, all images are uploaded in one submission below
+			uploadTestTexture(vk, context.getStagingRing(), *m_texture, **m_images[imgNdx]);
 
 			// Create image view and sampler
 			const VkImageViewCreateInfo imageViewParams =
@@ -497,6 +496,8 @@ ImageSamplingInstance::ImageSamplingInstance (Context&						context,
 			m_imageViews[imgNdx] = SharedImageViewPtr(new UniqueImageView(createImageView(vk, vkDevice, &imageViewParams)));
 		}
 
+		context.getStagingRing().submitAndWait();
+
 		m_sampler	= createSampler(vk, vkDevice, &m_samplerParams);
 	}
 
@@ -1517,18 +1518,18 @@ tcu::TestStatus ImageSamplingInstance::verifyImage (void)
 			texture		= m_texture.get();
 		}
 
+		// Read back all result images in one submission
+		std::vector<VkImage>			colorImages;
+		std::vector<tcu::TextureLevel>	results;
+
+		for (int imgNdx = 0; imgNdx < m_imageCount; ++imgNdx)
+			colorImages.push_back(**m_colorImages[imgNdx]);
+
+		readColorAttachments(m_context.getDeviceInterface(), m_context.getStagingRing(), colorImages, m_colorFormat, m_renderSize, results);
+
 		for (int imgNdx = 0; imgNdx < m_imageCount; ++imgNdx)
 		{
-			// Read back result image
-			UniquePtr<tcu::TextureLevel>		result			(readColorAttachment(m_context.getDeviceInterface(),
-																					 m_context.getDevice(),
-																					 m_context.getUniversalQueue(),
-																					 m_context.getUniversalQueueFamilyIndex(),
-																					 m_context.getDefaultAllocator(),
-																					 **m_colorImages[imgNdx],
-																					 m_colorFormat,
-																					 m_renderSize));
-			const tcu::ConstPixelBufferAccess	resultAccess	= result->getAccess();
+			const tcu::ConstPixelBufferAccess	resultAccess	= results[imgNdx].getAccess();
 			bool								compareOk		= validateResultImage(*texture,
 																					  m_imageViewType,
 																					  subresource,
@@ -212,12 +212,26 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	v
 													vk::VkImage					image,
 													vk::VkFormat				format,
 													const tcu::UVec2&			renderSize)
+{
+	SubmitBatch batch;
+
+	return readColorAttachment(vk, device, queue, queueFamilyIndex, allocator, image, format, renderSize, batch);
+}
+
+de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	vk,
+													vk::VkDevice				device,
+													vk::VkQueue					queue,
+													deUint32					queueFamilyIndex,
+													vk::Allocator&				allocator,
+													vk::VkImage					image,
+													vk::VkFormat				format,
+													const tcu::UVec2&			renderSize,
+													vk::SubmitBatch&			pendingWork)
 {
 	Move<VkBuffer>					buffer;
 	de::MovePtr<Allocation>			bufferAlloc;
 	Move<VkCommandPool>				cmdPool;
 	Move<VkCommandBuffer>			cmdBuffer;
-	Move<VkFence>					fence;
 	const tcu::TextureFormat		tcuFormat		= mapVkFormat(format);
 	const VkDeviceSize				pixelDataSize	= renderSize.x() * renderSize.y() * tcuFormat.getPixelSize();
 	de::MovePtr<tcu::TextureLevel>	resultLevel		(new tcu::TextureLevel(tcuFormat, renderSize.x(), renderSize.y()));
@@ -245,14 +259,13 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	v
 	cmdPool		= createCommandPool(vk, device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, queueFamilyIndex);
 	cmdBuffer	= allocateCommandBuffer(vk, device, *cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
-	// Create fence
-	fence = createFence(vk, device);
-
 	beginCommandBuffer(vk, *cmdBuffer);
 	copyImageToBuffer(vk, *cmdBuffer, image, *buffer, tcu::IVec2(renderSize.x(), renderSize.y()));
 	endCommandBuffer(vk, *cmdBuffer);
 
-	submitCommandsAndWait(vk, device, queue, cmdBuffer.get());
+	// Readback goes in the same submission as any pending work
+	pendingWork.addCommandBuffer(*cmdBuffer);
+	pendingWork.submitAndWait(vk, device, queue);
 
 	// Read buffer data
 	invalidateAlloc(vk, device, *bufferAlloc);
@@ -261,6 +274,64 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	v
 	return resultLevel;
 }
 
+static StagingRing::Region recordColorAttachmentReadback (const vk::DeviceInterface&	vk,
+															StagingRing&				stagingRing,
+															vk::VkImage					image,
+															const tcu::TextureFormat&	tcuFormat,
+															const tcu::UVec2&			renderSize)
+{
+	const VkDeviceSize				pixelDataSize	= renderSize.x() * renderSize.y() * tcuFormat.getPixelSize();
+	const StagingRing::Region		region			= stagingRing.allocate(pixelDataSize, (VkDeviceSize)tcuFormat.getPixelSize() * 4u);
+
+	copyImageToBuffer(vk, stagingRing.getCommandBuffer(), image, region.buffer, tcu::IVec2(renderSize.x(), renderSize.y()),
+					  VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, 1u,
+					  VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_ASPECT_COLOR_BIT, region.offset);
+
+	return region;
+}
+
+de::MovePtr<tcu::TextureLevel> readColorAttachment (const vk::DeviceInterface&	vk,
+													vk::StagingRing&			stagingRing,
+													vk::VkImage					image,
+													vk::VkFormat				format,
+													const tcu::UVec2&			renderSize)
+{
+	const tcu::TextureFormat		tcuFormat		= mapVkFormat(format);
+	const StagingRing::Region		region			= recordColorAttachmentReadback(vk, stagingRing, image, tcuFormat, renderSize);
+	de::MovePtr<tcu::TextureLevel>	resultLevel		(new tcu::TextureLevel(tcuFormat, renderSize.x(), renderSize.y()));
+
+	stagingRing.submitAndWait();
+
+	// Read buffer data
+	tcu::copy(*resultLevel, tcu::ConstPixelBufferAccess(resultLevel->getFormat(), resultLevel->getSize(), region.hostPtr));
+
+	return resultLevel;
+}
+
+void readColorAttachments (const vk::DeviceInterface&		vk,
+						   vk::StagingRing&					stagingRing,
+						   const std::vector<vk::VkImage>&	images,
+						   vk::VkFormat						format,
+						   const tcu::UVec2&				renderSize,
+						   std::vector<tcu::TextureLevel>&	dst)
+{
+	const tcu::TextureFormat			tcuFormat	= mapVkFormat(format);
+	std::vector<StagingRing::Region>	regions;
+
+	for (size_t imageNdx = 0; imageNdx < images.size(); ++imageNdx)
+		regions.push_back(recordColorAttachmentReadback(vk, stagingRing, images[imageNdx], tcuFormat, renderSize));
+
+	stagingRing.submitAndWait();
+
+	dst.resize(images.size());
+
+	for (size_t imageNdx = 0; imageNdx < images.size(); ++imageNdx)
+	{
+		dst[imageNdx].setStorage(tcuFormat, renderSize.x(), renderSize.y());
+		tcu::copy(dst[imageNdx], tcu::ConstPixelBufferAccess(tcuFormat, dst[imageNdx].getSize(), regions[imageNdx].hostPtr));
+	}
+}
+
 de::MovePtr<tcu::TextureLevel> readDepthAttachment (const vk::DeviceInterface&	vk,
 													vk::VkDevice				device,
 													vk::VkQueue					queue,
@@ -397,6 +468,48 @@ de::MovePtr<tcu::TextureLevel> readStencilAttachment (const vk::DeviceInterface&
 	return resultLevel;
 }
 
+//! Size of staging data for uploading srcTexture and optional srcStencilTexture, stencil data starts at stencilOffset.
+static deUint32 getUploadDataSize (const TestTexture& srcTexture, const TestTexture* srcStencilTexture, deUint32& stencilOffset)
+{
+	deUint32 dataSize = (srcTexture.isCompressed())? srcTexture.getCompressedSize(): srcTexture.getSize();
+
+	stencilOffset = 0u;
+
+	if (srcStencilTexture != DE_NULL)
+	{
+		stencilOffset	= static_cast<deUint32>(deAlign32(static_cast<deInt32>(dataSize), 4));
+		dataSize		= stencilOffset + srcStencilTexture->getSize();
+	}
+
+	return dataSize;
+}
+
+//! Write staging data to dst and return copy regions relative to dst.
+static std::vector<VkBufferImageCopy> writeUploadData (const TestTexture& srcTexture, const TestTexture* srcStencilTexture, deUint32 stencilOffset, deUint8* dst)
+{
+	std::vector<VkBufferImageCopy> copyRegions = srcTexture.getBufferCopyRegions();
+
+	srcTexture.write(dst);
+
+	if (srcStencilTexture != DE_NULL)
+	{
+		DE_ASSERT(stencilOffset != 0u);
+
+		srcStencilTexture->write(dst + stencilOffset);
+
+		std::vector<VkBufferImageCopy>	stencilCopyRegions = srcStencilTexture->getBufferCopyRegions();
+		for (size_t regionIdx = 0; regionIdx < stencilCopyRegions.size(); regionIdx++)
+		{
+			VkBufferImageCopy region = stencilCopyRegions[regionIdx];
+			region.bufferOffset += stencilOffset;
+
+			copyRegions.push_back(region);
+		}
+	}
+
+	return copyRegions;
+}
+
 void uploadTestTextureInternal (const DeviceInterface&	vk,
 								VkDevice				device,
 								VkQueue					queue,
@@ -409,22 +522,14 @@ void uploadTestTextureInternal (const DeviceInterface&	vk,
 {
 	Move<VkBuffer>					buffer;
 	de::MovePtr<Allocation>			bufferAlloc;
-	Move<VkCommandPool>				cmdPool;
-	Move<VkCommandBuffer>			cmdBuffer;
 	const VkImageAspectFlags		imageAspectFlags	= getImageAspectFlags(format);
 	deUint32						stencilOffset		= 0u;
-	std::vector<VkBufferImageCopy>	copyRegions			= srcTexture.getBufferCopyRegions();
-	deUint32						bufferSize			= (srcTexture.isCompressed())? srcTexture.getCompressedSize(): srcTexture.getSize();
+	std::vector<VkBufferImageCopy>	copyRegions;
+	const deUint32					bufferSize			= getUploadDataSize(srcTexture, srcStencilTexture, stencilOffset);
 
 	// Stencil-only texture should be provided if (and only if) the image has a combined DS format
 	DE_ASSERT((tcu::hasDepthComponent(format.order) && tcu::hasStencilComponent(format.order)) == (srcStencilTexture != DE_NULL));
 
-	if (srcStencilTexture != DE_NULL)
-	{
-		stencilOffset	= static_cast<deUint32>(deAlign32(static_cast<deInt32>(bufferSize), 4));
-		bufferSize		= stencilOffset + srcStencilTexture->getSize();
-	}
-
 	// Create source buffer
 	{
 		const VkBufferCreateInfo bufferParams =
@@ -445,29 +550,33 @@ void uploadTestTextureInternal (const DeviceInterface&	vk,
 	}
 
 	// Write buffer data
-	{
-		srcTexture.write(reinterpret_cast<deUint8*>(bufferAlloc->getHostPtr()));
-
-		if (srcStencilTexture != DE_NULL)
-		{
-			DE_ASSERT(stencilOffset != 0u);
+	copyRegions = writeUploadData(srcTexture, srcStencilTexture, stencilOffset, reinterpret_cast<deUint8*>(bufferAlloc->getHostPtr()));
+	flushAlloc(vk, device, *bufferAlloc);
 
-			srcStencilTexture->write(reinterpret_cast<deUint8*>(bufferAlloc->getHostPtr()) + stencilOffset);
+	copyBufferToImage(vk, device, queue, queueFamilyIndex, *buffer, bufferSize, copyRegions, DE_NULL, imageAspectFlags, srcTexture.getNumLevels(), srcTexture.getArraySize(), destImage);
+}
 
-			std::vector<VkBufferImageCopy>	stencilCopyRegions = srcStencilTexture->getBufferCopyRegions();
-			for (size_t regionIdx = 0; regionIdx < stencilCopyRegions.size(); regionIdx++)
-			{
-				VkBufferImageCopy region = stencilCopyRegions[regionIdx];
-				region.bufferOffset += stencilOffset;
+void uploadTestTextureInternal (const DeviceInterface&	vk,
+								StagingRing&			stagingRing,
+								const TestTexture&		srcTexture,
+								const TestTexture*		srcStencilTexture,
+								tcu::TextureFormat		format,
+								VkImage					destImage)
+{
+	const VkImageAspectFlags		imageAspectFlags	= getImageAspectFlags(format);
+	deUint32						stencilOffset		= 0u;
+	const deUint32					dataSize			= getUploadDataSize(srcTexture, srcStencilTexture, stencilOffset);
+	// Buffer offset must be a multiple of both 4 and texel block size
+	const int						texelBlockSize		= srcTexture.isCompressed() ? tcu::getBlockSize(srcTexture.getCompressedLevel(0, 0).getFormat())
+																				: tcu::getPixelSize(srcTexture.getTextureFormat());
+	const StagingRing::Region		region				= stagingRing.allocate(dataSize, (VkDeviceSize)texelBlockSize * 4u);
+	std::vector<VkBufferImageCopy>	copyRegions;
 
-				copyRegions.push_back(region);
-			}
-		}
+	DE_ASSERT((tcu::hasDepthComponent(format.order) && tcu::hasStencilComponent(format.order)) == (srcStencilTexture != DE_NULL));
 
-		flushAlloc(vk, device, *bufferAlloc);
-	}
+	copyRegions = writeUploadData(srcTexture, srcStencilTexture, stencilOffset, reinterpret_cast<deUint8*>(region.hostPtr));
 
-	copyBufferToImage(vk, device, queue, queueFamilyIndex, *buffer, bufferSize, copyRegions, DE_NULL, imageAspectFlags, srcTexture.getNumLevels(), srcTexture.getArraySize(), destImage);
+	copyBufferToImage(vk, stagingRing, region, copyRegions, imageAspectFlags, srcTexture.getNumLevels(), srcTexture.getArraySize(), destImage);
 }
 
 bool checkSparseImageFormatSupport (const VkPhysicalDevice		physicalDevice,
@@ -563,6 +672,36 @@ void uploadTestTextureInternalSparse (const DeviceInterface&					vk,
 	copyBufferToImage(vk, device, universalQueue, universalQueueFamilyIndex, *buffer, bufferSize, copyRegions, &(*imageMemoryBindSemaphore), imageAspectFlags, imageCreateInfo.mipLevels, imageCreateInfo.arrayLayers, destImage);
 }
 
+//! Split combined depth-stencil texture into separate depth and stencil textures for upload.
+static void splitDepthStencilTexture (const TestTexture& srcTexture, de::MovePtr<TestTexture>& srcDepthTexture, de::MovePtr<TestTexture>& srcStencilTexture)
+{
+	DE_ASSERT(tcu::isCombinedDepthStencilType(srcTexture.getTextureFormat().type));
+
+	if (tcu::hasDepthComponent(srcTexture.getTextureFormat().order))
+	{
+		tcu::TextureFormat format;
+		switch (srcTexture.getTextureFormat().type)
+		{
+			case tcu::TextureFormat::UNSIGNED_INT_16_8_8:
+				format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNORM_INT16);
+				break;
+			case tcu::TextureFormat::UNSIGNED_INT_24_8_REV:
+				format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNSIGNED_INT_24_8_REV);
+				break;
+			case tcu::TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV:
+				format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::FLOAT);
+				break;
+			default:
+				DE_FATAL("Unexpected source texture format.");
+				break;
+		}
+		srcDepthTexture = srcTexture.copy(format);
+	}
+
+	if (tcu::hasStencilComponent(srcTexture.getTextureFormat().order))
+		srcStencilTexture = srcTexture.copy(tcu::getEffectiveDepthStencilTextureFormat(srcTexture.getTextureFormat(), tcu::Sampler::MODE_STENCIL));
+}
+
 void uploadTestTexture (const DeviceInterface&			vk,
 						VkDevice						device,
 						VkQueue							queue,
@@ -576,29 +715,7 @@ void uploadTestTexture (const DeviceInterface&			vk,
 		de::MovePtr<TestTexture> srcDepthTexture;
 		de::MovePtr<TestTexture> srcStencilTexture;
 
-		if (tcu::hasDepthComponent(srcTexture.getTextureFormat().order))
-		{
-			tcu::TextureFormat format;
-			switch (srcTexture.getTextureFormat().type)
-			{
-				case tcu::TextureFormat::UNSIGNED_INT_16_8_8:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNORM_INT16);
-					break;
-				case tcu::TextureFormat::UNSIGNED_INT_24_8_REV:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::UNSIGNED_INT_24_8_REV);
-					break;
-				case tcu::TextureFormat::FLOAT_UNSIGNED_INT_24_8_REV:
-					format = tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::FLOAT);
-					break;
-				default:
-					DE_FATAL("Unexpected source texture format.");
-					break;
-			}
-			srcDepthTexture = srcTexture.copy(format);
-		}
-
-		if (tcu::hasStencilComponent(srcTexture.getTextureFormat().order))
-			srcStencilTexture = srcTexture.copy(tcu::getEffectiveDepthStencilTextureFormat(srcTexture.getTextureFormat(), tcu::Sampler::MODE_STENCIL));
+		splitDepthStencilTexture(srcTexture, srcDepthTexture, srcStencilTexture);
 
 		uploadTestTextureInternal(vk, device, queue, queueFamilyIndex, allocator, *srcDepthTexture, srcStencilTexture.get(), srcTexture.getTextureFormat(), destImage);
 	}
@@ -606,6 +723,24 @@ void uploadTestTexture (const DeviceInterface&			vk,
 		uploadTestTextureInternal(vk, device, queue, queueFamilyIndex, allocator, srcTexture, DE_NULL, srcTexture.getTextureFormat(), destImage);
 }
 
+void uploadTestTexture (const DeviceInterface&			vk,
+						StagingRing&					stagingRing,
+						const TestTexture&				srcTexture,
+						VkImage							destImage)
+{
+	if (tcu::isCombinedDepthStencilType(srcTexture.getTextureFormat().type))
+	{
+		de::MovePtr<TestTexture> srcDepthTexture;
+		de::MovePtr<TestTexture> srcStencilTexture;
+
+		splitDepthStencilTexture(srcTexture, srcDepthTexture, srcStencilTexture);
+
+		uploadTestTextureInternal(vk, stagingRing, *srcDepthTexture, srcStencilTexture.get(), srcTexture.getTextureFormat(), destImage);
+	}
+	else
+		uploadTestTextureInternal(vk, stagingRing, srcTexture, DE_NULL, srcTexture.getTextureFormat(), destImage);
+}
+
 void uploadTestTextureSparse (const DeviceInterface&					vk,
 							  VkDevice									device,
 							  const VkPhysicalDevice					physicalDevice,
@@ -30,6 +30,8 @@
 #include "vkPlatform.hpp"
 #include "vkMemUtil.hpp"
 #include "vkRef.hpp"
+#include "vkCmdUtil.hpp"
+#include "vkStagingRing.hpp"
 #include "tcuTexture.hpp"
 #include "tcuCompressedTexture.hpp"
 #include "deSharedPtr.hpp"
@@ -88,6 +90,43 @@ de::MovePtr<tcu::TextureLevel>	readColorAttachment			 (const vk::DeviceInterface
 															  vk::VkFormat					format,
 															  const tcu::UVec2&				renderSize);
 
+/*--------------------------------------------------------------------*//*!
+ * Same as above, but the readback is submitted together with the command
+ * buffers already collected into pendingWork, with a single wait for
+ * all of them. pendingWork is empty on return.
+ *//*--------------------------------------------------------------------*/
+de::MovePtr<tcu::TextureLevel>	readColorAttachment			 (const vk::DeviceInterface&	vk,
+															  vk::VkDevice					device,
+															  vk::VkQueue					queue,
+															  deUint32						queueFamilyIndex,
+															  vk::Allocator&				allocator,
+															  vk::VkImage					image,
+															  vk::VkFormat					format,
+															  const tcu::UVec2&				renderSize,
+															  vk::SubmitBatch&				pendingWork);
+
+/*--------------------------------------------------------------------*//*!
+ * Same as above, but the pixel data is read back through a region of
+ * stagingRing instead of a buffer allocated for this readback. The
+ * current batch of the ring is submitted.
+ *//*--------------------------------------------------------------------*/
+de::MovePtr<tcu::TextureLevel>	readColorAttachment			 (const vk::DeviceInterface&	vk,
+															  vk::StagingRing&				stagingRing,
+															  vk::VkImage					image,
+															  vk::VkFormat					format,
+															  const tcu::UVec2&				renderSize);
+
+/*--------------------------------------------------------------------*//*!
+ * Reads back several color attachments of the same format and size
+ * through stagingRing with a single submission. dst receives one level
+ * per image.
+ *//*--------------------------------------------------------------------*/
+void							readColorAttachments		 (const vk::DeviceInterface&		vk,
+															  vk::StagingRing&					stagingRing,
+															  const std::vector<vk::VkImage>&	images,
+															  vk::VkFormat						format,
+															  const tcu::UVec2&					renderSize,
+															  std::vector<tcu::TextureLevel>&	dst);
 
 /*--------------------------------------------------------------------*//*!
  * Gets a tcu::TextureLevel initialized with data from a VK depth
@@ -138,6 +177,17 @@ void							uploadTestTexture			(const vk::DeviceInterface&		vk,
 															 const TestTexture&				testTexture,
 															 vk::VkImage					destImage);
 
+/*--------------------------------------------------------------------*//*!
+ * Same as above, but the data is staged in stagingRing and the copy is
+ * recorded into its current batch. Image contents are defined once
+ * stagingRing.submitAndWait() returns, so several uploads can share one
+ * submission.
+ *//*--------------------------------------------------------------------*/
+void							uploadTestTexture			(const vk::DeviceInterface&		vk,
+															 vk::StagingRing&				stagingRing,
+															 const TestTexture&				testTexture,
+															 vk::VkImage					destImage);
+
 /*--------------------------------------------------------------------*//*!
  * Uploads data from a test texture to a destination VK image using sparse
  * binding.
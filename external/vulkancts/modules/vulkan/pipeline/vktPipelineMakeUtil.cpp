@@ -64,7 +64,8 @@ Move<VkPipeline> makeComputePipeline (const DeviceInterface&		vk,
 									  const VkDevice				device,
 									  const VkPipelineLayout		pipelineLayout,
 									  const VkShaderModule			shaderModule,
-									  const VkSpecializationInfo*	specInfo)
+									  const VkSpecializationInfo*	specInfo,
+									  const VkPipelineCache			pipelineCache)
 {
 	const VkPipelineShaderStageCreateInfo shaderStageInfo =
 	{
@@ -86,7 +87,7 @@ Move<VkPipeline> makeComputePipeline (const DeviceInterface&		vk,
 		DE_NULL,											// VkPipeline						basePipelineHandle;
 		0,													// deInt32							basePipelineIndex;
 	};
-	return createComputePipeline(vk, device, DE_NULL , &pipelineInfo);
+	return createComputePipeline(vk, device, pipelineCache, &pipelineInfo);
 }
 
 MovePtr<Allocation> bindImageDedicated (const InstanceInterface& vki, const DeviceInterface& vkd, const VkPhysicalDevice physDevice, const VkDevice device, const VkImage image, const MemoryRequirement requirement)
@@ -407,7 +407,7 @@ public:
 	virtual										~MultisampleRenderer		(void);
 
 	de::MovePtr<tcu::TextureLevel>				render						(void);
-	de::MovePtr<tcu::TextureLevel>				getSingleSampledImage		(deUint32 sampleId);
+	void										getSingleSampledImages		(std::vector<tcu::TextureLevel>& dst);
 
 protected:
 	void										initialize					(Context&										context,
@@ -1694,11 +1694,8 @@ tcu::TestStatus MinSampleShadingInstance::iterate (void)
 		MultisampleRenderer renderer (m_context, m_colorFormat, m_renderSize, m_primitiveTopology, m_vertices, m_multisampleStateParams, m_colorBlendState, RENDER_TYPE_COPY_SAMPLES, m_backingMode);
 		renderer.render();
 
-		sampleShadedImages.resize(m_multisampleStateParams.rasterizationSamples);
-		for (deUint32 sampleId = 0; sampleId < sampleShadedImages.size(); sampleId++)
-		{
-			sampleShadedImages[sampleId] = *renderer.getSingleSampledImage(sampleId);
-		}
+		renderer.getSingleSampledImages(sampleShadedImages);
+		DE_ASSERT(sampleShadedImages.size() == (size_t)m_multisampleStateParams.rasterizationSamples);
 	}
 
 	// Log images
@@ -3203,7 +3200,9 @@ void MultisampleRenderer::initialize (Context&									context,
 																									   DE_NULL,						// const VkPipelineRasterizationStateCreateInfo* rasterizationStateCreateInfo
 																									   &m_multisampleStateParams,	// const VkPipelineMultisampleStateCreateInfo*   multisampleStateCreateInfo
 																									   &depthStencilStateParams,	// const VkPipelineDepthStencilStateCreateInfo*  depthStencilStateCreateInfo
-																									   &colorBlendStateParams))));	// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																									   &colorBlendStateParams,		// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																									   DE_NULL,						// const VkPipelineDynamicStateCreateInfo*       dynamicStateCreateInfo
+																									   context.getPipelineCache()))));		// const VkPipelineCache                         pipelineCache
 			}
 	}
 
@@ -3258,7 +3257,9 @@ void MultisampleRenderer::initialize (Context&									context,
 																										 DE_NULL,								// const VkPipelineRasterizationStateCreateInfo* rasterizationStateCreateInfo
 																										 DE_NULL,								// const VkPipelineMultisampleStateCreateInfo*   multisampleStateCreateInfo
 																										 DE_NULL,								// const VkPipelineDepthStencilStateCreateInfo*  depthStencilStateCreateInfo
-																										 &colorBlendStateParams))));			// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																										 &colorBlendStateParams,				// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																										 DE_NULL,								// const VkPipelineDynamicStateCreateInfo*       dynamicStateCreateInfo
+																										 context.getPipelineCache()))));			// const VkPipelineCache                         pipelineCache
 			}
 		}
 
@@ -3559,9 +3560,15 @@ de::MovePtr<tcu::TextureLevel> MultisampleRenderer::render (void)
 	}
 }
 
-de::MovePtr<tcu::TextureLevel> MultisampleRenderer::getSingleSampledImage (deUint32 sampleId)
+void MultisampleRenderer::getSingleSampledImages (std::vector<tcu::TextureLevel>& dst)
 {
-	return readColorAttachment(m_context.getDeviceInterface(), m_context.getDevice(), m_context.getUniversalQueue(), m_context.getUniversalQueueFamilyIndex(), m_context.getDefaultAllocator(), *m_perSampleImages[sampleId]->m_image, m_colorFormat, m_renderSize.cast<deUint32>());
+	std::vector<VkImage> images;
+
+	for (size_t sampleId = 0; sampleId < m_perSampleImages.size(); sampleId++)
+		images.push_back(*m_perSampleImages[sampleId]->m_image);
+
+	// Read back all samples through the context staging ring in one submission
+	readColorAttachments(m_context.getDeviceInterface(), m_context.getStagingRing(), images, m_colorFormat, m_renderSize.cast<deUint32>(), dst);
 }
 
 // Multisample tests with subpasses using no attachments.
@@ -613,7 +613,10 @@ StencilTestInstance::StencilTestInstance (Context&					context,
 																&vertexInputStateParams,				// const VkPipelineVertexInputStateCreateInfo*   vertexInputStateCreateInfo
 																&rasterizationStateParams,				// const VkPipelineRasterizationStateCreateInfo* rasterizationStateCreateInfo
 																DE_NULL,								// const VkPipelineMultisampleStateCreateInfo*   multisampleStateCreateInfo
-																&depthStencilStateParams);				// const VkPipelineDepthStencilStateCreateInfo*  depthStencilStateCreateInfo
+																&depthStencilStateParams,				// const VkPipelineDepthStencilStateCreateInfo*  depthStencilStateCreateInfo
+																DE_NULL,								// const VkPipelineColorBlendStateCreateInfo*    colorBlendStateCreateInfo
+																DE_NULL,								// const VkPipelineDynamicStateCreateInfo*       dynamicStateCreateInfo
+																context.getPipelineCache());			// const VkPipelineCache                         pipelineCache
 		}
 	}
 
@@ -1573,12 +1573,7 @@ void VertexInputInstance::writeVertexInputValue (deUint8* destPtr, const VertexI
 
 tcu::TestStatus VertexInputInstance::iterate (void)
 {
-	const DeviceInterface&		vk			= m_context.getDeviceInterface();
-	const VkDevice				vkDevice	= m_context.getDevice();
-	const VkQueue				queue		= m_context.getUniversalQueue();
-
-	submitCommandsAndWait(vk, vkDevice, queue, m_cmdBuffer.get());
-
+	// Draw is submitted together with the readback in verifyImage()
 	return verifyImage();
 }
 
@@ -1640,7 +1635,11 @@ tcu::TestStatus VertexInputInstance::verifyImage (void)
 		const VkQueue					queue				= m_context.getUniversalQueue();
 		const deUint32					queueFamilyIndex	= m_context.getUniversalQueueFamilyIndex();
 		SimpleAllocator					allocator			(vk, vkDevice, getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-		de::MovePtr<tcu::TextureLevel>	result				= readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize);
+		SubmitBatch						drawBatch;
+
+		drawBatch.addCommandBuffer(*m_cmdBuffer);
+
+		de::MovePtr<tcu::TextureLevel>	result				= readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize, drawBatch);
 
 		compareOk = tcu::intThresholdPositionDeviationCompare(m_context.getTestContext().getLog(),
 															  "IntImageCompare",
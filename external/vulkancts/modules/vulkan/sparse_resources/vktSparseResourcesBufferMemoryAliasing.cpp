@@ -427,7 +427,7 @@ tcu::TestStatus BufferSparseMemoryAliasingInstance::iterate (void)
 		}
 
 		// Compare reference data with output data
-		if (deMemCmp(&referenceData[0], outputData, m_bufferSizeInBytes) != 0)
+		if (!verifySparseRegions(outputData, &referenceData[0], std::vector<SparseRegion>(1u, SparseRegion(0u, m_bufferSizeInBytes, SparseRegion::CONTENTS_REFERENCE))))
 			return tcu::TestStatus::fail("Failed");
 	}
 	return tcu::TestStatus::pass("Passed");
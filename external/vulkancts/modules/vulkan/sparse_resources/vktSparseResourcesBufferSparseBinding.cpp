@@ -337,7 +337,7 @@ tcu::TestStatus BufferSparseBindingInstance::iterate (void)
 		deviceInterface.queueWaitIdle(sparseQueue.queueHandle);
 
 		// Compare output data with reference data
-		if (deMemCmp(&referenceData[0], outputData, m_bufferSize) != 0)
+		if (!verifySparseRegions(outputData, &referenceData[0], std::vector<SparseRegion>(1u, SparseRegion(0u, m_bufferSize, SparseRegion::CONTENTS_REFERENCE))))
 			return tcu::TestStatus::fail("Failed");
 	}
 	return tcu::TestStatus::pass("Passed");
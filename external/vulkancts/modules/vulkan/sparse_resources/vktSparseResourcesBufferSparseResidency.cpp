@@ -390,7 +390,9 @@ tcu::TestStatus BufferSparseResidencyInstance::iterate (void)
 		// Wait for sparse queue to become idle
 		deviceInterface.queueWaitIdle(sparseQueue.queueHandle);
 
-		// Compare output data with reference data
+		// Compare output data with reference data, unbound slots read as zero only with residencyNonResidentStrict
+		std::vector<SparseRegion> regions;
+
 		for (deUint32 sparseBindNdx = 0; sparseBindNdx < numSparseSlots; ++sparseBindNdx)
 		{
 			const deUint32 alignment = static_cast<deUint32>(bufferMemRequirements.alignment);
@@ -398,18 +400,13 @@ tcu::TestStatus BufferSparseResidencyInstance::iterate (void)
 			const deUint32 size		 = sparseBindNdx == (numSparseSlots - 1) ? m_bufferSize % alignment : alignment;
 
 			if (sparseBindNdx % 2u == 0u)
-			{
-				if (deMemCmp(&referenceData[offset], outputData + offset, size) != 0)
-					return tcu::TestStatus::fail("Failed");
-			}
+				regions.push_back(SparseRegion(offset, size, SparseRegion::CONTENTS_REFERENCE));
 			else if (physicalDeviceProperties.sparseProperties.residencyNonResidentStrict)
-			{
-				deMemset(&referenceData[offset], 0u, size);
-
-				if (deMemCmp(&referenceData[offset], outputData + offset, size) != 0)
-					return tcu::TestStatus::fail("Failed");
-			}
+				regions.push_back(SparseRegion(offset, size, SparseRegion::CONTENTS_ZERO));
 		}
+
+		if (!verifySparseRegions(outputData, &referenceData[0], regions))
+			return tcu::TestStatus::fail("Failed");
 	}
 
 	return tcu::TestStatus::pass("Passed");
@@ -794,14 +794,18 @@ tcu::TestStatus ImageSparseMemoryAliasingInstance::iterate (void)
 				}
 			}
 
+			std::vector<SparseRegion> regions;
+
 			for (deUint32 mipmapNdx = aspectRequirements.imageMipTailFirstLod; mipmapNdx < imageSparseInfo.mipLevels; ++mipmapNdx)
 			{
 				const deUint32 mipLevelSizeInBytes	= getImageMipLevelSizeInBytes(imageSparseInfo.extent, imageSparseInfo.arrayLayers, formatDescription, planeNdx, mipmapNdx);
 				const deUint32 bufferOffset			= static_cast<deUint32>(bufferImageCopy[planeNdx*imageSparseInfo.mipLevels + mipmapNdx].bufferOffset);
 
-				if (deMemCmp(outputData + bufferOffset, &referenceData[bufferOffset], mipLevelSizeInBytes) != 0)
-					return tcu::TestStatus::fail("Failed");
+				regions.push_back(SparseRegion(bufferOffset, mipLevelSizeInBytes, SparseRegion::CONTENTS_REFERENCE));
 			}
+
+			if (!verifySparseRegions(outputData, &referenceData[0], regions))
+				return tcu::TestStatus::fail("Failed");
 		}
 	}
 
@@ -411,6 +411,8 @@ tcu::TestStatus ImageSparseBindingInstance::iterate (void)
 
 		const deUint8* outputData = static_cast<const deUint8*>(outputBufferAlloc->getHostPtr());
 
+		std::vector<SparseRegion> regions;
+
 		for (deUint32 planeNdx = 0; planeNdx < formatDescription.numPlanes; ++planeNdx)
 		{
 			for (deUint32 mipmapNdx = 0; mipmapNdx < imageSparseInfo.mipLevels; ++mipmapNdx)
@@ -418,10 +420,12 @@ tcu::TestStatus ImageSparseBindingInstance::iterate (void)
 				const deUint32 mipLevelSizeInBytes	= getImageMipLevelSizeInBytes(imageSparseInfo.extent, imageSparseInfo.arrayLayers, formatDescription, planeNdx, mipmapNdx);
 				const deUint32 bufferOffset			= static_cast<deUint32>(bufferImageCopy[ planeNdx * imageSparseInfo.mipLevels + mipmapNdx].bufferOffset);
 
-				if (deMemCmp(outputData + bufferOffset, &referenceData[bufferOffset], mipLevelSizeInBytes) != 0)
-					return tcu::TestStatus::fail("Failed");
+				regions.push_back(SparseRegion(bufferOffset, mipLevelSizeInBytes, SparseRegion::CONTENTS_REFERENCE));
 			}
 		}
+
+		if (!verifySparseRegions(outputData, &referenceData[0], regions))
+			return tcu::TestStatus::fail("Failed");
 	}
 
 	return tcu::TestStatus::pass("Passed");
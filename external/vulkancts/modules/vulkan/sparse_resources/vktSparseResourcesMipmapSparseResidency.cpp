@@ -542,6 +542,8 @@ tcu::TestStatus MipmapSparseResidencyInstance::iterate (void)
 		// Wait for sparse queue to become idle
 		deviceInterface.queueWaitIdle(sparseQueue.queueHandle);
 
+		std::vector<SparseRegion> regions;
+
 		for (deUint32 planeNdx = 0; planeNdx < formatDescription.numPlanes; ++planeNdx)
 		{
 			for (deUint32 mipmapNdx = 0; mipmapNdx < imageSparseInfo.mipLevels; ++mipmapNdx)
@@ -549,10 +551,12 @@ tcu::TestStatus MipmapSparseResidencyInstance::iterate (void)
 				const deUint32 mipLevelSizeInBytes	= getImageMipLevelSizeInBytes(imageSparseInfo.extent, imageSparseInfo.arrayLayers, formatDescription, planeNdx, mipmapNdx);
 				const deUint32 bufferOffset			= static_cast<deUint32>(bufferImageCopy[planeNdx*imageSparseInfo.mipLevels + mipmapNdx].bufferOffset);
 
-				if (deMemCmp(outputData + bufferOffset, &referenceData[bufferOffset], mipLevelSizeInBytes) != 0)
-					return tcu::TestStatus::fail("Failed");
+				regions.push_back(SparseRegion(bufferOffset, mipLevelSizeInBytes, SparseRegion::CONTENTS_REFERENCE));
 			}
 		}
+
+		if (!verifySparseRegions(outputData, &referenceData[0], regions))
+			return tcu::TestStatus::fail("Failed");
 	}
 	return tcu::TestStatus::pass("Passed");
 }
@@ -884,7 +884,8 @@ tcu::TestStatus SparseShaderIntrinsicsInstanceBase::iterate (void)
 	// Retrieve data from texels buffer to host memory
 	invalidateAlloc(deviceInterface, getDevice(), *bufferTexelsAlloc);
 
-	const deUint8* bufferTexelsData = static_cast<const deUint8*>(bufferTexelsAlloc->getHostPtr());
+	const deUint8*				bufferTexelsData	= static_cast<const deUint8*>(bufferTexelsAlloc->getHostPtr());
+	std::vector<SparseRegion>	regions;
 
 	for (deUint32 planeNdx = 0; planeNdx < formatDescription.numPlanes; ++planeNdx)
 	{
@@ -904,27 +905,20 @@ tcu::TestStatus SparseShaderIntrinsicsInstanceBase::iterate (void)
 			if (mipmapNdx < aspectRequirements.imageMipTailFirstLod)
 			{
 				if (mipmapNdx % MEMORY_BLOCK_TYPE_COUNT == MEMORY_BLOCK_BOUND)
-				{
-					if (deMemCmp(&bufferTexelsData[bufferOffset], &referenceData[bufferOffset], mipLevelSizeInBytes) != 0)
-						return tcu::TestStatus::fail("Failed");
-				}
+					regions.push_back(SparseRegion(bufferOffset, mipLevelSizeInBytes, SparseRegion::CONTENTS_REFERENCE));
 				else if (getPhysicalDeviceProperties(instance, physicalDevice).sparseProperties.residencyNonResidentStrict)
-				{
-					std::vector<deUint8> zeroData;
-					zeroData.assign(mipLevelSizeInBytes, 0u);
-
-					if (deMemCmp(&bufferTexelsData[bufferOffset], zeroData.data(), mipLevelSizeInBytes) != 0)
-						return tcu::TestStatus::fail("Failed");
-				}
+					regions.push_back(SparseRegion(bufferOffset, mipLevelSizeInBytes, SparseRegion::CONTENTS_ZERO));
 			}
 			else
 			{
-				if (deMemCmp(&bufferTexelsData[bufferOffset], &referenceData[bufferOffset], mipLevelSizeInBytes) != 0)
-					return tcu::TestStatus::fail("Failed");
+				regions.push_back(SparseRegion(bufferOffset, mipLevelSizeInBytes, SparseRegion::CONTENTS_REFERENCE));
 			}
 		}
 	}
 
+	if (!verifySparseRegions(bufferTexelsData, &referenceData[0], regions))
+		return tcu::TestStatus::fail("Failed");
+
 	return tcu::TestStatus::pass("Passed");
 }
 
@@ -27,6 +27,10 @@
 #include "vkTypeUtil.hpp"
 #include "tcuTextureUtil.hpp"
 #include "deStringUtil.hpp"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
+#include "deMemory.h"
+#include "deAtomic.h"
 
 #include <deMath.h>
 
@@ -1009,5 +1013,139 @@ vk::VkFormat getPlaneCompatibleFormatForWriting(const vk::PlanarFormatDescriptio
 	return result;
 }
 
+namespace
+{
+
+enum
+{
+	VERIFY_CHUNK_SIZE	= 1u << 20	//!< Bytes checked by a worker at a time
+};
+
+struct VerifyChunk
+{
+	const deUint8*	result;
+	const deUint8*	reference;	//!< Null if the chunk must be zero
+	size_t			size;
+};
+
+bool isZeroMemory (const deUint8* data, size_t size)
+{
+	// OR-reduce word-sized loads; compilers vectorize this loop
+	deUint64	accumulated	= 0u;
+	size_t		ndx			= 0u;
+
+	for (; ndx + sizeof(deUint64) <= size; ndx += sizeof(deUint64))
+	{
+		deUint64 word;
+		deMemcpy(&word, data + ndx, sizeof(word));
+		accumulated |= word;
+	}
+
+	for (; ndx < size; ++ndx)
+		accumulated |= data[ndx];
+
+	return accumulated == 0u;
+}
+
+bool verifyChunk (const VerifyChunk& chunk)
+{
+	if (chunk.reference)
+		return deMemCmp(chunk.result, chunk.reference, chunk.size) == 0;
+	else
+		return isZeroMemory(chunk.result, chunk.size);
+}
+
+class VerifyThread : public de::Thread
+{
+public:
+					VerifyThread	(const std::vector<VerifyChunk>& chunks, volatile deInt32* nextChunkNdx, volatile deInt32* failed)
+		: m_chunks			(chunks)
+		, m_nextChunkNdx	(nextChunkNdx)
+		, m_failed			(failed)
+	{
+	}
+
+	void			run				(void)
+	{
+		for (;;)
+		{
+			const size_t chunkNdx = (size_t)(deAtomicIncrement32(m_nextChunkNdx) - 1);
+
+			if (chunkNdx >= m_chunks.size() || *m_failed)
+				break;
+
+			if (!verifyChunk(m_chunks[chunkNdx]))
+			{
+				*m_failed = 1;
+				break;
+			}
+		}
+	}
+
+private:
+	const std::vector<VerifyChunk>&	m_chunks;
+	volatile deInt32*				m_nextChunkNdx;
+	volatile deInt32*				m_failed;
+};
+
+} // anonymous
+
+bool verifySparseRegions (const deUint8* result, const deUint8* reference, const std::vector<SparseRegion>& regions)
+{
+	std::vector<VerifyChunk> chunks;
+
+	for (size_t regionNdx = 0; regionNdx < regions.size(); ++regionNdx)
+	{
+		const SparseRegion& region = regions[regionNdx];
+
+		DE_ASSERT(region.contents < SparseRegion::CONTENTS_LAST);
+
+		for (size_t chunkOffset = 0; chunkOffset < region.size; chunkOffset += VERIFY_CHUNK_SIZE)
+		{
+			const VerifyChunk chunk =
+			{
+				result + region.offset + chunkOffset,
+				region.contents == SparseRegion::CONTENTS_REFERENCE ? reference + region.offset + chunkOffset : DE_NULL,
+				de::min<size_t>(VERIFY_CHUNK_SIZE, region.size - chunkOffset)
+			};
+
+			chunks.push_back(chunk);
+		}
+	}
+
+	{
+		const size_t numThreads = de::min<size_t>(chunks.size(), (size_t)deGetNumAvailableLogicalCores());
+
+		if (numThreads <= 1)
+		{
+			for (size_t chunkNdx = 0; chunkNdx < chunks.size(); ++chunkNdx)
+			{
+				if (!verifyChunk(chunks[chunkNdx]))
+					return false;
+			}
+
+			return true;
+		}
+		else
+		{
+			// Chunks are independent, stop handing them out after the first mismatch
+			volatile deInt32							nextChunkNdx	= 0;
+			volatile deInt32							failed			= 0;
+			std::vector<de::SharedPtr<VerifyThread> >	threads;
+
+			for (size_t threadNdx = 0; threadNdx < numThreads; ++threadNdx)
+			{
+				threads.push_back(de::SharedPtr<VerifyThread>(new VerifyThread(chunks, &nextChunkNdx, &failed)));
+				threads.back()->start();
+			}
+
+			for (size_t threadNdx = 0; threadNdx < numThreads; ++threadNdx)
+				threads[threadNdx]->join();
+
+			return failed == 0;
+		}
+	}
+}
+
 } // sparse
 } // vkt
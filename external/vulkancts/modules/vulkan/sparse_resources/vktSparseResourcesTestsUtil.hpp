@@ -269,6 +269,40 @@ inline const T* getDataOrNullptr (const std::vector<T>& vec, const std::size_t i
 	return (index < vec.size() ? &vec[index] : DE_NULL);
 }
 
+//! Byte range of a resource read back to host memory and the contents expected in it
+struct SparseRegion
+{
+	enum Contents
+	{
+		CONTENTS_REFERENCE = 0,	//!< Bound to memory, must match reference data
+		CONTENTS_ZERO,			//!< Not bound and residencyNonResidentStrict is supported, must read as zero
+
+		CONTENTS_LAST
+	};
+
+						SparseRegion	(std::size_t offset_, std::size_t size_, Contents contents_)
+							: offset	(offset_)
+							, size		(size_)
+							, contents	(contents_)
+						{
+						}
+
+	std::size_t			offset;
+	std::size_t			size;
+	Contents			contents;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Check result data against reference data over the given regions
+ *
+ * Regions are split into chunks that are checked on all available cores.
+ * Bytes outside the regions are not checked, so non-resident ranges with
+ * undefined contents are simply left out.
+ *//*--------------------------------------------------------------------*/
+bool								verifySparseRegions				(const deUint8*						result,
+																	 const deUint8*						reference,
+																	 const std::vector<SparseRegion>&	regions);
+
 } // sparse
 } // vkt
 
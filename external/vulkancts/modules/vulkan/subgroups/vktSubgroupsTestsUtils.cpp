@@ -60,6 +60,16 @@ deUint32 getNextWidth (const deUint32 width)
 	}
 }
 
+vector<deUint32> getFrameBufferTestWidths (void)
+{
+	vector<deUint32> widths;
+
+	for (deUint32 width = 1u; width < getMaxWidth(); width = getNextWidth(width))
+		widths.push_back(width);
+
+	return widths;
+}
+
 deUint32 getFormatSizeInBytes(const VkFormat format)
 {
 	switch (format)
@@ -2695,7 +2705,9 @@ tcu::TestStatus vkt::subgroups::makeTessellationEvaluationFrameBufferTestRequire
 	Buffer									vertexBuffer			(context, vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
 	unsigned								totalIterations			= 0u;
 	unsigned								failedIterations		= 0u;
-	Image									discardableImage		(context, maxWidth, 1u, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+	const vector<deUint32>					widths					= getFrameBufferTestWidths();
+	const deUint32							numWidths				= static_cast<deUint32>(widths.size());
+	Image									discardableImage		(context, maxWidth, numWidths, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
 
 	{
 		const Allocation&		alloc				= vertexBuffer.getAllocation();
@@ -2714,52 +2726,57 @@ tcu::TestStatus vkt::subgroups::makeTessellationEvaluationFrameBufferTestRequire
 		flushAlloc(vk, device, alloc);
 	}
 
-	const Unique<VkFramebuffer>	framebuffer			(makeFramebuffer(vk, device, *renderPass, discardableImage.getImageView(), maxWidth, 1u));
-	const VkViewport			viewport			= makeViewport(maxWidth, 1u);
-	const VkRect2D				scissor				= makeRect2D(maxWidth, 1u);
+	const Unique<VkFramebuffer>	framebuffer			(makeFramebuffer(vk, device, *renderPass, discardableImage.getImageView(), maxWidth, numWidths));
 	const vk::VkDeviceSize		imageResultSize		= tcu::getPixelSize(vk::mapVkFormat(format)) * maxWidth;
-	Buffer						imageBufferResult	(context, imageResultSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+	Buffer						imageBufferResult	(context, imageResultSize * numWidths, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
 	const VkDeviceSize			vertexBufferOffset	= 0u;
 
-	for (deUint32 width = 1u; width < maxWidth; width = getNextWidth(width))
+	// Every width is drawn to its own row of the image in a single render pass and submission
+	beginCommandBuffer(vk, *cmdBuffer);
 	{
-		totalIterations++;
+		beginRenderPass(vk, *cmdBuffer, *renderPass, *framebuffer, makeRect2D(0, 0, maxWidth, numWidths), tcu::Vec4(0.0f));
+
+		vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
 
-		beginCommandBuffer(vk, *cmdBuffer);
+		if (extraDataCount > 0)
 		{
+			vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipelineLayout, 0u, 1u,
+				&descriptorSet.get(), 0u, DE_NULL);
+		}
 
-			vk.cmdSetViewport(*cmdBuffer, 0, 1, &viewport);
-			vk.cmdSetScissor(*cmdBuffer, 0, 1, &scissor);
+		vk.cmdBindVertexBuffers(*cmdBuffer, 0u, 1u, vertexBuffer.getBufferPtr(), &vertexBufferOffset);
 
-			beginRenderPass(vk, *cmdBuffer, *renderPass, *framebuffer, makeRect2D(0, 0, maxWidth, 1u), tcu::Vec4(0.0f));
+		for (deUint32 row = 0u; row < numWidths; row++)
+		{
+			const VkViewport	viewport	= makeViewport(0.0f, static_cast<float>(row), static_cast<float>(maxWidth), 1.0f, 0.0f, 1.0f);
+			const VkRect2D		scissor		= makeRect2D(0, row, maxWidth, 1u);
 
-			vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+			vk.cmdSetViewport(*cmdBuffer, 0, 1, &viewport);
+			vk.cmdSetScissor(*cmdBuffer, 0, 1, &scissor);
 
-			if (extraDataCount > 0)
-			{
-				vk.cmdBindDescriptorSets(*cmdBuffer,
-					VK_PIPELINE_BIND_POINT_GRAPHICS, *pipelineLayout, 0u, 1u,
-					&descriptorSet.get(), 0u, DE_NULL);
-			}
+			vk.cmdDraw(*cmdBuffer, 2 * widths[row], 1, 0, 0);
+		}
 
-			vk.cmdBindVertexBuffers(*cmdBuffer, 0u, 1u, vertexBuffer.getBufferPtr(), &vertexBufferOffset);
-			vk.cmdDraw(*cmdBuffer, 2 * width, 1, 0, 0);
+		endRenderPass(vk, *cmdBuffer);
 
-			endRenderPass(vk, *cmdBuffer);
+		copyImageToBuffer(vk, *cmdBuffer, discardableImage.getImage(), imageBufferResult.getBuffer(), tcu::IVec2(maxWidth, numWidths), VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+	}
+	endCommandBuffer(vk, *cmdBuffer);
 
-			copyImageToBuffer(vk, *cmdBuffer, discardableImage.getImage(), imageBufferResult.getBuffer(), tcu::IVec2(maxWidth, 1), VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
-			endCommandBuffer(vk, *cmdBuffer);
+	submitCommandsAndWait(vk, device, queue, *cmdBuffer);
 
-			submitCommandsAndWait(vk, device, queue, *cmdBuffer);
-		}
+	{
+		const Allocation& allocResult = imageBufferResult.getAllocation();
+		invalidateAlloc(vk, device, allocResult);
 
+		for (deUint32 row = 0u; row < numWidths; row++)
 		{
-			const Allocation& allocResult = imageBufferResult.getAllocation();
-			invalidateAlloc(vk, device, allocResult);
-
 			std::vector<const void*> datas;
-			datas.push_back(allocResult.getHostPtr());
-			if (!checkResult(internalData, datas, width/2u, subgroupSize))
+			datas.push_back(static_cast<const deUint8*>(allocResult.getHostPtr()) + row * imageResultSize);
+
+			totalIterations++;
+
+			if (!checkResult(internalData, datas, widths[row]/2u, subgroupSize))
 				failedIterations++;
 		}
 	}
@@ -2924,7 +2941,9 @@ tcu::TestStatus vkt::subgroups::makeGeometryFrameBufferTestRequiredSubgroupSize(
 	Buffer									vertexBuffer			(context, vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
 	unsigned								totalIterations			= 0u;
 	unsigned								failedIterations		= 0u;
-	Image									discardableImage		(context, maxWidth, 1u, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+	const vector<deUint32>					widths					= getFrameBufferTestWidths();
+	const deUint32							numWidths				= static_cast<deUint32>(widths.size());
+	Image									discardableImage		(context, maxWidth, numWidths, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
 
 	{
 		const Allocation&		alloc				= vertexBuffer.getAllocation();
@@ -2942,59 +2961,57 @@ tcu::TestStatus vkt::subgroups::makeGeometryFrameBufferTestRequiredSubgroupSize(
 		flushAlloc(vk, device, alloc);
 	}
 
-	const Unique<VkFramebuffer>	framebuffer			(makeFramebuffer(vk, device, *renderPass, discardableImage.getImageView(), maxWidth, 1u));
-	const VkViewport			viewport			= makeViewport(maxWidth, 1u);
-	const VkRect2D				scissor				= makeRect2D(maxWidth, 1u);
+	const Unique<VkFramebuffer>	framebuffer			(makeFramebuffer(vk, device, *renderPass, discardableImage.getImageView(), maxWidth, numWidths));
 	const vk::VkDeviceSize		imageResultSize		= tcu::getPixelSize(vk::mapVkFormat(format)) * maxWidth;
-	Buffer						imageBufferResult	(context, imageResultSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+	Buffer						imageBufferResult	(context, imageResultSize * numWidths, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
 	const VkDeviceSize			vertexBufferOffset	= 0u;
 
-	for (deUint32 width = 1u; width < maxWidth; width = getNextWidth(width))
+	// Every width is drawn to its own row of the image in a single render pass and submission
+	beginCommandBuffer(vk, *cmdBuffer);
 	{
-		totalIterations++;
+		beginRenderPass(vk, *cmdBuffer, *renderPass, *framebuffer, makeRect2D(0, 0, maxWidth, numWidths), tcu::Vec4(0.0f));
+
+		vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
 
-		for (deUint32 ndx = 0u; ndx < inputBuffers.size(); ndx++)
+		if (extraDataCount > 0)
 		{
-			const Allocation& alloc = inputBuffers[ndx]->getAllocation();
-			initializeMemory(context, alloc, extraData[ndx]);
+			vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipelineLayout, 0u, 1u,
+				&descriptorSet.get(), 0u, DE_NULL);
 		}
 
-		beginCommandBuffer(vk, *cmdBuffer);
+		vk.cmdBindVertexBuffers(*cmdBuffer, 0u, 1u, vertexBuffer.getBufferPtr(), &vertexBufferOffset);
+
+		for (deUint32 row = 0u; row < numWidths; row++)
 		{
-			vk.cmdSetViewport(*cmdBuffer, 0, 1, &viewport);
+			const VkViewport	viewport	= makeViewport(0.0f, static_cast<float>(row), static_cast<float>(maxWidth), 1.0f, 0.0f, 1.0f);
+			const VkRect2D		scissor		= makeRect2D(0, row, maxWidth, 1u);
 
+			vk.cmdSetViewport(*cmdBuffer, 0, 1, &viewport);
 			vk.cmdSetScissor(*cmdBuffer, 0, 1, &scissor);
 
-			beginRenderPass(vk, *cmdBuffer, *renderPass, *framebuffer, makeRect2D(0, 0, maxWidth, 1u), tcu::Vec4(0.0f));
-
-			vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
-
-			if (extraDataCount > 0)
-			{
-				vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipelineLayout, 0u, 1u,
-					&descriptorSet.get(), 0u, DE_NULL);
-			}
-
-			vk.cmdBindVertexBuffers(*cmdBuffer, 0u, 1u, vertexBuffer.getBufferPtr(), &vertexBufferOffset);
-
-			vk.cmdDraw(*cmdBuffer, width, 1u, 0u, 0u);
+			vk.cmdDraw(*cmdBuffer, widths[row], 1u, 0u, 0u);
+		}
 
-			endRenderPass(vk, *cmdBuffer);
+		endRenderPass(vk, *cmdBuffer);
 
-			copyImageToBuffer(vk, *cmdBuffer, discardableImage.getImage(), imageBufferResult.getBuffer(), tcu::IVec2(maxWidth, 1), VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+		copyImageToBuffer(vk, *cmdBuffer, discardableImage.getImage(), imageBufferResult.getBuffer(), tcu::IVec2(maxWidth, numWidths), VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+	}
+	endCommandBuffer(vk, *cmdBuffer);
 
-			endCommandBuffer(vk, *cmdBuffer);
+	submitCommandsAndWait(vk, device, queue, *cmdBuffer);
 
-			submitCommandsAndWait(vk, device, queue, *cmdBuffer);
-		}
+	{
+		const Allocation& allocResult = imageBufferResult.getAllocation();
+		invalidateAlloc(vk, device, allocResult);
 
+		for (deUint32 row = 0u; row < numWidths; row++)
 		{
-			const Allocation& allocResult = imageBufferResult.getAllocation();
-			invalidateAlloc(vk, device, allocResult);
-
 			std::vector<const void*> datas;
-			datas.push_back(allocResult.getHostPtr());
-			if (!checkResult(internalData, datas, width, subgroupSize))
+			datas.push_back(static_cast<const deUint8*>(allocResult.getHostPtr()) + row * imageResultSize);
+
+			totalIterations++;
+
+			if (!checkResult(internalData, datas, widths[row], subgroupSize))
 				failedIterations++;
 		}
 	}
@@ -3473,7 +3490,9 @@ tcu::TestStatus vkt::subgroups::makeVertexFrameBufferTestRequiredSubgroupSize(Co
 	unsigned								totalIterations			= 0u;
 	unsigned								failedIterations		= 0u;
 
-	Image									discardableImage		(context, maxWidth, 1u, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+	const vector<deUint32>					widths					= getFrameBufferTestWidths();
+	const deUint32							numWidths				= static_cast<deUint32>(widths.size());
+	Image									discardableImage		(context, maxWidth, numWidths, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
 
 	{
 		const Allocation&		alloc				= vertexBuffer.getAllocation();
@@ -3491,59 +3510,57 @@ tcu::TestStatus vkt::subgroups::makeVertexFrameBufferTestRequiredSubgroupSize(Co
 		flushAlloc(vk, device, alloc);
 	}
 
-	const Unique<VkFramebuffer>	framebuffer			(makeFramebuffer(vk, device, *renderPass, discardableImage.getImageView(), maxWidth, 1u));
-	const VkViewport			viewport			= makeViewport(maxWidth, 1u);
-	const VkRect2D				scissor				= makeRect2D(maxWidth, 1u);
+	const Unique<VkFramebuffer>	framebuffer			(makeFramebuffer(vk, device, *renderPass, discardableImage.getImageView(), maxWidth, numWidths));
 	const vk::VkDeviceSize		imageResultSize		= tcu::getPixelSize(vk::mapVkFormat(format)) * maxWidth;
-	Buffer						imageBufferResult	(context, imageResultSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+	Buffer						imageBufferResult	(context, imageResultSize * numWidths, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
 	const VkDeviceSize			vertexBufferOffset	= 0u;
 
-	for (deUint32 width = 1u; width < maxWidth; width = getNextWidth(width))
+	// Every width is drawn to its own row of the image in a single render pass and submission
+	beginCommandBuffer(vk, *cmdBuffer);
 	{
-		totalIterations++;
+		beginRenderPass(vk, *cmdBuffer, *renderPass, *framebuffer, makeRect2D(0, 0, maxWidth, numWidths), tcu::Vec4(0.0f));
 
-		for (deUint32 ndx = 0u; ndx < inputBuffers.size(); ndx++)
+		vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+
+		if (extraDataCount > 0)
 		{
-			const Allocation& alloc = inputBuffers[ndx]->getAllocation();
-			initializeMemory(context, alloc, extraData[ndx]);
+			vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipelineLayout, 0u, 1u,
+				&descriptorSet.get(), 0u, DE_NULL);
 		}
 
-		beginCommandBuffer(vk, *cmdBuffer);
+		vk.cmdBindVertexBuffers(*cmdBuffer, 0u, 1u, vertexBuffer.getBufferPtr(), &vertexBufferOffset);
+
+		for (deUint32 row = 0u; row < numWidths; row++)
 		{
-			vk.cmdSetViewport(*cmdBuffer, 0, 1, &viewport);
+			const VkViewport	viewport	= makeViewport(0.0f, static_cast<float>(row), static_cast<float>(maxWidth), 1.0f, 0.0f, 1.0f);
+			const VkRect2D		scissor		= makeRect2D(0, row, maxWidth, 1u);
 
+			vk.cmdSetViewport(*cmdBuffer, 0, 1, &viewport);
 			vk.cmdSetScissor(*cmdBuffer, 0, 1, &scissor);
 
-			beginRenderPass(vk, *cmdBuffer, *renderPass, *framebuffer, makeRect2D(0, 0, maxWidth, 1u), tcu::Vec4(0.0f));
-
-			vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
-
-			if (extraDataCount > 0)
-			{
-				vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipelineLayout, 0u, 1u,
-					&descriptorSet.get(), 0u, DE_NULL);
-			}
-
-			vk.cmdBindVertexBuffers(*cmdBuffer, 0u, 1u, vertexBuffer.getBufferPtr(), &vertexBufferOffset);
-
-			vk.cmdDraw(*cmdBuffer, width, 1u, 0u, 0u);
+			vk.cmdDraw(*cmdBuffer, widths[row], 1u, 0u, 0u);
+		}
 
-			endRenderPass(vk, *cmdBuffer);
+		endRenderPass(vk, *cmdBuffer);
 
-			copyImageToBuffer(vk, *cmdBuffer, discardableImage.getImage(), imageBufferResult.getBuffer(), tcu::IVec2(maxWidth, 1), VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+		copyImageToBuffer(vk, *cmdBuffer, discardableImage.getImage(), imageBufferResult.getBuffer(), tcu::IVec2(maxWidth, numWidths), VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+	}
+	endCommandBuffer(vk, *cmdBuffer);
 
-			endCommandBuffer(vk, *cmdBuffer);
+	submitCommandsAndWait(vk, device, queue, *cmdBuffer);
 
-			submitCommandsAndWait(vk, device, queue, *cmdBuffer);
-		}
+	{
+		const Allocation& allocResult = imageBufferResult.getAllocation();
+		invalidateAlloc(vk, device, allocResult);
 
+		for (deUint32 row = 0u; row < numWidths; row++)
 		{
-			const Allocation& allocResult = imageBufferResult.getAllocation();
-			invalidateAlloc(vk, device, allocResult);
-
 			std::vector<const void*> datas;
-			datas.push_back(allocResult.getHostPtr());
-			if (!checkResult(internalData, datas, width, subgroupSize))
+			datas.push_back(static_cast<const deUint8*>(allocResult.getHostPtr()) + row * imageResultSize);
+
+			totalIterations++;
+
+			if (!checkResult(internalData, datas, widths[row], subgroupSize))
 				failedIterations++;
 		}
 	}
@@ -3849,30 +3866,25 @@ tcu::TestStatus vkt::subgroups::makeComputeTestRequiredSubgroupSize(
 	const VkQueue							queue					= context.getUniversalQueue();
 	const deUint32							queueFamilyIndex		= context.getUniversalQueueFamilyIndex();
 	VkDeviceSize							elementSize				= getFormatSizeInBytes(format);
+	const deUint32							numIterations			= localSizesToTestCount - 1;
 
-	VkDeviceSize maxSubgroupSize = maxSupportedSubgroupSize();
+	// All local sizes are dispatched in one submission, each writing its own region of the result
+	// buffer selected with a dynamic offset. Shaders index results by linear global invocation index.
+	VkDeviceSize maxInvocationCount = 0u;
 
-	if (isRequiredSubgroupSize)
+	for (deUint32 index = 0; index < numIterations; index++)
 	{
-		VkPhysicalDeviceSubgroupSizeControlPropertiesEXT subgroupSizeControlProperties;
-		subgroupSizeControlProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT;
-		subgroupSizeControlProperties.pNext = DE_NULL;
+		const VkDeviceSize invocationCount = (VkDeviceSize)numWorkgroups[0] * numWorkgroups[1] * numWorkgroups[2]
+										   * localSizesToTest[index][0] * localSizesToTest[index][1] * localSizesToTest[index][2];
 
-		VkPhysicalDeviceProperties2 properties2;
-		properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
-		properties2.pNext = &subgroupSizeControlProperties;
-		context.getInstanceInterface().getPhysicalDeviceProperties2(context.getPhysicalDevice(), &properties2);
-		maxSubgroupSize = deMax32(subgroupSizeControlProperties.maxSubgroupSize, static_cast<deUint32>(maxSubgroupSize));
+		maxInvocationCount = de::max(maxInvocationCount, invocationCount);
 	}
 
-	const VkDeviceSize resultBufferSize = maxSubgroupSize *
-										  maxSubgroupSize *
-										  maxSubgroupSize;
-
-	const VkDeviceSize resultBufferSizeInBytes = resultBufferSize * elementSize;
+	const VkDeviceSize resultBufferSizeInBytes = maxInvocationCount * elementSize;
+	const VkDeviceSize resultRegionSize = deAlign64(resultBufferSizeInBytes, context.getDeviceProperties().limits.minStorageBufferOffsetAlignment);
 
 	Buffer resultBuffer(
-		context, resultBufferSizeInBytes);
+		context, resultRegionSize * numIterations);
 
 	std::vector< de::SharedPtr<BufferOrImage> > inputBuffers(inputsCount);
 
@@ -3896,7 +3908,7 @@ tcu::TestStatus vkt::subgroups::makeComputeTestRequiredSubgroupSize(
 
 	DescriptorSetLayoutBuilder layoutBuilder;
 	layoutBuilder.addBinding(
-		resultBuffer.getType(), 1, VK_SHADER_STAGE_COMPUTE_BIT, DE_NULL);
+		VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_COMPUTE_BIT, DE_NULL);
 
 	for (deUint32 i = 0; i < inputsCount; i++)
 	{
@@ -3915,7 +3927,7 @@ tcu::TestStatus vkt::subgroups::makeComputeTestRequiredSubgroupSize(
 
 	DescriptorPoolBuilder poolBuilder;
 
-	poolBuilder.addType(resultBuffer.getType());
+	poolBuilder.addType(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC);
 
 	for (deUint32 i = 0; i < inputsCount; i++)
 	{
@@ -3937,7 +3949,7 @@ tcu::TestStatus vkt::subgroups::makeComputeTestRequiredSubgroupSize(
 
 	updateBuilder.writeSingle(*descriptorSet,
 							  DescriptorSetUpdateBuilder::Location::binding(0u),
-							  VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &resultDescriptorInfo);
+							  VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, &resultDescriptorInfo);
 
 	for (deUint32 i = 0; i < inputsCount; i++)
 	{
@@ -4001,54 +4013,67 @@ tcu::TestStatus vkt::subgroups::makeComputeTestRequiredSubgroupSize(
 		context.getTestContext().touchWatchdog();
 	}
 
-	for (deUint32 index = 0; index < (localSizesToTestCount - 1); index++)
+	beginCommandBuffer(vk, *cmdBuffer);
+
+	for (deUint32 index = 0; index < numIterations; index++)
 	{
+		const deUint32 dynamicOffset = static_cast<deUint32>(index * resultRegionSize);
 
-		// we are running one test
-		totalIterations++;
+		if (index > 0)
+		{
+			// Input buffers may be written by the shader, keep the dispatches ordered as separate submissions would
+			const VkMemoryBarrier barrier = makeMemoryBarrier(VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
 
-		beginCommandBuffer(vk, *cmdBuffer);
+			vk.cmdPipelineBarrier(*cmdBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0u, 1u, &barrier, 0u, DE_NULL, 0u, DE_NULL);
+		}
 
 		vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, **pipelines[index]);
 
 		vk.cmdBindDescriptorSets(*cmdBuffer,
 				VK_PIPELINE_BIND_POINT_COMPUTE, *pipelineLayout, 0u, 1u,
-				&descriptorSet.get(), 0u, DE_NULL);
+				&descriptorSet.get(), 1u, &dynamicOffset);
 
 		vk.cmdDispatch(*cmdBuffer,numWorkgroups[0], numWorkgroups[1], numWorkgroups[2]);
+	}
 
-		endCommandBuffer(vk, *cmdBuffer);
+	{
+		const VkMemoryBarrier barrier = makeMemoryBarrier(VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT);
 
-		submitCommandsAndWait(vk, device, queue, *cmdBuffer);
+		vk.cmdPipelineBarrier(*cmdBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0u, 1u, &barrier, 0u, DE_NULL, 0u, DE_NULL);
+	}
 
-		std::vector<const void*> datas;
+	endCommandBuffer(vk, *cmdBuffer);
 
-		{
-			const Allocation& resultAlloc = resultBuffer.getAllocation();
-			invalidateAlloc(vk, device, resultAlloc);
+	submitCommandsAndWait(vk, device, queue, *cmdBuffer);
 
-			// we always have our result data first
-			datas.push_back(resultAlloc.getHostPtr());
-		}
+	invalidateAlloc(vk, device, resultBuffer.getAllocation());
+
+	for (deUint32 i = 0; i < inputsCount; i++)
+	{
+		if (!inputBuffers[i]->isImage())
+			invalidateAlloc(vk, device, inputBuffers[i]->getAllocation());
+	}
+
+	for (deUint32 index = 0; index < numIterations; index++)
+	{
+		// we are running one test
+		totalIterations++;
+
+		std::vector<const void*> datas;
+
+		// we always have our result data first
+		datas.push_back(static_cast<const deUint8*>(resultBuffer.getAllocation().getHostPtr()) + index * resultRegionSize);
 
 		for (deUint32 i = 0; i < inputsCount; i++)
 		{
 			if (!inputBuffers[i]->isImage())
-			{
-				const Allocation& resultAlloc = inputBuffers[i]->getAllocation();
-				invalidateAlloc(vk, device, resultAlloc);
-
-				// we always have our result data first
-				datas.push_back(resultAlloc.getHostPtr());
-			}
+				datas.push_back(inputBuffers[i]->getAllocation().getHostPtr());
 		}
 
 		if (!checkResult(internalData, datas, numWorkgroups, localSizesToTest[index], subgroupSize))
 		{
 			failedIterations++;
 		}
-
-		vk.resetCommandBuffer(*cmdBuffer, 0);
 	}
 
 	if (0 < failedIterations)
@@ -816,8 +816,8 @@ void randomizeData(std::vector<deUint8>& outData, const ResourceDescription& des
 	de::Random	rng	(1234);
 
 	if (desc.type == RESOURCE_TYPE_BUFFER) {
-		for (deUint32 i = 0; i < outData.size(); i++)
-			outData[i] = rng.getUint8();
+		if (!outData.empty())
+			rng.fillBytes(&outData[0], outData.size());
 	} else {
 		const PlanarFormatDescription	planeDesc	= getPlanarFormatDescription(desc.imageFormat);
 		tcu::PixelBufferAccess			access		(mapVkFormat(desc.imageFormat),
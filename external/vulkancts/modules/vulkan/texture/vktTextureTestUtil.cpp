@@ -425,13 +425,12 @@ void TextureBinding::updateTextureData (const TestTextureSp& textureData, const
 		m_textureImageMemory = allocator.allocate(getImageMemoryRequirements(vkd, vkDevice, *m_textureImage), MemoryRequirement::Any);
 		VK_CHECK(vkd.bindImageMemory(vkDevice, *m_textureImage, m_textureImageMemory->getMemory(), m_textureImageMemory->getOffset()));
 
+		// Stage through the context ring instead of a buffer and command pool per texture
 		pipeline::uploadTestTexture	(vkd,
-									 vkDevice,
-									 m_context.getUniversalQueue(),
-									 m_context.getUniversalQueueFamilyIndex(),
-									 allocator,
+									 m_context.getStagingRing(),
 									 *m_textureData,
 									 *m_textureImage);
+		m_context.getStagingRing().submitAndWait();
 	}
 
 	updateTextureViewMipLevels(0, mipLevels - 1);
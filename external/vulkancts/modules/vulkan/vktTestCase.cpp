@@ -29,6 +29,7 @@
 #include "vkQueryUtil.hpp"
 #include "vkDeviceUtil.hpp"
 #include "vkMemUtil.hpp"
+#include "vkStagingRing.hpp"
 #include "vkPlatform.hpp"
 #include "vkDebugReportUtil.hpp"
 #include "vkDeviceFeatures.hpp"
@@ -36,11 +37,13 @@
 
 #include "tcuCommandLine.hpp"
 #include "tcuTestLog.hpp"
+#include "deMutex.hpp"
 
 #include "deSTLUtil.hpp"
 #include "deMemory.h"
 
 #include <set>
+#include <fstream>
 
 namespace vkt
 {
@@ -282,6 +285,76 @@ Move<VkDevice> createDefaultDevice (const PlatformInterface&			vkp,
 	return createDevice(vkp, instance, vki, physicalDevice, &deviceInfo);
 };
 
+// Counts the calls reported in DeviceStatistics, calls on other devices are not seen
+class StatisticsDeviceDriver : public DeviceDriver
+{
+public:
+								StatisticsDeviceDriver	(const PlatformInterface& platformInterface, VkInstance instance, VkDevice device)
+									: DeviceDriver	(platformInterface, instance, device)
+								{
+								}
+
+	VkResult					queueSubmit				(VkQueue queue, deUint32 submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const
+	{
+		{
+			const de::ScopedLock lock (m_lock);
+			m_statistics.numQueueSubmits += 1;
+		}
+
+		return DeviceDriver::queueSubmit(queue, submitCount, pSubmits, fence);
+	}
+
+	VkResult					allocateMemory			(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) const
+	{
+		const VkResult result = DeviceDriver::allocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+
+		if (result == VK_SUCCESS)
+		{
+			const de::ScopedLock lock (m_lock);
+			m_statistics.numMemoryAllocations	+= 1;
+			m_statistics.allocatedMemorySize	+= pAllocateInfo->allocationSize;
+		}
+
+		return result;
+	}
+
+	VkResult					createGraphicsPipelines	(VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+	{
+		{
+			const de::ScopedLock lock (m_lock);
+			m_statistics.numPipelinesCreated += createInfoCount;
+		}
+
+		return DeviceDriver::createGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	}
+
+	VkResult					createComputePipelines	(VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+	{
+		{
+			const de::ScopedLock lock (m_lock);
+			m_statistics.numPipelinesCreated += createInfoCount;
+		}
+
+		return DeviceDriver::createComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	}
+
+	DeviceStatistics			getStatistics			(void) const
+	{
+		const de::ScopedLock lock (m_lock);
+		return m_statistics;
+	}
+
+	void						resetStatistics			(void) const
+	{
+		const de::ScopedLock lock (m_lock);
+		m_statistics = DeviceStatistics();
+	}
+
+private:
+	mutable de::Mutex			m_lock;
+	mutable DeviceStatistics	m_statistics;
+};
+
 } // anonymous
 
 class DefaultDevice
@@ -325,6 +398,9 @@ public:
 	deUint32														getSparseQueueFamilyIndex				(void) const { return m_sparseQueueFamilyIndex;								}
 	VkQueue															getSparseQueue							(void) const;
 
+	DeviceStatistics												getStatistics							(void) const { return m_deviceInterface.getStatistics();					}
+	void															resetStatistics							(void) const { m_deviceInterface.resetStatistics();							}
+
 private:
 
 	const deUint32						m_maximumFrameworkVulkanVersion;
@@ -349,7 +425,7 @@ private:
 	const DeviceProperties				m_deviceProperties;
 
 	const Unique<VkDevice>				m_device;
-	const DeviceDriver					m_deviceInterface;
+	const StatisticsDeviceDriver		m_deviceInterface;
 };
 
 static deUint32 sanitizeApiVersion(deUint32 v)
@@ -411,6 +487,54 @@ vk::Allocator* createAllocator (DefaultDevice* device)
 	return new SimpleAllocator(device->getDeviceInterface(), device->getDevice(), memoryProperties);
 }
 
+// Pipeline cache utilities
+
+// Header written by vkGetPipelineCacheData(), see VkPipelineCacheHeaderVersion
+struct PipelineCacheHeader
+{
+	deUint32	headerSize;
+	deUint32	headerVersion;
+	deUint32	vendorID;
+	deUint32	deviceID;
+	deUint8		pipelineCacheUUID[VK_UUID_SIZE];
+};
+
+bool isPipelineCacheCompatible (const std::vector<deUint8>& data, const VkPhysicalDeviceProperties& properties)
+{
+	PipelineCacheHeader header;
+
+	if (data.size() < sizeof(header))
+		return false;
+
+	deMemcpy(&header, &data[0], sizeof(header));
+
+	return header.headerVersion	== VK_PIPELINE_CACHE_HEADER_VERSION_ONE	&&
+		   header.vendorID		== properties.vendorID					&&
+		   header.deviceID		== properties.deviceID					&&
+		   deMemCmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+std::vector<deUint8> readFile (const char* filename)
+{
+	std::ifstream			in		(filename, std::ios_base::binary);
+	std::vector<deUint8>	data;
+
+	if (in.is_open())
+	{
+		in.seekg(0, std::ios_base::end);
+		data.resize((size_t)in.tellg());
+		in.seekg(0, std::ios_base::beg);
+
+		if (!data.empty())
+			in.read((char*)&data[0], (std::streamsize)data.size());
+
+		if (!in.good())
+			data.clear();
+	}
+
+	return data;
+}
+
 } // anonymous
 
 // Context
@@ -425,10 +549,97 @@ Context::Context (tcu::TestContext&				testCtx,
 	, m_allocator				(createAllocator(m_device.get()))
 	, m_resultSetOnValidation	(false)
 {
+	if (*m_testCtx.getCommandLine().getPipelineCacheFilename() != 0)
+		loadPipelineCache();
 }
 
 Context::~Context (void)
 {
+	if (m_pipelineCache)
+	{
+		try
+		{
+			storePipelineCache();
+		}
+		catch (const std::exception& e)
+		{
+			tcu::print("WARNING: Failed to store pipeline cache: %s\n", e.what());
+		}
+	}
+}
+
+void Context::loadPipelineCache (void)
+{
+	const char* const				filename	= m_testCtx.getCommandLine().getPipelineCacheFilename();
+	std::vector<deUint8>			data		= readFile(filename);
+
+	// Data from another device or driver version would only be rejected by the driver
+	if (!data.empty() && !isPipelineCacheCompatible(data, getDeviceProperties()))
+	{
+		tcu::print("Pipeline cache in '%s' doesn't match current device, starting with an empty cache\n", filename);
+		data.clear();
+	}
+
+	{
+		const VkPipelineCacheCreateInfo	params	=
+		{
+			VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// VkStructureType				sType;
+			DE_NULL,										// const void*					pNext;
+			(VkPipelineCacheCreateFlags)0u,					// VkPipelineCacheCreateFlags	flags;
+			(deUintptr)data.size(),							// deUintptr					initialDataSize;
+			data.empty() ? DE_NULL : &data[0]				// const void*					pInitialData;
+		};
+
+		m_pipelineCache = createPipelineCache(getDeviceInterface(), getDevice(), &params);
+	}
+
+	tcu::print("Loaded %d bytes of pipeline cache from '%s'\n", (int)data.size(), filename);
+}
+
+void Context::storePipelineCache (void) const
+{
+	const char* const		filename	= m_testCtx.getCommandLine().getPipelineCacheFilename();
+	const DeviceInterface&	vkd			= getDeviceInterface();
+	deUintptr				dataSize	= 0;
+	std::vector<deUint8>	data;
+
+	VK_CHECK(vkd.getPipelineCacheData(getDevice(), *m_pipelineCache, &dataSize, DE_NULL));
+
+	data.resize(dataSize);
+
+	if (dataSize > 0)
+		VK_CHECK(vkd.getPipelineCacheData(getDevice(), *m_pipelineCache, &dataSize, &data[0]));
+
+	{
+		std::ofstream out (filename, std::ios_base::binary);
+
+		if (!data.empty())
+			out.write((const char*)&data[0], (std::streamsize)dataSize);
+
+		if (!out.good())
+			throw tcu::ResourceError(std::string("Failed to write ") + filename);
+	}
+
+	tcu::print("Stored %d bytes of pipeline cache to '%s'\n", (int)dataSize, filename);
+}
+
+vk::StagingRing& Context::getStagingRing (void)
+{
+	if (!m_stagingRing)
+		m_stagingRing = de::MovePtr<vk::StagingRing>(new vk::StagingRing(getDeviceInterface(), getDevice(), getUniversalQueue(), getUniversalQueueFamilyIndex(), getDefaultAllocator()));
+
+	return *m_stagingRing;
+}
+
+void Context::resetStagingRing (void)
+{
+	if (m_stagingRing)
+		m_stagingRing->reset();
+}
+
+void Context::releaseStagingRing (void)
+{
+	m_stagingRing.clear();
 }
 
 deUint32								Context::getMaximumFrameworkVulkanVersion	(void) const { return m_device->getMaximumFrameworkVulkanVersion();		}
@@ -533,6 +744,8 @@ vk::VkQueue								Context::getUniversalQueue					(void) const { return m_device
 deUint32								Context::getSparseQueueFamilyIndex			(void) const { return m_device->getSparseQueueFamilyIndex();	}
 vk::VkQueue								Context::getSparseQueue						(void) const { return m_device->getSparseQueue();				}
 vk::Allocator&							Context::getDefaultAllocator				(void) const { return *m_allocator;								}
+DeviceStatistics						Context::getDeviceStatistics				(void) const { return m_device->getStatistics();				}
+void									Context::resetDeviceStatistics				(void)		 { m_device->resetStatistics();							}
 deUint32								Context::getUsedApiVersion					(void) const { return m_device->getUsedApiVersion();			}
 bool									Context::contextSupports					(const deUint32 majorNum, const deUint32 minorNum, const deUint32 patchNum) const
 																							{ return m_device->getUsedApiVersion() >= VK_MAKE_VERSION(majorNum, minorNum, patchNum); }
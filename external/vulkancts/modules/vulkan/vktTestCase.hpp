@@ -26,6 +26,7 @@
 #include "tcuDefs.hpp"
 #include "tcuTestCase.hpp"
 #include "vkDefs.hpp"
+#include "vkRef.hpp"
 #include "deUniquePtr.hpp"
 #include "vkPrograms.hpp"
 #include "vkApiVersion.hpp"
@@ -44,6 +45,7 @@ namespace vk
 {
 class PlatformInterface;
 class Allocator;
+class StagingRing;
 struct SourceCollections;
 }
 
@@ -52,6 +54,23 @@ namespace vkt
 
 class DefaultDevice;
 
+//! Vulkan usage counters of the default device
+struct DeviceStatistics
+{
+	deUint64	numQueueSubmits;
+	deUint64	numPipelinesCreated;
+	deUint64	numMemoryAllocations;
+	deUint64	allocatedMemorySize;
+
+	DeviceStatistics (void)
+		: numQueueSubmits		(0)
+		, numPipelinesCreated	(0)
+		, numMemoryAllocations	(0)
+		, allocatedMemorySize	(0)
+	{
+	}
+};
+
 class Context
 {
 public:
@@ -96,6 +115,19 @@ public:
 	deUint32									getSparseQueueFamilyIndex			(void) const;
 	vk::VkQueue									getSparseQueue						(void) const;
 	vk::Allocator&								getDefaultAllocator					(void) const;
+
+	// Pipeline cache for the default device, DE_NULL unless enabled with --deqp-pipeline-cache-filename
+	vk::VkPipelineCache							getPipelineCache					(void) const { return *m_pipelineCache;	}
+
+	// Staging ring for the default device, created on first use and kept for the whole session
+	vk::StagingRing&							getStagingRing						(void);
+	void										resetStagingRing					(void);
+	void										releaseStagingRing					(void);
+
+	// Calls made through getDeviceInterface() since the last reset, reset by the executor before each test case
+	DeviceStatistics							getDeviceStatistics					(void) const;
+	void										resetDeviceStatistics				(void);
+
 	bool										contextSupports						(const deUint32 majorNum, const deUint32 minorNum, const deUint32 patchNum) const;
 	bool										contextSupports						(const vk::ApiVersion version) const;
 	bool										contextSupports						(const deUint32 requiredApiVersionBits) const;
@@ -117,10 +149,15 @@ protected:
 
 	const de::UniquePtr<DefaultDevice>			m_device;
 	const de::UniquePtr<vk::Allocator>			m_allocator;
+	de::MovePtr<vk::StagingRing>				m_stagingRing;
+	vk::Move<vk::VkPipelineCache>				m_pipelineCache;
 
 	bool										m_resultSetOnValidation;
 
 private:
+	void										loadPipelineCache					(void);
+	void										storePipelineCache					(void) const;
+
 												Context								(const Context&); // Not allowed
 	Context&									operator=							(const Context&); // Not allowed
 };
@@ -37,6 +37,9 @@ public:
 	{
 		de::UniquePtr<tcu::Resource> resource(archive.getResource(path));
 
+		if (const deUint8* const data = resource->getData())
+			return std::string(reinterpret_cast<const char*>(data), (size_t)resource->getSize());
+
 		std::vector<deUint8> readBuffer(resource->getSize() + 1);
 		resource->read(&readBuffer[0], resource->getSize());
 		readBuffer[readBuffer.size() - 1] = 0;
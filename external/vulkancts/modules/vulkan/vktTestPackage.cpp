@@ -38,7 +38,10 @@
 #include "vkApiVersion.hpp"
 #include "vkRenderDocUtil.hpp"
 
+#include "gluShaderLibrary.hpp"
+
 #include "deUniquePtr.hpp"
+#include "deClock.h"
 
 #include "vktTestGroupUtil.hpp"
 #include "vktApiTests.hpp"
@@ -101,6 +104,7 @@
 #include "vktShaderClockTests.hpp"
 #include "vktModifiersTests.hpp"
 #include "vktPostmortemTests.hpp"
+#include "vktPerformanceTests.hpp"
 
 #include <vector>
 #include <sstream>
@@ -218,6 +222,7 @@ private:
 	tcu::WaiverUtil								m_waiverMechanism;
 
 	TestInstance*								m_instance;			//!< Current test case instance
+	deUint64									m_programBuildTime;	//!< Time spent building programs of the current test case
 };
 
 static MovePtr<vk::Library> createLibrary (tcu::TestContext& testCtx)
@@ -250,6 +255,7 @@ TestCaseExecutor::TestCaseExecutor (tcu::TestContext& testCtx)
 							 : MovePtr<vk::RenderDocUtil>(DE_NULL))
 	, m_deviceProperties	(getPhysicalDeviceProperties(m_context))
 	, m_instance			(DE_NULL)
+	, m_programBuildTime	(0)
 {
 	tcu::SessionInfo sessionInfo(m_deviceProperties.vendorID,
 								 m_deviceProperties.deviceID,
@@ -265,6 +271,8 @@ TestCaseExecutor::TestCaseExecutor (tcu::TestContext& testCtx)
 TestCaseExecutor::~TestCaseExecutor (void)
 {
 	delete m_instance;
+
+	m_context.releaseStagingRing();
 }
 
 void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePath)
@@ -285,6 +293,9 @@ void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePat
 	if (!vktCase)
 		TCU_THROW(InternalError, "Test node not an instance of vkt::TestCase");
 
+	m_context.resetDeviceStatistics();
+	m_programBuildTime = 0;
+
 	if (m_waiverMechanism.isOnWaiverList(casePath))
 		throw tcu::TestException("Waived test", QP_TEST_RESULT_WAIVER);
 
@@ -292,6 +303,8 @@ void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePat
 
 	vktCase->delayedInit();
 
+	const deUint64 buildStartTime = deGetMicroseconds();
+
 	m_progCollection.clear();
 	vktCase->initPrograms(sourceProgs);
 
@@ -351,6 +364,8 @@ void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePat
 		buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, asmIterator, m_prebuiltBinRegistry, log, &m_progCollection, commandLine);
 	}
 
+	m_programBuildTime = deGetMicroseconds() - buildStartTime;
+
 	if (m_renderDoc) m_renderDoc->startFrame(m_context.getInstance());
 
 	DE_ASSERT(!m_instance);
@@ -363,6 +378,22 @@ void TestCaseExecutor::deinit (tcu::TestCase*)
 	delete m_instance;
 	m_instance = DE_NULL;
 
+	// Ring is kept for the session, but regions and dedicated buffers don't outlive the case
+	m_context.resetStagingRing();
+
+	{
+		const DeviceStatistics statistics = m_context.getDeviceStatistics();
+
+		m_context.getTestContext().getLog()
+			<< tcu::TestLog::Section("DeviceStatistics", "Default device usage in test case")
+			<< tcu::TestLog::Integer("ProgramBuildTime",		"Time spent building programs",		"us",		QP_KEY_TAG_TIME,	(deInt64)m_programBuildTime)
+			<< tcu::TestLog::Integer("QueueSubmits",			"vkQueueSubmit() calls",			"",			QP_KEY_TAG_NONE,	(deInt64)statistics.numQueueSubmits)
+			<< tcu::TestLog::Integer("PipelinesCreated",		"Graphics and compute pipelines",	"",			QP_KEY_TAG_NONE,	(deInt64)statistics.numPipelinesCreated)
+			<< tcu::TestLog::Integer("MemoryAllocations",		"vkAllocateMemory() calls",			"",			QP_KEY_TAG_NONE,	(deInt64)statistics.numMemoryAllocations)
+			<< tcu::TestLog::Integer("AllocatedDeviceMemory",	"Total size of allocations",		"bytes",	QP_KEY_TAG_NONE,	(deInt64)statistics.allocatedMemorySize)
+			<< tcu::TestLog::EndSection;
+	}
+
 	if (m_renderDoc) m_renderDoc->endFrame(m_context.getInstance());
 
 	// Collect and report any debug messages
@@ -425,12 +456,6 @@ void createGlslTests (tcu::TestCaseGroup* glslTests)
 		{ "swizzles",					"Swizzles"					},
 	};
 
-	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_es310Tests); ndx++)
-		glslTests->addChild(createShaderLibraryGroup(testCtx,
-													 s_es310Tests[ndx].name,
-													 s_es310Tests[ndx].description,
-													 std::string("vulkan/glsl/es310/") + s_es310Tests[ndx].name + ".test").release());
-
 	static const struct
 	{
 		const char*		name;
@@ -440,6 +465,27 @@ void createGlslTests (tcu::TestCaseGroup* glslTests)
 		{ "linkage",					"Linking"					},
 	};
 
+	// Parse all library files concurrently up front, groups pick up the results on init
+	{
+		std::vector<glu::sl::LibraryFile> files;
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_es310Tests); ndx++)
+			files.push_back(glu::sl::LibraryFile(std::string("vulkan/glsl/es310/") + s_es310Tests[ndx].name + ".test",
+												 std::string("dEQP-VK.glsl.") + s_es310Tests[ndx].name));
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_440Tests); ndx++)
+			files.push_back(glu::sl::LibraryFile(std::string("vulkan/glsl/440/") + s_440Tests[ndx].name + ".test",
+												 std::string("dEQP-VK.glsl.440.") + s_440Tests[ndx].name));
+
+		glu::sl::prefetchFiles(testCtx, files);
+	}
+
+	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_es310Tests); ndx++)
+		glslTests->addChild(createShaderLibraryGroup(testCtx,
+													 s_es310Tests[ndx].name,
+													 s_es310Tests[ndx].description,
+													 std::string("vulkan/glsl/es310/") + s_es310Tests[ndx].name + ".test").release());
+
 	de::MovePtr<tcu::TestCaseGroup> glsl440Tests = de::MovePtr<tcu::TestCaseGroup>(new tcu::TestCaseGroup(testCtx, "440", ""));
 
 	for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_440Tests); ndx++)
@@ -506,6 +552,15 @@ ExperimentalTestPackage::~ExperimentalTestPackage (void)
 {
 }
 
+PerformanceTestPackage::PerformanceTestPackage (tcu::TestContext& testCtx)
+	: BaseTestPackage(testCtx, "dEQP-VK-perf", "dEQP Vulkan Performance Tests")
+{
+}
+
+PerformanceTestPackage::~PerformanceTestPackage (void)
+{
+}
+
 tcu::TestCaseExecutor* BaseTestPackage::createExecutor (void) const
 {
 	return new TestCaseExecutor(m_testCtx);
@@ -559,4 +614,9 @@ void ExperimentalTestPackage::init (void)
 	addChild(postmortem::createTests			(m_testCtx));
 }
 
+void PerformanceTestPackage::init (void)
+{
+	addChild(performance::createTests			(m_testCtx));
+}
+
 } // vkt
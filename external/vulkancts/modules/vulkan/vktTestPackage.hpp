@@ -58,6 +58,15 @@ public:
 	virtual void				init					 (void);
 };
 
+class PerformanceTestPackage : public BaseTestPackage
+{
+public:
+								PerformanceTestPackage	(tcu::TestContext& testCtx);
+	virtual						~PerformanceTestPackage	(void);
+
+	virtual void				init					(void);
+};
+
 } // vkt
 
 #endif // _VKTTESTPACKAGE_HPP
@@ -35,5 +35,11 @@ static tcu::TestPackage* createExperimentalTestPackage (tcu::TestContext& testCt
 	return new vkt::ExperimentalTestPackage(testCtx);
 }
 
+static tcu::TestPackage* createPerformanceTestPackage (tcu::TestContext& testCtx)
+{
+	return new vkt::PerformanceTestPackage(testCtx);
+}
+
 tcu::TestPackageDescriptor g_vktPackageDescriptor("dEQP-VK", createTestPackage);
 tcu::TestPackageDescriptor g_vktExperimentalPackageDescriptor("dEQP-VK-experimental", createExperimentalTestPackage);
+tcu::TestPackageDescriptor g_vktPerformancePackageDescriptor("dEQP-VK-perf", createPerformanceTestPackage);
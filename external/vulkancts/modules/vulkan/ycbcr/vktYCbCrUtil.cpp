@@ -37,6 +37,9 @@
 
 #include "deSTLUtil.hpp"
 #include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
+#include "deThread.hpp"
+#include "deAtomic.h"
 
 namespace vkt
 {
@@ -228,16 +231,10 @@ void checkImageSupport (Context& context, VkFormat format, VkImageCreateFlags cr
 
 void fillRandom (de::Random* randomGen, MultiPlaneImageData* imageData)
 {
-	// \todo [pyry] Optimize, take into account bits that must be 0
+	// \todo [pyry] Take into account bits that must be 0
 
 	for (deUint32 planeNdx = 0; planeNdx < imageData->getDescription().numPlanes; ++planeNdx)
-	{
-		const size_t	planeSize	= imageData->getPlaneSize(planeNdx);
-		deUint8* const	planePtr	= (deUint8*)imageData->getPlanePtr(planeNdx);
-
-		for (size_t ndx = 0; ndx < planeSize; ++ndx)
-			planePtr[ndx] = randomGen->getUint8();
-	}
+		randomGen->fillBytes(imageData->getPlanePtr(planeNdx), imageData->getPlaneSize(planeNdx));
 }
 
 void fillGradient (MultiPlaneImageData* imageData, const tcu::Vec4& minVal, const tcu::Vec4& maxVal)
@@ -1200,24 +1197,84 @@ deUint32 getYCbCrFormatChannelCount (vk::VkFormat format)
 namespace
 {
 
+// Range expansion constants depend only on the range and the bit depth of the channel, so they
+// are computed once per format rather than for every filtered sample.
+struct RangeExpansion
+{
+	tcu::Interval	scale;		//!< Largest code value (narrow range)
+	tcu::Interval	offset;		//!< Chroma midpoint (full range) or code offset of zero (narrow range)
+	tcu::Interval	divisor;	//!< Number of codes in nominal range (narrow range)
+};
+
+RangeExpansion makeRangeExpansion (vk::VkSamplerYcbcrRange		range,
+								   const tcu::FloatFormat&		conversionFormat,
+								   const deUint32				bits,
+								   bool							isChroma)
+{
+	const deUint32	values		(0x1u << bits);
+	RangeExpansion	expansion;
+
+	switch (range)
+	{
+		case vk::VK_SAMPLER_YCBCR_RANGE_ITU_FULL:
+		{
+			if (isChroma)
+				expansion.offset = conversionFormat.roundOut(tcu::Interval((double)(0x1u << (bits - 1u)) / (double)((0x1u << bits) - 1u)), false);
+			break;
+		}
+
+		case vk::VK_SAMPLER_YCBCR_RANGE_ITU_NARROW:
+		{
+			expansion.scale		= tcu::Interval((double)(values - 1u));
+			expansion.offset	= tcu::Interval((double)((isChroma ? 128u : 16u) * (0x1u << (bits - 8u))));
+			expansion.divisor	= tcu::Interval((double)((isChroma ? 224u : 219u) * (0x1u << (bits - 8u))));
+			break;
+		}
+
+		default:
+			DE_FATAL("Unknown YCbCrRange");
+	}
+
+	return expansion;
+}
+
+struct RangeExpansionTable
+{
+	RangeExpansion	channel[3];
+};
+
+RangeExpansionTable makeRangeExpansionTable (vk::VkSamplerYcbcrModelConversion	colorModel,
+											 vk::VkSamplerYcbcrRange			range,
+											 const vector<tcu::FloatFormat>&	conversionFormat,
+											 const tcu::UVec4&					bitDepth)
+{
+	RangeExpansionTable table;
+
+	if (colorModel != vk::VK_SAMPLER_YCBCR_MODEL_CONVERSION_RGB_IDENTITY)
+	{
+		table.channel[0] = makeRangeExpansion(range, conversionFormat[0], bitDepth[0], true);
+		table.channel[1] = makeRangeExpansion(range, conversionFormat[1], bitDepth[1], false);
+		table.channel[2] = makeRangeExpansion(range, conversionFormat[2], bitDepth[2], true);
+	}
+
+	return table;
+}
+
 tcu::Interval rangeExpandChroma (vk::VkSamplerYcbcrRange		range,
 								 const tcu::FloatFormat&		conversionFormat,
-								 const deUint32					bits,
+								 const RangeExpansion&			expansion,
 								 const tcu::Interval&			sample)
 {
-	const deUint32	values	(0x1u << bits);
-
 	switch (range)
 	{
 		case vk::VK_SAMPLER_YCBCR_RANGE_ITU_FULL:
-			return conversionFormat.roundOut(sample - conversionFormat.roundOut(tcu::Interval((double)(0x1u << (bits - 1u)) / (double)((0x1u << bits) - 1u)), false), false);
+			return conversionFormat.roundOut(sample - expansion.offset, false);
 
 		case vk::VK_SAMPLER_YCBCR_RANGE_ITU_NARROW:
 		{
-			const tcu::Interval	a			(conversionFormat.roundOut(sample * tcu::Interval((double)(values - 1u)), false));
-			const tcu::Interval	dividend	(conversionFormat.roundOut(a - tcu::Interval((double)(128u * (0x1u << (bits - 8u)))), false));
-			const tcu::Interval	divisor		((double)(224u * (0x1u << (bits - 8u))));
-			const tcu::Interval	result		(conversionFormat.roundOut(dividend / divisor, false));
+			const tcu::Interval	a			(conversionFormat.roundOut(sample * expansion.scale, false));
+			const tcu::Interval	dividend	(conversionFormat.roundOut(a - expansion.offset, false));
+			const tcu::Interval	result		(conversionFormat.roundOut(dividend / expansion.divisor, false));
 
 			return result;
 		}
@@ -1230,11 +1287,9 @@ tcu::Interval rangeExpandChroma (vk::VkSamplerYcbcrRange		range,
 
 tcu::Interval rangeExpandLuma (vk::VkSamplerYcbcrRange		range,
 							   const tcu::FloatFormat&		conversionFormat,
-							   const deUint32				bits,
+							   const RangeExpansion&		expansion,
 							   const tcu::Interval&			sample)
 {
-	const deUint32	values	(0x1u << bits);
-
 	switch (range)
 	{
 		case vk::VK_SAMPLER_YCBCR_RANGE_ITU_FULL:
@@ -1242,10 +1297,9 @@ tcu::Interval rangeExpandLuma (vk::VkSamplerYcbcrRange		range,
 
 		case vk::VK_SAMPLER_YCBCR_RANGE_ITU_NARROW:
 		{
-			const tcu::Interval	a			(conversionFormat.roundOut(sample * tcu::Interval((double)(values - 1u)), false));
-			const tcu::Interval	dividend	(conversionFormat.roundOut(a - tcu::Interval((double)(16u * (0x1u << (bits - 8u)))), false));
-			const tcu::Interval	divisor		((double)(219u * (0x1u << (bits - 8u))));
-			const tcu::Interval	result		(conversionFormat.roundOut(dividend / divisor, false));
+			const tcu::Interval	a			(conversionFormat.roundOut(sample * expansion.scale, false));
+			const tcu::Interval	dividend	(conversionFormat.roundOut(a - expansion.offset, false));
+			const tcu::Interval	result		(conversionFormat.roundOut(dividend / expansion.divisor, false));
 
 			return result;
 		}
@@ -1276,7 +1330,7 @@ tcu::Interval clampMaybe (const tcu::Interval&	x,
 void convertColor (vk::VkSamplerYcbcrModelConversion	colorModel,
 				   vk::VkSamplerYcbcrRange				range,
 				   const vector<tcu::FloatFormat>&		conversionFormat,
-				   const tcu::UVec4&					bitDepth,
+				   const RangeExpansionTable&			rangeExpansion,
 				   const tcu::Interval					input[4],
 				   tcu::Interval						output[4])
 {
@@ -1291,9 +1345,9 @@ void convertColor (vk::VkSamplerYcbcrModelConversion	colorModel,
 
 		case vk::VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_IDENTITY:
 		{
-			output[0] = clampMaybe(rangeExpandChroma(range, conversionFormat[0], bitDepth[0], input[0]), -0.5, 0.5);
-			output[1] = clampMaybe(rangeExpandLuma(range, conversionFormat[1], bitDepth[1], input[1]), 0.0, 1.0);
-			output[2] = clampMaybe(rangeExpandChroma(range, conversionFormat[2], bitDepth[2], input[2]), -0.5, 0.5);
+			output[0] = clampMaybe(rangeExpandChroma(range, conversionFormat[0], rangeExpansion.channel[0], input[0]), -0.5, 0.5);
+			output[1] = clampMaybe(rangeExpandLuma(range, conversionFormat[1], rangeExpansion.channel[1], input[1]), 0.0, 1.0);
+			output[2] = clampMaybe(rangeExpandChroma(range, conversionFormat[2], rangeExpansion.channel[2], input[2]), -0.5, 0.5);
 			output[3] = input[3];
 			break;
 		}
@@ -1302,9 +1356,9 @@ void convertColor (vk::VkSamplerYcbcrModelConversion	colorModel,
 		case vk::VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_709:
 		case vk::VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_2020:
 		{
-			const tcu::Interval	y			(rangeExpandLuma(range, conversionFormat[1], bitDepth[1], input[1]));
-			const tcu::Interval	cr			(rangeExpandChroma(range, conversionFormat[0], bitDepth[0], input[0]));
-			const tcu::Interval	cb			(rangeExpandChroma(range, conversionFormat[2], bitDepth[2], input[2]));
+			const tcu::Interval	y			(rangeExpandLuma(range, conversionFormat[1], rangeExpansion.channel[1], input[1]));
+			const tcu::Interval	cr			(rangeExpandChroma(range, conversionFormat[0], rangeExpansion.channel[0], input[0]));
+			const tcu::Interval	cb			(rangeExpandChroma(range, conversionFormat[2], rangeExpansion.channel[2], input[2]));
 
 			const tcu::Interval	yClamped	(clampMaybe(y,   0.0, 1.0));
 			const tcu::Interval	crClamped	(clampMaybe(cr, -0.5, 0.5));
@@ -1581,43 +1635,131 @@ int divFloor (int a, int b)
 		return (a / b) - 1;
 }
 
-void calculateBounds (const ChannelAccess&				rPlane,
-					  const ChannelAccess&				gPlane,
-					  const ChannelAccess&				bPlane,
-					  const ChannelAccess&				aPlane,
-					  const UVec4&						bitDepth,
-					  const vector<Vec2>&				sts,
-					  const vector<FloatFormat>&		filteringFormat,
-					  const vector<FloatFormat>&		conversionFormat,
-					  const deUint32					subTexelPrecisionBits,
-					  vk::VkFilter						filter,
-					  vk::VkSamplerYcbcrModelConversion	colorModel,
-					  vk::VkSamplerYcbcrRange			range,
-					  vk::VkFilter						chromaFilter,
-					  vk::VkChromaLocation				xChromaOffset,
-					  vk::VkChromaLocation				yChromaOffset,
-					  const vk::VkComponentMapping&		componentMapping,
-					  bool								explicitReconstruction,
-					  vk::VkSamplerAddressMode			addressModeU,
-					  vk::VkSamplerAddressMode			addressModeV,
-					  std::vector<Vec4>&				minBounds,
-					  std::vector<Vec4>&				maxBounds,
-					  std::vector<Vec4>&				uvBounds,
-					  std::vector<IVec4>&				ijBounds)
+namespace
 {
-	const FloatFormat		highp			(-126, 127, 23, true,
-											 tcu::MAYBE,	// subnormals
-											 tcu::YES,		// infinities
-											 tcu::MAYBE);	// NaN
-	const FloatFormat		coordFormat		(-32, 32, 16, true);
-	const ChannelAccess&	rAccess			(swizzle(componentMapping.r, rPlane, rPlane, gPlane, bPlane, aPlane));
-	const ChannelAccess&	gAccess			(swizzle(componentMapping.g, gPlane, rPlane, gPlane, bPlane, aPlane));
-	const ChannelAccess&	bAccess			(swizzle(componentMapping.b, bPlane, rPlane, gPlane, bPlane, aPlane));
-	const ChannelAccess&	aAccess			(swizzle(componentMapping.a, aPlane, rPlane, gPlane, bPlane, aPlane));
 
-	const bool				subsampledX		= gAccess.getSize().x() > rAccess.getSize().x();
-	const bool				subsampledY		= gAccess.getSize().y() > rAccess.getSize().y();
+//! Bounds are computed in batches of consecutive samples, pulled by worker threads from a shared counter.
+class BoundsCalculator
+{
+public:
+	enum
+	{
+		BATCH_SIZE	= 256
+	};
 
+									BoundsCalculator	(const ChannelAccess&				rPlane,
+														 const ChannelAccess&				gPlane,
+														 const ChannelAccess&				bPlane,
+														 const ChannelAccess&				aPlane,
+														 const UVec4&						bitDepth,
+														 const vector<Vec2>&				sts,
+														 const vector<FloatFormat>&			filteringFormat,
+														 const vector<FloatFormat>&			conversionFormat,
+														 const deUint32						subTexelPrecisionBits,
+														 vk::VkFilter						filter,
+														 vk::VkSamplerYcbcrModelConversion	colorModel,
+														 vk::VkSamplerYcbcrRange			range,
+														 vk::VkFilter						chromaFilter,
+														 vk::VkChromaLocation				xChromaOffset,
+														 vk::VkChromaLocation				yChromaOffset,
+														 const vk::VkComponentMapping&		componentMapping,
+														 bool								explicitReconstruction,
+														 vk::VkSamplerAddressMode			addressModeU,
+														 vk::VkSamplerAddressMode			addressModeV,
+														 std::vector<Vec4>&					minBounds,
+														 std::vector<Vec4>&					maxBounds,
+														 std::vector<Vec4>&					uvBounds,
+														 std::vector<IVec4>&				ijBounds);
+
+	size_t							getNumBatches		(void) const { return (m_sts.size() + BATCH_SIZE - 1) / BATCH_SIZE; }
+	void							calculateBatch		(size_t batchNdx) const;
+
+private:
+	void							calculate			(size_t begin, size_t end) const;
+
+	const FloatFormat				m_highp;
+	const FloatFormat				m_coordFormat;
+	const ChannelAccess&			m_rAccess;
+	const ChannelAccess&			m_gAccess;
+	const ChannelAccess&			m_bAccess;
+	const ChannelAccess&			m_aAccess;
+	const bool						m_subsampledX;
+	const bool						m_subsampledY;
+	const RangeExpansionTable		m_rangeExpansion;
+
+	const vector<Vec2>&				m_sts;
+	const vector<FloatFormat>&		m_filteringFormat;
+	const vector<FloatFormat>&		m_conversionFormat;
+	const deUint32					m_subTexelPrecisionBits;
+	const vk::VkFilter				m_filter;
+	const vk::VkSamplerYcbcrModelConversion	m_colorModel;
+	const vk::VkSamplerYcbcrRange	m_range;
+	const vk::VkFilter				m_chromaFilter;
+	const vk::VkChromaLocation		m_xChromaOffset;
+	const vk::VkChromaLocation		m_yChromaOffset;
+	const bool						m_explicitReconstruction;
+	const vk::VkSamplerAddressMode	m_addressModeU;
+	const vk::VkSamplerAddressMode	m_addressModeV;
+
+	std::vector<Vec4>&				m_minBounds;
+	std::vector<Vec4>&				m_maxBounds;
+	std::vector<Vec4>&				m_uvBounds;
+	std::vector<IVec4>&				m_ijBounds;
+};
+
+BoundsCalculator::BoundsCalculator (const ChannelAccess&				rPlane,
+									const ChannelAccess&				gPlane,
+									const ChannelAccess&				bPlane,
+									const ChannelAccess&				aPlane,
+									const UVec4&						bitDepth,
+									const vector<Vec2>&					sts,
+									const vector<FloatFormat>&			filteringFormat,
+									const vector<FloatFormat>&			conversionFormat,
+									const deUint32						subTexelPrecisionBits,
+									vk::VkFilter						filter,
+									vk::VkSamplerYcbcrModelConversion	colorModel,
+									vk::VkSamplerYcbcrRange				range,
+									vk::VkFilter						chromaFilter,
+									vk::VkChromaLocation				xChromaOffset,
+									vk::VkChromaLocation				yChromaOffset,
+									const vk::VkComponentMapping&		componentMapping,
+									bool								explicitReconstruction,
+									vk::VkSamplerAddressMode			addressModeU,
+									vk::VkSamplerAddressMode			addressModeV,
+									std::vector<Vec4>&					minBounds,
+									std::vector<Vec4>&					maxBounds,
+									std::vector<Vec4>&					uvBounds,
+									std::vector<IVec4>&					ijBounds)
+	: m_highp					(-126, 127, 23, true,
+								 tcu::MAYBE,	// subnormals
+								 tcu::YES,		// infinities
+								 tcu::MAYBE)	// NaN
+	, m_coordFormat				(-32, 32, 16, true)
+	, m_rAccess					(swizzle(componentMapping.r, rPlane, rPlane, gPlane, bPlane, aPlane))
+	, m_gAccess					(swizzle(componentMapping.g, gPlane, rPlane, gPlane, bPlane, aPlane))
+	, m_bAccess					(swizzle(componentMapping.b, bPlane, rPlane, gPlane, bPlane, aPlane))
+	, m_aAccess					(swizzle(componentMapping.a, aPlane, rPlane, gPlane, bPlane, aPlane))
+	, m_subsampledX				(m_gAccess.getSize().x() > m_rAccess.getSize().x())
+	, m_subsampledY				(m_gAccess.getSize().y() > m_rAccess.getSize().y())
+	, m_rangeExpansion			(makeRangeExpansionTable(colorModel, range, conversionFormat, bitDepth))
+	, m_sts						(sts)
+	, m_filteringFormat			(filteringFormat)
+	, m_conversionFormat		(conversionFormat)
+	, m_subTexelPrecisionBits	(subTexelPrecisionBits)
+	, m_filter					(filter)
+	, m_colorModel				(colorModel)
+	, m_range					(range)
+	, m_chromaFilter			(chromaFilter)
+	, m_xChromaOffset			(xChromaOffset)
+	, m_yChromaOffset			(yChromaOffset)
+	, m_explicitReconstruction	(explicitReconstruction)
+	, m_addressModeU			(addressModeU)
+	, m_addressModeV			(addressModeV)
+	, m_minBounds				(minBounds)
+	, m_maxBounds				(maxBounds)
+	, m_uvBounds				(uvBounds)
+	, m_ijBounds				(ijBounds)
+{
 	minBounds.resize(sts.size(), Vec4(TCU_INFINITY));
 	maxBounds.resize(sts.size(), Vec4(-TCU_INFINITY));
 
@@ -1625,21 +1767,58 @@ void calculateBounds (const ChannelAccess&				rPlane,
 	ijBounds.resize(sts.size(), IVec4(0x7FFFFFFF, -1 -0x7FFFFFFF, 0x7FFFFFFF, -1 -0x7FFFFFFF));
 
 	// Chroma plane sizes must match
-	DE_ASSERT(rAccess.getSize() == bAccess.getSize());
+	DE_ASSERT(m_rAccess.getSize() == m_bAccess.getSize());
 
 	// Luma plane sizes must match
-	DE_ASSERT(gAccess.getSize() == aAccess.getSize());
+	DE_ASSERT(m_gAccess.getSize() == m_aAccess.getSize());
 
 	// Luma plane size must match chroma plane or be twice as big
-	DE_ASSERT(rAccess.getSize().x() == gAccess.getSize().x() || 2 * rAccess.getSize().x() == gAccess.getSize().x());
-	DE_ASSERT(rAccess.getSize().y() == gAccess.getSize().y() || 2 * rAccess.getSize().y() == gAccess.getSize().y());
+	DE_ASSERT(m_rAccess.getSize().x() == m_gAccess.getSize().x() || 2 * m_rAccess.getSize().x() == m_gAccess.getSize().x());
+	DE_ASSERT(m_rAccess.getSize().y() == m_gAccess.getSize().y() || 2 * m_rAccess.getSize().y() == m_gAccess.getSize().y());
 
 	DE_ASSERT(filter == vk::VK_FILTER_NEAREST || filter == vk::VK_FILTER_LINEAR);
 	DE_ASSERT(chromaFilter == vk::VK_FILTER_NEAREST || chromaFilter == vk::VK_FILTER_LINEAR);
-	DE_ASSERT(subsampledX || !subsampledY);
+	DE_ASSERT(m_subsampledX || !m_subsampledY);
+}
 
+void BoundsCalculator::calculateBatch (size_t batchNdx) const
+{
+	const size_t	begin	= batchNdx * BATCH_SIZE;
+	const size_t	end		= de::min(begin + BATCH_SIZE, m_sts.size());
+
+	calculate(begin, end);
+}
 
-	for (size_t ndx = 0; ndx < sts.size(); ndx++)
+void BoundsCalculator::calculate (size_t begin, size_t end) const
+{
+	const FloatFormat&					highp					= m_highp;
+	const FloatFormat&					coordFormat				= m_coordFormat;
+	const ChannelAccess&				rAccess					= m_rAccess;
+	const ChannelAccess&				gAccess					= m_gAccess;
+	const ChannelAccess&				bAccess					= m_bAccess;
+	const ChannelAccess&				aAccess					= m_aAccess;
+	const bool							subsampledX				= m_subsampledX;
+	const bool							subsampledY				= m_subsampledY;
+	const RangeExpansionTable&			rangeExpansion			= m_rangeExpansion;
+	const vector<Vec2>&					sts						= m_sts;
+	const vector<FloatFormat>&			filteringFormat			= m_filteringFormat;
+	const vector<FloatFormat>&			conversionFormat		= m_conversionFormat;
+	const deUint32						subTexelPrecisionBits	= m_subTexelPrecisionBits;
+	const vk::VkFilter					filter					= m_filter;
+	const vk::VkSamplerYcbcrModelConversion	colorModel			= m_colorModel;
+	const vk::VkSamplerYcbcrRange		range					= m_range;
+	const vk::VkFilter					chromaFilter			= m_chromaFilter;
+	const vk::VkChromaLocation			xChromaOffset			= m_xChromaOffset;
+	const vk::VkChromaLocation			yChromaOffset			= m_yChromaOffset;
+	const bool							explicitReconstruction	= m_explicitReconstruction;
+	const vk::VkSamplerAddressMode		addressModeU			= m_addressModeU;
+	const vk::VkSamplerAddressMode		addressModeV			= m_addressModeV;
+	std::vector<Vec4>&					minBounds				= m_minBounds;
+	std::vector<Vec4>&					maxBounds				= m_maxBounds;
+	std::vector<Vec4>&					uvBounds				= m_uvBounds;
+	std::vector<IVec4>&					ijBounds				= m_ijBounds;
+
+	for (size_t ndx = begin; ndx < end; ndx++)
 	{
 		const Vec2	st		(sts[ndx]);
 		Interval	bounds[4];
@@ -1704,7 +1883,7 @@ void calculateBounds (const ChannelAccess&				rPlane,
 					};
 					Interval dstColor[4];
 
-					convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
+					convertColor(colorModel, range, conversionFormat, rangeExpansion, srcColor, dstColor);
 
 					for (size_t compNdx = 0; compNdx < 4; compNdx++)
 						bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
@@ -1746,7 +1925,7 @@ void calculateBounds (const ChannelAccess&				rPlane,
 						};
 
 						Interval dstColor[4];
-						convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
+						convertColor(colorModel, range, conversionFormat, rangeExpansion, srcColor, dstColor);
 
 						for (size_t compNdx = 0; compNdx < 4; compNdx++)
 							bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
@@ -1818,7 +1997,7 @@ void calculateBounds (const ChannelAccess&				rPlane,
 					};
 					Interval dstColor[4];
 
-					convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
+					convertColor(colorModel, range, conversionFormat, rangeExpansion, srcColor, dstColor);
 
 					for (size_t compNdx = 0; compNdx < 4; compNdx++)
 						bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
@@ -1859,7 +2038,7 @@ void calculateBounds (const ChannelAccess&				rPlane,
 							aValue
 						};
 						Interval dstColor[4];
-						convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
+						convertColor(colorModel, range, conversionFormat, rangeExpansion, srcColor, dstColor);
 
 						for (size_t compNdx = 0; compNdx < 4; compNdx++)
 							bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
@@ -1873,6 +2052,89 @@ void calculateBounds (const ChannelAccess&				rPlane,
 	}
 }
 
+class BoundsThread : public de::Thread
+{
+public:
+					BoundsThread	(const BoundsCalculator& calculator, volatile deInt32* nextBatchNdx)
+		: m_calculator		(calculator)
+		, m_nextBatchNdx	(nextBatchNdx)
+	{
+	}
+
+	void			run				(void)
+	{
+		const size_t numBatches = m_calculator.getNumBatches();
+
+		for (;;)
+		{
+			const size_t batchNdx = (size_t)(deAtomicIncrement32(m_nextBatchNdx) - 1);
+
+			if (batchNdx >= numBatches)
+				break;
+
+			m_calculator.calculateBatch(batchNdx);
+		}
+	}
+
+private:
+	const BoundsCalculator&	m_calculator;
+	volatile deInt32*		m_nextBatchNdx;
+};
+
+} // anonymous
+
+void calculateBounds (const ChannelAccess&				rPlane,
+					  const ChannelAccess&				gPlane,
+					  const ChannelAccess&				bPlane,
+					  const ChannelAccess&				aPlane,
+					  const UVec4&						bitDepth,
+					  const vector<Vec2>&				sts,
+					  const vector<FloatFormat>&		filteringFormat,
+					  const vector<FloatFormat>&		conversionFormat,
+					  const deUint32					subTexelPrecisionBits,
+					  vk::VkFilter						filter,
+					  vk::VkSamplerYcbcrModelConversion	colorModel,
+					  vk::VkSamplerYcbcrRange			range,
+					  vk::VkFilter						chromaFilter,
+					  vk::VkChromaLocation				xChromaOffset,
+					  vk::VkChromaLocation				yChromaOffset,
+					  const vk::VkComponentMapping&		componentMapping,
+					  bool								explicitReconstruction,
+					  vk::VkSamplerAddressMode			addressModeU,
+					  vk::VkSamplerAddressMode			addressModeV,
+					  std::vector<Vec4>&				minBounds,
+					  std::vector<Vec4>&				maxBounds,
+					  std::vector<Vec4>&				uvBounds,
+					  std::vector<IVec4>&				ijBounds)
+{
+	const BoundsCalculator	calculator	(rPlane, gPlane, bPlane, aPlane, bitDepth, sts, filteringFormat, conversionFormat, subTexelPrecisionBits,
+										 filter, colorModel, range, chromaFilter, xChromaOffset, yChromaOffset, componentMapping, explicitReconstruction,
+										 addressModeU, addressModeV, minBounds, maxBounds, uvBounds, ijBounds);
+	const size_t			numBatches	= calculator.getNumBatches();
+	const size_t			numThreads	= de::min<size_t>(numBatches, (size_t)deGetNumAvailableLogicalCores());
+
+	if (numThreads <= 1)
+	{
+		for (size_t batchNdx = 0; batchNdx < numBatches; batchNdx++)
+			calculator.calculateBatch(batchNdx);
+	}
+	else
+	{
+		// Every sample is independent and written to its own output slot, so batches can be processed in any order
+		volatile deInt32							nextBatchNdx	= 0;
+		vector<de::SharedPtr<BoundsThread> >		threads;
+
+		for (size_t threadNdx = 0; threadNdx < numThreads; threadNdx++)
+		{
+			threads.push_back(de::SharedPtr<BoundsThread>(new BoundsThread(calculator, &nextBatchNdx)));
+			threads.back()->start();
+		}
+
+		for (size_t threadNdx = 0; threadNdx < numThreads; threadNdx++)
+			threads[threadNdx]->join();
+	}
+}
+
 } // ycbcr
 
 } // vkt
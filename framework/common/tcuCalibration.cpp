@@ -1,6 +1,6 @@
 /*-------------------------------------------------------------------------
- * drawElements Quality Program OpenGL (ES) Module
- * -----------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
  *
  * Copyright 2014 The Android Open Source Project
  *
@@ -21,7 +21,7 @@
  * \brief Calibration tools.
  *//*--------------------------------------------------------------------*/
 
-#include "glsCalibration.hpp"
+#include "tcuCalibration.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuVectorUtil.hpp"
 #include "deStringUtil.hpp"
@@ -33,14 +33,7 @@
 
 using std::string;
 using std::vector;
-using tcu::Vec2;
-using tcu::TestLog;
-using tcu::TestNode;
-using namespace glu;
-
-namespace deqp
-{
-namespace gls
+namespace tcu
 {
 
 // Reorders input arbitrarily, linear complexity and no allocations
@@ -57,7 +50,7 @@ float destructiveMedian (vector<T>& data)
 		return *mid;
 }
 
-LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints)
+LineParameters theilSenLinearRegression (const std::vector<Vec2>& dataPoints)
 {
 	const float		epsilon					= 1e-6f;
 
@@ -114,10 +107,10 @@ static float linearSample (const std::vector<T>& values, float position)
 	DE_ASSERT(higherNdx >= 0 && higherNdx < (int)values.size());
 	DE_ASSERT(interpolationFactor >= 0 && interpolationFactor < 1.0f);
 
-	return tcu::mix((float)values[lowerNdx], (float)values[higherNdx], interpolationFactor);
+	return mix((float)values[lowerNdx], (float)values[higherNdx], interpolationFactor);
 }
 
-LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence)
+LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<Vec2>& dataPoints, float reportedConfidence)
 {
 	DE_ASSERT(!dataPoints.empty());
 
@@ -132,14 +125,14 @@ LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<t
 	// Compute the median slope via each element
 	for (int i = 0; i < numDataPoints; i++)
 	{
-		const tcu::Vec2&	ptA		= dataPoints[i];
+		const Vec2&	ptA		= dataPoints[i];
 		std::vector<float>	slopes;
 
 		slopes.reserve(numDataPoints);
 
 		for (int j = 0; j < numDataPoints; j++)
 		{
-			const tcu::Vec2& ptB = dataPoints[j];
+			const Vec2& ptB = dataPoints[j];
 
 			if (de::abs(ptA.x() - ptB.x()) > epsilon)
 				slopes.push_back((ptA.y() - ptB.y()) / (ptA.x() - ptB.x()));
@@ -392,7 +385,7 @@ void TheilSenCalibrator::recomputeParameters (void)
 	}
 }
 
-void logCalibrationInfo (tcu::TestLog& log, const TheilSenCalibrator& calibrator)
+void logCalibrationInfo (TestLog& log, const TheilSenCalibrator& calibrator)
 {
 	const CalibratorParameters&				params				= calibrator.getParameters();
 	const std::vector<CalibrateIteration>&	calibrateIterations	= calibrator.getCalibrationInfo();
@@ -413,5 +406,4 @@ void logCalibrationInfo (tcu::TestLog& log, const TheilSenCalibrator& calibrator
 	log << TestLog::EndSection;
 }
 
-} // gls
-} // deqp
+} // tcu
@@ -90,6 +90,8 @@ DE_DECLARE_COMMAND_LINE_OPT(ArchiveDir,					std::string);
 DE_DECLARE_COMMAND_LINE_OPT(VKDeviceID,					int);
 DE_DECLARE_COMMAND_LINE_OPT(VKDeviceGroupID,			int);
 DE_DECLARE_COMMAND_LINE_OPT(LogFlush,					bool);
+DE_DECLARE_COMMAND_LINE_OPT(LogAsync,					bool);
+DE_DECLARE_COMMAND_LINE_OPT(LogSharedRing,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(Validation,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(PrintValidationErrors,		bool);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCache,				bool);
@@ -97,9 +99,12 @@ DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheFilename,		std::string);
 DE_DECLARE_COMMAND_LINE_OPT(Optimization,				int);
 DE_DECLARE_COMMAND_LINE_OPT(OptimizeSpirv,				bool);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheTruncate,		bool);
+DE_DECLARE_COMMAND_LINE_OPT(PipelineCacheFilename,		std::string);
+DE_DECLARE_COMMAND_LINE_OPT(TraceFilename,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(RenderDoc,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(CaseFraction,				std::vector<int>);
 DE_DECLARE_COMMAND_LINE_OPT(CaseFractionMandatoryTests,	std::string);
+DE_DECLARE_COMMAND_LINE_OPT(CaseFractionHistoryFile,	std::string);
 DE_DECLARE_COMMAND_LINE_OPT(WaiverFile,					std::string);
 
 static void parseIntList (const char* src, std::vector<int>* dst)
@@ -190,6 +195,8 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<TestOOM>						(DE_NULL,	"deqp-test-oom",							"Run tests that exhaust memory on purpose",			s_enableNames,		TEST_OOM_DEFAULT)
 		<< Option<ArchiveDir>					(DE_NULL,	"deqp-archive-dir",							"Path to test resource files",											".")
 		<< Option<LogFlush>						(DE_NULL,	"deqp-log-flush",							"Enable or disable log file fflush",				s_enableNames,		"enable")
+		<< Option<LogAsync>						(DE_NULL,	"deqp-log-async",							"Write log file from a separate I/O thread",		s_enableNames,		"disable")
+		<< Option<LogSharedRing>				(DE_NULL,	"deqp-log-shm",								"Stream log to shared memory ring created by execserver, log file is used as fallback")
 		<< Option<Validation>					(DE_NULL,	"deqp-validation",							"Enable or disable test case validation",			s_enableNames,		"disable")
 		<< Option<PrintValidationErrors>		(DE_NULL,	"deqp-print-validation-errors",				"Print validation errors to standard error")
 		<< Option<Optimization>					(DE_NULL,	"deqp-optimization-recipe",					"Shader optimization recipe (0=disabled, 1=performance, 2=size)",		"0")
@@ -197,9 +204,12 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<ShaderCache>					(DE_NULL,	"deqp-shadercache",							"Enable or disable shader cache",					s_enableNames,		"enable")
 		<< Option<ShaderCacheFilename>			(DE_NULL,	"deqp-shadercache-filename",				"Write shader cache to given file",										"shadercache.bin")
 		<< Option<ShaderCacheTruncate>			(DE_NULL,	"deqp-shadercache-truncate",				"Truncate shader cache before running tests",		s_enableNames,		"enable")
+		<< Option<PipelineCacheFilename>		(DE_NULL,	"deqp-pipeline-cache-filename",				"Load and store Vulkan pipeline cache in given file",					"")
+		<< Option<TraceFilename>				(DE_NULL,	"deqp-trace-filename",						"Trace execution and write Chrome trace events to given file",			"")
 		<< Option<RenderDoc>					(DE_NULL,	"deqp-renderdoc",							"Enable RenderDoc frame markers",					s_enableNames,		"disable")
 		<< Option<CaseFraction>					(DE_NULL,	"deqp-fraction",							"Run a fraction of the test cases (e.g. N,M means run group%M==N)",	parseIntList,	"")
 		<< Option<CaseFractionMandatoryTests>	(DE_NULL,	"deqp-fraction-mandatory-caselist-file",	"Case list file that must be run for each fraction",					"")
+		<< Option<CaseFractionHistoryFile>		(DE_NULL,	"deqp-fraction-history-file",				"Balance fractions using case durations from given file",				"")
 		<< Option<WaiverFile>					(DE_NULL,	"deqp-waiver-file",							"Read waived tests from given file",									"");
 }
 
@@ -780,6 +790,9 @@ bool CommandLine::parse (int argc, const char* const* argv)
 	if (!m_cmdLine.getOption<opt::LogFlush>())
 		m_logFlags |= QP_TEST_LOG_NO_FLUSH;
 
+	if (m_cmdLine.getOption<opt::LogAsync>())
+		m_logFlags |= QP_TEST_LOG_ASYNC;
+
 	if ((m_cmdLine.hasOption<opt::CasePath>()?1:0) +
 		(m_cmdLine.hasOption<opt::CaseList>()?1:0) +
 		(m_cmdLine.hasOption<opt::CaseListFile>()?1:0) +
@@ -844,14 +857,25 @@ bool					CommandLine::isOutOfMemoryTestEnabled		(void) const	{ return m_cmdLine.
 bool					CommandLine::isShadercacheEnabled			(void) const	{ return m_cmdLine.getOption<opt::ShaderCache>();							}
 const char*				CommandLine::getShaderCacheFilename			(void) const	{ return m_cmdLine.getOption<opt::ShaderCacheFilename>().c_str();			}
 bool					CommandLine::isShaderCacheTruncateEnabled	(void) const	{ return m_cmdLine.getOption<opt::ShaderCacheTruncate>();					}
+const char*				CommandLine::getPipelineCacheFilename		(void) const	{ return m_cmdLine.getOption<opt::PipelineCacheFilename>().c_str();			}
+const char*				CommandLine::getTraceFilename				(void) const	{ return m_cmdLine.getOption<opt::TraceFilename>().c_str();					}
 int						CommandLine::getOptimizationRecipe			(void) const	{ return m_cmdLine.getOption<opt::Optimization>();							}
 bool					CommandLine::isSpirvOptimizationEnabled		(void) const	{ return m_cmdLine.getOption<opt::OptimizeSpirv>();							}
 bool					CommandLine::isRenderDocEnabled				(void) const	{ return m_cmdLine.getOption<opt::RenderDoc>();								}
 const char*				CommandLine::getWaiverFileName				(void) const	{ return m_cmdLine.getOption<opt::WaiverFile>().c_str();					}
 const std::vector<int>&	CommandLine::getCaseFraction				(void) const	{ return m_cmdLine.getOption<opt::CaseFraction>();							}
 const char*				CommandLine::getCaseFractionMandatoryTests	(void) const	{ return m_cmdLine.getOption<opt::CaseFractionMandatoryTests>().c_str();	}
+const char*				CommandLine::getCaseFractionHistoryFile		(void) const	{ return m_cmdLine.getOption<opt::CaseFractionHistoryFile>().c_str();		}
 const char*				CommandLine::getArchiveDir					(void) const	{ return m_cmdLine.getOption<opt::ArchiveDir>().c_str();					}
 
+const char* CommandLine::getLogSharedRingName (void) const
+{
+	if (m_cmdLine.hasOption<opt::LogSharedRing>())
+		return m_cmdLine.getOption<opt::LogSharedRing>().c_str();
+	else
+		return DE_NULL;
+}
+
 const char* CommandLine::getGLContextType (void) const
 {
 	if (m_cmdLine.hasOption<opt::GLContextType>())
@@ -952,11 +976,157 @@ bool CaseListFilter::checkTestCaseName (const char* caseName) const
 	return result;
 }
 
+namespace
+{
+
+struct GroupDuration
+{
+	std::string	path;
+	double		duration;
+
+	bool operator< (const GroupDuration& other) const
+	{
+		// Longest first, ties broken by name so that every fraction computes the same assignment.
+		if (duration != other.duration)
+			return duration > other.duration;
+		return path < other.path;
+	}
+};
+
+std::vector<std::string> splitHistoryLine (const std::string& line, bool isCsv)
+{
+	std::vector<std::string>	fields;
+	std::string					field;
+
+	// CSV fields are separated by commas only and may be empty, other lines by any whitespace.
+	for (std::string::const_iterator c = line.begin(); c != line.end(); ++c)
+	{
+		if (*c == ',' && isCsv)
+		{
+			fields.push_back(field);
+			field.clear();
+		}
+		else if (*c == ' ' || *c == '\t' || *c == '\r')
+		{
+			if (!field.empty() && !isCsv)
+			{
+				fields.push_back(field);
+				field.clear();
+			}
+		}
+		else
+			field += *c;
+	}
+
+	if (!field.empty() || (isCsv && !fields.empty()))
+		fields.push_back(field);
+
+	return fields;
+}
+
+} // anonymous
+
+std::map<std::string, int> assignCaseFractionGroups (std::istream& history, int numFractions)
+{
+	std::map<std::string, double>	groupDurations;
+	std::vector<GroupDuration>		sortedGroups;
+	std::vector<double>				fractionDurations	((size_t)numFractions, 0.0);
+	std::map<std::string, int>		groupFractions;
+	std::string						line;
+	bool							isFirstLine			= true;
+	bool							isCsv				= false;
+	size_t							durationNdx			= 1;
+
+	DE_ASSERT(numFractions > 0);
+
+	// Accumulate case durations per group. The history is either "<case path> <duration>" lines, or
+	// CSV with a header line naming the CasePath and TestDuration columns, such as the output of
+	// testlog-stats --cases=all. Lines that don't parse are ignored.
+	while (std::getline(history, line))
+	{
+		std::vector<std::string>	fields;
+		double						duration	= 0.0;
+
+		if (isFirstLine)
+		{
+			isFirstLine = false;
+			fields		= splitHistoryLine(line, true);
+
+			if (!fields.empty() && fields[0] == "CasePath")
+			{
+				const std::vector<std::string>::const_iterator durationField = std::find(fields.begin(), fields.end(), "TestDuration");
+
+				if (durationField == fields.end())
+					throw Exception("Case fraction history CSV has no TestDuration column");
+
+				isCsv		= true;
+				durationNdx	= (size_t)(durationField - fields.begin());
+				continue;
+			}
+		}
+
+		fields = splitHistoryLine(line, isCsv);
+
+		if (isCsv ? fields.size() <= durationNdx : fields.size() != 2)
+			continue;
+
+		{
+			std::istringstream	str	(fields[durationNdx]);
+
+			if (!(str >> duration) || !(str >> std::ws).eof() || duration < 0.0)
+				continue;
+		}
+
+		{
+			const size_t groupEnd = fields[0].rfind('.');
+
+			if (groupEnd == std::string::npos || groupEnd == 0)
+				continue;
+
+			groupDurations[fields[0].substr(0, groupEnd)] += duration;
+		}
+	}
+
+	for (std::map<std::string, double>::const_iterator group = groupDurations.begin(); group != groupDurations.end(); ++group)
+	{
+		const GroupDuration groupDuration = { group->first, group->second };
+		sortedGroups.push_back(groupDuration);
+	}
+
+	// Longest processing time first: give each group to the currently least loaded fraction.
+	std::sort(sortedGroups.begin(), sortedGroups.end());
+
+	for (std::vector<GroupDuration>::const_iterator group = sortedGroups.begin(); group != sortedGroups.end(); ++group)
+	{
+		const int fractionNdx = (int)(std::min_element(fractionDurations.begin(), fractionDurations.end()) - fractionDurations.begin());
+
+		fractionDurations[fractionNdx]	+= group->duration;
+		groupFractions[group->path]		 = fractionNdx;
+	}
+
+	return groupFractions;
+}
+
 bool CaseListFilter::checkCaseFraction (int i, const std::string& testCaseName) const
 {
-	return	m_caseFraction.size() != 2 ||
-		((i % m_caseFraction[1]) == m_caseFraction[0]) ||
-		(m_caseFractionMandatoryTests.get()!=DE_NULL && m_caseFractionMandatoryTests->matches(testCaseName));
+	if (m_caseFraction.size() != 2)
+		return true;
+
+	if (m_caseFractionMandatoryTests.get() != DE_NULL && m_caseFractionMandatoryTests->matches(testCaseName))
+		return true;
+
+	if (!m_caseFractionGroups.empty())
+	{
+		const size_t										groupEnd	= testCaseName.rfind('.');
+		const std::map<std::string, int>::const_iterator	group		= groupEnd != std::string::npos ? m_caseFractionGroups.find(testCaseName.substr(0, groupEnd))
+																										: m_caseFractionGroups.end();
+
+		// Groups missing from the history fall back to the index based split.
+		if (group != m_caseFractionGroups.end())
+			return group->second == m_caseFraction[0];
+	}
+
+	return (i % m_caseFraction[1]) == m_caseFraction[0];
 }
 
 CaseListFilter::CaseListFilter (void)
@@ -1017,6 +1187,17 @@ CaseListFilter::CaseListFilter (const de::cmdline::CommandLine& cmdLine, const t
 	if (m_caseFraction.size() != 0 && m_caseFraction.size() != 2)
 		throw Exception("Invalid case fraction. Must have two components.");
 
+	if (m_caseFraction.size() == 2 && !cmdLine.getOption<opt::CaseFractionHistoryFile>().empty())
+	{
+		const std::string&	historyFilename	= cmdLine.getOption<opt::CaseFractionHistoryFile>();
+		std::ifstream		in				(historyFilename.c_str(), std::ios_base::binary);
+
+		if (!in.is_open() || !in.good())
+			throw Exception("Failed to open case fraction history file: '" + historyFilename + "'");
+
+		m_caseFractionGroups = assignCaseFractionGroups(in, m_caseFraction[1]);
+	}
+
 	if (m_caseFraction.size() == 2)
 	{
 		std::string					caseFractionMandatoryTestsFilename = cmdLine.getOption<opt::CaseFractionMandatoryTests>();
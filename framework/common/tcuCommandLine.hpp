@@ -29,6 +29,7 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <istream>
 
 namespace tcu
@@ -98,6 +99,10 @@ bool matchWildcards(std::string::const_iterator		patternStart,
 					std::string::const_iterator		pathEnd,
 					bool							allowPrefix);
 
+// Assign test groups to fractions based on case duration history ("<case path> <duration>" per line,
+// or CSV with CasePath and TestDuration columns). Throws Exception for CSV without TestDuration.
+std::map<std::string, int> assignCaseFractionGroups (std::istream& history, int numFractions);
+
 class CaseListFilter
 {
 public:
@@ -121,6 +126,7 @@ private:
 	CaseTreeNode*					m_caseTree;
 	de::MovePtr<const CasePaths>	m_casePaths;
 	std::vector<int>				m_caseFraction;
+	std::map<std::string, int>		m_caseFractionGroups;
 	de::MovePtr<const CasePaths>	m_caseFractionMandatoryTests;
 };
 
@@ -146,6 +152,9 @@ public:
 	//! Get log file name (--deqp-log-filename)
 	const char*						getLogFileName					(void) const;
 
+	//! Get shared memory log ring name (--deqp-log-shm), or DE_NULL if not set
+	const char*						getLogSharedRingName			(void) const;
+
 	//! Get logging flags
 	deUint32						getLogFlags						(void) const;
 
@@ -237,6 +246,12 @@ public:
 	//! Should the shader cache be truncated before run (--deqp-shadercache-truncate)
 	bool							isShaderCacheTruncateEnabled	(void) const;
 
+	//! Get the filename for Vulkan pipeline cache, empty if disabled (--deqp-pipeline-cache-filename)
+	const char*						getPipelineCacheFilename		(void) const;
+
+	//! Get the filename for execution trace, empty if disabled (--deqp-trace-filename)
+	const char*						getTraceFilename				(void) const;
+
 	//! Get shader optimization recipe (--deqp-optimization-recipe)
 	int								getOptimizationRecipe		(void) const;
 
@@ -255,6 +270,9 @@ public:
 	//! Get must-list filename
 	const char*						getCaseFractionMandatoryTests(void) const;
 
+	//! Get case duration history filename used for balancing fractions (--deqp-fraction-history-file)
+	const char*						getCaseFractionHistoryFile	(void) const;
+
 	//! Get archive directory path
 	const char*						getArchiveDir				(void) const;
 
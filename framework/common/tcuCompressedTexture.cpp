@@ -27,8 +27,13 @@
 
 #include "deStringUtil.hpp"
 #include "deFloat16.h"
+#include "deMemory.h"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
+#include "deAtomic.h"
 
 #include <algorithm>
+#include <exception>
 
 namespace tcu
 {
@@ -2493,36 +2498,191 @@ int componentSum (const IVec3& vec)
 	return vec.x() + vec.y() + vec.z();
 }
 
-} // anonymous
-
-void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
+/*--------------------------------------------------------------------*//*!
+ * \brief Decompresses rows of blocks into a texture
+ *
+ * Each row is a run of blocks with the same y and z. Recently decoded
+ * blocks are kept in a small direct-mapped cache keyed by the compressed
+ * data, so textures built from repeating blocks decode each one once.
+ *//*--------------------------------------------------------------------*/
+class BlockRowDecompressor
 {
-	const int				blockSize			= getBlockSize(fmt);
-	const IVec3				blockPixelSize		(getBlockPixelSize(fmt));
-	const IVec3				blockCount			(deDivRoundUp32(dst.getWidth(),		blockPixelSize.x()),
-												 deDivRoundUp32(dst.getHeight(),	blockPixelSize.y()),
-												 deDivRoundUp32(dst.getDepth(),		blockPixelSize.z()));
-	const IVec3				blockPitches		(blockSize, blockSize * blockCount.x(), blockSize * blockCount.x() * blockCount.y());
+public:
+									BlockRowDecompressor	(const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params);
+
+	int								getNumRows				(void) const { return m_blockCount.y() * m_blockCount.z(); }
+	void							decompressRow			(int rowNdx);
+
+private:
+	enum
+	{
+		CACHE_SIZE		= 64,
+		MAX_BLOCK_SIZE	= 16
+	};
+
+	struct CacheEntry
+	{
+		bool						valid;
+		deUint8						key[MAX_BLOCK_SIZE];
+		std::vector<deUint8>		pixels;
+
+									CacheEntry				(void) : valid(false) {}
+	};
 
-	std::vector<deUint8>	uncompressedBlock	(dst.getFormat().getPixelSize() * blockPixelSize.x() * blockPixelSize.y() * blockPixelSize.z());
-	const PixelBufferAccess	blockAccess			(getUncompressedFormat(fmt), blockPixelSize.x(), blockPixelSize.y(), blockPixelSize.z(), &uncompressedBlock[0]);
+	void							decompressBlock			(const deUint8* blockPtr);
 
+	const PixelBufferAccess			m_dst;
+	const CompressedTexFormat		m_format;
+	const deUint8* const			m_src;
+	const TexDecompressionParams	m_params;
+	const int						m_blockSize;
+	const IVec3						m_blockPixelSize;
+	const IVec3						m_blockCount;
+	const IVec3						m_blockPitches;
+
+	std::vector<deUint8>			m_uncompressedBlock;
+	const PixelBufferAccess			m_blockAccess;
+	std::vector<CacheEntry>			m_cache;
+};
+
+BlockRowDecompressor::BlockRowDecompressor (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
+	: m_dst					(dst)
+	, m_format				(fmt)
+	, m_src					(src)
+	, m_params				(params)
+	, m_blockSize			(getBlockSize(fmt))
+	, m_blockPixelSize		(getBlockPixelSize(fmt))
+	, m_blockCount			(deDivRoundUp32(dst.getWidth(),		m_blockPixelSize.x()),
+							 deDivRoundUp32(dst.getHeight(),	m_blockPixelSize.y()),
+							 deDivRoundUp32(dst.getDepth(),		m_blockPixelSize.z()))
+	, m_blockPitches		(m_blockSize, m_blockSize * m_blockCount.x(), m_blockSize * m_blockCount.x() * m_blockCount.y())
+	, m_uncompressedBlock	(dst.getFormat().getPixelSize() * m_blockPixelSize.x() * m_blockPixelSize.y() * m_blockPixelSize.z())
+	, m_blockAccess			(getUncompressedFormat(fmt), m_blockPixelSize.x(), m_blockPixelSize.y(), m_blockPixelSize.z(), &m_uncompressedBlock[0])
+	, m_cache				(CACHE_SIZE)
+{
 	DE_ASSERT(dst.getFormat() == getUncompressedFormat(fmt));
+	DE_ASSERT(m_blockSize <= MAX_BLOCK_SIZE);
+}
+
+void BlockRowDecompressor::decompressBlock (const deUint8* blockPtr)
+{
+	deUint32 hash = 0;
+
+	for (int byteNdx = 0; byteNdx < m_blockSize; byteNdx++)
+		hash = hash * 31u + blockPtr[byteNdx];
 
-	for (int blockZ = 0; blockZ < blockCount.z(); blockZ++)
-	for (int blockY = 0; blockY < blockCount.y(); blockY++)
-	for (int blockX = 0; blockX < blockCount.x(); blockX++)
+	{
+		CacheEntry& entry = m_cache[deUint32Hash(hash) % (deUint32)CACHE_SIZE];
+
+		if (entry.valid && deMemCmp(entry.key, blockPtr, (size_t)m_blockSize) == 0)
+		{
+			std::copy(entry.pixels.begin(), entry.pixels.end(), m_uncompressedBlock.begin());
+			return;
+		}
+
+		tcu::decompressBlock(m_format, m_blockAccess, blockPtr, m_params);
+
+		entry.valid		= true;
+		entry.pixels	= m_uncompressedBlock;
+		deMemcpy(entry.key, blockPtr, (size_t)m_blockSize);
+	}
+}
+
+void BlockRowDecompressor::decompressRow (int rowNdx)
+{
+	const int blockY = rowNdx % m_blockCount.y();
+	const int blockZ = rowNdx / m_blockCount.y();
+
+	for (int blockX = 0; blockX < m_blockCount.x(); blockX++)
 	{
 		const IVec3				blockPos	(blockX, blockY, blockZ);
-		const deUint8* const	blockPtr	= src + componentSum(blockPos * blockPitches);
-		const IVec3				copySize	(de::min(blockPixelSize.x(), dst.getWidth()		- blockPos.x() * blockPixelSize.x()),
-											 de::min(blockPixelSize.y(), dst.getHeight()	- blockPos.y() * blockPixelSize.y()),
-											 de::min(blockPixelSize.z(), dst.getDepth()		- blockPos.z() * blockPixelSize.z()));
-		const IVec3				dstPixelPos	= blockPos * blockPixelSize;
+		const deUint8* const	blockPtr	= m_src + componentSum(blockPos * m_blockPitches);
+		const IVec3				copySize	(de::min(m_blockPixelSize.x(), m_dst.getWidth()		- blockPos.x() * m_blockPixelSize.x()),
+											 de::min(m_blockPixelSize.y(), m_dst.getHeight()	- blockPos.y() * m_blockPixelSize.y()),
+											 de::min(m_blockPixelSize.z(), m_dst.getDepth()		- blockPos.z() * m_blockPixelSize.z()));
+		const IVec3				dstPixelPos	= blockPos * m_blockPixelSize;
 
-		decompressBlock(fmt, blockAccess, blockPtr, params);
+		decompressBlock(blockPtr);
 
-		copy(getSubregion(dst, dstPixelPos.x(), dstPixelPos.y(), dstPixelPos.z(), copySize.x(), copySize.y(), copySize.z()), getSubregion(blockAccess, 0, 0, 0, copySize.x(), copySize.y(), copySize.z()));
+		copy(getSubregion(m_dst, dstPixelPos.x(), dstPixelPos.y(), dstPixelPos.z(), copySize.x(), copySize.y(), copySize.z()), getSubregion(m_blockAccess, 0, 0, 0, copySize.x(), copySize.y(), copySize.z()));
+	}
+}
+
+class DecompressThread : public de::Thread
+{
+public:
+								DecompressThread	(const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params, volatile deInt32* nextRowNdx)
+									: m_decompressor	(dst, fmt, src, params)
+									, m_nextRowNdx		(nextRowNdx)
+								{
+								}
+
+	void						run					(void)
+	{
+		try
+		{
+			for (;;)
+			{
+				const int rowNdx = (int)deAtomicIncrement32(m_nextRowNdx) - 1;
+
+				if (rowNdx >= m_decompressor.getNumRows())
+					break;
+
+				m_decompressor.decompressRow(rowNdx);
+			}
+		}
+		catch (...)
+		{
+			// Rethrown by decompress() once all threads have finished.
+			m_error = std::current_exception();
+		}
+	}
+
+	const std::exception_ptr&	getError			(void) const { return m_error; }
+
+private:
+	BlockRowDecompressor		m_decompressor;
+	volatile deInt32*			m_nextRowNdx;
+	std::exception_ptr			m_error;
+};
+
+} // anonymous
+
+void decompress (const PixelBufferAccess& dst, CompressedTexFormat fmt, const deUint8* src, const TexDecompressionParams& params)
+{
+	// Small textures are not worth the thread start-up cost
+	const int	minBlocksPerThread	= 256;
+	const IVec3	blockPixelSize		(getBlockPixelSize(fmt));
+	const int	numRows				= deDivRoundUp32(dst.getHeight(), blockPixelSize.y()) * deDivRoundUp32(dst.getDepth(), blockPixelSize.z());
+	const int	numBlocks			= numRows * deDivRoundUp32(dst.getWidth(), blockPixelSize.x());
+	const int	numThreads			= de::min(de::min(numRows, numBlocks / minBlocksPerThread), (int)deGetNumAvailableLogicalCores());
+
+	if (numThreads <= 1)
+	{
+		BlockRowDecompressor decompressor(dst, fmt, src, params);
+
+		for (int rowNdx = 0; rowNdx < numRows; rowNdx++)
+			decompressor.decompressRow(rowNdx);
+	}
+	else
+	{
+		volatile deInt32								nextRowNdx	= 0;
+		std::vector<de::SharedPtr<DecompressThread> >	threads;
+
+		for (int threadNdx = 0; threadNdx < numThreads; threadNdx++)
+		{
+			threads.push_back(de::SharedPtr<DecompressThread>(new DecompressThread(dst, fmt, src, params, &nextRowNdx)));
+			threads.back()->start();
+		}
+
+		for (int threadNdx = 0; threadNdx < numThreads; threadNdx++)
+			threads[threadNdx]->join();
+
+		for (int threadNdx = 0; threadNdx < numThreads; threadNdx++)
+		{
+			if (threads[threadNdx]->getError())
+				std::rethrow_exception(threads[threadNdx]->getError());
+		}
 	}
 }
 
@@ -29,6 +29,7 @@
 #include "tcuVector.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuRGBA.hpp"
+#include "tcuTrace.hpp"
 #include "tcuTexture.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuFloat.hpp"
@@ -216,6 +217,8 @@ static int findNumPositionDeviationFailingPixels (const PixelBufferAccess& error
  *//*--------------------------------------------------------------------*/
 bool fuzzyCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, float threshold, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::fuzzyCompare");
+
 	FuzzyCompareParams	params;		// Use defaults.
 	TextureLevel		errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	float				difference		= fuzzyCompare(params, reference, result, errorMask.getAccess());
@@ -334,6 +337,8 @@ static deInt64 computeSquaredDiffSum (const ConstPixelBufferAccess& ref, const C
  *//*--------------------------------------------------------------------*/
 int measurePixelDiffAccuracy (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, int bestScoreDiff, int worstScoreDiff, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::measurePixelDiffAccuracy");
+
 	TextureLevel	diffMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	int				diffFactor		= 8;
 	deInt64			squaredSum		= computeSquaredDiffSum(reference, result, diffMask.getAccess(), diffFactor);
@@ -487,6 +492,8 @@ static tcu::UVec4 computeFlushRelaxedULPDiff (const tcu::Vec4& a, const tcu::Vec
  *//*--------------------------------------------------------------------*/
 bool floatUlpThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::floatUlpThresholdCompare");
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -573,6 +580,8 @@ bool floatUlpThresholdCompare (TestLog& log, const char* imageSetName, const cha
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const Vec4& threshold, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::floatThresholdCompare");
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -660,6 +669,8 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const Vec4& reference, const ConstPixelBufferAccess& result, const Vec4& threshold, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::floatThresholdCompare");
+
 	const int			width				= result.getWidth();
 	const int			height				= result.getHeight();
 	const int			depth				= result.getDepth();
@@ -742,6 +753,8 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::intThresholdCompare");
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -829,6 +842,8 @@ bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* im
  *//*--------------------------------------------------------------------*/
 bool dsThresholdCompare(TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const float threshold, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::dsThresholdCompare");
+
 	int					width = reference.getWidth();
 	int					height = reference.getHeight();
 	int					depth = reference.getDepth();
@@ -939,6 +954,8 @@ bool dsThresholdCompare(TestLog& log, const char* imageSetName, const char* imag
  *//*--------------------------------------------------------------------*/
 bool intThresholdPositionDeviationCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::intThresholdPositionDeviationCompare");
+
 	const int			width				= reference.getWidth();
 	const int			height				= reference.getHeight();
 	const int			depth				= reference.getDepth();
@@ -1018,6 +1035,8 @@ bool intThresholdPositionDeviationCompare (TestLog& log, const char* imageSetNam
  *//*--------------------------------------------------------------------*/
 bool intThresholdPositionDeviationErrorThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, int maxAllowedFailingPixels, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::intThresholdPositionDeviationErrorThresholdCompare");
+
 	const int			width				= reference.getWidth();
 	const int			height				= reference.getHeight();
 	const int			depth				= reference.getDepth();
@@ -1108,6 +1127,8 @@ bool pixelThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool bilinearCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const RGBA threshold, CompareLogMode logMode)
 {
+	TCU_TRACE_SCOPE("tcu::bilinearCompare");
+
 	TextureLevel		errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	bool				isOk			= bilinearCompare(reference, result, errorMask, threshold);
 	Vec4				pixelBias		(0.0f, 0.0f, 0.0f, 0.0f);
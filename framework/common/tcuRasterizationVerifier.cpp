@@ -31,6 +31,9 @@
 
 #include "deMath.h"
 #include "deStringUtil.hpp"
+#include "deSharedPtr.hpp"
+#include "deThread.hpp"
+#include "deAtomic.h"
 
 #include "rrRasterizer.hpp"
 
@@ -206,6 +209,416 @@ tcu::IVec4 getTriangleAABB (const TriangleSceneSpec::SceneTriangle& triangle, co
 	return aabb;
 }
 
+typedef tcu::Vector<deInt64, 2> I64Vec2;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Per-triangle state of calculateTriangleCoverage()
+ *
+ * Everything that does not depend on the queried pixel is computed once
+ * per triangle instead of once per pixel.
+ *//*--------------------------------------------------------------------*/
+struct TriangleCoverageSetup
+{
+						TriangleCoverageSetup	(const tcu::Vec4& p0, const tcu::Vec4& p1, const tcu::Vec4& p2, const tcu::IVec2& viewportSize, int subpixelBits, bool multisample);
+
+	deUint64			numSubPixels;
+	deUint64			pixelHitBoxSize;
+	bool				multisample;
+	tcu::Vec2			screenSpaceMin;
+	tcu::Vec2			screenSpaceMax;
+	DVec2				subPixelSpace[3];		//!< Vertices of a clockwise triangle
+	double				edgeLengthSquared[3];
+	I64Vec2				subPixelSpaceFloor[3];
+	I64Vec2				subPixelSpaceCeil[3];
+};
+
+TriangleCoverageSetup::TriangleCoverageSetup (const tcu::Vec4& p0, const tcu::Vec4& p1, const tcu::Vec4& p2, const tcu::IVec2& viewportSize, int subpixelBits, bool multisample_)
+	: numSubPixels		(((deUint64)1) << subpixelBits)
+	, pixelHitBoxSize	((multisample_) ? (numSubPixels) : 5)	//!< 5 = ceil(6 * sqrt(2) / 2) to account for a 3 subpixel fuzz around pixel center
+	, multisample		(multisample_)
+{
+	const bool			order								= isTriangleClockwise(p0, p1, p2);			//!< clockwise / counter-clockwise
+	const tcu::Vec4&	orderedP0							= p0;										//!< vertices of a clockwise triangle
+	const tcu::Vec4&	orderedP1							= (order) ? (p1) : (p2);
+	const tcu::Vec4&	orderedP2							= (order) ? (p2) : (p1);
+	const tcu::Vec2		triangleNormalizedDeviceSpace[3]	=
+	{
+		tcu::Vec2(orderedP0.x() / orderedP0.w(), orderedP0.y() / orderedP0.w()),
+		tcu::Vec2(orderedP1.x() / orderedP1.w(), orderedP1.y() / orderedP1.w()),
+		tcu::Vec2(orderedP2.x() / orderedP2.w(), orderedP2.y() / orderedP2.w()),
+	};
+	const tcu::Vec2		triangleScreenSpace[3]				=
+	{
+		(triangleNormalizedDeviceSpace[0] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
+		(triangleNormalizedDeviceSpace[1] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
+		(triangleNormalizedDeviceSpace[2] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
+	};
+
+	screenSpaceMin = tcu::Vec2(de::min(de::min(triangleScreenSpace[0].x(), triangleScreenSpace[1].x()), triangleScreenSpace[2].x()),
+							   de::min(de::min(triangleScreenSpace[0].y(), triangleScreenSpace[1].y()), triangleScreenSpace[2].y()));
+	screenSpaceMax = tcu::Vec2(de::max(de::max(triangleScreenSpace[0].x(), triangleScreenSpace[1].x()), triangleScreenSpace[2].x()),
+							   de::max(de::max(triangleScreenSpace[0].y(), triangleScreenSpace[1].y()), triangleScreenSpace[2].y()));
+
+	for (int vtxNdx = 0; vtxNdx < 3; ++vtxNdx)
+	{
+		subPixelSpace[vtxNdx]		= DVec2(triangleScreenSpace[vtxNdx].x() * (double)numSubPixels, triangleScreenSpace[vtxNdx].y() * (double)numSubPixels);
+
+		// both rounding directions
+		subPixelSpaceFloor[vtxNdx]	= I64Vec2(deFloorFloatToInt32(triangleScreenSpace[vtxNdx].x() * (float)numSubPixels), deFloorFloatToInt32(triangleScreenSpace[vtxNdx].y() * (float)numSubPixels));
+		subPixelSpaceCeil[vtxNdx]	= I64Vec2(deCeilFloatToInt32(triangleScreenSpace[vtxNdx].x() * (float)numSubPixels), deCeilFloatToInt32(triangleScreenSpace[vtxNdx].y() * (float)numSubPixels));
+	}
+
+	for (int vtxNdx = 0; vtxNdx < 3; ++vtxNdx)
+		edgeLengthSquared[vtxNdx] = tcu::lengthSquared(subPixelSpace[(vtxNdx + 1) % 3] - subPixelSpace[vtxNdx]);
+}
+
+CoverageType calculateTriangleCoverage (const TriangleCoverageSetup& setup, const tcu::IVec2& pixel)
+{
+	const deUint64	numSubPixels	= setup.numSubPixels;
+	const deUint64	pixelHitBoxSize	= setup.pixelHitBoxSize;
+
+	// Broad bounding box - pixel check
+	{
+		if ((float)pixel.x() > setup.screenSpaceMax.x() + 1 ||
+			(float)pixel.y() > setup.screenSpaceMax.y() + 1 ||
+			(float)pixel.x() < setup.screenSpaceMin.x() - 1 ||
+			(float)pixel.y() < setup.screenSpaceMin.y() - 1)
+			return COVERAGE_NONE;
+	}
+
+	// Broad triangle - pixel area intersection
+	{
+		const DVec2 pixelCenterPosition			=	DVec2((double)pixel.x(), (double)pixel.y()) * DVec2((double)numSubPixels, (double)numSubPixels) +
+													DVec2((double)numSubPixels / 2, (double)numSubPixels / 2);
+		const DVec2* const triangleSubPixelSpace	= setup.subPixelSpace;
+
+		// Check (using cross product) if pixel center is
+		// a) too far from any edge
+		// b) fully inside all edges
+		bool insideAllEdges = true;
+		for (int vtxNdx = 0; vtxNdx < 3; ++vtxNdx)
+		{
+			const int		otherVtxNdx				= (vtxNdx + 1) % 3;
+			const double	maxPixelDistanceSquared	= (double)(pixelHitBoxSize * pixelHitBoxSize); // Max distance from the pixel center from within the pixel is (sqrt(2) * boxWidth/2). Use 2x value for rounding tolerance
+			const DVec2		edge					= triangleSubPixelSpace[otherVtxNdx]	- triangleSubPixelSpace[vtxNdx];
+			const DVec2		v						= pixelCenterPosition					- triangleSubPixelSpace[vtxNdx];
+			const double	crossProduct			= (edge.x() * v.y() - edge.y() * v.x());
+
+			// distance from edge: (edge x v) / |edge|
+			//     (edge x v) / |edge| > maxPixelDistance
+			// ==> (edge x v)^2 / edge^2 > maxPixelDistance^2    | edge x v > 0
+			// ==> (edge x v)^2 > maxPixelDistance^2 * edge^2
+			if (crossProduct < 0 && crossProduct*crossProduct > maxPixelDistanceSquared * setup.edgeLengthSquared[vtxNdx])
+				return COVERAGE_NONE;
+			if (crossProduct < 0 || crossProduct*crossProduct < maxPixelDistanceSquared * setup.edgeLengthSquared[vtxNdx])
+				insideAllEdges = false;
+		}
+
+		if (insideAllEdges)
+			return COVERAGE_FULL;
+	}
+
+	// Accurate intersection for edge pixels
+	{
+		//  In multisampling, the sample points can be anywhere in the pixel, and in single sampling only in the center.
+		const I64Vec2 pixelCorners[4] =
+		{
+			I64Vec2((pixel.x()+0) * numSubPixels, (pixel.y()+0) * numSubPixels),
+			I64Vec2((pixel.x()+1) * numSubPixels, (pixel.y()+0) * numSubPixels),
+			I64Vec2((pixel.x()+1) * numSubPixels, (pixel.y()+1) * numSubPixels),
+			I64Vec2((pixel.x()+0) * numSubPixels, (pixel.y()+1) * numSubPixels),
+		};
+
+		// 3 subpixel tolerance around pixel center to account for accumulated errors during various line rasterization methods
+		const I64Vec2 pixelCenterCorners[4] =
+		{
+			I64Vec2(pixel.x() * numSubPixels + numSubPixels/2 - 3, pixel.y() * numSubPixels + numSubPixels/2 - 3),
+			I64Vec2(pixel.x() * numSubPixels + numSubPixels/2 + 3, pixel.y() * numSubPixels + numSubPixels/2 - 3),
+			I64Vec2(pixel.x() * numSubPixels + numSubPixels/2 + 3, pixel.y() * numSubPixels + numSubPixels/2 + 3),
+			I64Vec2(pixel.x() * numSubPixels + numSubPixels/2 - 3, pixel.y() * numSubPixels + numSubPixels/2 + 3),
+		};
+
+		const I64Vec2* const triangleSubPixelSpaceFloor	= setup.subPixelSpaceFloor;
+		const I64Vec2* const triangleSubPixelSpaceCeil	= setup.subPixelSpaceCeil;
+		const I64Vec2* const corners					= (setup.multisample) ? (pixelCorners) : (pixelCenterCorners);
+
+		// Test if any edge (with any rounding) intersects the pixel (boundary). If it does => Partial. If not => fully inside or outside
+
+		for (int edgeNdx = 0; edgeNdx < 3; ++edgeNdx)
+		for (int startRounding = 0; startRounding < 4; ++startRounding)
+		for (int endRounding = 0; endRounding < 4; ++endRounding)
+		{
+			const int		nextEdgeNdx	= (edgeNdx+1) % 3;
+			const I64Vec2	startPos	((startRounding&0x01)	? (triangleSubPixelSpaceFloor[edgeNdx].x())		: (triangleSubPixelSpaceCeil[edgeNdx].x()),		(startRounding&0x02)	? (triangleSubPixelSpaceFloor[edgeNdx].y())		: (triangleSubPixelSpaceCeil[edgeNdx].y()));
+			const I64Vec2	endPos		((endRounding&0x01)		? (triangleSubPixelSpaceFloor[nextEdgeNdx].x())	: (triangleSubPixelSpaceCeil[nextEdgeNdx].x()),	(endRounding&0x02)		? (triangleSubPixelSpaceFloor[nextEdgeNdx].y())	: (triangleSubPixelSpaceCeil[nextEdgeNdx].y()));
+
+			for (int pixelEdgeNdx = 0; pixelEdgeNdx < 4; ++pixelEdgeNdx)
+			{
+				const int pixelEdgeEnd = (pixelEdgeNdx + 1) % 4;
+
+				if (lineLineIntersect(startPos, endPos, corners[pixelEdgeNdx], corners[pixelEdgeEnd]))
+					return COVERAGE_PARTIAL;
+			}
+		}
+
+		// fully inside or outside
+		for (int edgeNdx = 0; edgeNdx < 3; ++edgeNdx)
+		{
+			const int		nextEdgeNdx		= (edgeNdx+1) % 3;
+			const I64Vec2&	startPos		= triangleSubPixelSpaceFloor[edgeNdx];
+			const I64Vec2&	endPos			= triangleSubPixelSpaceFloor[nextEdgeNdx];
+			const I64Vec2	edge			= endPos - startPos;
+			const I64Vec2	v				= corners[0] - endPos;
+			const deInt64	crossProduct	= (edge.x() * v.y() - edge.y() * v.x());
+
+			// a corner of the pixel is outside => "fully inside" option is impossible
+			if (crossProduct < 0)
+				return COVERAGE_NONE;
+		}
+
+		return COVERAGE_FULL;
+	}
+}
+
+std::vector<TriangleCoverageSetup> setupTriangleCoverage (const TriangleSceneSpec& scene, const tcu::IVec2& viewportSize, int subpixelBits, bool multisample)
+{
+	std::vector<TriangleCoverageSetup> setups;
+
+	setups.reserve(scene.triangles.size());
+
+	for (size_t triNdx = 0; triNdx < scene.triangles.size(); ++triNdx)
+		setups.push_back(TriangleCoverageSetup(scene.triangles[triNdx].positions[0], scene.triangles[triNdx].positions[1], scene.triangles[triNdx].positions[2], viewportSize, subpixelBits, multisample));
+
+	return setups;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Triangles binned into screen tiles
+ *
+ * Each tile lists, in scene order, the triangles whose bounding box grown
+ * by the coverage query tolerance touches the tile. Triangles that are not
+ * listed in a pixel's tile cannot have any coverage on that pixel.
+ * getAABB() returns the unexpanded getTriangleAABB() of a triangle.
+ *//*--------------------------------------------------------------------*/
+class TriangleBins
+{
+public:
+	enum
+	{
+		TILE_SIZE	= 32
+	};
+
+								TriangleBins	(const TriangleSceneSpec& scene, const std::vector<TriangleCoverageSetup>& setups, const tcu::IVec2& viewportSize);
+
+	int							getNumTiles		(void) const					{ return m_numTilesX * m_numTilesY;			}
+	tcu::IVec4					getTileRect		(int tileNdx) const;			//!< Inclusive (x0, y0, x1, y1)
+	const std::vector<int>&		getBin			(int tileNdx) const				{ return m_bins[tileNdx];					}
+	const tcu::IVec4&			getAABB			(int triNdx) const				{ return m_aabbs[triNdx];					}
+
+private:
+	const tcu::IVec2					m_viewportSize;
+	const int							m_numTilesX;
+	const int							m_numTilesY;
+	std::vector<tcu::IVec4>				m_aabbs;
+	std::vector<std::vector<int> >		m_bins;
+};
+
+TriangleBins::TriangleBins (const TriangleSceneSpec& scene, const std::vector<TriangleCoverageSetup>& setups, const tcu::IVec2& viewportSize)
+	: m_viewportSize	(viewportSize)
+	, m_numTilesX		((viewportSize.x() + TILE_SIZE - 1) / TILE_SIZE)
+	, m_numTilesY		((viewportSize.y() + TILE_SIZE - 1) / TILE_SIZE)
+	, m_bins			(m_numTilesX * m_numTilesY)
+{
+	// calculateTriangleCoverage() accepts pixels up to one pixel outside the triangle's bounding box, keep one extra for rounding
+	const float	guardBand	= 2.0f;
+	const float	maxX		= (float)(viewportSize.x() - 1);
+	const float	maxY		= (float)(viewportSize.y() - 1);
+
+	DE_ASSERT(setups.size() == scene.triangles.size());
+
+	m_aabbs.reserve(scene.triangles.size());
+
+	for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
+	{
+		const tcu::Vec2&	ssMin	= setups[triNdx].screenSpaceMin;
+		const tcu::Vec2&	ssMax	= setups[triNdx].screenSpaceMax;
+		const bool			finite	= !tcu::Float32(ssMin.x()).isInf() && !tcu::Float32(ssMin.x()).isNaN() &&
+									  !tcu::Float32(ssMin.y()).isInf() && !tcu::Float32(ssMin.y()).isNaN() &&
+									  !tcu::Float32(ssMax.x()).isInf() && !tcu::Float32(ssMax.x()).isNaN() &&
+									  !tcu::Float32(ssMax.y()).isInf() && !tcu::Float32(ssMax.y()).isNaN();
+
+		// Degenerate triangles may still produce coverage anywhere, bin them everywhere
+		const int			tileMinX	= (finite) ? ((int)de::clamp(deFloatFloor(ssMin.x()) - guardBand, 0.0f, maxX) / TILE_SIZE) : (0);
+		const int			tileMinY	= (finite) ? ((int)de::clamp(deFloatFloor(ssMin.y()) - guardBand, 0.0f, maxY) / TILE_SIZE) : (0);
+		const int			tileMaxX	= (finite) ? ((int)de::clamp(deFloatCeil(ssMax.x()) + guardBand, 0.0f, maxX) / TILE_SIZE) : (m_numTilesX - 1);
+		const int			tileMaxY	= (finite) ? ((int)de::clamp(deFloatCeil(ssMax.y()) + guardBand, 0.0f, maxY) / TILE_SIZE) : (m_numTilesY - 1);
+
+		m_aabbs.push_back(getTriangleAABB(scene.triangles[triNdx], viewportSize));
+
+		for (int tileY = tileMinY; tileY <= tileMaxY; ++tileY)
+		for (int tileX = tileMinX; tileX <= tileMaxX; ++tileX)
+			m_bins[tileY * m_numTilesX + tileX].push_back(triNdx);
+	}
+}
+
+tcu::IVec4 TriangleBins::getTileRect (int tileNdx) const
+{
+	const int tileX = tileNdx % m_numTilesX;
+	const int tileY = tileNdx / m_numTilesX;
+	const int x0	= tileX * TILE_SIZE;
+	const int y0	= tileY * TILE_SIZE;
+
+	return tcu::IVec4(x0, y0, de::min(x0 + (int)TILE_SIZE, m_viewportSize.x()) - 1, de::min(y0 + (int)TILE_SIZE, m_viewportSize.y()) - 1);
+}
+
+class TileProcessor
+{
+public:
+	virtual			~TileProcessor	(void) {}
+	virtual void	processTile		(int tileNdx) const = 0;
+};
+
+class TileProcessorThread : public de::Thread
+{
+public:
+					TileProcessorThread	(const TileProcessor& processor, int numTiles, volatile deInt32* nextTileNdx)
+						: m_processor	(processor)
+						, m_numTiles	(numTiles)
+						, m_nextTileNdx	(nextTileNdx)
+					{
+					}
+
+	void			run					(void)
+	{
+		for (;;)
+		{
+			const int tileNdx = (int)deAtomicIncrement32(m_nextTileNdx) - 1;
+
+			if (tileNdx >= m_numTiles)
+				break;
+
+			m_processor.processTile(tileNdx);
+		}
+	}
+
+private:
+	const TileProcessor&	m_processor;
+	const int				m_numTiles;
+	volatile deInt32*		m_nextTileNdx;
+};
+
+//! Process all tiles using one thread per logical core. Tiles must not share any output.
+void processTiles (const TileProcessor& processor, int numTiles)
+{
+	const int numThreads = de::min(numTiles, (int)deGetNumAvailableLogicalCores());
+
+	if (numThreads <= 1)
+	{
+		for (int tileNdx = 0; tileNdx < numTiles; ++tileNdx)
+			processor.processTile(tileNdx);
+	}
+	else
+	{
+		volatile deInt32									nextTileNdx	= 0;
+		std::vector<de::SharedPtr<TileProcessorThread> >	threads;
+
+		for (int threadNdx = 0; threadNdx < numThreads; ++threadNdx)
+		{
+			threads.push_back(de::SharedPtr<TileProcessorThread>(new TileProcessorThread(processor, numTiles, &nextTileNdx)));
+			threads.back()->start();
+		}
+
+		for (int threadNdx = 0; threadNdx < numThreads; ++threadNdx)
+			threads[threadNdx]->join();
+	}
+}
+
+//! Builds the reference coverage map of verifyTriangleGroupRasterization() one tile at a time
+class CoverageMapProcessor : public TileProcessor
+{
+public:
+								CoverageMapProcessor	(const TriangleSceneSpec&					scene,
+														 const std::vector<TriangleCoverageSetup>&	setups,
+														 const TriangleBins&						bins,
+														 const tcu::IVec2&							viewportSize,
+														 const tcu::PixelBufferAccess&				coverageMap)
+									: m_scene			(scene)
+									, m_setups			(setups)
+									, m_bins			(bins)
+									, m_viewportSize	(viewportSize)
+									, m_coverageMap		(coverageMap)
+								{
+								}
+
+	void						processTile				(int tileNdx) const;
+
+private:
+	const TriangleSceneSpec&					m_scene;
+	const std::vector<TriangleCoverageSetup>&	m_setups;
+	const TriangleBins&							m_bins;
+	const tcu::IVec2							m_viewportSize;
+	const tcu::PixelBufferAccess				m_coverageMap;
+};
+
+void CoverageMapProcessor::processTile (int tileNdx) const
+{
+	const tcu::IVec4			tileRect	= m_bins.getTileRect(tileNdx);
+	const std::vector<int>&		bin			= m_bins.getBin(tileNdx);
+
+	for (size_t binNdx = 0; binNdx < bin.size(); ++binNdx)
+	{
+		const int			triNdx	= bin[binNdx];
+		const tcu::IVec4&	aabb	= m_bins.getAABB(triNdx);
+
+		for (int y = de::max(tileRect.y(), aabb.y()); y <= de::min(aabb.w(), tileRect.w()); ++y)
+		for (int x = de::max(tileRect.x(), aabb.x()); x <= de::min(aabb.z(), tileRect.z()); ++x)
+		{
+			if (m_coverageMap.getPixelUint(x, y).x() == COVERAGE_FULL)
+				continue;
+
+			const CoverageType coverage = calculateTriangleCoverage(m_setups[triNdx], tcu::IVec2(x, y));
+
+			if (coverage == COVERAGE_FULL)
+			{
+				m_coverageMap.setPixel(tcu::IVec4(COVERAGE_FULL, 0, 0, 0), x, y);
+			}
+			else if (coverage == COVERAGE_PARTIAL)
+			{
+				CoverageType resultCoverage = COVERAGE_PARTIAL;
+
+				// Sharing an edge with another triangle?
+				// There should always be such a triangle, but the pixel in the other triangle might be
+				// on multiple edges, some of which are not shared. In these cases the coverage cannot be determined.
+				// Assume full coverage if the pixel is only on a shared edge in shared triangle too.
+				if (pixelOnlyOnASharedEdge(tcu::IVec2(x, y), m_scene.triangles[triNdx], m_viewportSize))
+				{
+					bool friendFound = false;
+					for (size_t friendBinNdx = 0; friendBinNdx < bin.size(); ++friendBinNdx)
+					{
+						const int friendTriNdx = bin[friendBinNdx];
+
+						if (friendTriNdx == triNdx)
+							continue;
+
+						const CoverageType friendCoverage = calculateTriangleCoverage(m_setups[friendTriNdx], tcu::IVec2(x, y));
+
+						if (friendCoverage != COVERAGE_NONE && pixelOnlyOnASharedEdge(tcu::IVec2(x, y), m_scene.triangles[friendTriNdx], m_viewportSize))
+						{
+							friendFound = true;
+							break;
+						}
+					}
+
+					if (friendFound)
+						resultCoverage = COVERAGE_FULL;
+				}
+
+				m_coverageMap.setPixel(tcu::IVec4(resultCoverage, 0, 0, 0), x, y);
+			}
+		}
+	}
+}
+
 float getExponentEpsilonFromULP (int valueExponent, deUint32 ulp)
 {
 	DE_ASSERT(ulp < (1u<<10));
@@ -654,78 +1067,81 @@ struct MultisampleLineInterpolator
 	}
 };
 
-template <typename Interpolator>
-bool verifyTriangleGroupInterpolationWithInterpolator (const tcu::Surface&							surface,
-													   const TriangleSceneSpec&						scene,
-													   const RasterizationArguments&				args,
-													   VerifyTriangleGroupInterpolationLogStash&	logStash,
-													   const Interpolator&							interpolator)
+//! Range of reference colors that may end up in a pixel
+struct PixelColorStack
 {
-	const tcu::RGBA		invalidPixelColor	= tcu::RGBA(255, 0, 0, 255);
-	const bool			multisampled		= (args.numSamples != 0);
-	const tcu::IVec2	viewportSize		= tcu::IVec2(surface.getWidth(), surface.getHeight());
-	const int			errorFloodThreshold	= 4;
-	int					errorCount			= 0;
-	int					invalidPixels		= 0;
-	int					subPixelBits		= args.subpixelBits;
-	tcu::Surface		errorMask			(surface.getWidth(), surface.getHeight());
-
-	tcu::clear(errorMask.getAccess(), tcu::Vec4(0.0f, 0.0f, 0.0f, 1.0f));
-
-	// log format
-
-	logStash.messages.push_back(std::string("Verifying rasterization result. Native format is RGB" + de::toString(args.redBits) + de::toString(args.greenBits) + de::toString(args.blueBits)));
-	if (args.redBits > 8 || args.greenBits > 8 || args.blueBits > 8)
-		logStash.messages.push_back(std::string("Warning! More than 8 bits in a color channel, this may produce false negatives."));
+	int			stackSize;
+	tcu::Vec4	colorStackMin;
+	tcu::Vec4	colorStackMax;
+};
 
-	// subpixel bits in a valid range?
+template <typename Interpolator>
+class ColorStackProcessor : public TileProcessor
+{
+public:
+								ColorStackProcessor	(const TriangleSceneSpec&					scene,
+													 const std::vector<TriangleCoverageSetup>&	setups,
+													 const TriangleBins&						bins,
+													 const Interpolator&						interpolator,
+													 const tcu::IVec2&							viewportSize,
+													 bool										multisampled,
+													 int										subPixelBits,
+													 std::vector<PixelColorStack>&				colorStacks)
+									: m_scene			(scene)
+									, m_setups			(setups)
+									, m_bins			(bins)
+									, m_interpolator	(interpolator)
+									, m_viewportSize	(viewportSize)
+									, m_multisampled	(multisampled)
+									, m_subPixelBits	(subPixelBits)
+									, m_colorStacks		(colorStacks)
+								{
+								}
 
-	if (subPixelBits < 0)
-	{
-		logStash.messages.push_back(std::string("Invalid subpixel count (" + de::toString(subPixelBits) + "), assuming 0"));
-		subPixelBits = 0;
-	}
-	else if (subPixelBits > 16)
-	{
-		// At high subpixel bit counts we might overflow. Checking at lower bit count is ok, but is less strict
-		logStash.messages.push_back(std::string("Subpixel count is greater than 16 (" + de::toString(subPixelBits) + ")."
-												" Checking results using less strict 16 bit requirements. This may produce false positives."));
-		subPixelBits = 16;
-	}
+	void						processTile			(int tileNdx) const;
+
+private:
+	const TriangleSceneSpec&					m_scene;
+	const std::vector<TriangleCoverageSetup>&	m_setups;
+	const TriangleBins&							m_bins;
+	const Interpolator&							m_interpolator;
+	const tcu::IVec2							m_viewportSize;
+	const bool									m_multisampled;
+	const int									m_subPixelBits;
+	std::vector<PixelColorStack>&				m_colorStacks;
+};
 
-	// check pixels
+template <typename Interpolator>
+void ColorStackProcessor<Interpolator>::processTile (int tileNdx) const
+{
+	const tcu::IVec4			tileRect	= m_bins.getTileRect(tileNdx);
+	const std::vector<int>&		bin			= m_bins.getBin(tileNdx);
 
-	for (int y = 0; y < surface.getHeight(); ++y)
-	for (int x = 0; x < surface.getWidth();  ++x)
+	for (int y = tileRect.y(); y <= tileRect.w(); ++y)
+	for (int x = tileRect.x(); x <= tileRect.z(); ++x)
 	{
-		const tcu::RGBA		color				= surface.getPixel(x, y);
 		bool				stackBottomFound	= false;
 		int					stackSize			= 0;
 		tcu::Vec4			colorStackMin;
 		tcu::Vec4			colorStackMax;
 
 		// Iterate triangle coverage front to back, find the stack of pontentially contributing fragments
-		for (int triNdx = (int)scene.triangles.size() - 1; triNdx >= 0; --triNdx)
+		for (int binNdx = (int)bin.size() - 1; binNdx >= 0; --binNdx)
 		{
-			const CoverageType coverage = calculateTriangleCoverage(scene.triangles[triNdx].positions[0],
-																	scene.triangles[triNdx].positions[1],
-																	scene.triangles[triNdx].positions[2],
-																	tcu::IVec2(x, y),
-																	viewportSize,
-																	subPixelBits,
-																	multisampled);
+			const int			triNdx		= bin[binNdx];
+			const CoverageType	coverage	= calculateTriangleCoverage(m_setups[triNdx], tcu::IVec2(x, y));
 
 			if (coverage == COVERAGE_FULL || coverage == COVERAGE_PARTIAL)
 			{
 				// potentially contributes to the result fragment's value
-				const InterpolationRange weights = interpolator.interpolate(triNdx, tcu::IVec2(x, y), viewportSize, multisampled, subPixelBits);
+				const InterpolationRange weights = m_interpolator.interpolate(triNdx, tcu::IVec2(x, y), m_viewportSize, m_multisampled, m_subPixelBits);
 
-				const tcu::Vec4 fragmentColorMax =	de::clamp(weights.max.x(), 0.0f, 1.0f) * scene.triangles[triNdx].colors[0] +
-													de::clamp(weights.max.y(), 0.0f, 1.0f) * scene.triangles[triNdx].colors[1] +
-													de::clamp(weights.max.z(), 0.0f, 1.0f) * scene.triangles[triNdx].colors[2];
-				const tcu::Vec4 fragmentColorMin =	de::clamp(weights.min.x(), 0.0f, 1.0f) * scene.triangles[triNdx].colors[0] +
-													de::clamp(weights.min.y(), 0.0f, 1.0f) * scene.triangles[triNdx].colors[1] +
-													de::clamp(weights.min.z(), 0.0f, 1.0f) * scene.triangles[triNdx].colors[2];
+				const tcu::Vec4 fragmentColorMax =	de::clamp(weights.max.x(), 0.0f, 1.0f) * m_scene.triangles[triNdx].colors[0] +
+													de::clamp(weights.max.y(), 0.0f, 1.0f) * m_scene.triangles[triNdx].colors[1] +
+													de::clamp(weights.max.z(), 0.0f, 1.0f) * m_scene.triangles[triNdx].colors[2];
+				const tcu::Vec4 fragmentColorMin =	de::clamp(weights.min.x(), 0.0f, 1.0f) * m_scene.triangles[triNdx].colors[0] +
+													de::clamp(weights.min.y(), 0.0f, 1.0f) * m_scene.triangles[triNdx].colors[1] +
+													de::clamp(weights.min.z(), 0.0f, 1.0f) * m_scene.triangles[triNdx].colors[2];
 
 				if (stackSize++ == 0)
 				{
@@ -756,6 +1172,77 @@ bool verifyTriangleGroupInterpolationWithInterpolator (const tcu::Surface&
 			colorStackMin = tcu::Vec4(0.0f, 0.0f, 0.0f, 1.0f);
 		}
 
+		{
+			PixelColorStack& pixelStack = m_colorStacks[y * m_viewportSize.x() + x];
+
+			pixelStack.stackSize		= stackSize;
+			pixelStack.colorStackMin	= colorStackMin;
+			pixelStack.colorStackMax	= colorStackMax;
+		}
+	}
+}
+
+template <typename Interpolator>
+bool verifyTriangleGroupInterpolationWithInterpolator (const tcu::Surface&							surface,
+													   const TriangleSceneSpec&						scene,
+													   const RasterizationArguments&				args,
+													   VerifyTriangleGroupInterpolationLogStash&	logStash,
+													   const Interpolator&							interpolator)
+{
+	const tcu::RGBA		invalidPixelColor	= tcu::RGBA(255, 0, 0, 255);
+	const bool			multisampled		= (args.numSamples != 0);
+	const tcu::IVec2	viewportSize		= tcu::IVec2(surface.getWidth(), surface.getHeight());
+	const int			errorFloodThreshold	= 4;
+	int					errorCount			= 0;
+	int					invalidPixels		= 0;
+	int					subPixelBits		= args.subpixelBits;
+	tcu::Surface		errorMask			(surface.getWidth(), surface.getHeight());
+
+	tcu::clear(errorMask.getAccess(), tcu::Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+
+	// log format
+
+	logStash.messages.push_back(std::string("Verifying rasterization result. Native format is RGB" + de::toString(args.redBits) + de::toString(args.greenBits) + de::toString(args.blueBits)));
+	if (args.redBits > 8 || args.greenBits > 8 || args.blueBits > 8)
+		logStash.messages.push_back(std::string("Warning! More than 8 bits in a color channel, this may produce false negatives."));
+
+	// subpixel bits in a valid range?
+
+	if (subPixelBits < 0)
+	{
+		logStash.messages.push_back(std::string("Invalid subpixel count (" + de::toString(subPixelBits) + "), assuming 0"));
+		subPixelBits = 0;
+	}
+	else if (subPixelBits > 16)
+	{
+		// At high subpixel bit counts we might overflow. Checking at lower bit count is ok, but is less strict
+		logStash.messages.push_back(std::string("Subpixel count is greater than 16 (" + de::toString(subPixelBits) + ")."
+												" Checking results using less strict 16 bit requirements. This may produce false positives."));
+		subPixelBits = 16;
+	}
+
+	// calculate reference color ranges
+
+	std::vector<PixelColorStack> colorStacks (surface.getWidth() * surface.getHeight());
+
+	{
+		const std::vector<TriangleCoverageSetup>	setups		= setupTriangleCoverage(scene, viewportSize, subPixelBits, multisampled);
+		const TriangleBins							bins		(scene, setups, viewportSize);
+
+		processTiles(ColorStackProcessor<Interpolator>(scene, setups, bins, interpolator, viewportSize, multisampled, subPixelBits, colorStacks), bins.getNumTiles());
+	}
+
+	// check pixels
+
+	for (int y = 0; y < surface.getHeight(); ++y)
+	for (int x = 0; x < surface.getWidth();  ++x)
+	{
+		const tcu::RGBA				color			= surface.getPixel(x, y);
+		const PixelColorStack&		pixelStack		= colorStacks[y * surface.getWidth() + x];
+		const int					stackSize		= pixelStack.stackSize;
+		tcu::Vec4					colorStackMin	= pixelStack.colorStackMin;
+		tcu::Vec4					colorStackMax	= pixelStack.colorStackMax;
+
 		// Is the result image color in the valid range.
 		if (stackSize == 0)
 		{
@@ -2345,149 +2832,7 @@ bool verifySinglesampleWideLineGroupInterpolation (const tcu::Surface& surface,
 
 CoverageType calculateTriangleCoverage (const tcu::Vec4& p0, const tcu::Vec4& p1, const tcu::Vec4& p2, const tcu::IVec2& pixel, const tcu::IVec2& viewportSize, int subpixelBits, bool multisample)
 {
-	typedef tcu::Vector<deInt64, 2> I64Vec2;
-
-	const deUint64		numSubPixels						= ((deUint64)1) << subpixelBits;
-	const deUint64		pixelHitBoxSize						= (multisample) ? (numSubPixels) : 5;		//!< 5 = ceil(6 * sqrt(2) / 2) to account for a 3 subpixel fuzz around pixel center
-	const bool			order								= isTriangleClockwise(p0, p1, p2);			//!< clockwise / counter-clockwise
-	const tcu::Vec4&	orderedP0							= p0;										//!< vertices of a clockwise triangle
-	const tcu::Vec4&	orderedP1							= (order) ? (p1) : (p2);
-	const tcu::Vec4&	orderedP2							= (order) ? (p2) : (p1);
-	const tcu::Vec2		triangleNormalizedDeviceSpace[3]	=
-	{
-		tcu::Vec2(orderedP0.x() / orderedP0.w(), orderedP0.y() / orderedP0.w()),
-		tcu::Vec2(orderedP1.x() / orderedP1.w(), orderedP1.y() / orderedP1.w()),
-		tcu::Vec2(orderedP2.x() / orderedP2.w(), orderedP2.y() / orderedP2.w()),
-	};
-	const tcu::Vec2		triangleScreenSpace[3]				=
-	{
-		(triangleNormalizedDeviceSpace[0] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
-		(triangleNormalizedDeviceSpace[1] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
-		(triangleNormalizedDeviceSpace[2] + tcu::Vec2(1.0f, 1.0f)) * 0.5f * tcu::Vec2((float)viewportSize.x(), (float)viewportSize.y()),
-	};
-
-	// Broad bounding box - pixel check
-	{
-		const float minX = de::min(de::min(triangleScreenSpace[0].x(), triangleScreenSpace[1].x()), triangleScreenSpace[2].x());
-		const float minY = de::min(de::min(triangleScreenSpace[0].y(), triangleScreenSpace[1].y()), triangleScreenSpace[2].y());
-		const float maxX = de::max(de::max(triangleScreenSpace[0].x(), triangleScreenSpace[1].x()), triangleScreenSpace[2].x());
-		const float maxY = de::max(de::max(triangleScreenSpace[0].y(), triangleScreenSpace[1].y()), triangleScreenSpace[2].y());
-
-		if ((float)pixel.x() > maxX + 1 ||
-			(float)pixel.y() > maxY + 1 ||
-			(float)pixel.x() < minX - 1 ||
-			(float)pixel.y() < minY - 1)
-			return COVERAGE_NONE;
-	}
-
-	// Broad triangle - pixel area intersection
-	{
-		const DVec2 pixelCenterPosition			=	DVec2((double)pixel.x(), (double)pixel.y()) * DVec2((double)numSubPixels, (double)numSubPixels) +
-													DVec2((double)numSubPixels / 2, (double)numSubPixels / 2);
-		const DVec2 triangleSubPixelSpace[3]	=
-		{
-			DVec2(triangleScreenSpace[0].x() * (double)numSubPixels, triangleScreenSpace[0].y() * (double)numSubPixels),
-			DVec2(triangleScreenSpace[1].x() * (double)numSubPixels, triangleScreenSpace[1].y() * (double)numSubPixels),
-			DVec2(triangleScreenSpace[2].x() * (double)numSubPixels, triangleScreenSpace[2].y() * (double)numSubPixels),
-		};
-
-		// Check (using cross product) if pixel center is
-		// a) too far from any edge
-		// b) fully inside all edges
-		bool insideAllEdges = true;
-		for (int vtxNdx = 0; vtxNdx < 3; ++vtxNdx)
-		{
-			const int		otherVtxNdx				= (vtxNdx + 1) % 3;
-			const double	maxPixelDistanceSquared	= (double)(pixelHitBoxSize * pixelHitBoxSize); // Max distance from the pixel center from within the pixel is (sqrt(2) * boxWidth/2). Use 2x value for rounding tolerance
-			const DVec2		edge					= triangleSubPixelSpace[otherVtxNdx]	- triangleSubPixelSpace[vtxNdx];
-			const DVec2		v						= pixelCenterPosition					- triangleSubPixelSpace[vtxNdx];
-			const double	crossProduct			= (edge.x() * v.y() - edge.y() * v.x());
-
-			// distance from edge: (edge x v) / |edge|
-			//     (edge x v) / |edge| > maxPixelDistance
-			// ==> (edge x v)^2 / edge^2 > maxPixelDistance^2    | edge x v > 0
-			// ==> (edge x v)^2 > maxPixelDistance^2 * edge^2
-			if (crossProduct < 0 && crossProduct*crossProduct > maxPixelDistanceSquared * tcu::lengthSquared(edge))
-				return COVERAGE_NONE;
-			if (crossProduct < 0 || crossProduct*crossProduct < maxPixelDistanceSquared * tcu::lengthSquared(edge))
-				insideAllEdges = false;
-		}
-
-		if (insideAllEdges)
-			return COVERAGE_FULL;
-	}
-
-	// Accurate intersection for edge pixels
-	{
-		//  In multisampling, the sample points can be anywhere in the pixel, and in single sampling only in the center.
-		const I64Vec2 pixelCorners[4] =
-		{
-			I64Vec2((pixel.x()+0) * numSubPixels, (pixel.y()+0) * numSubPixels),
-			I64Vec2((pixel.x()+1) * numSubPixels, (pixel.y()+0) * numSubPixels),
-			I64Vec2((pixel.x()+1) * numSubPixels, (pixel.y()+1) * numSubPixels),
-			I64Vec2((pixel.x()+0) * numSubPixels, (pixel.y()+1) * numSubPixels),
-		};
-
-		// 3 subpixel tolerance around pixel center to account for accumulated errors during various line rasterization methods
-		const I64Vec2 pixelCenterCorners[4] =
-		{
-			I64Vec2(pixel.x() * numSubPixels + numSubPixels/2 - 3, pixel.y() * numSubPixels + numSubPixels/2 - 3),
-			I64Vec2(pixel.x() * numSubPixels + numSubPixels/2 + 3, pixel.y() * numSubPixels + numSubPixels/2 - 3),
-			I64Vec2(pixel.x() * numSubPixels + numSubPixels/2 + 3, pixel.y() * numSubPixels + numSubPixels/2 + 3),
-			I64Vec2(pixel.x() * numSubPixels + numSubPixels/2 - 3, pixel.y() * numSubPixels + numSubPixels/2 + 3),
-		};
-
-		// both rounding directions
-		const I64Vec2 triangleSubPixelSpaceFloor[3] =
-		{
-			I64Vec2(deFloorFloatToInt32(triangleScreenSpace[0].x() * (float)numSubPixels), deFloorFloatToInt32(triangleScreenSpace[0].y() * (float)numSubPixels)),
-			I64Vec2(deFloorFloatToInt32(triangleScreenSpace[1].x() * (float)numSubPixels), deFloorFloatToInt32(triangleScreenSpace[1].y() * (float)numSubPixels)),
-			I64Vec2(deFloorFloatToInt32(triangleScreenSpace[2].x() * (float)numSubPixels), deFloorFloatToInt32(triangleScreenSpace[2].y() * (float)numSubPixels)),
-		};
-		const I64Vec2 triangleSubPixelSpaceCeil[3] =
-		{
-			I64Vec2(deCeilFloatToInt32(triangleScreenSpace[0].x() * (float)numSubPixels), deCeilFloatToInt32(triangleScreenSpace[0].y() * (float)numSubPixels)),
-			I64Vec2(deCeilFloatToInt32(triangleScreenSpace[1].x() * (float)numSubPixels), deCeilFloatToInt32(triangleScreenSpace[1].y() * (float)numSubPixels)),
-			I64Vec2(deCeilFloatToInt32(triangleScreenSpace[2].x() * (float)numSubPixels), deCeilFloatToInt32(triangleScreenSpace[2].y() * (float)numSubPixels)),
-		};
-		const I64Vec2* const corners = (multisample) ? (pixelCorners) : (pixelCenterCorners);
-
-		// Test if any edge (with any rounding) intersects the pixel (boundary). If it does => Partial. If not => fully inside or outside
-
-		for (int edgeNdx = 0; edgeNdx < 3; ++edgeNdx)
-		for (int startRounding = 0; startRounding < 4; ++startRounding)
-		for (int endRounding = 0; endRounding < 4; ++endRounding)
-		{
-			const int		nextEdgeNdx	= (edgeNdx+1) % 3;
-			const I64Vec2	startPos	((startRounding&0x01)	? (triangleSubPixelSpaceFloor[edgeNdx].x())		: (triangleSubPixelSpaceCeil[edgeNdx].x()),		(startRounding&0x02)	? (triangleSubPixelSpaceFloor[edgeNdx].y())		: (triangleSubPixelSpaceCeil[edgeNdx].y()));
-			const I64Vec2	endPos		((endRounding&0x01)		? (triangleSubPixelSpaceFloor[nextEdgeNdx].x())	: (triangleSubPixelSpaceCeil[nextEdgeNdx].x()),	(endRounding&0x02)		? (triangleSubPixelSpaceFloor[nextEdgeNdx].y())	: (triangleSubPixelSpaceCeil[nextEdgeNdx].y()));
-
-			for (int pixelEdgeNdx = 0; pixelEdgeNdx < 4; ++pixelEdgeNdx)
-			{
-				const int pixelEdgeEnd = (pixelEdgeNdx + 1) % 4;
-
-				if (lineLineIntersect(startPos, endPos, corners[pixelEdgeNdx], corners[pixelEdgeEnd]))
-					return COVERAGE_PARTIAL;
-			}
-		}
-
-		// fully inside or outside
-		for (int edgeNdx = 0; edgeNdx < 3; ++edgeNdx)
-		{
-			const int		nextEdgeNdx		= (edgeNdx+1) % 3;
-			const I64Vec2&	startPos		= triangleSubPixelSpaceFloor[edgeNdx];
-			const I64Vec2&	endPos			= triangleSubPixelSpaceFloor[nextEdgeNdx];
-			const I64Vec2	edge			= endPos - startPos;
-			const I64Vec2	v				= corners[0] - endPos;
-			const deInt64	crossProduct	= (edge.x() * v.y() - edge.y() * v.x());
-
-			// a corner of the pixel is outside => "fully inside" option is impossible
-			if (crossProduct < 0)
-				return COVERAGE_NONE;
-		}
-
-		return COVERAGE_FULL;
-	}
+	return calculateTriangleCoverage(TriangleCoverageSetup(p0, p1, p2, viewportSize, subpixelBits, multisample), pixel);
 }
 
 static void logTriangleGroupRasterizationStash (const tcu::Surface& surface, tcu::TestLog& log, VerifyTriangleGroupRasterizationLogStash& logStash)
@@ -2558,66 +2903,12 @@ bool verifyTriangleGroupRasterization (const tcu::Surface& surface, const Triang
 
 	tcu::clear(coverageMap.getAccess(), tcu::IVec4(COVERAGE_NONE, 0, 0, 0));
 
-	for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
+	// A pixel ends up with the best coverage any triangle gives it, so tiles can be filled independently
 	{
-		const tcu::IVec4 aabb = getTriangleAABB(scene.triangles[triNdx], viewportSize);
-
-		for (int y = de::max(0, aabb.y()); y <= de::min(aabb.w(), coverageMap.getHeight() - 1); ++y)
-		for (int x = de::max(0, aabb.x()); x <= de::min(aabb.z(), coverageMap.getWidth() - 1); ++x)
-		{
-			if (coverageMap.getAccess().getPixelUint(x, y).x() == COVERAGE_FULL)
-				continue;
+		const std::vector<TriangleCoverageSetup>	setups		= setupTriangleCoverage(scene, viewportSize, subPixelBits, multisampled);
+		const TriangleBins							bins		(scene, setups, viewportSize);
 
-			const CoverageType coverage = calculateTriangleCoverage(scene.triangles[triNdx].positions[0],
-																	scene.triangles[triNdx].positions[1],
-																	scene.triangles[triNdx].positions[2],
-																	tcu::IVec2(x, y),
-																	viewportSize,
-																	subPixelBits,
-																	multisampled);
-
-			if (coverage == COVERAGE_FULL)
-			{
-				coverageMap.getAccess().setPixel(tcu::IVec4(COVERAGE_FULL, 0, 0, 0), x, y);
-			}
-			else if (coverage == COVERAGE_PARTIAL)
-			{
-				CoverageType resultCoverage = COVERAGE_PARTIAL;
-
-				// Sharing an edge with another triangle?
-				// There should always be such a triangle, but the pixel in the other triangle might be
-				// on multiple edges, some of which are not shared. In these cases the coverage cannot be determined.
-				// Assume full coverage if the pixel is only on a shared edge in shared triangle too.
-				if (pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[triNdx], viewportSize))
-				{
-					bool friendFound = false;
-					for (int friendTriNdx = 0; friendTriNdx < (int)scene.triangles.size(); ++friendTriNdx)
-					{
-						if (friendTriNdx == triNdx)
-							continue;
-
-						const CoverageType friendCoverage	= calculateTriangleCoverage(scene.triangles[friendTriNdx].positions[0],
-																						scene.triangles[friendTriNdx].positions[1],
-																						scene.triangles[friendTriNdx].positions[2],
-																						tcu::IVec2(x, y),
-																						viewportSize,
-																						subPixelBits,
-																						multisampled);
-
-						if (friendCoverage != COVERAGE_NONE && pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[friendTriNdx], viewportSize))
-						{
-							friendFound = true;
-							break;
-						}
-					}
-
-					if (friendFound)
-						resultCoverage = COVERAGE_FULL;
-				}
-
-				coverageMap.getAccess().setPixel(tcu::IVec4(resultCoverage, 0, 0, 0), x, y);
-			}
-		}
+		processTiles(CoverageMapProcessor(scene, setups, bins, viewportSize, coverageMap.getAccess()), bins.getNumTiles());
 	}
 
 	// check pixels
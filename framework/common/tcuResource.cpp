@@ -22,14 +22,259 @@
  *//*--------------------------------------------------------------------*/
 
 #include "tcuResource.hpp"
+#include "deMutex.hpp"
+#include "deMemory.h"
 
 #include <stdio.h>
+#include <map>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_SYMBIAN) || (DE_OS == DE_OS_QNX)
+#	define TCU_RESOURCE_MMAP_POSIX 1
+#	include <sys/types.h>
+#	include <sys/stat.h>
+#	include <sys/mman.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#elif (DE_OS == DE_OS_WIN32)
+#	define TCU_RESOURCE_MMAP_WIN32 1
+#	define VC_EXTRALEAN
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <windows.h>
+#endif
 
 namespace tcu
 {
 
+// FileMapping
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Read-only mapping of a whole file into process address space
+ *//*--------------------------------------------------------------------*/
+class FileMapping
+{
+public:
+							FileMapping		(const char* filename);
+							~FileMapping	(void);
+
+	const deUint8*			getData			(void) const { return m_data;	}
+	int						getSize			(void) const { return m_size;	}
+
+private:
+							FileMapping		(const FileMapping& other);
+	FileMapping&			operator=		(const FileMapping& other);
+
+	const deUint8*			m_data;
+	int						m_size;
+#if defined(TCU_RESOURCE_MMAP_WIN32)
+	HANDLE					m_mappingHandle;
+#endif
+};
+
+#if defined(TCU_RESOURCE_MMAP_POSIX)
+
+FileMapping::FileMapping (const char* filename)
+	: m_data	(DE_NULL)
+	, m_size	(0)
+{
+	const int	fd	= open(filename, O_RDONLY);
+	struct stat	st;
+
+	if (fd < 0)
+		throw ResourceError("Failed to open file", filename, __FILE__, __LINE__);
+
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size > 0x7fffffff)
+	{
+		close(fd);
+		throw ResourceError("Failed to query file size", filename, __FILE__, __LINE__);
+	}
+
+	m_size = (int)st.st_size;
+
+	// \note Zero-sized mappings are not allowed, empty files are left unmapped.
+	if (m_size > 0)
+	{
+		void* const ptr = mmap(DE_NULL, (size_t)m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (ptr == MAP_FAILED)
+		{
+			close(fd);
+			throw ResourceError("Failed to map file", filename, __FILE__, __LINE__);
+		}
+
+		m_data = (const deUint8*)ptr;
+	}
+
+	// Mapping keeps the file referenced, descriptor is no longer needed.
+	close(fd);
+}
+
+FileMapping::~FileMapping (void)
+{
+	if (m_data)
+		munmap((void*)m_data, (size_t)m_size);
+}
+
+#elif defined(TCU_RESOURCE_MMAP_WIN32)
+
+FileMapping::FileMapping (const char* filename)
+	: m_data			(DE_NULL)
+	, m_size			(0)
+	, m_mappingHandle	(DE_NULL)
+{
+	const HANDLE	file	= CreateFile(filename, GENERIC_READ, FILE_SHARE_READ, DE_NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, DE_NULL);
+	LARGE_INTEGER	size;
+
+	if (file == INVALID_HANDLE_VALUE)
+		throw ResourceError("Failed to open file", filename, __FILE__, __LINE__);
+
+	if (!GetFileSizeEx(file, &size) || size.QuadPart > 0x7fffffff)
+	{
+		CloseHandle(file);
+		throw ResourceError("Failed to query file size", filename, __FILE__, __LINE__);
+	}
+
+	m_size = (int)size.QuadPart;
+
+	if (m_size > 0)
+	{
+		m_mappingHandle = CreateFileMapping(file, DE_NULL, PAGE_READONLY, 0, 0, DE_NULL);
+
+		if (m_mappingHandle)
+			m_data = (const deUint8*)MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+		if (!m_data)
+		{
+			if (m_mappingHandle)
+				CloseHandle(m_mappingHandle);
+			CloseHandle(file);
+			throw ResourceError("Failed to map file", filename, __FILE__, __LINE__);
+		}
+	}
+
+	CloseHandle(file);
+}
+
+FileMapping::~FileMapping (void)
+{
+	if (m_data)
+		UnmapViewOfFile(m_data);
+
+	if (m_mappingHandle)
+		CloseHandle(m_mappingHandle);
+}
+
+#else
+
+FileMapping::FileMapping (const char* filename)
+	: m_data	(DE_NULL)
+	, m_size	(0)
+{
+	DE_UNREF(filename);
+	DE_FATAL("Memory-mapped files not supported on this platform");
+}
+
+FileMapping::~FileMapping (void)
+{
+}
+
+#endif
+
+// FileMappingCache
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Cache of live file mappings, keyed by full path
+ *
+ * Cache holds only weak references, so a file stays mapped only while some
+ * resource is using it and concurrent or repeated requests for the same
+ * file share one mapping. When the last reference is released the file is
+ * unmapped and its entry removed, which keeps the number of mappings
+ * bounded over long runs.
+ *//*--------------------------------------------------------------------*/
+class FileMappingCache
+{
+public:
+										FileMappingCache	(void) {}
+										~FileMappingCache	(void) { DE_ASSERT(m_mappings.empty()); }
+
+	static de::SharedPtr<FileMapping>	getMapping			(const de::SharedPtr<FileMappingCache>& cache, const std::string& filename);
+
+private:
+										FileMappingCache	(const FileMappingCache& other);
+	FileMappingCache&					operator=			(const FileMappingCache& other);
+
+	struct Entry
+	{
+		const FileMapping*			mapping;
+		de::WeakPtr<FileMapping>	ref;
+	};
+
+	//! Removes cache entry before deleting the mapping. Keeps cache alive until then.
+	struct Deleter
+	{
+		de::SharedPtr<FileMappingCache>	cache;
+		std::string						filename;
+
+		Deleter (const de::SharedPtr<FileMappingCache>& cache_, const std::string& filename_) : cache(cache_), filename(filename_) {}
+
+		void operator() (FileMapping* mapping)
+		{
+			cache->removeMapping(filename, mapping);
+			delete mapping;
+		}
+	};
+
+	void								removeMapping		(const std::string& filename, const FileMapping* mapping);
+
+	typedef std::map<std::string, Entry> MappingMap;
+
+	de::Mutex							m_lock;
+	MappingMap							m_mappings;
+};
+
+de::SharedPtr<FileMapping> FileMappingCache::getMapping (const de::SharedPtr<FileMappingCache>& cache, const std::string& filename)
+{
+	const de::ScopedLock	lock	(cache->m_lock);
+	MappingMap::iterator	pos		= cache->m_mappings.find(filename);
+
+	if (pos != cache->m_mappings.end())
+	{
+		try
+		{
+			return de::SharedPtr<FileMapping>(pos->second.ref);
+		}
+		catch (const de::DeadReferenceException&)
+		{
+			// Last reference was just released, deleter hasn't removed the entry yet.
+		}
+	}
+
+	{
+		const de::SharedPtr<FileMapping>	mapping	(new FileMapping(filename.c_str()), Deleter(cache, filename));
+		Entry&								entry	= cache->m_mappings[filename];
+
+		entry.mapping	= mapping.get();
+		entry.ref		= mapping;
+
+		return mapping;
+	}
+}
+
+void FileMappingCache::removeMapping (const std::string& filename, const FileMapping* mapping)
+{
+	const de::ScopedLock	lock	(m_lock);
+	MappingMap::iterator	pos		= m_mappings.find(filename);
+
+	// Entry may already point to a new mapping of the same file.
+	if (pos != m_mappings.end() && pos->second.mapping == mapping)
+		m_mappings.erase(pos);
+}
+
+// DirArchive
+
 DirArchive::DirArchive (const char* path)
-	: m_path(path)
+	: m_path	(path)
+	, m_cache	(MappedFileResource::isSupported() ? new FileMappingCache() : DE_NULL)
 {
 	// Append leading / if necessary
 	if (m_path.length() > 0 && m_path[m_path.length()-1] != '/')
@@ -42,7 +287,12 @@ DirArchive::~DirArchive ()
 
 Resource* DirArchive::getResource (const char* name) const
 {
-	return static_cast<Resource*>(new FileResource((m_path + name).c_str()));
+	const std::string filename = m_path + name;
+
+	if (m_cache)
+		return static_cast<Resource*>(new MappedFileResource(filename, FileMappingCache::getMapping(m_cache, filename)));
+	else
+		return static_cast<Resource*>(new FileResource(filename.c_str()));
 }
 
 FileResource::FileResource (const char* filename)
@@ -83,6 +333,61 @@ void FileResource::setPosition (int position)
 	fseek(m_file, (size_t)position, SEEK_SET);
 }
 
+// MappedFileResource
+
+MappedFileResource::MappedFileResource (const char* filename)
+	: Resource		(std::string(filename))
+	, m_mapping		(new FileMapping(filename))
+	, m_position	(0)
+{
+}
+
+MappedFileResource::MappedFileResource (const std::string& name, const de::SharedPtr<FileMapping>& mapping)
+	: Resource		(name)
+	, m_mapping		(mapping)
+	, m_position	(0)
+{
+}
+
+MappedFileResource::~MappedFileResource (void)
+{
+}
+
+void MappedFileResource::read (deUint8* dst, int numBytes)
+{
+	TCU_CHECK(numBytes >= 0 && numBytes <= m_mapping->getSize() - m_position);
+
+	if (numBytes > 0)
+		deMemcpy(dst, m_mapping->getData() + m_position, (size_t)numBytes);
+
+	m_position += numBytes;
+}
+
+int MappedFileResource::getSize (void) const
+{
+	return m_mapping->getSize();
+}
+
+void MappedFileResource::setPosition (int position)
+{
+	DE_ASSERT(de::inRange(position, 0, m_mapping->getSize()));
+	m_position = position;
+}
+
+const deUint8* MappedFileResource::getData (void) const
+{
+	return m_mapping->getData();
+}
+
+bool MappedFileResource::isSupported (void)
+{
+#if defined(TCU_RESOURCE_MMAP_POSIX) || defined(TCU_RESOURCE_MMAP_WIN32)
+	return true;
+#else
+	return false;
+#endif
+}
+
 ResourcePrefix::ResourcePrefix (const Archive& archive, const char* prefix)
 	: m_archive	(archive)
 	, m_prefix	(prefix)
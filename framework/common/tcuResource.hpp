@@ -24,6 +24,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "tcuDefs.hpp"
+#include "deSharedPtr.hpp"
 
 #include <string>
 
@@ -52,6 +53,18 @@ public:
 	virtual int			getPosition		(void) const = 0;
 	virtual void		setPosition		(int position) = 0;
 
+	/*--------------------------------------------------------------------*//*!
+	 * \brief Get pointer to resource contents
+	 *
+	 * Resources that are resident in memory (for example memory-mapped
+	 * files) can expose their contents directly to avoid copying them
+	 * through read(). Pointer stays valid until the resource object is
+	 * destroyed and spans getSize() bytes.
+	 *
+	 * \return Pointer to contents or DE_NULL if direct access is not supported
+	 *//*--------------------------------------------------------------------*/
+	virtual const deUint8*	getData		(void) const { return DE_NULL; }
+
 	const std::string&	getName			(void) const { return m_name; }
 
 protected:
@@ -85,8 +98,16 @@ protected:
 						Archive			() {}
 };
 
+class FileMapping;
+class FileMappingCache;
+
 /*--------------------------------------------------------------------*//*!
  * \brief Directory-based archive implementation
+ *
+ * On platforms that support it files are memory-mapped. A mapping is
+ * shared by all resource objects opened for the same file and is released
+ * together with the last of them. Copies of the archive share the same
+ * mappings.
  *//*--------------------------------------------------------------------*/
 class DirArchive : public Archive
 {
@@ -97,12 +118,12 @@ public:
 	Resource*			getResource			(const char* name) const;
 
 	// \note Assignment and copy allowed
-						DirArchive			(const DirArchive& other) : Archive(), m_path(other.m_path) {}
-	DirArchive&			operator=			(const DirArchive& other) { m_path = other.m_path; return *this; }
+						DirArchive			(const DirArchive& other) : Archive(), m_path(other.m_path), m_cache(other.m_cache) {}
+	DirArchive&			operator=			(const DirArchive& other) { m_path = other.m_path; m_cache = other.m_cache; return *this; }
 
 private:
-	std::string			m_path;
-
+	std::string							m_path;
+	de::SharedPtr<FileMappingCache>		m_cache;
 };
 
 class FileResource : public Resource
@@ -123,6 +144,35 @@ private:
 	FILE*				m_file;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Read-only resource backed by a memory-mapped file
+ *
+ * read() copies from the mapping; getData() gives direct access to the
+ * whole file without copies.
+ *//*--------------------------------------------------------------------*/
+class MappedFileResource : public Resource
+{
+public:
+								MappedFileResource	(const char* filename);
+								MappedFileResource	(const std::string& name, const de::SharedPtr<FileMapping>& mapping);
+								~MappedFileResource	(void);
+
+	void						read				(deUint8* dst, int numBytes);
+	int							getSize				(void) const;
+	int							getPosition			(void) const { return m_position;	}
+	void						setPosition			(int position);
+	const deUint8*				getData				(void) const;
+
+	static bool					isSupported			(void);
+
+private:
+								MappedFileResource	(const MappedFileResource& other);
+	MappedFileResource&			operator=			(const MappedFileResource& other);
+
+	de::SharedPtr<FileMapping>	m_mapping;
+	int							m_position;
+};
+
 class ResourcePrefix : public Archive
 {
 public:
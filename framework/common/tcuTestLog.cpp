@@ -23,6 +23,7 @@
 
 #include "deCommandLine.h"
 #include "tcuTestLog.hpp"
+#include "tcuTrace.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuSurface.hpp"
 #include "deMath.h"
@@ -188,6 +189,14 @@ TestLog::TestLog (const char* fileName, deUint32 flags)
 		throw ResourceError(std::string("Failed to open test log file '") + fileName + "'");
 }
 
+TestLog::TestLog (const char* fileName, const char* sharedRingName, deUint32 flags)
+	: m_log(sharedRingName ? qpTestLog_createSharedRingLog(sharedRingName, fileName, flags)
+						   : qpTestLog_createFileLog(fileName, flags))
+{
+	if (!m_log)
+		throw ResourceError(std::string("Failed to open test log file '") + fileName + "'");
+}
+
 void TestLog::writeSessionInfo(std::string additionalInfo)
 {
 	qpTestLog_beginSession(m_log, additionalInfo.c_str());
@@ -241,6 +250,8 @@ static Vector<int, Size> computeScaledSize (const Vector<int, Size>& imageSize,
 
 void TestLog::writeImage (const char* name, const char* description, const ConstPixelBufferAccess& access, const Vec4& pixelScale, const Vec4& pixelBias, qpImageCompressionMode compressionMode)
 {
+	TCU_TRACE_SCOPE("tcu::TestLog::writeImage");
+
 	const TextureFormat&	format		= access.getFormat();
 	int						width		= access.getWidth();
 	int						height		= access.getHeight();
@@ -103,6 +103,7 @@ public:
 	typedef LogNumber<deInt64>		Integer;
 
 	explicit			TestLog					(const char* fileName, deUint32 flags = 0);
+						TestLog					(const char* fileName, const char* sharedRingName, deUint32 flags);
 						~TestLog				(void);
 
 	void				writeSessionInfo		(std::string additionalInfo = "");
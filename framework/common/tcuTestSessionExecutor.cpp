@@ -24,14 +24,40 @@
 #include "tcuTestSessionExecutor.hpp"
 #include "tcuCommandLine.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuTrace.hpp"
 
 #include "deClock.h"
+#include "deStringUtil.hpp"
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+#	include <sys/resource.h>
+#endif
 
 namespace tcu
 {
 
 using std::vector;
 
+//! Peak resident set size of the process in kilobytes, or 0 if not available
+static deInt64 getPeakResidentMemoryKB (void)
+{
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+
+#	if (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS)
+	// Reported in bytes on Apple platforms
+	return (deInt64)usage.ru_maxrss / 1024;
+#	else
+	return (deInt64)usage.ru_maxrss;
+#	endif
+#else
+	return 0;
+#endif
+}
+
 static qpTestCaseType nodeTypeToTestCaseType (TestNodeType nodeType)
 {
 	switch (nodeType)
@@ -55,12 +81,27 @@ TestSessionExecutor::TestSessionExecutor (TestPackageRoot& root, TestContext& te
 	, m_abortSession		(false)
 	, m_isInTestCase		(false)
 	, m_testStartTime		(0)
+	, m_testInitTime		(0)
+	, m_testIterateTime		(0)
 	, m_packageStartTime	(0)
 {
+	if (*testCtx.getCommandLine().getTraceFilename() != 0)
+	{
+		try
+		{
+			trace::enable(testCtx.getCommandLine().getTraceFilename());
+		}
+		catch (const tcu::ResourceError& e)
+		{
+			print("%s\n", e.what());
+		}
+	}
 }
 
 TestSessionExecutor::~TestSessionExecutor (void)
 {
+	if (trace::isEnabled())
+		trace::disable();
 }
 
 bool TestSessionExecutor::iterate (void)
@@ -177,6 +218,22 @@ void TestSessionExecutor::leaveTestPackage (TestPackage* testPackage)
 		m_testCtx.getLog() << TestLog::Integer(it->first, "The test group case duration in microseconds", "us", QP_KEY_TAG_TIME, it->second);
 
 	m_testCtx.getLog().endTestsCasesTime();
+
+	// Events recorded outside test cases, e.g. in package init, are written out here
+	if (trace::isEnabled())
+		flushTrace();
+}
+
+void TestSessionExecutor::flushTrace (void)
+{
+	try
+	{
+		trace::flush();
+	}
+	catch (const tcu::ResourceError& e)
+	{
+		print("%s\n", e.what());
+	}
 }
 
 void TestSessionExecutor::enterTestGroup (const std::string& casePath)
@@ -201,11 +258,14 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 	m_testCtx.setTerminateAfter(false);
 	log.startCase(casePath.c_str(), caseType);
 
-	m_isInTestCase	= true;
-	m_testStartTime	= deGetMicroseconds();
+	m_isInTestCase		= true;
+	m_testStartTime		= deGetMicroseconds();
+	m_testIterateTime	= 0;
 
 	try
 	{
+		TCU_TRACE_SCOPE("tcu::TestCaseExecutor::init");
+
 		m_caseExecutor->init(testCase, casePath);
 		initOk = true;
 	}
@@ -230,6 +290,8 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 		log << e;
 	}
 
+	m_testInitTime = deGetMicroseconds() - m_testStartTime;
+
 	DE_ASSERT(initOk || m_testCtx.getTestResult() != QP_TEST_RESULT_LAST);
 
 	return initOk;
@@ -237,11 +299,14 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 
 void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 {
-	TestLog&	log		= m_testCtx.getLog();
+	TestLog&		log				= m_testCtx.getLog();
+	const deUint64	deinitStartTime	= deGetMicroseconds();
 
 	// De-init case.
 	try
 	{
+		TCU_TRACE_SCOPE("tcu::TestCaseExecutor::deinit");
+
 		m_caseExecutor->deinit(testCase);
 	}
 	catch (const tcu::Exception& e)
@@ -250,6 +315,38 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 		m_testCtx.setTerminateAfter(true);
 	}
 
+	{
+		const deInt64 peakResidentMemory = getPeakResidentMemoryKB();
+
+		log << TestLog::Section("CaseStatistics", "Test case execution statistics")
+			<< TestLog::Integer("InitTime",		"Time spent in test case init",		"us",	QP_KEY_TAG_TIME,	(deInt64)m_testInitTime)
+			<< TestLog::Integer("IterateTime",	"Time spent in test case iterate",	"us",	QP_KEY_TAG_TIME,	(deInt64)m_testIterateTime)
+			<< TestLog::Integer("DeinitTime",	"Time spent in test case deinit",	"us",	QP_KEY_TAG_TIME,	(deInt64)(deGetMicroseconds() - deinitStartTime));
+
+		if (peakResidentMemory > 0)
+			log << TestLog::Integer("PeakResidentMemory", "Peak resident memory of the process", "KiB", QP_KEY_TAG_NONE, peakResidentMemory);
+
+		log << TestLog::EndSection;
+	}
+
+	if (trace::isEnabled())
+	{
+		const vector<trace::Total> totals = trace::getTotals(m_testStartTime);
+
+		if (!totals.empty())
+		{
+			log << TestLog::Section("Trace", "Time spent in traced scopes, nested scopes are included in their parents");
+
+			for (size_t totalNdx = 0; totalNdx < totals.size(); totalNdx++)
+				log << TestLog::Integer(totals[totalNdx].name, (de::toString(totals[totalNdx].count) + " calls").c_str(), "us", QP_KEY_TAG_TIME, (deInt64)totals[totalNdx].totalTime);
+
+			log << TestLog::EndSection;
+		}
+
+		// Drop the events of this case so that trace memory stays bounded by a single case
+		flushTrace();
+	}
+
 	{
 		const deInt64 duration = deGetMicroseconds()-m_testStartTime;
 		m_testStartTime = 0;
@@ -292,11 +389,14 @@ TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase
 {
 	TestLog&				log				= m_testCtx.getLog();
 	TestCase::IterateResult	iterateResult	= TestCase::STOP;
+	const deUint64			startTime		= deGetMicroseconds();
 
 	m_testCtx.touchWatchdog();
 
 	try
 	{
+		TCU_TRACE_SCOPE("tcu::TestCaseExecutor::iterate");
+
 		iterateResult = m_caseExecutor->iterate(testCase);
 	}
 	catch (const std::bad_alloc&)
@@ -316,6 +416,8 @@ TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase
 		m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, e.getMessage());
 	}
 
+	m_testIterateTime += deGetMicroseconds() - startTime;
+
 	return iterateResult;
 }
 
@@ -82,6 +82,8 @@ private:
 	TestCase::IterateResult			iterateTestCase		(TestCase* testCase);
 	void							leaveTestCase		(TestCase* testCase);
 
+	void							flushTrace			(void);
+
 	enum State
 	{
 		STATE_TRAVERSE_HIERARCHY = 0,
@@ -102,6 +104,8 @@ private:
 	bool							m_abortSession;
 	bool							m_isInTestCase;
 	deUint64						m_testStartTime;
+	deUint64						m_testInitTime;
+	deUint64						m_testIterateTime;
 	deUint64						m_packageStartTime;
 	std::map<std::string, deUint64>	m_groupsDurationTime;
 };
@@ -0,0 +1,236 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Scoped timers for tracing where test execution spends time.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuTrace.hpp"
+#include "tcuDefs.hpp"
+
+#include "deMutex.hpp"
+#include "deThreadLocal.hpp"
+#include "deSharedPtr.hpp"
+
+#include <cstdio>
+
+namespace tcu
+{
+namespace trace
+{
+
+using std::vector;
+
+volatile bool g_isEnabled = false;
+
+namespace
+{
+
+struct Event
+{
+	const char*		name;
+	deUint64		beginTime;
+	deUint64		duration;
+};
+
+struct ThreadBuffer
+{
+	de::Mutex		lock;
+	int				threadNdx;
+	vector<Event>	events;
+
+	ThreadBuffer (int threadNdx_) : threadNdx(threadNdx_) {}
+};
+
+// Buffers are kept until the process exits so that events of finished threads are not lost.
+// Their events are dropped once flushed to the file.
+struct TraceState
+{
+	de::Mutex								lock;
+	de::ThreadLocal							currentBuffer;
+	vector<de::SharedPtr<ThreadBuffer> >	buffers;
+	FILE*									file;
+	bool									isFirstEvent;
+
+	TraceState (void) : file(DE_NULL), isFirstEvent(true) {}
+};
+
+// Written after every flush and overwritten by the next one, so that the file is always complete
+const char			s_traceFooter[]		= "\n]}\n";
+const long			s_traceFooterSize	= (long)sizeof(s_traceFooter) - 1;
+
+TraceState& getState (void)
+{
+	static TraceState state;
+	return state;
+}
+
+ThreadBuffer& getThreadBuffer (void)
+{
+	TraceState&		state	= getState();
+	ThreadBuffer*	buffer	= static_cast<ThreadBuffer*>(state.currentBuffer.get());
+
+	if (!buffer)
+	{
+		const de::ScopedLock lock (state.lock);
+
+		state.buffers.push_back(de::SharedPtr<ThreadBuffer>(new ThreadBuffer((int)state.buffers.size())));
+		buffer = state.buffers.back().get();
+		state.currentBuffer.set(buffer);
+	}
+
+	return *buffer;
+}
+
+} // anonymous
+
+void enable (const char* filename)
+{
+	// Construct shared state before any worker thread may need it
+	TraceState&				state	= getState();
+	const de::ScopedLock	lock	(state.lock);
+
+	DE_ASSERT(!state.file);
+
+	state.file			= fopen(filename, "wb");
+	state.isFirstEvent	= true;
+
+	if (!state.file)
+		throw ResourceError(std::string("Failed to open trace file ") + filename);
+
+	fprintf(state.file, "{\"traceEvents\":[%s", s_traceFooter);
+	g_isEnabled = true;
+}
+
+void disable (void)
+{
+	TraceState& state = getState();
+
+	g_isEnabled = false;
+
+	try
+	{
+		flush();
+	}
+	catch (const ResourceError&)
+	{
+		// File is closed regardless, whatever was flushed before remains valid
+	}
+
+	{
+		const de::ScopedLock lock (state.lock);
+
+		if (state.file)
+		{
+			fclose(state.file);
+			state.file = DE_NULL;
+		}
+	}
+}
+
+void record (const char* name, deUint64 beginTime, deUint64 duration)
+{
+	ThreadBuffer&			buffer	= getThreadBuffer();
+	const de::ScopedLock	lock	(buffer.lock);
+	const Event				event	= { name, beginTime, duration };
+
+	buffer.events.push_back(event);
+}
+
+vector<Total> getTotals (deUint64 sinceTime)
+{
+	TraceState&				state	= getState();
+	const de::ScopedLock	lock	(state.lock);
+	vector<Total>			totals;
+
+	for (size_t bufferNdx = 0; bufferNdx < state.buffers.size(); bufferNdx++)
+	{
+		ThreadBuffer&			buffer		= *state.buffers[bufferNdx];
+		const de::ScopedLock	bufferLock	(buffer.lock);
+
+		// Events are appended in completion order, scan backwards until the window starts
+		for (size_t eventNdx = buffer.events.size(); eventNdx > 0; eventNdx--)
+		{
+			const Event&	event		= buffer.events[eventNdx - 1];
+			size_t			totalNdx	= 0;
+
+			if (event.beginTime + event.duration < sinceTime)
+				break;
+
+			if (event.beginTime < sinceTime)
+				continue;
+
+			while (totalNdx < totals.size() && totals[totalNdx].name != event.name)
+				totalNdx++;
+
+			if (totalNdx == totals.size())
+			{
+				const Total total = { event.name, 0, 0 };
+				totals.push_back(total);
+			}
+
+			totals[totalNdx].count		+= 1;
+			totals[totalNdx].totalTime	+= event.duration;
+		}
+	}
+
+	return totals;
+}
+
+void flush (void)
+{
+	TraceState&				state	= getState();
+	const de::ScopedLock	lock	(state.lock);
+	FILE* const				file	= state.file;
+
+	if (!file)
+		return;
+
+	if (fseek(file, -s_traceFooterSize, SEEK_END) != 0)
+		throw ResourceError("Failed to seek trace file");
+
+	for (size_t bufferNdx = 0; bufferNdx < state.buffers.size(); bufferNdx++)
+	{
+		ThreadBuffer&	buffer	= *state.buffers[bufferNdx];
+		vector<Event>	events;
+
+		// Swap out so that the thread can keep recording while events are written
+		{
+			const de::ScopedLock bufferLock (buffer.lock);
+			events.swap(buffer.events);
+		}
+
+		for (size_t eventNdx = 0; eventNdx < events.size(); eventNdx++)
+		{
+			const Event& event = events[eventNdx];
+
+			fprintf(file, "%s{\"name\":\"%s\",\"cat\":\"deqp\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu,\"pid\":0,\"tid\":%d}",
+					state.isFirstEvent ? "\n" : ",\n", event.name, (unsigned long long)event.beginTime, (unsigned long long)event.duration, buffer.threadNdx);
+			state.isFirstEvent = false;
+		}
+	}
+
+	fputs(s_traceFooter, file);
+
+	if (fflush(file) != 0 || ferror(file))
+		throw ResourceError("Failed to write trace file");
+}
+
+} // trace
+} // tcu
@@ -0,0 +1,103 @@
+#ifndef _TCUTRACE_HPP
+#define _TCUTRACE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Scoped timers for tracing where test execution spends time.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "deClock.h"
+
+#include <vector>
+
+namespace tcu
+{
+namespace trace
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Tracing
+ *
+ * Scopes marked with TCU_TRACE_SCOPE() are timed once tracing has been
+ * enabled with enable(). Events are appended to per-thread buffers, where
+ * they can be summed up per scope name, until flush() appends them to the
+ * trace file as Chrome trace-event JSON (chrome://tracing, Perfetto) and
+ * drops them. The file is valid JSON after every flush.
+ *
+ * When tracing is disabled a scope costs a single flag check. Scope names
+ * must be string literals or otherwise outlive the trace.
+ *//*--------------------------------------------------------------------*/
+
+struct Total
+{
+	const char*		name;
+	int				count;
+	deUint64		totalTime;		//!< Sum of scope durations in microseconds
+};
+
+extern volatile bool	g_isEnabled;
+
+inline bool				isEnabled			(void) { return g_isEnabled; }
+
+//! Start tracing into the given file. Throws ResourceError if the file can't be created.
+void					enable				(const char* filename);
+
+//! Flush remaining events, close the trace file and stop tracing
+void					disable				(void);
+
+void					record				(const char* name, deUint64 beginTime, deUint64 duration);
+
+//! Sum of events that began at or after sinceTime, per scope name, in first-seen order
+std::vector<Total>		getTotals			(deUint64 sinceTime);
+
+//! Append all buffered events to the trace file and drop them. Throws ResourceError on I/O failure.
+void					flush				(void);
+
+class Scope
+{
+public:
+					Scope	(const char* name)
+						: m_name		(isEnabled() ? name : DE_NULL)
+						, m_beginTime	(m_name ? deGetMicroseconds() : 0)
+					{
+					}
+
+					~Scope	(void)
+					{
+						if (m_name)
+							record(m_name, m_beginTime, deGetMicroseconds() - m_beginTime);
+					}
+
+private:
+					Scope	(const Scope&);
+	Scope&			operator=	(const Scope&);
+
+	const char*		m_name;
+	const deUint64	m_beginTime;
+};
+
+} // trace
+} // tcu
+
+//! Time the rest of the enclosing scope under NAME
+#define TCU_TRACE_SCOPE(NAME) const tcu::trace::Scope tcuTraceScope_ (NAME)
+
+#endif // _TCUTRACE_HPP
@@ -26,6 +26,16 @@
 #include <float.h>
 #include <math.h>
 
+#if (DE_CPU == DE_CPU_X86_64) || ((DE_CPU == DE_CPU_X86) && defined(__SSE2__))
+#	define DE_RANDOM_USE_SSE2
+#	include <emmintrin.h>
+#endif
+
+enum
+{
+	FILL_CHUNK_SIZE	= 64	/*!< Number of values converted at a time by bulk fills.	*/
+};
+
 DE_BEGIN_EXTERN_C
 
 /*--------------------------------------------------------------------*//*!
@@ -103,4 +113,123 @@ deBool deRandom_getBool (deRandom* rnd)
 	return ((val & 0xFFFFFF) < 0x800000);
 }
 
+#if defined(DE_RANDOM_USE_SSE2)
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Advance a xorshift128 state vector (x, y, z, w) by four values.
+ * \param state	State in lanes 0..3.
+ * \return New state, which also holds the next four values in order.
+ *
+ * Each step computes w' = g(w) ^ h(x) with g(v) = v ^ (v >> 19) and
+ * h(t) = t ^ (t << 11) ^ ((t ^ (t << 11)) >> 8). Both are linear, and
+ * g(g(v)) = v, so w'[k] = h(x[k]) ^ g(h(x[k-1])) ^ w'[k-2] and all four
+ * lanes can be evaluated together.
+ *//*--------------------------------------------------------------------*/
+static __m128i stepXorshift128x4 (__m128i state)
+{
+	const __m128i	oddLanes	= _mm_set_epi32(-1, 0, -1, 0);
+	__m128i			h			= _mm_xor_si128(state, _mm_slli_epi32(state, 11));
+	__m128i			gh;
+	__m128i			gw;
+	__m128i			d;
+
+	h	= _mm_xor_si128(h, _mm_srli_epi32(h, 8));
+	gh	= _mm_xor_si128(h, _mm_srli_epi32(h, 19));
+	gw	= _mm_xor_si128(state, _mm_srli_epi32(state, 19));
+
+	/* d[k] = h[k] ^ g(previous value); previous value of lane 0 is w. */
+	d	= _mm_xor_si128(h, _mm_or_si128(_mm_slli_si128(gh, 4), _mm_srli_si128(gw, 12)));
+
+	/* w'[k] = d[k] ^ w'[k-2], where w'[-1] = w and w'[-2] ^ g(w) is already in d[0]. */
+	return _mm_xor_si128(_mm_xor_si128(d, _mm_slli_si128(d, 8)), _mm_and_si128(_mm_shuffle_epi32(state, _MM_SHUFFLE(3, 3, 3, 3)), oddLanes));
+}
+#endif
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Fill an array with pseudo random uint32s.
+ * \param rnd		Pointer to RNG.
+ * \param dst		Destination array.
+ * \param numValues	Number of values to generate.
+ *
+ * Produces the same values, and leaves the RNG in the same state, as
+ * numValues calls to deRandom_getUint32().
+ *//*--------------------------------------------------------------------*/
+void deRandom_fillUint32 (deRandom* rnd, deUint32* dst, size_t numValues)
+{
+	size_t ndx = 0;
+
+#if defined(DE_RANDOM_USE_SSE2)
+	if (numValues >= 4)
+	{
+		__m128i state = _mm_set_epi32((int)rnd->w, (int)rnd->z, (int)rnd->y, (int)rnd->x);
+
+		for (; ndx + 4 <= numValues; ndx += 4)
+		{
+			state = stepXorshift128x4(state);
+			_mm_storeu_si128((__m128i*)(dst + ndx), state);
+		}
+
+		rnd->x = dst[ndx - 4];
+		rnd->y = dst[ndx - 3];
+		rnd->z = dst[ndx - 2];
+		rnd->w = dst[ndx - 1];
+	}
+#endif
+
+	for (; ndx < numValues; ndx++)
+		dst[ndx] = deRandom_getUint32(rnd);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Fill a buffer with pseudo random bytes.
+ * \param rnd		Pointer to RNG.
+ * \param dst		Destination buffer.
+ * \param numBytes	Number of bytes to generate.
+ *
+ * Each byte is the low 8 bits of a deRandom_getUint32() value, as with
+ * de::Random::getUint8().
+ *//*--------------------------------------------------------------------*/
+void deRandom_fillBytes (deRandom* rnd, void* dst, size_t numBytes)
+{
+	deUint8*	dstBytes	= (deUint8*)dst;
+	deUint32	values		[FILL_CHUNK_SIZE];
+	size_t		chunkStart;
+
+	for (chunkStart = 0; chunkStart < numBytes; chunkStart += FILL_CHUNK_SIZE)
+	{
+		const size_t	chunkSize	= (numBytes - chunkStart < FILL_CHUNK_SIZE) ? numBytes - chunkStart : FILL_CHUNK_SIZE;
+		size_t			ndx;
+
+		deRandom_fillUint32(rnd, values, chunkSize);
+
+		for (ndx = 0; ndx < chunkSize; ndx++)
+			dstBytes[chunkStart + ndx] = (deUint8)values[ndx];
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Fill an array with pseudo random floats in range [0, 1[.
+ * \param rnd		Pointer to RNG.
+ * \param dst		Destination array.
+ * \param numValues	Number of values to generate.
+ *
+ * Produces the same values as numValues calls to deRandom_getFloat().
+ *//*--------------------------------------------------------------------*/
+void deRandom_fillFloat (deRandom* rnd, float* dst, size_t numValues)
+{
+	deUint32	values		[FILL_CHUNK_SIZE];
+	size_t		chunkStart;
+
+	for (chunkStart = 0; chunkStart < numValues; chunkStart += FILL_CHUNK_SIZE)
+	{
+		const size_t	chunkSize	= (numValues - chunkStart < FILL_CHUNK_SIZE) ? numValues - chunkStart : FILL_CHUNK_SIZE;
+		size_t			ndx;
+
+		deRandom_fillUint32(rnd, values, chunkSize);
+
+		for (ndx = 0; ndx < chunkSize; ndx++)
+			dst[chunkStart + ndx] = (float)(values[ndx] & 0xFFFFFFFu) / (float)(0xFFFFFFFu+1);
+	}
+}
+
 DE_END_EXTERN_C
@@ -51,6 +51,10 @@ float		deRandom_getFloat		(deRandom* rnd);
 double		deRandom_getDouble		(deRandom* rnd);
 deBool		deRandom_getBool		(deRandom* rnd);
 
+void		deRandom_fillUint32		(deRandom* rnd, deUint32* dst, size_t numValues);
+void		deRandom_fillBytes		(deRandom* rnd, void* dst, size_t numBytes);
+void		deRandom_fillFloat		(deRandom* rnd, float* dst, size_t numValues);
+
 DE_END_EXTERN_C
 
 #endif /* _DERANDOM_H */
@@ -94,6 +94,32 @@ void Random_selfTest (void)
 			DE_TEST_ASSERT(de::abs(expected[i] - rnd.getFloat()) < epsilon);
 	}
 
+	// fillBytes(), fillUint32(), fillFloat()
+
+	{
+		for (int numValues = 0; numValues < 40; numValues++)
+		{
+			Random		bulk		(4789);
+			Random		scalar		(4789);
+			deUint8		bytes		[40];
+			deUint32	values		[40];
+			float		floats		[40];
+
+			bulk.fillBytes(bytes, (size_t)numValues);
+			bulk.fillUint32(values, (size_t)numValues);
+			bulk.fillFloat(floats, (size_t)numValues);
+
+			for (int i = 0; i < numValues; i++)
+				DE_TEST_ASSERT(bytes[i] == scalar.getUint8());
+			for (int i = 0; i < numValues; i++)
+				DE_TEST_ASSERT(values[i] == scalar.getUint32());
+			for (int i = 0; i < numValues; i++)
+				DE_TEST_ASSERT(floats[i] == scalar.getFloat());
+
+			DE_TEST_ASSERT(bulk == scalar);
+		}
+	}
+
 	// getFloat(a, b)
 
 	{
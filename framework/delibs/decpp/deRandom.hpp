@@ -54,6 +54,11 @@ public:
 	deUint16		getUint16			(void)			{ return (deUint16)deRandom_getUint32(&m_rnd);	}
 	deUint8			getUint8			(void)			{ return (deUint8)deRandom_getUint32(&m_rnd);	}
 
+	// Bulk variants, same values as repeated getUint8() / getUint32() / getFloat() calls
+	void			fillBytes			(void* dst, size_t numBytes)		{ deRandom_fillBytes(&m_rnd, dst, numBytes);	}
+	void			fillUint32			(deUint32* dst, size_t numValues)	{ deRandom_fillUint32(&m_rnd, dst, numValues);	}
+	void			fillFloat			(float* dst, size_t numValues)		{ deRandom_fillFloat(&m_rnd, dst, numValues);	}
+
 	template <class InputIter, class OutputIter>
 	void			choose				(InputIter first, InputIter last, OutputIter result, int numItems);
 
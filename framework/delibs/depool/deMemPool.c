@@ -24,6 +24,8 @@
 #include "deMemPool.h"
 #include "deMemory.h"
 #include "deInt32.h"
+#include "deAtomic.h"
+#include "deThreadLocal.h"
 
 #if defined(DE_SUPPORT_FAILING_POOL_ALLOC)
 #	include "deRandom.h"
@@ -36,7 +38,8 @@ enum
 {
 	INITIAL_PAGE_SIZE		= 128,		/*!< Size for the first allocated memory page.			*/
 	MAX_PAGE_SIZE			= 8096,		/*!< Maximum size for a memory page.					*/
-	MEM_PAGE_BASE_ALIGN		= 4			/*!< Base alignment guarantee for mem page data ptr.	*/
+	MEM_PAGE_BASE_ALIGN		= 4,		/*!< Base alignment guarantee for mem page data ptr.	*/
+	THREAD_PAGE_CACHE_SIZE	= 4			/*!< Number of concurrent pools cached per thread.		*/
 };
 
 typedef struct MemPage_s MemPage;
@@ -82,6 +85,11 @@ struct DebugAlloc_s
  * creating the root pool with the deMemPool_createFailingRoot() function.
  * When the feature is enabled, also creation of sub-pools occasionally
  * fails.
+ *
+ * Root pools created with the DE_MEMPOOL_CONCURRENT flag (and their
+ * children) allow allocations from multiple threads. Each thread allocates
+ * from a page of its own and new pages are linked to the pool without
+ * locking.
  *//*--------------------------------------------------------------------*/
 struct deMemPool_s
 {
@@ -95,6 +103,9 @@ struct deMemPool_s
 
 	MemPage*		currentPage;		/*!< Current memory page from which to allocate.	*/
 
+	deBool			isConcurrent;		/*!< Can allocations be made from multiple threads?	*/
+	deUint32		concurrentId;		/*!< Unique id for thread page caches.				*/
+
 #if defined(DE_SUPPORT_FAILING_POOL_ALLOC)
 	deBool			allowFailing;		/*!< Is allocation failure simulation enabled?		*/
 	deRandom		failRandom;			/*!< RNG for failing allocations.					*/
@@ -160,6 +171,25 @@ static void MemPage_destroy (MemPage* page)
 	deFree(page);
 }
 
+#if defined(DE_THREAD_LOCAL)
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Per-thread page of a concurrent pool.
+ *
+ * Pages are never released before the pool is destroyed and pool ids are
+ * never reused, so a stale entry can't match a live pool.
+ *//*--------------------------------------------------------------------*/
+typedef struct ThreadPageCache_s
+{
+	deUint32	poolId;
+	MemPage*	page;
+} ThreadPageCache;
+
+static DE_THREAD_LOCAL ThreadPageCache	s_threadPageCache[THREAD_PAGE_CACHE_SIZE];
+#endif
+
+static volatile deInt32					s_lastConcurrentPoolId	= 0;
+
 /*--------------------------------------------------------------------*//*!
  * \internal
  * \brief Internal function for creating a new memory pool.
@@ -205,6 +235,12 @@ static deMemPool* createPoolInternal (deMemPool* parent)
 	/* Get utils from parent. */
 	pool->util = parent ? parent->util : DE_NULL;
 
+	if (parent && parent->isConcurrent)
+	{
+		pool->isConcurrent	= DE_TRUE;
+		pool->concurrentId	= (deUint32)deAtomicIncrement32(&s_lastConcurrentPoolId);
+	}
+
 #if defined(DE_SUPPORT_FAILING_POOL_ALLOC)
 	pool->allowFailing = parent ? parent->allowFailing : DE_FALSE;
 	deRandom_init(&pool->failRandom, parent ? deRandom_getUint32(&parent->failRandom) : 0x1234abcd);
@@ -254,6 +290,20 @@ deMemPool* deMemPool_createRoot	(const deMemPoolUtil* util, deUint32 flags)
 		pool->debugAllocListHead	= DE_NULL;
 	}
 #endif
+	if (flags & DE_MEMPOOL_CONCURRENT)
+	{
+		/* Failure simulation and debug allocations keep unsynchronized state in the pool. */
+		DE_ASSERT((flags & (DE_MEMPOOL_ENABLE_FAILING_ALLOCS|DE_MEMPOOL_ENABLE_DEBUG_ALLOCS)) == 0);
+
+#if defined(DE_SUPPORT_FAILING_POOL_ALLOC)
+		pool->allowFailing			= DE_FALSE;
+#endif
+#if defined(DE_SUPPORT_DEBUG_POOLS)
+		pool->enableDebugAllocs		= DE_FALSE;
+#endif
+		pool->isConcurrent			= DE_TRUE;
+		pool->concurrentId			= (deUint32)deAtomicIncrement32(&s_lastConcurrentPoolId);
+	}
 	DE_UNREF(flags); /* in case no debug features enabled */
 
 	/* Get copy of utilities. */
@@ -423,9 +473,139 @@ int deMemPool_getCapacity (const deMemPool* pool, deBool recurse)
 	return numCapacityBytes;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Atomically read the current page of a concurrent pool.
+ *
+ * The page list is never empty, so the exchange never takes place.
+ *//*--------------------------------------------------------------------*/
+DE_INLINE MemPage* loadCurrentPage (deMemPool* pool)
+{
+	return (MemPage*)deAtomicCompareExchangePtr((void* volatile*)&pool->currentPage, DE_NULL, DE_NULL);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Create a page for a concurrent pool and link it to the pool.
+ * \param pool			Concurrent pool.
+ * \param numBytes		Size of the first allocation made from the page.
+ * \param alignBytes	Alignment of the first allocation.
+ * \param allocPtr		Receives the first allocation.
+ * \return The created memory page (or null on failure).
+ *
+ * The page is pushed to the pool's page list with compare-and-swap, so
+ * multiple threads may add pages at the same time.
+ *//*--------------------------------------------------------------------*/
+static MemPage* createConcurrentPage (deMemPool* pool, size_t numBytes, deUint32 alignBytes, void** allocPtr)
+{
+	int			maxAlignPadding		= deMax32(0, ((int)alignBytes)-MEM_PAGE_BASE_ALIGN);
+	int			pageCapacity		= deMax32(MAX_PAGE_SIZE, ((int)numBytes)+maxAlignPadding);
+	MemPage*	page				= MemPage_create((size_t)pageCapacity);
+	void*		alignedPtr;
+
+	if (!page)
+		return DE_NULL;
+
+	alignedPtr				= deAlignPtr((void*)(page + 1), alignBytes);
+	page->bytesAllocated	= (int)((deUintptr)alignedPtr - (deUintptr)(page + 1) + numBytes);
+	DE_ASSERT(page->bytesAllocated <= page->capacity);
+
+	{
+		MemPage* head = loadCurrentPage(pool);
+
+		for (;;)
+		{
+			MemPage* prevHead;
+
+			page->nextPage	= head;
+			prevHead		= (MemPage*)deAtomicCompareExchangePtr((void* volatile*)&pool->currentPage, head, page);
+
+			if (prevHead == head)
+				break;
+
+			head = prevHead;
+		}
+	}
+
+	*allocPtr = alignedPtr;
+	return page;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Allocate memory from a concurrent pool.
+ *
+ * If thread-local storage is available each thread carves its allocations
+ * from a page of its own and only refilling the page touches shared state.
+ * Otherwise allocations are made directly from the pool's current page
+ * using compare-and-swap.
+ *//*--------------------------------------------------------------------*/
+static void* deMemPool_allocConcurrent (deMemPool* pool, size_t numBytes, deUint32 alignBytes)
+{
+	void* ptr = DE_NULL;
+
+	DE_ASSERT(deIsPowerOfTwo32((int)alignBytes));
+
+#if defined(DE_THREAD_LOCAL)
+	{
+		ThreadPageCache*	cache	= &s_threadPageCache[pool->concurrentId % THREAD_PAGE_CACHE_SIZE];
+		MemPage*			page	= (cache->poolId == pool->concurrentId) ? cache->page : DE_NULL;
+
+		if (page)
+		{
+			void*	curPagePtr		= (void*)((deUint8*)(page + 1) + page->bytesAllocated);
+			void*	alignedPtr		= deAlignPtr(curPagePtr, alignBytes);
+			size_t	alignPadding	= (size_t)((deUintptr)alignedPtr - (deUintptr)curPagePtr);
+
+			if (numBytes + alignPadding <= (size_t)(page->capacity - page->bytesAllocated))
+			{
+				page->bytesAllocated += (int)(numBytes + alignPadding);
+				return alignedPtr;
+			}
+		}
+
+		page = createConcurrentPage(pool, numBytes, alignBytes, &ptr);
+		if (!page)
+			return DE_NULL;
+
+		cache->poolId	= pool->concurrentId;
+		cache->page		= page;
+	}
+#else
+	for (;;)
+	{
+		MemPage*	page			= loadCurrentPage(pool);
+		deUint32	bytesAllocated	= deAtomicCompareExchange32((volatile deUint32*)&page->bytesAllocated, 0u, 0u); /* atomic read */
+		void*		curPagePtr		= (void*)((deUint8*)(page + 1) + bytesAllocated);
+		void*		alignedPtr		= deAlignPtr(curPagePtr, alignBytes);
+		size_t		alignPadding	= (size_t)((deUintptr)alignedPtr - (deUintptr)curPagePtr);
+
+		if (numBytes + alignPadding > (size_t)page->capacity - bytesAllocated)
+		{
+			if (!createConcurrentPage(pool, numBytes, alignBytes, &ptr))
+				return DE_NULL;
+			break;
+		}
+
+		if (deAtomicCompareExchange32((volatile deUint32*)&page->bytesAllocated, bytesAllocated, bytesAllocated + (deUint32)(numBytes + alignPadding)) == bytesAllocated)
+		{
+			ptr = alignedPtr;
+			break;
+		}
+	}
+#endif
+
+	return ptr;
+}
+
 DE_INLINE void* deMemPool_allocInternal (deMemPool* pool, size_t numBytes, deUint32 alignBytes)
 {
-	MemPage* curPage = pool->currentPage;
+	MemPage* curPage;
+
+	if (pool->isConcurrent)
+		return deMemPool_allocConcurrent(pool, numBytes, alignBytes);
+
+	curPage = pool->currentPage;
 
 #if defined(DE_SUPPORT_FAILING_POOL_ALLOC)
 	if (pool->allowFailing)
@@ -39,7 +39,8 @@
 typedef enum deMemPoolFlag_e
 {
 	DE_MEMPOOL_ENABLE_FAILING_ALLOCS	= (1<<0),
-	DE_MEMPOOL_ENABLE_DEBUG_ALLOCS		= (1<<1)
+	DE_MEMPOOL_ENABLE_DEBUG_ALLOCS		= (1<<1),
+	DE_MEMPOOL_CONCURRENT				= (1<<2)	/*!< Allocations (deMemPool_alloc() and friends) may be made from multiple threads. Creating and destroying pools must still be synchronized. */
 } deMemPoolFlag;
 
 enum
@@ -144,5 +144,41 @@ void dePoolHash_selfTest (void)
 		DE_TEST_ASSERT(deTestHash_getNumElements(hash) == 0);
 	}
 
+	/* Test repeated insert() and delete() of a sliding key range. */
+	{
+		int	i;
+		int	capacity			= 0;
+		int	numAllocatedBytes	= 0;
+
+		for (i = 0; i < 20000; i++)
+		{
+			deTestHash_insert(hash, (deInt16)i, -i);
+			if (i >= 100)
+				deTestHash_delete(hash, (deInt16)(i - 100));
+
+			/* Purging deleted entries must not grow the table or the pool. */
+			if (i == 1000)
+			{
+				capacity			= hash->capacity;
+				numAllocatedBytes	= deMemPool_getNumAllocatedBytes(pool, DE_FALSE);
+			}
+		}
+
+		DE_TEST_ASSERT(hash->capacity == capacity);
+		DE_TEST_ASSERT(deMemPool_getNumAllocatedBytes(pool, DE_FALSE) == numAllocatedBytes);
+
+		DE_TEST_ASSERT(deTestHash_getNumElements(hash) == 100);
+		for (i = 0; i < 20000; i++)
+		{
+			const int* val = deTestHash_find(hash, (deInt16)i);
+			if (i >= 19900)
+				DE_TEST_ASSERT(val && (*val == -i));
+			else
+				DE_TEST_ASSERT(!val);
+		}
+
+		deTestHash_reset(hash);
+	}
+
 	deMemPool_destroy(pool);
 }
@@ -30,9 +30,17 @@
 
 #include <string.h> /* memset() */
 
+#if (DE_CPU == DE_CPU_X86_64) || ((DE_CPU == DE_CPU_X86) && defined(__SSE2__))
+#	define DE_POOL_HASH_USE_SSE2
+#	include <emmintrin.h>
+#endif
+
 enum
 {
-	DE_HASH_ELEMENTS_PER_SLOT	= 4
+	DE_POOL_HASH_GROUP_SIZE		= 16,		/*!< Number of control bytes probed at once.	*/
+
+	DE_POOL_HASH_CTRL_EMPTY		= 0x80,		/*!< Control byte of an unused entry.			*/
+	DE_POOL_HASH_CTRL_DELETED	= 0xFE		/*!< Control byte of a deleted entry.			*/
 };
 
 DE_BEGIN_EXTERN_C
@@ -41,6 +49,98 @@ void	dePoolHash_selfTest		(void);
 
 DE_END_EXTERN_C
 
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Control byte stored for a used entry (low 7 bits of the hash).
+ *//*--------------------------------------------------------------------*/
+DE_INLINE deUint8 dePoolHash_getTag (deUint32 hashValue)
+{
+	return (deUint8)(hashValue & 0x7Fu);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Index of the first group in the probe sequence of a hash.
+ *//*--------------------------------------------------------------------*/
+DE_INLINE int dePoolHash_getFirstGroup (deUint32 hashValue, int capacity)
+{
+	DE_ASSERT(deIsPowerOfTwo32(capacity) && capacity >= DE_POOL_HASH_GROUP_SIZE);
+	return (int)(((hashValue >> 7) * (deUint32)DE_POOL_HASH_GROUP_SIZE) & (deUint32)(capacity - 1));
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Bit mask of the entries in a group whose control byte is value.
+ *//*--------------------------------------------------------------------*/
+DE_INLINE deUint32 dePoolHash_matchGroup (const deUint8* group, deUint8 value)
+{
+#if defined(DE_POOL_HASH_USE_SSE2)
+	return (deUint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)value), _mm_loadu_si128((const __m128i*)group)));
+#else
+	deUint32	mask	= 0;
+	int			ndx;
+
+	for (ndx = 0; ndx < DE_POOL_HASH_GROUP_SIZE; ndx++)
+		mask |= (group[ndx] == value ? 1u : 0u) << ndx;
+
+	return mask;
+#endif
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Bit mask of the empty or deleted entries in a group.
+ *//*--------------------------------------------------------------------*/
+DE_INLINE deUint32 dePoolHash_matchFree (const deUint8* group)
+{
+#if defined(DE_POOL_HASH_USE_SSE2)
+	return (deUint32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+	deUint32	mask	= 0;
+	int			ndx;
+
+	for (ndx = 0; ndx < DE_POOL_HASH_GROUP_SIZE; ndx++)
+		mask |= (deUint32)(group[ndx] >> 7) << ndx;
+
+	return mask;
+#endif
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Find the first empty or deleted entry in the probe sequence.
+ *
+ * Groups are probed with triangular steps, which visits every group of a
+ * power-of-two table. The table must have at least one free entry.
+ *//*--------------------------------------------------------------------*/
+DE_INLINE int dePoolHash_findFreeEntry (const deUint8* control, int capacity, deUint32 hashValue)
+{
+	int groupNdx	= dePoolHash_getFirstGroup(hashValue, capacity);
+	int step		= 0;
+
+	for (;;)
+	{
+		const deUint32 freeMask = dePoolHash_matchFree(control + groupNdx);
+
+		if (freeMask)
+			return groupNdx + deCtz32(freeMask);
+
+		step		+= DE_POOL_HASH_GROUP_SIZE;
+		groupNdx	= (groupNdx + step) & (capacity - 1);
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \internal
+ * \brief Index of the first used entry at or after ndx (capacity if none).
+ *//*--------------------------------------------------------------------*/
+DE_INLINE int dePoolHash_findNextUsedEntry (const deUint8* control, int capacity, int ndx)
+{
+	while (ndx < capacity && (control[ndx] & DE_POOL_HASH_CTRL_EMPTY) != 0)
+		ndx++;
+	return ndx;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Declare a template pool hash class interface.
  * \param TYPENAME	Type name of the declared hash.
@@ -51,7 +151,13 @@ DE_END_EXTERN_C
  * the hash, see DE_IMPLEMENT_POOL_HASH. Usually this macro is put into the
  * header file and the implementation macro is put in some .c file.
  *
- * \todo [petri] Detailed description.
+ * The hash uses open addressing. Each entry has a control byte that is
+ * either empty, deleted or holds 7 bits of the key's hash. Lookups compare
+ * a group of DE_POOL_HASH_GROUP_SIZE control bytes at once (with SSE2 when
+ * available) and only compare keys whose hash bits match. The table is
+ * kept at most 7/8 full, counting deleted entries. When deleted entries
+ * make up most of that load they are purged in place instead of growing
+ * the table, so insert/delete churn doesn't allocate from the pool.
  *
  * The functions for operating the hash are:
  * \todo [petri] Figure out how to comment these in Doxygen-style.
@@ -66,32 +172,22 @@ DE_END_EXTERN_C
 *//*--------------------------------------------------------------------*/
 #define DE_DECLARE_POOL_HASH(TYPENAME, KEYTYPE, VALUETYPE)		\
 \
-typedef struct TYPENAME##Slot_s TYPENAME##Slot;    \
-\
-struct TYPENAME##Slot_s \
-{    \
-	int				numUsed; \
-	TYPENAME##Slot*	nextSlot; \
-	KEYTYPE			keys[DE_HASH_ELEMENTS_PER_SLOT]; \
-	VALUETYPE		values[DE_HASH_ELEMENTS_PER_SLOT]; \
-}; \
-\
 typedef struct TYPENAME##_s    \
 {    \
 	deMemPool*			pool;				\
 	int					numElements;		\
+	int					numDeleted;			\
 \
-	int					slotTableSize;		\
-	TYPENAME##Slot**	slotTable;			\
-	TYPENAME##Slot*		slotFreeList;		\
+	int					capacity;			\
+	deUint8*			control;			\
+	KEYTYPE*			keys;				\
+	VALUETYPE*			values;				\
 } TYPENAME; /* NOLINT(TYPENAME) */			\
 \
 typedef struct TYPENAME##Iter_s \
 {	\
 	const TYPENAME*			hash;			\
-	int						curSlotIndex;	\
-	const TYPENAME##Slot*	curSlot;		\
-	int						curElemIndex;	\
+	int						curNdx;			\
 } TYPENAME##Iter;	\
 \
 TYPENAME*	TYPENAME##_create	(deMemPool* pool);											\
@@ -115,71 +211,31 @@ DE_INLINE int TYPENAME##_getNumElements (const TYPENAME* hash)    \
 \
 DE_INLINE void TYPENAME##Iter_init (const TYPENAME* hash, TYPENAME##Iter* iter)    \
 {	\
-	iter->hash			= hash;		\
-	iter->curSlotIndex	= 0;		\
-	iter->curSlot		= DE_NULL;	\
-	iter->curElemIndex	= 0;		\
-	if (TYPENAME##_getNumElements(hash) > 0)		\
-	{												\
-		int slotTableSize	= hash->slotTableSize;	\
-		int slotNdx			= 0;					\
-		while (slotNdx < slotTableSize)				\
-		{											\
-			if (hash->slotTable[slotNdx])			\
-				break;								\
-			slotNdx++;								\
-		}											\
-		DE_ASSERT(slotNdx < slotTableSize);			\
-		iter->curSlotIndex = slotNdx;				\
-		iter->curSlot = hash->slotTable[slotNdx];	\
-		DE_ASSERT(iter->curSlot);					\
-	}	\
+	iter->hash		= hash;	\
+	iter->curNdx	= dePoolHash_findNextUsedEntry(hash->control, hash->capacity, 0);	\
 }	\
 \
 DE_INLINE deBool TYPENAME##Iter_hasItem (const TYPENAME##Iter* iter)    \
 {	\
-	return (iter->curSlot != DE_NULL); \
+	return (iter->curNdx < iter->hash->capacity); \
 }	\
 \
 DE_INLINE void TYPENAME##Iter_next (TYPENAME##Iter* iter)    \
 {	\
 	DE_ASSERT(TYPENAME##Iter_hasItem(iter));	\
-	if (++iter->curElemIndex == iter->curSlot->numUsed)	\
-	{													\
-		iter->curElemIndex = 0;							\
-		if (iter->curSlot->nextSlot)					\
-		{												\
-			iter->curSlot = iter->curSlot->nextSlot;	\
-		}												\
-		else											\
-		{												\
-			const TYPENAME*	hash			= iter->hash;			\
-			int				curSlotIndex	= iter->curSlotIndex;	\
-			int				slotTableSize	= hash->slotTableSize;	\
-			while (++curSlotIndex < slotTableSize)		\
-			{											\
-				if (hash->slotTable[curSlotIndex])		\
-					break;								\
-			}											\
-			iter->curSlotIndex = curSlotIndex;			\
-			if (curSlotIndex < slotTableSize)					\
-				iter->curSlot = hash->slotTable[curSlotIndex];	\
-			else												\
-				iter->curSlot = DE_NULL;						\
-		}	\
-	}	\
+	iter->curNdx = dePoolHash_findNextUsedEntry(iter->hash->control, iter->hash->capacity, iter->curNdx + 1);	\
 }	\
 \
 DE_INLINE KEYTYPE TYPENAME##Iter_getKey	(const TYPENAME##Iter* iter)    \
 {	\
 	DE_ASSERT(TYPENAME##Iter_hasItem(iter));	\
-	return iter->curSlot->keys[iter->curElemIndex];	\
+	return iter->hash->keys[iter->curNdx];	\
 }	\
 \
 DE_INLINE VALUETYPE	TYPENAME##Iter_getValue	(const TYPENAME##Iter* iter)    \
 {	\
 	DE_ASSERT(TYPENAME##Iter_hasItem(iter));	\
-	return iter->curSlot->values[iter->curElemIndex];	\
+	return iter->hash->values[iter->curNdx];	\
 }	\
 \
 struct TYPENAME##Dummy_s { int dummy; }
@@ -214,207 +270,197 @@ TYPENAME* TYPENAME##_create (deMemPool* pool)    \
 \
 void TYPENAME##_reset (DE_PTR_TYPE(TYPENAME) hash)    \
 {   \
-	int slotNdx; \
-	for (slotNdx = 0; slotNdx < hash->slotTableSize; slotNdx++)	\
-	{	\
-		TYPENAME##Slot* slot = hash->slotTable[slotNdx]; \
-		while (slot) \
-		{ \
-			TYPENAME##Slot*	nextSlot = slot->nextSlot;	\
-			slot->nextSlot = hash->slotFreeList;		\
-			hash->slotFreeList = slot;	\
-			slot->numUsed = 0;			\
-			slot = nextSlot;			\
-		}	\
-		hash->slotTable[slotNdx] = DE_NULL; \
-	}	\
-	hash->numElements = 0; \
+	if (hash->capacity > 0) \
+		memset(hash->control, DE_POOL_HASH_CTRL_EMPTY, (size_t)hash->capacity); \
+	hash->numElements	= 0; \
+	hash->numDeleted	= 0; \
 }	\
 \
-TYPENAME##Slot* TYPENAME##_allocSlot (DE_PTR_TYPE(TYPENAME) hash)    \
-{   \
-	TYPENAME##Slot* slot; \
-	if (hash->slotFreeList) \
-	{ \
-		slot = hash->slotFreeList; \
-		hash->slotFreeList = hash->slotFreeList->nextSlot; \
-	} \
-	else \
-		slot = (TYPENAME##Slot*)deMemPool_alloc(hash->pool, sizeof(TYPENAME##Slot) * DE_HASH_ELEMENTS_PER_SLOT); \
+deBool TYPENAME##_rehash (DE_PTR_TYPE(TYPENAME) hash, int newCapacity)    \
+{    \
+	deUint8*	newControl	= (deUint8*)deMemPool_alloc(hash->pool, sizeof(deUint8) * (size_t)newCapacity); \
+	KEYTYPE*	newKeys		= (KEYTYPE*)deMemPool_alloc(hash->pool, sizeof(KEYTYPE) * (size_t)newCapacity); \
+	VALUETYPE*	newValues	= (VALUETYPE*)deMemPool_alloc(hash->pool, sizeof(VALUETYPE) * (size_t)newCapacity); \
+	int			ndx; \
 \
-	if (slot) \
-	{ \
-		slot->nextSlot = DE_NULL; \
-		slot->numUsed = 0; \
-	} \
+	DE_ASSERT(deIsPowerOfTwo32(newCapacity) && newCapacity >= DE_POOL_HASH_GROUP_SIZE); \
+	DE_ASSERT(hash->numElements * 8 < newCapacity * 7); \
 \
-	return slot; \
-} \
+	if (!newControl || !newKeys || !newValues) \
+		return DE_FALSE; \
 \
-deBool TYPENAME##_rehash (DE_PTR_TYPE(TYPENAME) hash, int newSlotTableSize)    \
-{    \
-	DE_ASSERT(deIsPowerOfTwo32(newSlotTableSize) && newSlotTableSize > 0); \
-	if (newSlotTableSize > hash->slotTableSize)    \
+	memset(newControl, DE_POOL_HASH_CTRL_EMPTY, (size_t)newCapacity); \
+\
+	for (ndx = 0; ndx < hash->capacity; ndx++) \
 	{ \
-		TYPENAME##Slot**	oldSlotTable = hash->slotTable; \
-		TYPENAME##Slot**	newSlotTable = (TYPENAME##Slot**)deMemPool_alloc(hash->pool, sizeof(TYPENAME##Slot*) * (size_t)newSlotTableSize); \
-		int					oldSlotTableSize = hash->slotTableSize; \
-		int					slotNdx; \
+		if ((hash->control[ndx] & DE_POOL_HASH_CTRL_EMPTY) == 0) \
+		{ \
+			const deUint32	hashValue	= HASHFUNC(hash->keys[ndx]); \
+			const int		newNdx		= dePoolHash_findFreeEntry(newControl, newCapacity, hashValue); \
 \
-		if (!newSlotTable) \
-			return DE_FALSE; \
+			newControl[newNdx]	= dePoolHash_getTag(hashValue); \
+			newKeys[newNdx]		= hash->keys[ndx]; \
+			newValues[newNdx]	= hash->values[ndx]; \
+		} \
+	} \
 \
-		for (slotNdx = 0; slotNdx < oldSlotTableSize; slotNdx++) \
-			newSlotTable[slotNdx] = oldSlotTable[slotNdx]; \
+	hash->capacity		= newCapacity; \
+	hash->control		= newControl; \
+	hash->keys			= newKeys; \
+	hash->values		= newValues; \
+	hash->numDeleted	= 0; \
 \
-		for (slotNdx = oldSlotTableSize; slotNdx < newSlotTableSize; slotNdx++) \
-			newSlotTable[slotNdx] = DE_NULL; \
+	return DE_TRUE;    \
+}    \
 \
-		hash->slotTableSize		= newSlotTableSize; \
-		hash->slotTable			= newSlotTable; \
+void TYPENAME##_purgeDeleted (DE_PTR_TYPE(TYPENAME) hash)    \
+{    \
+	int ndx; \
+\
+	/* Deleted entries become empty and used entries become deleted, i.e. waiting to be placed. */ \
+	for (ndx = 0; ndx < hash->capacity; ndx++) \
+		hash->control[ndx] = (hash->control[ndx] & DE_POOL_HASH_CTRL_EMPTY) ? (deUint8)DE_POOL_HASH_CTRL_EMPTY : (deUint8)DE_POOL_HASH_CTRL_DELETED; \
 \
-		for (slotNdx = 0; slotNdx < oldSlotTableSize; slotNdx++) \
+	for (ndx = 0; ndx < hash->capacity; ndx++) \
+	{ \
+		if (hash->control[ndx] == DE_POOL_HASH_CTRL_DELETED) \
 		{ \
-			TYPENAME##Slot* slot = oldSlotTable[slotNdx]; \
-			newSlotTable[slotNdx] = DE_NULL; \
-			while (slot) \
+			const deUint32	hashValue	= HASHFUNC(hash->keys[ndx]); \
+			const int		newNdx		= dePoolHash_findFreeEntry(hash->control, hash->capacity, hashValue); \
+\
+			if ((newNdx & ~(DE_POOL_HASH_GROUP_SIZE - 1)) == (ndx & ~(DE_POOL_HASH_GROUP_SIZE - 1))) \
+			{ \
+				/* Already in the first group with room, lookups find it in place. */ \
+				hash->control[ndx] = dePoolHash_getTag(hashValue); \
+			} \
+			else if (hash->control[newNdx] == DE_POOL_HASH_CTRL_EMPTY) \
 			{ \
-				int elemNdx; \
-				for (elemNdx = 0; elemNdx < slot->numUsed; elemNdx++) \
-				{ \
-					hash->numElements--; \
-					if (!TYPENAME##_insert(hash, slot->keys[elemNdx], slot->values[elemNdx])) \
-						return DE_FALSE; \
-				} \
-				slot = slot->nextSlot; \
+				hash->control[newNdx]	= dePoolHash_getTag(hashValue); \
+				hash->keys[newNdx]		= hash->keys[ndx]; \
+				hash->values[newNdx]	= hash->values[ndx]; \
+				hash->control[ndx]		= DE_POOL_HASH_CTRL_EMPTY; \
+			} \
+			else \
+			{ \
+				/* Swap with an entry still waiting to be placed and place that one next. */ \
+				KEYTYPE		tmpKey		= hash->keys[newNdx]; \
+				VALUETYPE	tmpValue	= hash->values[newNdx]; \
+\
+				hash->control[newNdx]	= dePoolHash_getTag(hashValue); \
+				hash->keys[newNdx]		= hash->keys[ndx]; \
+				hash->values[newNdx]	= hash->values[ndx]; \
+				hash->keys[ndx]			= tmpKey; \
+				hash->values[ndx]		= tmpValue; \
+				ndx--; \
 			} \
 		} \
 	} \
 \
-	return DE_TRUE;    \
+	hash->numDeleted = 0; \
 }    \
 \
-VALUETYPE* TYPENAME##_find (const TYPENAME* hash, KEYTYPE key)    \
+deBool TYPENAME##_reserve (DE_PTR_TYPE(TYPENAME) hash, int capacity)    \
+{    \
+	int newCapacity = deMax32(DE_POOL_HASH_GROUP_SIZE, hash->capacity); \
+\
+	while (capacity * 8 >= newCapacity * 7) \
+		newCapacity *= 2; \
+\
+	if (newCapacity > hash->capacity) \
+		return TYPENAME##_rehash(hash, newCapacity); \
+\
+	return DE_TRUE; \
+}    \
+\
+int TYPENAME##_findIndex (const TYPENAME* hash, KEYTYPE key)    \
 {    \
 	if (hash->numElements > 0) \
 	{	\
-		int				slotNdx	= (int)(HASHFUNC(key) & (deUint32)(hash->slotTableSize - 1)); \
-		TYPENAME##Slot*	slot	= hash->slotTable[slotNdx]; \
-		DE_ASSERT(deInBounds32(slotNdx, 0, hash->slotTableSize)); \
-	\
-		while (slot) \
+		const deUint32	hashValue	= HASHFUNC(key); \
+		const deUint8	tag			= dePoolHash_getTag(hashValue); \
+		int				groupNdx	= dePoolHash_getFirstGroup(hashValue, hash->capacity); \
+		int				step		= 0; \
+\
+		for (;;) \
 		{ \
-			int elemNdx; \
-			for (elemNdx = 0; elemNdx < slot->numUsed; elemNdx++) \
+			deUint32 matchMask = dePoolHash_matchGroup(hash->control + groupNdx, tag); \
+\
+			while (matchMask) \
 			{ \
-				if (CMPFUNC(slot->keys[elemNdx], key)) \
-					return &slot->values[elemNdx]; \
+				const int ndx = groupNdx + deCtz32(matchMask); \
+				if (CMPFUNC(hash->keys[ndx], key)) \
+					return ndx; \
+				matchMask &= matchMask - 1; \
 			} \
-			slot = slot->nextSlot; \
+\
+			/* Key would have been inserted to the first group with an empty entry. */ \
+			if (dePoolHash_matchGroup(hash->control + groupNdx, DE_POOL_HASH_CTRL_EMPTY)) \
+				break; \
+\
+			step		+= DE_POOL_HASH_GROUP_SIZE; \
+			groupNdx	= (groupNdx + step) & (hash->capacity - 1); \
 		} \
 	} \
 \
-	return DE_NULL; \
+	return -1; \
+}    \
+\
+VALUETYPE* TYPENAME##_find (const TYPENAME* hash, KEYTYPE key)    \
+{    \
+	const int ndx = TYPENAME##_findIndex(hash, key); \
+	return (ndx >= 0) ? &hash->values[ndx] : DE_NULL; \
 }    \
 \
 deBool TYPENAME##_insert (DE_PTR_TYPE(TYPENAME) hash, KEYTYPE key, VALUETYPE value)    \
 {    \
-	int				slotNdx; \
-	TYPENAME##Slot*	slot; \
+	deUint32	hashValue; \
+	int			ndx; \
 \
 	DE_ASSERT(!TYPENAME##_find(hash, key));	\
 \
-	if ((hash->numElements + 1) >= hash->slotTableSize * DE_HASH_ELEMENTS_PER_SLOT) \
-		if (!TYPENAME##_rehash(hash, deMax32(4, 2*hash->slotTableSize))) \
-			return DE_FALSE; \
-\
-	slotNdx	= (int)(HASHFUNC(key) & (deUint32)(hash->slotTableSize - 1)); \
-	DE_ASSERT(slotNdx >= 0 && slotNdx < hash->slotTableSize); \
-	slot	= hash->slotTable[slotNdx]; \
-\
-	if (!slot) \
+	if ((hash->numElements + hash->numDeleted + 1) * 8 >= hash->capacity * 7) \
 	{ \
-		slot = TYPENAME##_allocSlot(hash); \
-		if (!slot) return DE_FALSE; \
-		hash->slotTable[slotNdx] = slot; \
-	} \
-\
-	for (;;) \
-	{ \
-		if (slot->numUsed == DE_HASH_ELEMENTS_PER_SLOT) \
+		/* Grow unless most of the load comes from deleted entries. */ \
+		if ((hash->numElements + 1) * 16 >= hash->capacity * 7) \
 		{ \
-			if (slot->nextSlot) \
-				slot = slot->nextSlot; \
-			else \
-			{ \
-				TYPENAME##Slot* nextSlot = TYPENAME##_allocSlot(hash); \
-				if (!nextSlot) return DE_FALSE; \
-				slot->nextSlot = nextSlot; \
-				slot = nextSlot; \
-			} \
+			if (!TYPENAME##_rehash(hash, deMax32(DE_POOL_HASH_GROUP_SIZE, 2*hash->capacity))) \
+				return DE_FALSE; \
 		} \
 		else \
-		{ \
-			slot->keys[slot->numUsed]	= key; \
-			slot->values[slot->numUsed]	= value; \
-			slot->numUsed++; \
-			hash->numElements++; \
-			return DE_TRUE; \
-		} \
+			TYPENAME##_purgeDeleted(hash); \
 	} \
+\
+	hashValue	= HASHFUNC(key); \
+	ndx			= dePoolHash_findFreeEntry(hash->control, hash->capacity, hashValue); \
+\
+	if (hash->control[ndx] == DE_POOL_HASH_CTRL_DELETED) \
+		hash->numDeleted--; \
+\
+	hash->control[ndx]	= dePoolHash_getTag(hashValue); \
+	hash->keys[ndx]		= key; \
+	hash->values[ndx]	= value; \
+	hash->numElements++; \
+\
+	return DE_TRUE; \
 } \
 \
 void TYPENAME##_delete (DE_PTR_TYPE(TYPENAME) hash, KEYTYPE key)    \
 {    \
-	int				slotNdx; \
-	TYPENAME##Slot*	slot; \
-	TYPENAME##Slot*	prevSlot = DE_NULL; \
+	const int	ndx			= TYPENAME##_findIndex(hash, key); \
+	const int	groupNdx	= ndx & ~(DE_POOL_HASH_GROUP_SIZE - 1); \
 \
-	DE_ASSERT(hash->numElements > 0); \
-	slotNdx	= (int)(HASHFUNC(key) & (deUint32)(hash->slotTableSize - 1)); \
-	DE_ASSERT(slotNdx >= 0 && slotNdx < hash->slotTableSize); \
-	slot	= hash->slotTable[slotNdx]; \
-	DE_ASSERT(slot); \
+	DE_ASSERT(ndx >= 0); \
 \
-	for (;;) \
+	/* Lookups stop at a group with an empty entry, so entries in such group don't need a tombstone. */ \
+	if (dePoolHash_matchGroup(hash->control + groupNdx, DE_POOL_HASH_CTRL_EMPTY)) \
+		hash->control[ndx] = DE_POOL_HASH_CTRL_EMPTY; \
+	else \
 	{ \
-		int elemNdx; \
-		DE_ASSERT(slot->numUsed > 0); \
-		for (elemNdx = 0; elemNdx < slot->numUsed; elemNdx++) \
-		{ \
-			if (CMPFUNC(slot->keys[elemNdx], key)) \
-			{ \
-				TYPENAME##Slot*	lastSlot = slot; \
-				while (lastSlot->nextSlot) \
-				{ \
-					prevSlot = lastSlot; \
-					lastSlot = lastSlot->nextSlot; \
-				} \
-\
-				slot->keys[elemNdx]		= lastSlot->keys[lastSlot->numUsed-1]; \
-				slot->values[elemNdx]	= lastSlot->values[lastSlot->numUsed-1]; \
-				lastSlot->numUsed--; \
-\
-				if (lastSlot->numUsed == 0) \
-				{ \
-					if (prevSlot) \
-						prevSlot->nextSlot = DE_NULL; \
-					else \
-						hash->slotTable[slotNdx] = DE_NULL; \
-\
-					lastSlot->nextSlot = hash->slotFreeList; \
-					hash->slotFreeList = lastSlot; \
-				} \
-\
-				hash->numElements--; \
-				return; \
-			} \
-		} \
-\
-		prevSlot = slot; \
-		slot = slot->nextSlot; \
-		DE_ASSERT(slot); \
+		hash->control[ndx] = DE_POOL_HASH_CTRL_DELETED; \
+		hash->numDeleted++; \
 	} \
+\
+	hash->numElements--; \
 }    \
 struct TYPENAME##Dummy2_s { int dummy; }
 
@@ -429,27 +475,21 @@ deBool HASHTYPENAME##_copyToArray(const HASHTYPENAME* hash, DE_PTR_TYPE(KEYARRAY
 {	\
 	int numElements	= hash->numElements;	\
 	int arrayNdx	= 0;	\
-	int slotNdx;	\
+	int ndx;	\
 	\
 	if ((keyArray && !KEYARRAYTYPENAME##_setSize(keyArray, numElements)) ||			\
 		(valueArray && !VALUEARRAYTYPENAME##_setSize(valueArray, numElements)))		\
 		return DE_FALSE;	\
 	\
-	for (slotNdx = 0; slotNdx < hash->slotTableSize; slotNdx++) \
+	for (ndx = 0; ndx < hash->capacity; ndx++) \
 	{ \
-		const HASHTYPENAME##Slot* slot = hash->slotTable[slotNdx]; \
-		while (slot) \
-		{ \
-			int elemNdx; \
-			for (elemNdx = 0; elemNdx < slot->numUsed; elemNdx++) \
-			{	\
-				if (keyArray)	\
-					KEYARRAYTYPENAME##_set(keyArray, arrayNdx, slot->keys[elemNdx]); \
-				if (valueArray)	\
-					VALUEARRAYTYPENAME##_set(valueArray, arrayNdx, slot->values[elemNdx]);	\
-				arrayNdx++;	\
-			} \
-			slot = slot->nextSlot; \
+		if ((hash->control[ndx] & DE_POOL_HASH_CTRL_EMPTY) == 0) \
+		{	\
+			if (keyArray)	\
+				KEYARRAYTYPENAME##_set(keyArray, arrayNdx, hash->keys[ndx]); \
+			if (valueArray)	\
+				VALUEARRAYTYPENAME##_set(valueArray, arrayNdx, hash->values[ndx]);	\
+			arrayNdx++;	\
 		} \
 	}	\
 	DE_ASSERT(arrayNdx == numElements);	\
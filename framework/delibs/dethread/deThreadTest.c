@@ -26,6 +26,7 @@
 #include "deMutex.h"
 #include "deSemaphore.h"
 #include "deMemory.h"
+#include "deInt32.h"
 #include "deRandom.h"
 #include "deAtomic.h"
 #include "deThreadLocal.h"
@@ -689,3 +690,99 @@ void deSingleton_selfTest (void)
 			runSingletonThreadedTest(numThreads, initTimeMs);
 	}
 }
+
+/* Concurrent memory pool self-test. */
+
+DE_DECLARE_POOL_ARRAY(deConcurrentPoolBlockArray, deUint8*);
+
+typedef struct ConcurrentPoolThreadData_s
+{
+	deMemPool*					pool;
+	deUint32					seed;
+	deConcurrentPoolBlockArray*	blocks;
+} ConcurrentPoolThreadData;
+
+static size_t getConcurrentPoolBlockSize (deRandom* rnd)
+{
+	/* Mostly small allocations, sometimes larger than a pool page. */
+	return (deRandom_getUint32(rnd) % 64 == 0) ? (size_t)(9000 + deRandom_getUint32(rnd) % 1000) : (size_t)(1 + deRandom_getUint32(rnd) % 200);
+}
+
+static void concurrentPoolTestThread (void* arg)
+{
+	ConcurrentPoolThreadData*	data	= (ConcurrentPoolThreadData*)arg;
+	deRandom					rnd;
+	int							blockNdx;
+
+	deRandom_init(&rnd, data->seed);
+
+	/* Pool containers can be used on the shared pool as long as each container stays in one thread. */
+	data->blocks = deConcurrentPoolBlockArray_create(data->pool);
+	DE_TEST_ASSERT(data->blocks);
+
+	for (blockNdx = 0; blockNdx < 2000; blockNdx++)
+	{
+		const size_t	size	= getConcurrentPoolBlockSize(&rnd);
+		const deBool	aligned	= (blockNdx % 3) == 0;
+		deUint8*		block	= aligned ? (deUint8*)deMemPool_alignedAlloc(data->pool, size, 16) : (deUint8*)deMemPool_alloc(data->pool, size);
+
+		DE_TEST_ASSERT(block);
+		DE_TEST_ASSERT(!aligned || deIsAlignedPtr(block, 16));
+
+		deMemset(block, (int)(deUint8)(data->seed + (deUint32)blockNdx), size);
+		DE_TEST_ASSERT(deConcurrentPoolBlockArray_pushBack(data->blocks, block));
+	}
+}
+
+void deMemPoolConcurrent_selfTest (void)
+{
+	enum { NUM_THREADS = 4 };
+
+	deMemPool*					pool	= deMemPool_createRoot(DE_NULL, DE_MEMPOOL_CONCURRENT);
+	ConcurrentPoolThreadData	data	[NUM_THREADS];
+	deThread					threads	[NUM_THREADS];
+	int							threadNdx;
+
+	DE_TEST_ASSERT(pool);
+
+	for (threadNdx = 0; threadNdx < NUM_THREADS; threadNdx++)
+	{
+		data[threadNdx].pool	= pool;
+		data[threadNdx].seed	= 0x1234u + (deUint32)threadNdx * 0x3d;
+		data[threadNdx].blocks	= DE_NULL;
+
+		threads[threadNdx] = deThread_create(concurrentPoolTestThread, &data[threadNdx], DE_NULL);
+		DE_TEST_ASSERT(threads[threadNdx]);
+	}
+
+	for (threadNdx = 0; threadNdx < NUM_THREADS; threadNdx++)
+	{
+		DE_TEST_ASSERT(deThread_join(threads[threadNdx]));
+		deThread_destroy(threads[threadNdx]);
+	}
+
+	/* Blocks must not overlap: every block still holds the pattern its thread wrote. */
+	for (threadNdx = 0; threadNdx < NUM_THREADS; threadNdx++)
+	{
+		deRandom	rnd;
+		int			blockNdx;
+
+		deRandom_init(&rnd, data[threadNdx].seed);
+		DE_TEST_ASSERT(deConcurrentPoolBlockArray_getNumElements(data[threadNdx].blocks) == 2000);
+
+		for (blockNdx = 0; blockNdx < 2000; blockNdx++)
+		{
+			const size_t	size	= getConcurrentPoolBlockSize(&rnd);
+			const deUint8	value	= (deUint8)(data[threadNdx].seed + (deUint32)blockNdx);
+			const deUint8*	block	= deConcurrentPoolBlockArray_get(data[threadNdx].blocks, blockNdx);
+			size_t			ndx;
+
+			for (ndx = 0; ndx < size; ndx++)
+				DE_TEST_ASSERT(block[ndx] == value);
+		}
+	}
+
+	DE_TEST_ASSERT(deMemPool_getNumAllocatedBytes(pool, DE_FALSE) <= deMemPool_getCapacity(pool, DE_FALSE));
+
+	deMemPool_destroy(pool);
+}
@@ -44,6 +44,10 @@ int main (int argc, char* argv[])
 	deAtomic_selfTest();
 	printf("ok\n");
 
+	printf("Testing concurrent deMemPool... ");
+	deMemPoolConcurrent_selfTest();
+	printf("ok\n");
+
 	printf("All tests ok!\n");
 	return 0;
 }
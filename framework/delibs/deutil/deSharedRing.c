@@ -0,0 +1,542 @@
+/*-------------------------------------------------------------------------
+ * drawElements Utility Library
+ * ----------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Inter-process byte ring buffer in named shared memory.
+ *//*--------------------------------------------------------------------*/
+
+#include "deSharedRing.h"
+#include "deMemory.h"
+#include "deString.h"
+#include "deThread.h"
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_QNX)
+
+#include "deInt32.h"
+#include "deAtomic.h"
+#include "deClock.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <string.h>
+
+enum
+{
+	RING_MAGIC			= 0x476e6952,	/* "RinG" */
+	CACHE_LINE_SIZE		= 64
+};
+
+typedef enum RingFlag_e
+{
+	RINGFLAG_PRODUCER_ATTACHED	= (1<<0),
+	RINGFLAG_PRODUCER_CLOSED	= (1<<1),
+	RINGFLAG_CONSUMER_CLOSED	= (1<<2),
+	RINGFLAG_ABANDONED			= (1<<3)	/*!< Producer gave up on the ring, nothing more will be written. */
+} RingFlag;
+
+/* Shared header, followed by ring data. Positions run freely and wrap at 2^32. */
+typedef struct RingHeader_s
+{
+	deUint32			magic;
+	deUint32			dataSize;
+	deUint32			consumerPid;		/*!< For detecting a consumer that exited without closing the ring.	*/
+	volatile deUint32	flags;
+	deUint8				pad0[CACHE_LINE_SIZE - 4*sizeof(deUint32)];
+
+	volatile deUint32	writePos;			/*!< Only written by producer.	*/
+	deUint8				pad1[CACHE_LINE_SIZE - sizeof(deUint32)];
+
+	volatile deUint32	readPos;			/*!< Only written by consumer.	*/
+	deUint8				pad2[CACHE_LINE_SIZE - sizeof(deUint32)];
+} RingHeader;
+
+struct deSharedRing_s
+{
+	RingHeader*			header;
+	deUint8*			data;
+	size_t				mappedSize;
+	char*				name;				/*!< Consumer only, for unlinking the shared memory object.	*/
+};
+
+static deUint32 setFlags (RingHeader* header, deUint32 flags)
+{
+	for (;;)
+	{
+		const deUint32 oldFlags = header->flags;
+
+		if (deAtomicCompareExchangeUint32(&header->flags, oldFlags, oldFlags|flags) == oldFlags)
+			return oldFlags;
+	}
+}
+
+static deSharedRing* createRing (void* ptr, size_t mappedSize)
+{
+	deSharedRing* ring = (deSharedRing*)deCalloc(sizeof(deSharedRing));
+
+	if (!ring)
+		return DE_NULL;
+
+	ring->header		= (RingHeader*)ptr;
+	ring->data			= (deUint8*)ptr + sizeof(RingHeader);
+	ring->mappedSize	= mappedSize;
+
+	return ring;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Create a new ring
+ * \param name	Name of the shared memory object, must start with '/' and
+ *				must not exist yet
+ * \param size	Ring data size, power of two, at most 2GiB
+ * \return Ring instance, or DE_NULL if creating shared memory failed
+ *//*--------------------------------------------------------------------*/
+deSharedRing* deSharedRing_create (const char* name, size_t size)
+{
+	const size_t	mappedSize	= sizeof(RingHeader) + size;
+	const size_t	nameLen		= strlen(name);
+	deSharedRing*	ring		= DE_NULL;
+	void*			ptr			= MAP_FAILED;
+	int				fd;
+
+	DE_ASSERT(name[0] == '/');
+	DE_ASSERT(deIsPowerOfTwoSize(size) && size > 0 && size <= 0x80000000u);
+
+	fd = shm_open(name, O_RDWR|O_CREAT|O_EXCL, 0600);
+	if (fd < 0)
+		return DE_NULL;
+
+	if (ftruncate(fd, (off_t)mappedSize) == 0)
+		ptr = mmap(DE_NULL, mappedSize, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+
+	close(fd);
+
+	if (ptr != MAP_FAILED)
+		ring = createRing(ptr, mappedSize);
+
+	if (ring)
+		ring->name = (char*)deMalloc(nameLen + 1);
+
+	if (!ring || !ring->name)
+	{
+		if (ptr != MAP_FAILED)
+			munmap(ptr, mappedSize);
+
+		if (ring)
+			deFree(ring);
+
+		shm_unlink(name);
+		return DE_NULL;
+	}
+
+	deMemcpy(ring->name, name, nameLen + 1);
+
+	/* Shared memory is zero-initialized, publish magic last so that a half-initialized ring is never accepted. */
+	ring->header->dataSize		= (deUint32)size;
+	ring->header->consumerPid	= (deUint32)getpid();
+	deMemoryReadWriteFence();
+	ring->header->magic = RING_MAGIC;
+
+	return ring;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Attach to a ring as the producer
+ * \param name Name the consumer created the ring with
+ * \return Ring instance, or DE_NULL if the ring doesn't exist or already
+ *		   has a producer
+ *//*--------------------------------------------------------------------*/
+deSharedRing* deSharedRing_open (const char* name)
+{
+	deSharedRing*	ring	= DE_NULL;
+	void*			ptr		= MAP_FAILED;
+	struct stat		st;
+	int				fd;
+
+	fd = shm_open(name, O_RDWR, 0);
+	if (fd < 0)
+		return DE_NULL;
+
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size > sizeof(RingHeader))
+		ptr = mmap(DE_NULL, (size_t)st.st_size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+
+	close(fd);
+
+	if (ptr == MAP_FAILED)
+		return DE_NULL;
+
+	{
+		RingHeader* header = (RingHeader*)ptr;
+
+		if (header->magic != RING_MAGIC																||
+			sizeof(RingHeader) + header->dataSize != (size_t)st.st_size								||
+			(setFlags(header, RINGFLAG_PRODUCER_ATTACHED) & RINGFLAG_PRODUCER_ATTACHED) != 0		||
+			!(ring = createRing(ptr, (size_t)st.st_size)))
+		{
+			munmap(ptr, (size_t)st.st_size);
+			return DE_NULL;
+		}
+	}
+
+	deMemoryReadWriteFence();
+
+	return ring;
+}
+
+void deSharedRing_destroy (deSharedRing* ring)
+{
+	DE_ASSERT(ring);
+
+	/* Make sure everything written so far is visible before the other end sees the flag. */
+	deMemoryReadWriteFence();
+	setFlags(ring->header, ring->name ? RINGFLAG_CONSUMER_CLOSED : RINGFLAG_PRODUCER_CLOSED);
+
+	munmap(ring->header, ring->mappedSize);
+
+	if (ring->name)
+	{
+		shm_unlink(ring->name);
+		deFree(ring->name);
+	}
+
+	deFree(ring);
+}
+
+static deBool isConsumerAlive (const RingHeader* header)
+{
+	if (header->flags & RINGFLAG_CONSUMER_CLOSED)
+		return DE_FALSE;
+
+	/* Signal 0 only checks that the process exists. */
+	return kill((pid_t)header->consumerPid, 0) == 0 || errno != ESRCH;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Write data to ring
+ * \param timeoutMs Maximum time to wait for the consumer to make room
+ *
+ * Waits for the consumer while the ring is full. If the consumer has
+ * closed the ring or exited, or makes no room within timeoutMs, the ring
+ * is abandoned and this and all further writes fail.
+ * \return Number of bytes written, less than numBytes if the ring was abandoned
+ *//*--------------------------------------------------------------------*/
+size_t deSharedRing_write (deSharedRing* ring, const void* data, size_t numBytes, deUint32 timeoutMs)
+{
+	RingHeader* const	header			= ring->header;
+	const size_t		dataSize		= header->dataSize;
+	const deUint8*		src				= (const deUint8*)data;
+	const size_t		totalBytes		= numBytes;
+	deUint32			writePos		= header->writePos;
+	deUint64			waitStartTime	= 0;
+
+	DE_ASSERT(!ring->name);
+
+	if (header->flags & RINGFLAG_ABANDONED)
+		return 0;
+
+	while (numBytes > 0)
+	{
+		const deUint32	readPos	= header->readPos;
+		size_t			numFree;
+		size_t			chunkSize;
+		size_t			offset;
+		size_t			firstSize;
+
+		/* Don't overwrite anything the consumer is still reading. */
+		deMemoryReadWriteFence();
+
+		numFree = dataSize - (size_t)(writePos - readPos);
+
+		if (numFree == 0)
+		{
+			if (waitStartTime == 0)
+				waitStartTime = deGetMicroseconds();
+
+			if (!isConsumerAlive(header) || deGetMicroseconds() - waitStartTime > (deUint64)timeoutMs * 1000u)
+			{
+				setFlags(header, RINGFLAG_ABANDONED);
+				break;
+			}
+
+			deSleep(1);
+			continue;
+		}
+
+		waitStartTime = 0;
+
+		chunkSize	= (numBytes < numFree) ? numBytes : numFree;
+		offset		= (size_t)writePos & (dataSize - 1);
+		firstSize	= (chunkSize < dataSize - offset) ? chunkSize : dataSize - offset;
+
+		deMemcpy(ring->data + offset, src, firstSize);
+		deMemcpy(ring->data, src + firstSize, chunkSize - firstSize);
+
+		/* Publish data before the position. */
+		deMemoryReadWriteFence();
+
+		writePos			+= (deUint32)chunkSize;
+		header->writePos	= writePos;
+
+		src			+= chunkSize;
+		numBytes	-= chunkSize;
+	}
+
+	return totalBytes - numBytes;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Read available data from ring without waiting
+ * \return Number of bytes read
+ *//*--------------------------------------------------------------------*/
+size_t deSharedRing_read (deSharedRing* ring, void* dst, size_t maxBytes)
+{
+	RingHeader* const	header		= ring->header;
+	const size_t		dataSize	= header->dataSize;
+	const deUint32		readPos		= header->readPos;
+	const deUint32		writePos	= header->writePos;
+	const size_t		numAvail	= (size_t)(writePos - readPos);
+	const size_t		chunkSize	= (maxBytes < numAvail) ? maxBytes : numAvail;
+	const size_t		offset		= (size_t)readPos & (dataSize - 1);
+	const size_t		firstSize	= (chunkSize < dataSize - offset) ? chunkSize : dataSize - offset;
+
+	DE_ASSERT(ring->name);
+
+	if (chunkSize == 0)
+		return 0;
+
+	/* Read data only after observing the position. */
+	deMemoryReadWriteFence();
+
+	deMemcpy(dst, ring->data + offset, firstSize);
+	deMemcpy((deUint8*)dst + firstSize, ring->data, chunkSize - firstSize);
+
+	/* Finish reading before handing space back to producer. */
+	deMemoryReadWriteFence();
+
+	header->readPos = readPos + (deUint32)chunkSize;
+
+	return chunkSize;
+}
+
+deBool deSharedRing_isProducerAttached (const deSharedRing* ring)
+{
+	return (ring->header->flags & RINGFLAG_PRODUCER_ATTACHED) != 0;
+}
+
+deBool deSharedRing_isProducerClosed (const deSharedRing* ring)
+{
+	return (ring->header->flags & RINGFLAG_PRODUCER_CLOSED) != 0;
+}
+
+deBool deSharedRing_isAbandoned (const deSharedRing* ring)
+{
+	return (ring->header->flags & RINGFLAG_ABANDONED) != 0;
+}
+
+#define DE_SHARED_RING_SUPPORTED 1
+
+#else
+
+/* \note No shared memory support, callers fall back to other transports. */
+
+deSharedRing* deSharedRing_create (const char* name, size_t size)
+{
+	DE_UNREF(name);
+	DE_UNREF(size);
+	return DE_NULL;
+}
+
+deSharedRing* deSharedRing_open (const char* name)
+{
+	DE_UNREF(name);
+	return DE_NULL;
+}
+
+void deSharedRing_destroy (deSharedRing* ring)
+{
+	DE_UNREF(ring);
+	DE_ASSERT(DE_FALSE);
+}
+
+size_t deSharedRing_write (deSharedRing* ring, const void* data, size_t numBytes, deUint32 timeoutMs)
+{
+	DE_UNREF(ring);
+	DE_UNREF(data);
+	DE_UNREF(numBytes);
+	DE_UNREF(timeoutMs);
+	DE_ASSERT(DE_FALSE);
+	return 0;
+}
+
+size_t deSharedRing_read (deSharedRing* ring, void* dst, size_t maxBytes)
+{
+	DE_UNREF(ring);
+	DE_UNREF(dst);
+	DE_UNREF(maxBytes);
+	DE_ASSERT(DE_FALSE);
+	return 0;
+}
+
+deBool deSharedRing_isProducerAttached (const deSharedRing* ring)
+{
+	DE_UNREF(ring);
+	DE_ASSERT(DE_FALSE);
+	return DE_FALSE;
+}
+
+deBool deSharedRing_isProducerClosed (const deSharedRing* ring)
+{
+	DE_UNREF(ring);
+	DE_ASSERT(DE_FALSE);
+	return DE_FALSE;
+}
+
+deBool deSharedRing_isAbandoned (const deSharedRing* ring)
+{
+	DE_UNREF(ring);
+	DE_ASSERT(DE_FALSE);
+	return DE_FALSE;
+}
+
+#endif
+
+typedef struct SelfTestProducer_s
+{
+	deSharedRing*	ring;
+	const deUint8*	data;
+	size_t			size;
+} SelfTestProducer;
+
+static void selfTestProducerFunc (void* arg)
+{
+	const SelfTestProducer*	producer	= (const SelfTestProducer*)arg;
+	size_t					pos			= 0;
+	size_t					chunkSize	= 1;
+
+	/* Chunks both smaller and larger than the ring. */
+	while (pos < producer->size)
+	{
+		const size_t numBytes = (chunkSize < producer->size - pos) ? chunkSize : producer->size - pos;
+
+		DE_TEST_ASSERT(deSharedRing_write(producer->ring, producer->data + pos, numBytes, 10000u) == numBytes);
+
+		pos			+= numBytes;
+		chunkSize	= (chunkSize * 7 + 3) % 1000;
+	}
+}
+
+void deSharedRing_selfTest (void)
+{
+#if defined(DE_SHARED_RING_SUPPORTED)
+	enum
+	{
+		RING_SIZE	= 256,
+		DATA_SIZE	= 64*1024
+	};
+
+	char				name[64];
+	deUint8*			src			= (deUint8*)deMalloc(DATA_SIZE);
+	deUint8*			dst			= (deUint8*)deMalloc(DATA_SIZE);
+	deSharedRing*		consumer;
+	SelfTestProducer	producer;
+	deThread			thread;
+	size_t				numRead		= 0;
+	int					ndx;
+
+	DE_TEST_ASSERT(src && dst);
+
+	for (ndx = 0; ndx < DATA_SIZE; ndx++)
+		src[ndx] = (deUint8)(ndx * 13 + (ndx >> 8));
+
+	deSprintf(name, sizeof(name), "/deSharedRingTest-%d", (int)getpid());
+
+	consumer = deSharedRing_create(name, RING_SIZE);
+	DE_TEST_ASSERT(consumer);
+	DE_TEST_ASSERT(!deSharedRing_create(name, RING_SIZE));
+	DE_TEST_ASSERT(!deSharedRing_isProducerAttached(consumer));
+
+	producer.ring	= deSharedRing_open(name);
+	producer.data	= src;
+	producer.size	= DATA_SIZE;
+
+	DE_TEST_ASSERT(producer.ring);
+	DE_TEST_ASSERT(!deSharedRing_open(name));
+	DE_TEST_ASSERT(deSharedRing_isProducerAttached(consumer));
+
+	thread = deThread_create(selfTestProducerFunc, &producer, DE_NULL);
+	DE_TEST_ASSERT(thread);
+
+	while (numRead < DATA_SIZE)
+	{
+		const size_t numBytes = deSharedRing_read(consumer, dst + numRead, (size_t)(numRead % 300) + 1);
+
+		if (numBytes == 0)
+			deYield();
+
+		numRead += numBytes;
+	}
+
+	DE_TEST_ASSERT(deThread_join(thread));
+	deThread_destroy(thread);
+
+	DE_TEST_ASSERT(deMemCmp(src, dst, DATA_SIZE) == 0);
+	DE_TEST_ASSERT(deSharedRing_read(consumer, dst, DATA_SIZE) == 0);
+
+	DE_TEST_ASSERT(!deSharedRing_isProducerClosed(consumer));
+	deSharedRing_destroy(producer.ring);
+	DE_TEST_ASSERT(deSharedRing_isProducerClosed(consumer));
+
+	deSharedRing_destroy(consumer);
+	DE_TEST_ASSERT(!deSharedRing_open(name));
+
+	/* Producer gives up on a consumer that doesn't read. */
+	consumer		= deSharedRing_create(name, RING_SIZE);
+	producer.ring	= deSharedRing_open(name);
+	DE_TEST_ASSERT(consumer && producer.ring);
+
+	DE_TEST_ASSERT(deSharedRing_write(producer.ring, src, RING_SIZE + 1, 10u) == RING_SIZE);
+	DE_TEST_ASSERT(deSharedRing_isAbandoned(consumer));
+	DE_TEST_ASSERT(deSharedRing_write(producer.ring, src, 1, 10u) == 0);
+	DE_TEST_ASSERT(deSharedRing_read(consumer, dst, DATA_SIZE) == RING_SIZE);
+	DE_TEST_ASSERT(deSharedRing_write(producer.ring, src, 1, 10u) == 0);
+
+	deSharedRing_destroy(producer.ring);
+	deSharedRing_destroy(consumer);
+
+	/* Producer gives up right away on a closed consumer. */
+	consumer		= deSharedRing_create(name, RING_SIZE);
+	producer.ring	= deSharedRing_open(name);
+	DE_TEST_ASSERT(consumer && producer.ring);
+
+	deSharedRing_destroy(consumer);
+	DE_TEST_ASSERT(deSharedRing_write(producer.ring, src, RING_SIZE, 100000u) == RING_SIZE);
+	DE_TEST_ASSERT(deSharedRing_write(producer.ring, src, 1, 100000u) == 0);
+
+	deSharedRing_destroy(producer.ring);
+
+	deFree(src);
+	deFree(dst);
+#else
+	DE_TEST_ASSERT(!deSharedRing_create("/deSharedRingTest", 256));
+	DE_TEST_ASSERT(!deSharedRing_open("/deSharedRingTest"));
+#endif
+}
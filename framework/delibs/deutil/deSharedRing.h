@@ -0,0 +1,62 @@
+#ifndef _DESHAREDRING_H
+#define _DESHAREDRING_H
+/*-------------------------------------------------------------------------
+ * drawElements Utility Library
+ * ----------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Inter-process byte ring buffer in named shared memory.
+ *
+ * Single producer, single consumer. The consumer creates and owns the
+ * ring, and the producer attaches to it by name from another process.
+ * Data written by the producer stays readable after the producer process
+ * has exited or crashed.
+ *
+ * The producer gives up on the ring if the consumer closes it, exits, or
+ * doesn't make room within the write timeout. The ring is then marked as
+ * abandoned and the producer is expected to continue on another channel.
+ *
+ * Only supported on platforms with POSIX shared memory; elsewhere
+ * creating and opening a ring always fails.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.h"
+
+DE_BEGIN_EXTERN_C
+
+typedef struct deSharedRing_s deSharedRing;
+
+/* Consumer. */
+deSharedRing*	deSharedRing_create				(const char* name, size_t size);
+size_t			deSharedRing_read				(deSharedRing* ring, void* dst, size_t maxBytes);
+deBool			deSharedRing_isProducerAttached	(const deSharedRing* ring);
+deBool			deSharedRing_isProducerClosed	(const deSharedRing* ring);
+deBool			deSharedRing_isAbandoned		(const deSharedRing* ring);
+
+/* Producer. */
+deSharedRing*	deSharedRing_open				(const char* name);
+size_t			deSharedRing_write				(deSharedRing* ring, const void* data, size_t numBytes, deUint32 timeoutMs);
+
+/* Closing the producer end signals end of stream, closing the consumer end makes further writes fail. */
+void			deSharedRing_destroy			(deSharedRing* ring);
+
+void			deSharedRing_selfTest			(void);
+
+DE_END_EXTERN_C
+
+#endif /* _DESHAREDRING_H */
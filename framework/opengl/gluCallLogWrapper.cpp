@@ -36,6 +36,7 @@ CallLogWrapper::CallLogWrapper (const glw::Functions& gl, tcu::TestLog& log)
 	: m_gl			(gl)
 	, m_log			(log)
 	, m_enableLog	(false)
+	, m_enableTrace	(false)
 {
 }
 
@@ -43,6 +44,29 @@ CallLogWrapper::~CallLogWrapper (void)
 {
 }
 
+void CallLogWrapper::enableCallTrace (bool enable)
+{
+	if (enable && m_trace.getSize() == 0)
+		m_trace.setSize(DEFAULT_CALL_TRACE_SIZE);
+
+	m_enableTrace = enable;
+}
+
+void CallLogWrapper::logCallTrace (void)
+{
+	std::vector<std::string> calls;
+
+	m_trace.decode(calls);
+	m_trace.clear();
+
+	m_log << TestLog::Section("CallTrace", "Recorded GL calls");
+
+	for (size_t callNdx = 0; callNdx < calls.size(); callNdx++)
+		m_log << TestLog::Message << calls[callNdx] << TestLog::EndMessage;
+
+	m_log << TestLog::EndSection;
+}
+
 template <typename T>
 inline tcu::Format::ArrayPointer<T> getPointerStr (const T* arr, deUint32 size)
 {
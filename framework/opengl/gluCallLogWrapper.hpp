@@ -24,6 +24,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "gluDefs.hpp"
+#include "gluCallTrace.hpp"
 #include "tcuTestLog.hpp"
 #include "glwDefs.hpp"
 
@@ -48,10 +49,25 @@ public:
 	bool					isLoggingEnabled		(void)			{ return m_enableLog; }
 	tcu::TestLog&			getLog					(void)			{ return m_log; }
 
+	//! Record calls into a binary ring buffer, independent of text logging.
+	void					enableCallTrace			(bool enable);
+	bool					isCallTraceEnabled		(void)			{ return m_enableTrace; }
+	CallTrace&				getCallTrace			(void)			{ return m_trace; }
+
+	//! Write recorded calls to the log as text and clear the trace.
+	void					logCallTrace			(void);
+
 private:
+	enum
+	{
+		DEFAULT_CALL_TRACE_SIZE	= 64*1024	//!< In 64-bit words, fits about 13k calls of typical size.
+	};
+
 	const glw::Functions&	m_gl;
 	tcu::TestLog&			m_log;
 	bool					m_enableLog;
+	bool					m_enableTrace;
+	CallTrace				m_trace;
 } DE_WARN_UNUSED_TYPE;
 
 } // glu
@@ -8,6 +8,8 @@ void CallLogWrapper::glActiveShaderProgram (glw::GLuint pipeline, glw::GLuint pr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glActiveShaderProgram(" << pipeline << ", " << program << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glActiveShaderProgram", 2).addUint(pipeline).addUint(program);
 	m_gl.activeShaderProgram(pipeline, program);
 }
 
@@ -15,6 +17,8 @@ void CallLogWrapper::glActiveTexture (glw::GLenum texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glActiveTexture(" << getTextureUnitStr(texture) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glActiveTexture", 1).addHex(texture);
 	m_gl.activeTexture(texture);
 }
 
@@ -22,6 +26,8 @@ void CallLogWrapper::glAttachShader (glw::GLuint program, glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glAttachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glAttachShader", 2).addUint(program).addUint(shader);
 	m_gl.attachShader(program, shader);
 }
 
@@ -29,6 +35,8 @@ void CallLogWrapper::glBeginConditionalRender (glw::GLuint id, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginConditionalRender(" << id << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBeginConditionalRender", 2).addUint(id).addHex(mode);
 	m_gl.beginConditionalRender(id, mode);
 }
 
@@ -36,6 +44,8 @@ void CallLogWrapper::glBeginQuery (glw::GLenum target, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginQuery(" << getQueryTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBeginQuery", 2).addHex(target).addUint(id);
 	m_gl.beginQuery(target, id);
 }
 
@@ -43,6 +53,8 @@ void CallLogWrapper::glBeginQueryIndexed (glw::GLenum target, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginQueryIndexed(" << toHex(target) << ", " << index << ", " << id << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBeginQueryIndexed", 3).addHex(target).addUint(index).addUint(id);
 	m_gl.beginQueryIndexed(target, index, id);
 }
 
@@ -50,6 +62,8 @@ void CallLogWrapper::glBeginTransformFeedback (glw::GLenum primitiveMode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginTransformFeedback(" << getPrimitiveTypeStr(primitiveMode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBeginTransformFeedback", 1).addHex(primitiveMode);
 	m_gl.beginTransformFeedback(primitiveMode);
 }
 
@@ -57,6 +71,8 @@ void CallLogWrapper::glBindAttribLocation (glw::GLuint program, glw::GLuint inde
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindAttribLocation(" << program << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindAttribLocation", 3).addUint(program).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.bindAttribLocation(program, index, name);
 }
 
@@ -64,6 +80,8 @@ void CallLogWrapper::glBindBuffer (glw::GLenum target, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffer(" << getBufferTargetStr(target) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindBuffer", 2).addHex(target).addUint(buffer);
 	m_gl.bindBuffer(target, buffer);
 }
 
@@ -71,6 +89,8 @@ void CallLogWrapper::glBindBufferBase (glw::GLenum target, glw::GLuint index, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBufferBase(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindBufferBase", 3).addHex(target).addUint(index).addUint(buffer);
 	m_gl.bindBufferBase(target, index, buffer);
 }
 
@@ -78,6 +98,8 @@ void CallLogWrapper::glBindBufferRange (glw::GLenum target, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBufferRange(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindBufferRange", 5).addHex(target).addUint(index).addUint(buffer).addInt(offset).addInt(size);
 	m_gl.bindBufferRange(target, index, buffer, offset, size);
 }
 
@@ -85,6 +107,8 @@ void CallLogWrapper::glBindBuffersBase (glw::GLenum target, glw::GLuint first, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffersBase(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindBuffersBase", 4).addHex(target).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers)));
 	m_gl.bindBuffersBase(target, first, count, buffers);
 }
 
@@ -92,6 +116,8 @@ void CallLogWrapper::glBindBuffersRange (glw::GLenum target, glw::GLuint first,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffersRange(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sizes))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindBuffersRange", 6).addHex(target).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(sizes)));
 	m_gl.bindBuffersRange(target, first, count, buffers, offsets, sizes);
 }
 
@@ -99,6 +125,8 @@ void CallLogWrapper::glBindFragDataLocation (glw::GLuint program, glw::GLuint co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFragDataLocation(" << program << ", " << color << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindFragDataLocation", 3).addUint(program).addUint(color).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.bindFragDataLocation(program, color, name);
 }
 
@@ -106,6 +134,8 @@ void CallLogWrapper::glBindFragDataLocationIndexed (glw::GLuint program, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFragDataLocationIndexed(" << program << ", " << colorNumber << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindFragDataLocationIndexed", 4).addUint(program).addUint(colorNumber).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.bindFragDataLocationIndexed(program, colorNumber, index, name);
 }
 
@@ -113,6 +143,8 @@ void CallLogWrapper::glBindFramebuffer (glw::GLenum target, glw::GLuint framebuf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFramebuffer(" << getFramebufferTargetStr(target) << ", " << framebuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindFramebuffer", 2).addHex(target).addUint(framebuffer);
 	m_gl.bindFramebuffer(target, framebuffer);
 }
 
@@ -120,6 +152,8 @@ void CallLogWrapper::glBindImageTexture (glw::GLuint unit, glw::GLuint texture,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindImageTexture(" << unit << ", " << texture << ", " << level << ", " << getBooleanStr(layered) << ", " << layer << ", " << getImageAccessStr(access) << ", " << getUncompressedTextureFormatStr(format) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindImageTexture", 7).addUint(unit).addUint(texture).addInt(level).addBoolean(layered).addInt(layer).addHex(access).addHex(format);
 	m_gl.bindImageTexture(unit, texture, level, layered, layer, access, format);
 }
 
@@ -127,6 +161,8 @@ void CallLogWrapper::glBindImageTextures (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindImageTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindImageTextures", 3).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(textures)));
 	m_gl.bindImageTextures(first, count, textures);
 }
 
@@ -134,6 +170,8 @@ void CallLogWrapper::glBindMultiTextureEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindMultiTextureEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << texture << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindMultiTextureEXT", 3).addHex(texunit).addHex(target).addUint(texture);
 	m_gl.bindMultiTextureEXT(texunit, target, texture);
 }
 
@@ -141,6 +179,8 @@ void CallLogWrapper::glBindProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindProgramPipeline", 1).addUint(pipeline);
 	m_gl.bindProgramPipeline(pipeline);
 }
 
@@ -148,6 +188,8 @@ void CallLogWrapper::glBindRenderbuffer (glw::GLenum target, glw::GLuint renderb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindRenderbuffer(" << getFramebufferTargetStr(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindRenderbuffer", 2).addHex(target).addUint(renderbuffer);
 	m_gl.bindRenderbuffer(target, renderbuffer);
 }
 
@@ -155,6 +197,8 @@ void CallLogWrapper::glBindSampler (glw::GLuint unit, glw::GLuint sampler)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindSampler(" << unit << ", " << sampler << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindSampler", 2).addUint(unit).addUint(sampler);
 	m_gl.bindSampler(unit, sampler);
 }
 
@@ -162,6 +206,8 @@ void CallLogWrapper::glBindSamplers (glw::GLuint first, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindSamplers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindSamplers", 3).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers)));
 	m_gl.bindSamplers(first, count, samplers);
 }
 
@@ -169,6 +215,8 @@ void CallLogWrapper::glBindTexture (glw::GLenum target, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTexture(" << getTextureTargetStr(target) << ", " << texture << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindTexture", 2).addHex(target).addUint(texture);
 	m_gl.bindTexture(target, texture);
 }
 
@@ -176,6 +224,8 @@ void CallLogWrapper::glBindTextureUnit (glw::GLuint unit, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTextureUnit(" << unit << ", " << texture << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindTextureUnit", 2).addUint(unit).addUint(texture);
 	m_gl.bindTextureUnit(unit, texture);
 }
 
@@ -183,6 +233,8 @@ void CallLogWrapper::glBindTextures (glw::GLuint first, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindTextures", 3).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(textures)));
 	m_gl.bindTextures(first, count, textures);
 }
 
@@ -190,6 +242,8 @@ void CallLogWrapper::glBindTransformFeedback (glw::GLenum target, glw::GLuint id
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTransformFeedback(" << getTransformFeedbackTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindTransformFeedback", 2).addHex(target).addUint(id);
 	m_gl.bindTransformFeedback(target, id);
 }
 
@@ -197,6 +251,8 @@ void CallLogWrapper::glBindVertexArray (glw::GLuint array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexArray(" << array << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindVertexArray", 1).addUint(array);
 	m_gl.bindVertexArray(array);
 }
 
@@ -204,6 +260,8 @@ void CallLogWrapper::glBindVertexBuffer (glw::GLuint bindingindex, glw::GLuint b
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexBuffer(" << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindVertexBuffer", 4).addUint(bindingindex).addUint(buffer).addInt(offset).addInt(stride);
 	m_gl.bindVertexBuffer(bindingindex, buffer, offset, stride);
 }
 
@@ -211,6 +269,8 @@ void CallLogWrapper::glBindVertexBuffers (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexBuffers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBindVertexBuffers", 5).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(strides)));
 	m_gl.bindVertexBuffers(first, count, buffers, offsets, strides);
 }
 
@@ -218,6 +278,8 @@ void CallLogWrapper::glBlendBarrier (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendBarrier(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendBarrier", 0);
 	m_gl.blendBarrier();
 }
 
@@ -225,6 +287,8 @@ void CallLogWrapper::glBlendColor (glw::GLfloat red, glw::GLfloat green, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendColor", 4).addFloat(red).addFloat(green).addFloat(blue).addFloat(alpha);
 	m_gl.blendColor(red, green, blue, alpha);
 }
 
@@ -232,6 +296,8 @@ void CallLogWrapper::glBlendEquation (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquation(" << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendEquation", 1).addHex(mode);
 	m_gl.blendEquation(mode);
 }
 
@@ -239,6 +305,8 @@ void CallLogWrapper::glBlendEquationSeparate (glw::GLenum modeRGB, glw::GLenum m
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationSeparate(" << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendEquationSeparate", 2).addHex(modeRGB).addHex(modeAlpha);
 	m_gl.blendEquationSeparate(modeRGB, modeAlpha);
 }
 
@@ -246,6 +314,8 @@ void CallLogWrapper::glBlendEquationSeparatei (glw::GLuint buf, glw::GLenum mode
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationSeparatei(" << buf << ", " << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendEquationSeparatei", 3).addUint(buf).addHex(modeRGB).addHex(modeAlpha);
 	m_gl.blendEquationSeparatei(buf, modeRGB, modeAlpha);
 }
 
@@ -253,6 +323,8 @@ void CallLogWrapper::glBlendEquationi (glw::GLuint buf, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationi(" << buf << ", " << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendEquationi", 2).addUint(buf).addHex(mode);
 	m_gl.blendEquationi(buf, mode);
 }
 
@@ -260,6 +332,8 @@ void CallLogWrapper::glBlendFunc (glw::GLenum sfactor, glw::GLenum dfactor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFunc(" << getBlendFactorStr(sfactor) << ", " << getBlendFactorStr(dfactor) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendFunc", 2).addHex(sfactor).addHex(dfactor);
 	m_gl.blendFunc(sfactor, dfactor);
 }
 
@@ -267,6 +341,8 @@ void CallLogWrapper::glBlendFuncSeparate (glw::GLenum sfactorRGB, glw::GLenum df
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFuncSeparate(" << getBlendFactorStr(sfactorRGB) << ", " << getBlendFactorStr(dfactorRGB) << ", " << getBlendFactorStr(sfactorAlpha) << ", " << getBlendFactorStr(dfactorAlpha) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendFuncSeparate", 4).addHex(sfactorRGB).addHex(dfactorRGB).addHex(sfactorAlpha).addHex(dfactorAlpha);
 	m_gl.blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 }
 
@@ -274,6 +350,8 @@ void CallLogWrapper::glBlendFuncSeparatei (glw::GLuint buf, glw::GLenum srcRGB,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFuncSeparatei(" << buf << ", " << toHex(srcRGB) << ", " << toHex(dstRGB) << ", " << toHex(srcAlpha) << ", " << toHex(dstAlpha) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendFuncSeparatei", 5).addUint(buf).addHex(srcRGB).addHex(dstRGB).addHex(srcAlpha).addHex(dstAlpha);
 	m_gl.blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
@@ -281,6 +359,8 @@ void CallLogWrapper::glBlendFunci (glw::GLuint buf, glw::GLenum src, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFunci(" << buf << ", " << toHex(src) << ", " << toHex(dst) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlendFunci", 3).addUint(buf).addHex(src).addHex(dst);
 	m_gl.blendFunci(buf, src, dst);
 }
 
@@ -288,6 +368,8 @@ void CallLogWrapper::glBlitFramebuffer (glw::GLint srcX0, glw::GLint srcY0, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlitFramebuffer(" << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << getBufferMaskStr(mask) << ", " << getTextureFilterStr(filter) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlitFramebuffer", 10).addInt(srcX0).addInt(srcY0).addInt(srcX1).addInt(srcY1).addInt(dstX0).addInt(dstY0).addInt(dstX1).addInt(dstY1).addHex(mask).addHex(filter);
 	m_gl.blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -295,6 +377,8 @@ void CallLogWrapper::glBlitNamedFramebuffer (glw::GLuint readFramebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlitNamedFramebuffer(" << readFramebuffer << ", " << drawFramebuffer << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBlitNamedFramebuffer", 12).addUint(readFramebuffer).addUint(drawFramebuffer).addInt(srcX0).addInt(srcY0).addInt(srcX1).addInt(srcY1).addInt(dstX0).addInt(dstY0).addInt(dstX1).addInt(dstY1).addHex(mask).addHex(filter);
 	m_gl.blitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -302,6 +386,8 @@ void CallLogWrapper::glBufferData (glw::GLenum target, glw::GLsizeiptr size, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferData(" << getBufferTargetStr(target) << ", " << size << ", " << data << ", " << getUsageStr(usage) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBufferData", 4).addHex(target).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data))).addHex(usage);
 	m_gl.bufferData(target, size, data, usage);
 }
 
@@ -309,6 +395,8 @@ void CallLogWrapper::glBufferPageCommitmentARB (glw::GLenum target, glw::GLintpt
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferPageCommitmentARB(" << toHex(target) << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBufferPageCommitmentARB", 4).addHex(target).addInt(offset).addInt(size).addBoolean(commit);
 	m_gl.bufferPageCommitmentARB(target, offset, size, commit);
 }
 
@@ -316,6 +404,8 @@ void CallLogWrapper::glBufferStorage (glw::GLenum target, glw::GLsizeiptr size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferStorage(" << toHex(target) << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBufferStorage", 4).addHex(target).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data))).addHex(flags);
 	m_gl.bufferStorage(target, size, data, flags);
 }
 
@@ -323,6 +413,8 @@ void CallLogWrapper::glBufferSubData (glw::GLenum target, glw::GLintptr offset,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferSubData(" << getBufferTargetStr(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glBufferSubData", 4).addHex(target).addInt(offset).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.bufferSubData(target, offset, size, data);
 }
 
@@ -330,6 +422,8 @@ glw::GLenum CallLogWrapper::glCheckFramebufferStatus (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckFramebufferStatus(" << getFramebufferTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCheckFramebufferStatus", 1).addHex(target);
 	glw::GLenum returnValue = m_gl.checkFramebufferStatus(target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getFramebufferStatusStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -340,6 +434,8 @@ glw::GLenum CallLogWrapper::glCheckNamedFramebufferStatus (glw::GLuint framebuff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckNamedFramebufferStatus(" << framebuffer << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCheckNamedFramebufferStatus", 2).addUint(framebuffer).addHex(target);
 	glw::GLenum returnValue = m_gl.checkNamedFramebufferStatus(framebuffer, target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -350,6 +446,8 @@ glw::GLenum CallLogWrapper::glCheckNamedFramebufferStatusEXT (glw::GLuint frameb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckNamedFramebufferStatusEXT(" << framebuffer << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCheckNamedFramebufferStatusEXT", 2).addUint(framebuffer).addHex(target);
 	glw::GLenum returnValue = m_gl.checkNamedFramebufferStatusEXT(framebuffer, target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -360,6 +458,8 @@ void CallLogWrapper::glClampColor (glw::GLenum target, glw::GLenum clamp)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClampColor(" << toHex(target) << ", " << toHex(clamp) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClampColor", 2).addHex(target).addHex(clamp);
 	m_gl.clampColor(target, clamp);
 }
 
@@ -367,6 +467,8 @@ void CallLogWrapper::glClear (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClear(" << getBufferMaskStr(mask) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClear", 1).addHex(mask);
 	m_gl.clear(mask);
 }
 
@@ -374,6 +476,8 @@ void CallLogWrapper::glClearBufferData (glw::GLenum target, glw::GLenum internal
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferData(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearBufferData", 5).addHex(target).addHex(internalformat).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.clearBufferData(target, internalformat, format, type, data);
 }
 
@@ -381,6 +485,8 @@ void CallLogWrapper::glClearBufferSubData (glw::GLenum target, glw::GLenum inter
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferSubData(" << toHex(target) << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearBufferSubData", 7).addHex(target).addHex(internalformat).addInt(offset).addInt(size).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.clearBufferSubData(target, internalformat, offset, size, format, type, data);
 }
 
@@ -388,6 +494,8 @@ void CallLogWrapper::glClearBufferfi (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferfi(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearBufferfi", 4).addHex(buffer).addInt(drawbuffer).addFloat(depth).addInt(stencil);
 	m_gl.clearBufferfi(buffer, drawbuffer, depth, stencil);
 }
 
@@ -395,6 +503,8 @@ void CallLogWrapper::glClearBufferfv (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferfv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearBufferfv", 3).addHex(buffer).addInt(drawbuffer).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.clearBufferfv(buffer, drawbuffer, value);
 }
 
@@ -402,6 +512,8 @@ void CallLogWrapper::glClearBufferiv (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearBufferiv", 3).addHex(buffer).addInt(drawbuffer).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.clearBufferiv(buffer, drawbuffer, value);
 }
 
@@ -409,6 +521,8 @@ void CallLogWrapper::glClearBufferuiv (glw::GLenum buffer, glw::GLint drawbuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferuiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearBufferuiv", 3).addHex(buffer).addInt(drawbuffer).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.clearBufferuiv(buffer, drawbuffer, value);
 }
 
@@ -416,6 +530,8 @@ void CallLogWrapper::glClearColor (glw::GLfloat red, glw::GLfloat green, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearColor", 4).addFloat(red).addFloat(green).addFloat(blue).addFloat(alpha);
 	m_gl.clearColor(red, green, blue, alpha);
 }
 
@@ -423,6 +539,8 @@ void CallLogWrapper::glClearDepth (glw::GLdouble depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearDepth(" << depth << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearDepth", 1).addDouble(depth);
 	m_gl.clearDepth(depth);
 }
 
@@ -430,6 +548,8 @@ void CallLogWrapper::glClearDepthf (glw::GLfloat d)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearDepthf(" << d << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearDepthf", 1).addFloat(d);
 	m_gl.clearDepthf(d);
 }
 
@@ -437,6 +557,8 @@ void CallLogWrapper::glClearNamedBufferData (glw::GLuint buffer, glw::GLenum int
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferData(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearNamedBufferData", 5).addUint(buffer).addHex(internalformat).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.clearNamedBufferData(buffer, internalformat, format, type, data);
 }
 
@@ -444,6 +566,8 @@ void CallLogWrapper::glClearNamedBufferDataEXT (glw::GLuint buffer, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferDataEXT(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearNamedBufferDataEXT", 5).addUint(buffer).addHex(internalformat).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.clearNamedBufferDataEXT(buffer, internalformat, format, type, data);
 }
 
@@ -451,6 +575,8 @@ void CallLogWrapper::glClearNamedBufferSubData (glw::GLuint buffer, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferSubData(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearNamedBufferSubData", 7).addUint(buffer).addHex(internalformat).addInt(offset).addInt(size).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.clearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
 }
 
@@ -458,6 +584,8 @@ void CallLogWrapper::glClearNamedBufferSubDataEXT (glw::GLuint buffer, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferSubDataEXT(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearNamedBufferSubDataEXT", 7).addUint(buffer).addHex(internalformat).addInt(offset).addInt(size).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.clearNamedBufferSubDataEXT(buffer, internalformat, offset, size, format, type, data);
 }
 
@@ -465,6 +593,8 @@ void CallLogWrapper::glClearNamedFramebufferfi (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferfi(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearNamedFramebufferfi", 5).addUint(framebuffer).addHex(buffer).addInt(drawbuffer).addFloat(depth).addInt(stencil);
 	m_gl.clearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
 }
 
@@ -472,6 +602,8 @@ void CallLogWrapper::glClearNamedFramebufferfv (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferfv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearNamedFramebufferfv", 4).addUint(framebuffer).addHex(buffer).addInt(drawbuffer).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.clearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -479,6 +611,8 @@ void CallLogWrapper::glClearNamedFramebufferiv (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearNamedFramebufferiv", 4).addUint(framebuffer).addHex(buffer).addInt(drawbuffer).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.clearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -486,6 +620,8 @@ void CallLogWrapper::glClearNamedFramebufferuiv (glw::GLuint framebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferuiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearNamedFramebufferuiv", 4).addUint(framebuffer).addHex(buffer).addInt(drawbuffer).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.clearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -493,6 +629,8 @@ void CallLogWrapper::glClearStencil (glw::GLint s)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearStencil(" << s << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearStencil", 1).addInt(s);
 	m_gl.clearStencil(s);
 }
 
@@ -500,6 +638,8 @@ void CallLogWrapper::glClearTexImage (glw::GLuint texture, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearTexImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearTexImage", 5).addUint(texture).addInt(level).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.clearTexImage(texture, level, format, type, data);
 }
 
@@ -507,6 +647,8 @@ void CallLogWrapper::glClearTexSubImage (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClearTexSubImage", 11).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.clearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
 }
 
@@ -514,6 +656,8 @@ void CallLogWrapper::glClientAttribDefaultEXT (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClientAttribDefaultEXT(" << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClientAttribDefaultEXT", 1).addHex(mask);
 	m_gl.clientAttribDefaultEXT(mask);
 }
 
@@ -521,6 +665,8 @@ glw::GLenum CallLogWrapper::glClientWaitSync (glw::GLsync sync, glw::GLbitfield
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClientWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClientWaitSync", 3).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(sync))).addHex(flags).addUint(timeout);
 	glw::GLenum returnValue = m_gl.clientWaitSync(sync, flags, timeout);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -531,6 +677,8 @@ void CallLogWrapper::glClipControl (glw::GLenum origin, glw::GLenum depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClipControl(" << toHex(origin) << ", " << toHex(depth) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glClipControl", 2).addHex(origin).addHex(depth);
 	m_gl.clipControl(origin, depth);
 }
 
@@ -538,6 +686,8 @@ void CallLogWrapper::glColorMask (glw::GLboolean red, glw::GLboolean green, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glColorMask(" << getBooleanStr(red) << ", " << getBooleanStr(green) << ", " << getBooleanStr(blue) << ", " << getBooleanStr(alpha) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glColorMask", 4).addBoolean(red).addBoolean(green).addBoolean(blue).addBoolean(alpha);
 	m_gl.colorMask(red, green, blue, alpha);
 }
 
@@ -545,6 +695,8 @@ void CallLogWrapper::glColorMaski (glw::GLuint index, glw::GLboolean r, glw::GLb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glColorMaski(" << index << ", " << getBooleanStr(r) << ", " << getBooleanStr(g) << ", " << getBooleanStr(b) << ", " << getBooleanStr(a) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glColorMaski", 5).addUint(index).addBoolean(r).addBoolean(g).addBoolean(b).addBoolean(a);
 	m_gl.colorMaski(index, r, g, b, a);
 }
 
@@ -552,6 +704,8 @@ void CallLogWrapper::glCompileShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompileShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompileShader", 1).addUint(shader);
 	m_gl.compileShader(shader);
 }
 
@@ -559,6 +713,8 @@ void CallLogWrapper::glCompressedMultiTexImage1DEXT (glw::GLenum texunit, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedMultiTexImage1DEXT", 8).addHex(texunit).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedMultiTexImage1DEXT(texunit, target, level, internalformat, width, border, imageSize, bits);
 }
 
@@ -566,6 +722,8 @@ void CallLogWrapper::glCompressedMultiTexImage2DEXT (glw::GLenum texunit, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedMultiTexImage2DEXT", 9).addHex(texunit).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(height).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedMultiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, imageSize, bits);
 }
 
@@ -573,6 +731,8 @@ void CallLogWrapper::glCompressedMultiTexImage3DEXT (glw::GLenum texunit, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedMultiTexImage3DEXT", 10).addHex(texunit).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedMultiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, imageSize, bits);
 }
 
@@ -580,6 +740,8 @@ void CallLogWrapper::glCompressedMultiTexSubImage1DEXT (glw::GLenum texunit, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedMultiTexSubImage1DEXT", 8).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(width).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedMultiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, imageSize, bits);
 }
 
@@ -587,6 +749,8 @@ void CallLogWrapper::glCompressedMultiTexSubImage2DEXT (glw::GLenum texunit, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedMultiTexSubImage2DEXT", 10).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(width).addInt(height).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
 }
 
@@ -594,6 +758,8 @@ void CallLogWrapper::glCompressedMultiTexSubImage3DEXT (glw::GLenum texunit, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedMultiTexSubImage3DEXT", 12).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
 }
 
@@ -601,6 +767,8 @@ void CallLogWrapper::glCompressedTexImage1D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage1D(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTexImage1D", 7).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
 }
 
@@ -608,6 +776,8 @@ void CallLogWrapper::glCompressedTexImage2D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTexImage2D", 8).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(height).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
 }
 
@@ -615,6 +785,8 @@ void CallLogWrapper::glCompressedTexImage3D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTexImage3D", 9).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
@@ -622,6 +794,8 @@ void CallLogWrapper::glCompressedTexImage3DOES (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTexImage3DOES", 9).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTexImage3DOES(target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
@@ -629,6 +803,8 @@ void CallLogWrapper::glCompressedTexSubImage1D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTexSubImage1D", 7).addHex(target).addInt(level).addInt(xoffset).addInt(width).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
 }
 
@@ -636,6 +812,8 @@ void CallLogWrapper::glCompressedTexSubImage2D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTexSubImage2D", 9).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(width).addInt(height).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -643,6 +821,8 @@ void CallLogWrapper::glCompressedTexSubImage3D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTexSubImage3D", 11).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -650,6 +830,8 @@ void CallLogWrapper::glCompressedTexSubImage3DOES (glw::GLenum target, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTexSubImage3DOES", 11).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -657,6 +839,8 @@ void CallLogWrapper::glCompressedTextureImage1DEXT (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureImage1DEXT", 8).addUint(texture).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedTextureImage1DEXT(texture, target, level, internalformat, width, border, imageSize, bits);
 }
 
@@ -664,6 +848,8 @@ void CallLogWrapper::glCompressedTextureImage2DEXT (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureImage2DEXT", 9).addUint(texture).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(height).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedTextureImage2DEXT(texture, target, level, internalformat, width, height, border, imageSize, bits);
 }
 
@@ -671,6 +857,8 @@ void CallLogWrapper::glCompressedTextureImage3DEXT (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureImage3DEXT", 10).addUint(texture).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addInt(border).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedTextureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, imageSize, bits);
 }
 
@@ -678,6 +866,8 @@ void CallLogWrapper::glCompressedTextureSubImage1D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureSubImage1D", 7).addUint(texture).addInt(level).addInt(xoffset).addInt(width).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
 }
 
@@ -685,6 +875,8 @@ void CallLogWrapper::glCompressedTextureSubImage1DEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureSubImage1DEXT", 8).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(width).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedTextureSubImage1DEXT(texture, target, level, xoffset, width, format, imageSize, bits);
 }
 
@@ -692,6 +884,8 @@ void CallLogWrapper::glCompressedTextureSubImage2D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureSubImage2D", 9).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(width).addInt(height).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -699,6 +893,8 @@ void CallLogWrapper::glCompressedTextureSubImage2DEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureSubImage2DEXT", 10).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(width).addInt(height).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
 }
 
@@ -706,6 +902,8 @@ void CallLogWrapper::glCompressedTextureSubImage3D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureSubImage3D", 11).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.compressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -713,6 +911,8 @@ void CallLogWrapper::glCompressedTextureSubImage3DEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << bits << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCompressedTextureSubImage3DEXT", 12).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addInt(imageSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bits)));
 	m_gl.compressedTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
 }
 
@@ -720,6 +920,8 @@ void CallLogWrapper::glCopyBufferSubData (glw::GLenum readTarget, glw::GLenum wr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyBufferSubData(" << toHex(readTarget) << ", " << toHex(writeTarget) << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyBufferSubData", 5).addHex(readTarget).addHex(writeTarget).addInt(readOffset).addInt(writeOffset).addInt(size);
 	m_gl.copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
 }
 
@@ -727,6 +929,8 @@ void CallLogWrapper::glCopyImageSubData (glw::GLuint srcName, glw::GLenum srcTar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyImageSubData(" << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyImageSubData", 15).addUint(srcName).addHex(srcTarget).addInt(srcLevel).addInt(srcX).addInt(srcY).addInt(srcZ).addUint(dstName).addHex(dstTarget).addInt(dstLevel).addInt(dstX).addInt(dstY).addInt(dstZ).addInt(srcWidth).addInt(srcHeight).addInt(srcDepth);
 	m_gl.copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
@@ -734,6 +938,8 @@ void CallLogWrapper::glCopyMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyMultiTexImage1DEXT", 8).addHex(texunit).addHex(target).addInt(level).addHex(internalformat).addInt(x).addInt(y).addInt(width).addInt(border);
 	m_gl.copyMultiTexImage1DEXT(texunit, target, level, internalformat, x, y, width, border);
 }
 
@@ -741,6 +947,8 @@ void CallLogWrapper::glCopyMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyMultiTexImage2DEXT", 9).addHex(texunit).addHex(target).addInt(level).addHex(internalformat).addInt(x).addInt(y).addInt(width).addInt(height).addInt(border);
 	m_gl.copyMultiTexImage2DEXT(texunit, target, level, internalformat, x, y, width, height, border);
 }
 
@@ -748,6 +956,8 @@ void CallLogWrapper::glCopyMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyMultiTexSubImage1DEXT", 7).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(x).addInt(y).addInt(width);
 	m_gl.copyMultiTexSubImage1DEXT(texunit, target, level, xoffset, x, y, width);
 }
 
@@ -755,6 +965,8 @@ void CallLogWrapper::glCopyMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyMultiTexSubImage2DEXT", 9).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -762,6 +974,8 @@ void CallLogWrapper::glCopyMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyMultiTexSubImage3DEXT", 10).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -769,6 +983,8 @@ void CallLogWrapper::glCopyNamedBufferSubData (glw::GLuint readBuffer, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyNamedBufferSubData(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyNamedBufferSubData", 5).addUint(readBuffer).addUint(writeBuffer).addInt(readOffset).addInt(writeOffset).addInt(size);
 	m_gl.copyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
@@ -776,6 +992,8 @@ void CallLogWrapper::glCopyTexImage1D (glw::GLenum target, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTexImage1D", 7).addHex(target).addInt(level).addHex(internalformat).addInt(x).addInt(y).addInt(width).addInt(border);
 	m_gl.copyTexImage1D(target, level, internalformat, x, y, width, border);
 }
 
@@ -783,6 +1001,8 @@ void CallLogWrapper::glCopyTexImage2D (glw::GLenum target, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTexImage2D", 8).addHex(target).addInt(level).addHex(internalformat).addInt(x).addInt(y).addInt(width).addInt(height).addInt(border);
 	m_gl.copyTexImage2D(target, level, internalformat, x, y, width, height, border);
 }
 
@@ -790,6 +1010,8 @@ void CallLogWrapper::glCopyTexSubImage1D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTexSubImage1D", 6).addHex(target).addInt(level).addInt(xoffset).addInt(x).addInt(y).addInt(width);
 	m_gl.copyTexSubImage1D(target, level, xoffset, x, y, width);
 }
 
@@ -797,6 +1019,8 @@ void CallLogWrapper::glCopyTexSubImage2D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage2D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTexSubImage2D", 8).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -804,6 +1028,8 @@ void CallLogWrapper::glCopyTexSubImage3D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage3D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTexSubImage3D", 9).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -811,6 +1037,8 @@ void CallLogWrapper::glCopyTexSubImage3DOES (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTexSubImage3DOES", 9).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -818,6 +1046,8 @@ void CallLogWrapper::glCopyTextureImage1DEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTextureImage1DEXT", 8).addUint(texture).addHex(target).addInt(level).addHex(internalformat).addInt(x).addInt(y).addInt(width).addInt(border);
 	m_gl.copyTextureImage1DEXT(texture, target, level, internalformat, x, y, width, border);
 }
 
@@ -825,6 +1055,8 @@ void CallLogWrapper::glCopyTextureImage2DEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTextureImage2DEXT", 9).addUint(texture).addHex(target).addInt(level).addHex(internalformat).addInt(x).addInt(y).addInt(width).addInt(height).addInt(border);
 	m_gl.copyTextureImage2DEXT(texture, target, level, internalformat, x, y, width, height, border);
 }
 
@@ -832,6 +1064,8 @@ void CallLogWrapper::glCopyTextureSubImage1D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTextureSubImage1D", 6).addUint(texture).addInt(level).addInt(xoffset).addInt(x).addInt(y).addInt(width);
 	m_gl.copyTextureSubImage1D(texture, level, xoffset, x, y, width);
 }
 
@@ -839,6 +1073,8 @@ void CallLogWrapper::glCopyTextureSubImage1DEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTextureSubImage1DEXT", 7).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(x).addInt(y).addInt(width);
 	m_gl.copyTextureSubImage1DEXT(texture, target, level, xoffset, x, y, width);
 }
 
@@ -846,6 +1082,8 @@ void CallLogWrapper::glCopyTextureSubImage2D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTextureSubImage2D", 8).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -853,6 +1091,8 @@ void CallLogWrapper::glCopyTextureSubImage2DEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTextureSubImage2DEXT", 9).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -860,6 +1100,8 @@ void CallLogWrapper::glCopyTextureSubImage3D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTextureSubImage3D", 9).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -867,6 +1109,8 @@ void CallLogWrapper::glCopyTextureSubImage3DEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCopyTextureSubImage3DEXT", 10).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.copyTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -874,6 +1118,8 @@ void CallLogWrapper::glCreateBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateBuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers)));
 	m_gl.createBuffers(n, buffers);
 }
 
@@ -881,6 +1127,8 @@ void CallLogWrapper::glCreateFramebuffers (glw::GLsizei n, glw::GLuint *framebuf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateFramebuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers)));
 	m_gl.createFramebuffers(n, framebuffers);
 }
 
@@ -888,6 +1136,8 @@ glw::GLuint CallLogWrapper::glCreateProgram (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateProgram(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateProgram", 0);
 	glw::GLuint returnValue = m_gl.createProgram();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -898,6 +1148,8 @@ void CallLogWrapper::glCreateProgramPipelines (glw::GLsizei n, glw::GLuint *pipe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateProgramPipelines", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines)));
 	m_gl.createProgramPipelines(n, pipelines);
 }
 
@@ -905,6 +1157,8 @@ void CallLogWrapper::glCreateQueries (glw::GLenum target, glw::GLsizei n, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateQueries(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateQueries", 3).addHex(target).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ids)));
 	m_gl.createQueries(target, n, ids);
 }
 
@@ -912,6 +1166,8 @@ void CallLogWrapper::glCreateRenderbuffers (glw::GLsizei n, glw::GLuint *renderb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateRenderbuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers)));
 	m_gl.createRenderbuffers(n, renderbuffers);
 }
 
@@ -919,6 +1175,8 @@ void CallLogWrapper::glCreateSamplers (glw::GLsizei n, glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateSamplers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateSamplers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers)));
 	m_gl.createSamplers(n, samplers);
 }
 
@@ -926,6 +1184,8 @@ glw::GLuint CallLogWrapper::glCreateShader (glw::GLenum type)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateShader(" << getShaderTypeStr(type) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateShader", 1).addHex(type);
 	glw::GLuint returnValue = m_gl.createShader(type);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -936,6 +1196,8 @@ glw::GLuint CallLogWrapper::glCreateShaderProgramv (glw::GLenum type, glw::GLsiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateShaderProgramv(" << toHex(type) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strings))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateShaderProgramv", 3).addHex(type).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(strings)));
 	glw::GLuint returnValue = m_gl.createShaderProgramv(type, count, strings);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -946,6 +1208,8 @@ void CallLogWrapper::glCreateTextures (glw::GLenum target, glw::GLsizei n, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateTextures(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateTextures", 3).addHex(target).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(textures)));
 	m_gl.createTextures(target, n, textures);
 }
 
@@ -953,6 +1217,8 @@ void CallLogWrapper::glCreateTransformFeedbacks (glw::GLsizei n, glw::GLuint *id
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateTransformFeedbacks", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ids)));
 	m_gl.createTransformFeedbacks(n, ids);
 }
 
@@ -960,6 +1226,8 @@ void CallLogWrapper::glCreateVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCreateVertexArrays", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays)));
 	m_gl.createVertexArrays(n, arrays);
 }
 
@@ -967,6 +1235,8 @@ void CallLogWrapper::glCullFace (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCullFace(" << getFaceStr(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glCullFace", 1).addHex(mode);
 	m_gl.cullFace(mode);
 }
 
@@ -974,6 +1244,8 @@ void CallLogWrapper::glDebugMessageCallback (glw::GLDEBUGPROC callback, const vo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageCallback(" << toHex(reinterpret_cast<deUintptr>(callback)) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(userParam))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDebugMessageCallback", 2).addPointer(reinterpret_cast<deUintptr>(callback)).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(userParam)));
 	m_gl.debugMessageCallback(callback, userParam);
 }
 
@@ -981,6 +1253,8 @@ void CallLogWrapper::glDebugMessageControl (glw::GLenum source, glw::GLenum type
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageControl(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << getDebugMessageSeverityStr(severity) << ", " << count << ", " << getPointerStr(ids, (count)) << ", " << getBooleanStr(enabled) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDebugMessageControl", 6).addHex(source).addHex(type).addHex(severity).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))).addBoolean(enabled);
 	m_gl.debugMessageControl(source, type, severity, count, ids, enabled);
 }
 
@@ -988,6 +1262,8 @@ void CallLogWrapper::glDebugMessageInsert (glw::GLenum source, glw::GLenum type,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageInsert(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << id << ", " << getDebugMessageSeverityStr(severity) << ", " << length << ", " << getStringStr(buf) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDebugMessageInsert", 6).addHex(source).addHex(type).addUint(id).addHex(severity).addInt(length).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(buf)));
 	m_gl.debugMessageInsert(source, type, id, severity, length, buf);
 }
 
@@ -995,6 +1271,8 @@ void CallLogWrapper::glDeleteBuffers (glw::GLsizei n, const glw::GLuint *buffers
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteBuffers(" << n << ", " << getPointerStr(buffers, n) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteBuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers)));
 	m_gl.deleteBuffers(n, buffers);
 }
 
@@ -1002,6 +1280,8 @@ void CallLogWrapper::glDeleteFramebuffers (glw::GLsizei n, const glw::GLuint *fr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteFramebuffers(" << n << ", " << getPointerStr(framebuffers, n) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteFramebuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers)));
 	m_gl.deleteFramebuffers(n, framebuffers);
 }
 
@@ -1009,6 +1289,8 @@ void CallLogWrapper::glDeleteProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteProgram", 1).addUint(program);
 	m_gl.deleteProgram(program);
 }
 
@@ -1016,6 +1298,8 @@ void CallLogWrapper::glDeleteProgramPipelines (glw::GLsizei n, const glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteProgramPipelines(" << n << ", " << getPointerStr(pipelines, n) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteProgramPipelines", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines)));
 	m_gl.deleteProgramPipelines(n, pipelines);
 }
 
@@ -1023,6 +1307,8 @@ void CallLogWrapper::glDeleteQueries (glw::GLsizei n, const glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteQueries(" << n << ", " << getPointerStr(ids, n) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteQueries", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ids)));
 	m_gl.deleteQueries(n, ids);
 }
 
@@ -1030,6 +1316,8 @@ void CallLogWrapper::glDeleteRenderbuffers (glw::GLsizei n, const glw::GLuint *r
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteRenderbuffers(" << n << ", " << getPointerStr(renderbuffers, n) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteRenderbuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers)));
 	m_gl.deleteRenderbuffers(n, renderbuffers);
 }
 
@@ -1037,6 +1325,8 @@ void CallLogWrapper::glDeleteSamplers (glw::GLsizei count, const glw::GLuint *sa
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteSamplers", 2).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers)));
 	m_gl.deleteSamplers(count, samplers);
 }
 
@@ -1044,6 +1334,8 @@ void CallLogWrapper::glDeleteShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteShader", 1).addUint(shader);
 	m_gl.deleteShader(shader);
 }
 
@@ -1051,6 +1343,8 @@ void CallLogWrapper::glDeleteSync (glw::GLsync sync)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteSync(" << sync << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteSync", 1).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(sync)));
 	m_gl.deleteSync(sync);
 }
 
@@ -1058,6 +1352,8 @@ void CallLogWrapper::glDeleteTextures (glw::GLsizei n, const glw::GLuint *textur
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteTextures(" << n << ", " << getPointerStr(textures, n) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteTextures", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(textures)));
 	m_gl.deleteTextures(n, textures);
 }
 
@@ -1065,6 +1361,8 @@ void CallLogWrapper::glDeleteTransformFeedbacks (glw::GLsizei n, const glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteTransformFeedbacks", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ids)));
 	m_gl.deleteTransformFeedbacks(n, ids);
 }
 
@@ -1072,6 +1370,8 @@ void CallLogWrapper::glDeleteVertexArrays (glw::GLsizei n, const glw::GLuint *ar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteVertexArrays(" << n << ", " << getPointerStr(arrays, n) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDeleteVertexArrays", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays)));
 	m_gl.deleteVertexArrays(n, arrays);
 }
 
@@ -1079,6 +1379,8 @@ void CallLogWrapper::glDepthBoundsEXT (glw::GLclampd zmin, glw::GLclampd zmax)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthBoundsEXT(" << zmin << ", " << zmax << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthBoundsEXT", 2).addDouble(zmin).addDouble(zmax);
 	m_gl.depthBoundsEXT(zmin, zmax);
 }
 
@@ -1086,6 +1388,8 @@ void CallLogWrapper::glDepthFunc (glw::GLenum func)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthFunc(" << getCompareFuncStr(func) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthFunc", 1).addHex(func);
 	m_gl.depthFunc(func);
 }
 
@@ -1093,6 +1397,8 @@ void CallLogWrapper::glDepthMask (glw::GLboolean flag)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthMask(" << getBooleanStr(flag) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthMask", 1).addBoolean(flag);
 	m_gl.depthMask(flag);
 }
 
@@ -1100,6 +1406,8 @@ void CallLogWrapper::glDepthRange (glw::GLdouble n, glw::GLdouble f)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRange(" << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthRange", 2).addDouble(n).addDouble(f);
 	m_gl.depthRange(n, f);
 }
 
@@ -1107,6 +1415,8 @@ void CallLogWrapper::glDepthRangeArrayfvOES (glw::GLuint first, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeArrayfvOES(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthRangeArrayfvOES", 3).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.depthRangeArrayfvOES(first, count, v);
 }
 
@@ -1114,6 +1424,8 @@ void CallLogWrapper::glDepthRangeArrayv (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthRangeArrayv", 3).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.depthRangeArrayv(first, count, v);
 }
 
@@ -1121,6 +1433,8 @@ void CallLogWrapper::glDepthRangeIndexed (glw::GLuint index, glw::GLdouble n, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeIndexed(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthRangeIndexed", 3).addUint(index).addDouble(n).addDouble(f);
 	m_gl.depthRangeIndexed(index, n, f);
 }
 
@@ -1128,6 +1442,8 @@ void CallLogWrapper::glDepthRangeIndexedfOES (glw::GLuint index, glw::GLfloat n,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeIndexedfOES(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthRangeIndexedfOES", 3).addUint(index).addFloat(n).addFloat(f);
 	m_gl.depthRangeIndexedfOES(index, n, f);
 }
 
@@ -1135,6 +1451,8 @@ void CallLogWrapper::glDepthRangef (glw::GLfloat n, glw::GLfloat f)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangef(" << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDepthRangef", 2).addFloat(n).addFloat(f);
 	m_gl.depthRangef(n, f);
 }
 
@@ -1142,6 +1460,8 @@ void CallLogWrapper::glDetachShader (glw::GLuint program, glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDetachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDetachShader", 2).addUint(program).addUint(shader);
 	m_gl.detachShader(program, shader);
 }
 
@@ -1149,6 +1469,8 @@ void CallLogWrapper::glDisable (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDisable", 1).addHex(cap);
 	m_gl.disable(cap);
 }
 
@@ -1156,6 +1478,8 @@ void CallLogWrapper::glDisableClientStateIndexedEXT (glw::GLenum array, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDisableClientStateIndexedEXT", 2).addHex(array).addUint(index);
 	m_gl.disableClientStateIndexedEXT(array, index);
 }
 
@@ -1163,6 +1487,8 @@ void CallLogWrapper::glDisableClientStateiEXT (glw::GLenum array, glw::GLuint in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableClientStateiEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDisableClientStateiEXT", 2).addHex(array).addUint(index);
 	m_gl.disableClientStateiEXT(array, index);
 }
 
@@ -1170,6 +1496,8 @@ void CallLogWrapper::glDisableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDisableVertexArrayAttrib", 2).addUint(vaobj).addUint(index);
 	m_gl.disableVertexArrayAttrib(vaobj, index);
 }
 
@@ -1177,6 +1505,8 @@ void CallLogWrapper::glDisableVertexArrayAttribEXT (glw::GLuint vaobj, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayAttribEXT(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDisableVertexArrayAttribEXT", 2).addUint(vaobj).addUint(index);
 	m_gl.disableVertexArrayAttribEXT(vaobj, index);
 }
 
@@ -1184,6 +1514,8 @@ void CallLogWrapper::glDisableVertexArrayEXT (glw::GLuint vaobj, glw::GLenum arr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDisableVertexArrayEXT", 2).addUint(vaobj).addHex(array);
 	m_gl.disableVertexArrayEXT(vaobj, array);
 }
 
@@ -1191,6 +1523,8 @@ void CallLogWrapper::glDisableVertexAttribArray (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDisableVertexAttribArray", 1).addUint(index);
 	m_gl.disableVertexAttribArray(index);
 }
 
@@ -1198,6 +1532,8 @@ void CallLogWrapper::glDisablei (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDisablei", 2).addHex(target).addUint(index);
 	m_gl.disablei(target, index);
 }
 
@@ -1205,6 +1541,8 @@ void CallLogWrapper::glDispatchCompute (glw::GLuint num_groups_x, glw::GLuint nu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDispatchCompute(" << num_groups_x << ", " << num_groups_y << ", " << num_groups_z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDispatchCompute", 3).addUint(num_groups_x).addUint(num_groups_y).addUint(num_groups_z);
 	m_gl.dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
 }
 
@@ -1212,6 +1550,8 @@ void CallLogWrapper::glDispatchComputeIndirect (glw::GLintptr indirect)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDispatchComputeIndirect(" << indirect << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDispatchComputeIndirect", 1).addInt(indirect);
 	m_gl.dispatchComputeIndirect(indirect);
 }
 
@@ -1219,6 +1559,8 @@ void CallLogWrapper::glDrawArrays (glw::GLenum mode, glw::GLint first, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawArrays", 3).addHex(mode).addInt(first).addInt(count);
 	m_gl.drawArrays(mode, first, count);
 }
 
@@ -1226,6 +1568,8 @@ void CallLogWrapper::glDrawArraysIndirect (glw::GLenum mode, const void *indirec
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysIndirect(" << getPrimitiveTypeStr(mode) << ", " << indirect << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawArraysIndirect", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect)));
 	m_gl.drawArraysIndirect(mode, indirect);
 }
 
@@ -1233,6 +1577,8 @@ void CallLogWrapper::glDrawArraysInstanced (glw::GLenum mode, glw::GLint first,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysInstanced(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawArraysInstanced", 4).addHex(mode).addInt(first).addInt(count).addInt(instancecount);
 	m_gl.drawArraysInstanced(mode, first, count, instancecount);
 }
 
@@ -1240,6 +1586,8 @@ void CallLogWrapper::glDrawArraysInstancedBaseInstance (glw::GLenum mode, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysInstancedBaseInstance(" << toHex(mode) << ", " << first << ", " << count << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawArraysInstancedBaseInstance", 5).addHex(mode).addInt(first).addInt(count).addInt(instancecount).addUint(baseinstance);
 	m_gl.drawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
 }
 
@@ -1247,6 +1595,8 @@ void CallLogWrapper::glDrawBuffer (glw::GLenum buf)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawBuffer(" << toHex(buf) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawBuffer", 1).addHex(buf);
 	m_gl.drawBuffer(buf);
 }
 
@@ -1254,6 +1604,8 @@ void CallLogWrapper::glDrawBuffers (glw::GLsizei n, const glw::GLenum *bufs)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawBuffers(" << n << ", " << getEnumPointerStr(bufs, n, getDrawReadBufferName) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawBuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs)));
 	m_gl.drawBuffers(n, bufs);
 }
 
@@ -1261,6 +1613,8 @@ void CallLogWrapper::glDrawElements (glw::GLenum mode, glw::GLsizei count, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElements(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawElements", 4).addHex(mode).addInt(count).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices)));
 	m_gl.drawElements(mode, count, type, indices);
 }
 
@@ -1268,6 +1622,8 @@ void CallLogWrapper::glDrawElementsBaseVertex (glw::GLenum mode, glw::GLsizei co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawElementsBaseVertex", 5).addHex(mode).addInt(count).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))).addInt(basevertex);
 	m_gl.drawElementsBaseVertex(mode, count, type, indices, basevertex);
 }
 
@@ -1275,6 +1631,8 @@ void CallLogWrapper::glDrawElementsIndirect (glw::GLenum mode, glw::GLenum type,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsIndirect(" << getPrimitiveTypeStr(mode) << ", " << getTypeStr(type) << ", " << indirect << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawElementsIndirect", 3).addHex(mode).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect)));
 	m_gl.drawElementsIndirect(mode, type, indirect);
 }
 
@@ -1282,6 +1640,8 @@ void CallLogWrapper::glDrawElementsInstanced (glw::GLenum mode, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstanced(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawElementsInstanced", 5).addHex(mode).addInt(count).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))).addInt(instancecount);
 	m_gl.drawElementsInstanced(mode, count, type, indices, instancecount);
 }
 
@@ -1289,6 +1649,8 @@ void CallLogWrapper::glDrawElementsInstancedBaseInstance (glw::GLenum mode, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawElementsInstancedBaseInstance", 6).addHex(mode).addInt(count).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))).addInt(instancecount).addUint(baseinstance);
 	m_gl.drawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
 }
 
@@ -1296,6 +1658,8 @@ void CallLogWrapper::glDrawElementsInstancedBaseVertex (glw::GLenum mode, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawElementsInstancedBaseVertex", 6).addHex(mode).addInt(count).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))).addInt(instancecount).addInt(basevertex);
 	m_gl.drawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
 }
 
@@ -1303,6 +1667,8 @@ void CallLogWrapper::glDrawElementsInstancedBaseVertexBaseInstance (glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertexBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawElementsInstancedBaseVertexBaseInstance", 7).addHex(mode).addInt(count).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))).addInt(instancecount).addInt(basevertex).addUint(baseinstance);
 	m_gl.drawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
 }
 
@@ -1310,6 +1676,8 @@ void CallLogWrapper::glDrawRangeElements (glw::GLenum mode, glw::GLuint start, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawRangeElements(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawRangeElements", 6).addHex(mode).addUint(start).addUint(end).addInt(count).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices)));
 	m_gl.drawRangeElements(mode, start, end, count, type, indices);
 }
 
@@ -1317,6 +1685,8 @@ void CallLogWrapper::glDrawRangeElementsBaseVertex (glw::GLenum mode, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawRangeElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawRangeElementsBaseVertex", 7).addHex(mode).addUint(start).addUint(end).addInt(count).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))).addInt(basevertex);
 	m_gl.drawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
 }
 
@@ -1324,6 +1694,8 @@ void CallLogWrapper::glDrawTransformFeedback (glw::GLenum mode, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedback(" << toHex(mode) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawTransformFeedback", 2).addHex(mode).addUint(id);
 	m_gl.drawTransformFeedback(mode, id);
 }
 
@@ -1331,6 +1703,8 @@ void CallLogWrapper::glDrawTransformFeedbackInstanced (glw::GLenum mode, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackInstanced(" << toHex(mode) << ", " << id << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawTransformFeedbackInstanced", 3).addHex(mode).addUint(id).addInt(instancecount);
 	m_gl.drawTransformFeedbackInstanced(mode, id, instancecount);
 }
 
@@ -1338,6 +1712,8 @@ void CallLogWrapper::glDrawTransformFeedbackStream (glw::GLenum mode, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStream(" << toHex(mode) << ", " << id << ", " << stream << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawTransformFeedbackStream", 3).addHex(mode).addUint(id).addUint(stream);
 	m_gl.drawTransformFeedbackStream(mode, id, stream);
 }
 
@@ -1345,6 +1721,8 @@ void CallLogWrapper::glDrawTransformFeedbackStreamInstanced (glw::GLenum mode, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStreamInstanced(" << toHex(mode) << ", " << id << ", " << stream << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glDrawTransformFeedbackStreamInstanced", 4).addHex(mode).addUint(id).addUint(stream).addInt(instancecount);
 	m_gl.drawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
 }
 
@@ -1352,6 +1730,8 @@ void CallLogWrapper::glEGLImageTargetRenderbufferStorageOES (glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEGLImageTargetRenderbufferStorageOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEGLImageTargetRenderbufferStorageOES", 2).addHex(target).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(image)));
 	m_gl.eglImageTargetRenderbufferStorageOES(target, image);
 }
 
@@ -1359,6 +1739,8 @@ void CallLogWrapper::glEGLImageTargetTexture2DOES (glw::GLenum target, glw::GLeg
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEGLImageTargetTexture2DOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEGLImageTargetTexture2DOES", 2).addHex(target).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(image)));
 	m_gl.eglImageTargetTexture2DOES(target, image);
 }
 
@@ -1366,6 +1748,8 @@ void CallLogWrapper::glEnable (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEnable", 1).addHex(cap);
 	m_gl.enable(cap);
 }
 
@@ -1373,6 +1757,8 @@ void CallLogWrapper::glEnableClientStateIndexedEXT (glw::GLenum array, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableClientStateIndexedEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEnableClientStateIndexedEXT", 2).addHex(array).addUint(index);
 	m_gl.enableClientStateIndexedEXT(array, index);
 }
 
@@ -1380,6 +1766,8 @@ void CallLogWrapper::glEnableClientStateiEXT (glw::GLenum array, glw::GLuint ind
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableClientStateiEXT(" << toHex(array) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEnableClientStateiEXT", 2).addHex(array).addUint(index);
 	m_gl.enableClientStateiEXT(array, index);
 }
 
@@ -1387,6 +1775,8 @@ void CallLogWrapper::glEnableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint i
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEnableVertexArrayAttrib", 2).addUint(vaobj).addUint(index);
 	m_gl.enableVertexArrayAttrib(vaobj, index);
 }
 
@@ -1394,6 +1784,8 @@ void CallLogWrapper::glEnableVertexArrayAttribEXT (glw::GLuint vaobj, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayAttribEXT(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEnableVertexArrayAttribEXT", 2).addUint(vaobj).addUint(index);
 	m_gl.enableVertexArrayAttribEXT(vaobj, index);
 }
 
@@ -1401,6 +1793,8 @@ void CallLogWrapper::glEnableVertexArrayEXT (glw::GLuint vaobj, glw::GLenum arra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayEXT(" << vaobj << ", " << toHex(array) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEnableVertexArrayEXT", 2).addUint(vaobj).addHex(array);
 	m_gl.enableVertexArrayEXT(vaobj, array);
 }
 
@@ -1408,6 +1802,8 @@ void CallLogWrapper::glEnableVertexAttribArray (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEnableVertexAttribArray", 1).addUint(index);
 	m_gl.enableVertexAttribArray(index);
 }
 
@@ -1415,6 +1811,8 @@ void CallLogWrapper::glEnablei (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEnablei", 2).addHex(target).addUint(index);
 	m_gl.enablei(target, index);
 }
 
@@ -1422,6 +1820,8 @@ void CallLogWrapper::glEndConditionalRender (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndConditionalRender(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEndConditionalRender", 0);
 	m_gl.endConditionalRender();
 }
 
@@ -1429,6 +1829,8 @@ void CallLogWrapper::glEndQuery (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndQuery(" << getQueryTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEndQuery", 1).addHex(target);
 	m_gl.endQuery(target);
 }
 
@@ -1436,6 +1838,8 @@ void CallLogWrapper::glEndQueryIndexed (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndQueryIndexed(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEndQueryIndexed", 2).addHex(target).addUint(index);
 	m_gl.endQueryIndexed(target, index);
 }
 
@@ -1443,6 +1847,8 @@ void CallLogWrapper::glEndTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glEndTransformFeedback", 0);
 	m_gl.endTransformFeedback();
 }
 
@@ -1450,6 +1856,8 @@ glw::GLsync CallLogWrapper::glFenceSync (glw::GLenum condition, glw::GLbitfield
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFenceSync(" << toHex(condition) << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFenceSync", 2).addHex(condition).addHex(flags);
 	glw::GLsync returnValue = m_gl.fenceSync(condition, flags);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1460,6 +1868,8 @@ void CallLogWrapper::glFinish (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFinish(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFinish", 0);
 	m_gl.finish();
 }
 
@@ -1467,6 +1877,8 @@ void CallLogWrapper::glFlush (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlush(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFlush", 0);
 	m_gl.flush();
 }
 
@@ -1474,6 +1886,8 @@ void CallLogWrapper::glFlushMappedBufferRange (glw::GLenum target, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFlushMappedBufferRange", 3).addHex(target).addInt(offset).addInt(length);
 	m_gl.flushMappedBufferRange(target, offset, length);
 }
 
@@ -1481,6 +1895,8 @@ void CallLogWrapper::glFlushMappedNamedBufferRange (glw::GLuint buffer, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedNamedBufferRange(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFlushMappedNamedBufferRange", 3).addUint(buffer).addInt(offset).addInt(length);
 	m_gl.flushMappedNamedBufferRange(buffer, offset, length);
 }
 
@@ -1488,6 +1904,8 @@ void CallLogWrapper::glFlushMappedNamedBufferRangeEXT (glw::GLuint buffer, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedNamedBufferRangeEXT(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFlushMappedNamedBufferRangeEXT", 3).addUint(buffer).addInt(offset).addInt(length);
 	m_gl.flushMappedNamedBufferRangeEXT(buffer, offset, length);
 }
 
@@ -1495,6 +1913,8 @@ void CallLogWrapper::glFramebufferDrawBufferEXT (glw::GLuint framebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferDrawBufferEXT(" << framebuffer << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferDrawBufferEXT", 2).addUint(framebuffer).addHex(mode);
 	m_gl.framebufferDrawBufferEXT(framebuffer, mode);
 }
 
@@ -1502,6 +1922,8 @@ void CallLogWrapper::glFramebufferDrawBuffersEXT (glw::GLuint framebuffer, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferDrawBuffersEXT(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferDrawBuffersEXT", 3).addUint(framebuffer).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs)));
 	m_gl.framebufferDrawBuffersEXT(framebuffer, n, bufs);
 }
 
@@ -1509,6 +1931,8 @@ void CallLogWrapper::glFramebufferParameteri (glw::GLenum target, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferParameteri(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferParameteri", 3).addHex(target).addHex(pname).addInt(param);
 	m_gl.framebufferParameteri(target, pname, param);
 }
 
@@ -1516,6 +1940,8 @@ void CallLogWrapper::glFramebufferReadBufferEXT (glw::GLuint framebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferReadBufferEXT(" << framebuffer << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferReadBufferEXT", 2).addUint(framebuffer).addHex(mode);
 	m_gl.framebufferReadBufferEXT(framebuffer, mode);
 }
 
@@ -1523,6 +1949,8 @@ void CallLogWrapper::glFramebufferRenderbuffer (glw::GLenum target, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferRenderbuffer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferTargetStr(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferRenderbuffer", 4).addHex(target).addHex(attachment).addHex(renderbuffertarget).addUint(renderbuffer);
 	m_gl.framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -1530,6 +1958,8 @@ void CallLogWrapper::glFramebufferTexture (glw::GLenum target, glw::GLenum attac
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTexture", 4).addHex(target).addHex(attachment).addUint(texture).addInt(level);
 	m_gl.framebufferTexture(target, attachment, texture, level);
 }
 
@@ -1537,6 +1967,8 @@ void CallLogWrapper::glFramebufferTexture1D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture1D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTexture1D", 5).addHex(target).addHex(attachment).addHex(textarget).addUint(texture).addInt(level);
 	m_gl.framebufferTexture1D(target, attachment, textarget, texture, level);
 }
 
@@ -1544,6 +1976,8 @@ void CallLogWrapper::glFramebufferTexture2D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture2D(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getTextureTargetStr(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTexture2D", 5).addHex(target).addHex(attachment).addHex(textarget).addUint(texture).addInt(level);
 	m_gl.framebufferTexture2D(target, attachment, textarget, texture, level);
 }
 
@@ -1551,6 +1985,8 @@ void CallLogWrapper::glFramebufferTexture2DMultisampleEXT (glw::GLenum target, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture2DMultisampleEXT(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << samples << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTexture2DMultisampleEXT", 6).addHex(target).addHex(attachment).addHex(textarget).addUint(texture).addInt(level).addInt(samples);
 	m_gl.framebufferTexture2DMultisampleEXT(target, attachment, textarget, texture, level, samples);
 }
 
@@ -1558,6 +1994,8 @@ void CallLogWrapper::glFramebufferTexture3D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture3D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTexture3D", 6).addHex(target).addHex(attachment).addHex(textarget).addUint(texture).addInt(level).addInt(zoffset);
 	m_gl.framebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
 }
 
@@ -1565,6 +2003,8 @@ void CallLogWrapper::glFramebufferTexture3DOES (glw::GLenum target, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture3DOES(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTexture3DOES", 6).addHex(target).addHex(attachment).addHex(textarget).addUint(texture).addInt(level).addInt(zoffset);
 	m_gl.framebufferTexture3DOES(target, attachment, textarget, texture, level, zoffset);
 }
 
@@ -1572,6 +2012,8 @@ void CallLogWrapper::glFramebufferTextureLayer (glw::GLenum target, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTextureLayer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTextureLayer", 5).addHex(target).addHex(attachment).addUint(texture).addInt(level).addInt(layer);
 	m_gl.framebufferTextureLayer(target, attachment, texture, level, layer);
 }
 
@@ -1579,6 +2021,8 @@ void CallLogWrapper::glFramebufferTextureMultisampleMultiviewOVR (glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTextureMultisampleMultiviewOVR(" << toHex(target) << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << samples << ", " << baseViewIndex << ", " << numViews << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTextureMultisampleMultiviewOVR", 7).addHex(target).addHex(attachment).addUint(texture).addInt(level).addInt(samples).addInt(baseViewIndex).addInt(numViews);
 	m_gl.framebufferTextureMultisampleMultiviewOVR(target, attachment, texture, level, samples, baseViewIndex, numViews);
 }
 
@@ -1586,6 +2030,8 @@ void CallLogWrapper::glFramebufferTextureMultiviewOVR (glw::GLenum target, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTextureMultiviewOVR(" << toHex(target) << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << baseViewIndex << ", " << numViews << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFramebufferTextureMultiviewOVR", 6).addHex(target).addHex(attachment).addUint(texture).addInt(level).addInt(baseViewIndex).addInt(numViews);
 	m_gl.framebufferTextureMultiviewOVR(target, attachment, texture, level, baseViewIndex, numViews);
 }
 
@@ -1593,6 +2039,8 @@ void CallLogWrapper::glFrontFace (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFrontFace(" << getWindingStr(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glFrontFace", 1).addHex(mode);
 	m_gl.frontFace(mode);
 }
 
@@ -1600,6 +2048,8 @@ void CallLogWrapper::glGenBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenBuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers)));
 	m_gl.genBuffers(n, buffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// buffers = " << getPointerStr(buffers, n) << TestLog::EndMessage;
@@ -1609,6 +2059,8 @@ void CallLogWrapper::glGenFramebuffers (glw::GLsizei n, glw::GLuint *framebuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenFramebuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers)));
 	m_gl.genFramebuffers(n, framebuffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// framebuffers = " << getPointerStr(framebuffers, n) << TestLog::EndMessage;
@@ -1618,6 +2070,8 @@ void CallLogWrapper::glGenProgramPipelines (glw::GLsizei n, glw::GLuint *pipelin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenProgramPipelines", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines)));
 	m_gl.genProgramPipelines(n, pipelines);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// pipelines = " << getPointerStr(pipelines, n) << TestLog::EndMessage;
@@ -1627,6 +2081,8 @@ void CallLogWrapper::glGenQueries (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenQueries(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenQueries", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ids)));
 	m_gl.genQueries(n, ids);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
@@ -1636,6 +2092,8 @@ void CallLogWrapper::glGenRenderbuffers (glw::GLsizei n, glw::GLuint *renderbuff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenRenderbuffers", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers)));
 	m_gl.genRenderbuffers(n, renderbuffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// renderbuffers = " << getPointerStr(renderbuffers, n) << TestLog::EndMessage;
@@ -1645,6 +2103,8 @@ void CallLogWrapper::glGenSamplers (glw::GLsizei count, glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenSamplers", 2).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers)));
 	m_gl.genSamplers(count, samplers);
 }
 
@@ -1652,6 +2112,8 @@ void CallLogWrapper::glGenTextures (glw::GLsizei n, glw::GLuint *textures)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenTextures(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenTextures", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(textures)));
 	m_gl.genTextures(n, textures);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// textures = " << getPointerStr(textures, n) << TestLog::EndMessage;
@@ -1661,6 +2123,8 @@ void CallLogWrapper::glGenTransformFeedbacks (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenTransformFeedbacks", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ids)));
 	m_gl.genTransformFeedbacks(n, ids);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
@@ -1670,6 +2134,8 @@ void CallLogWrapper::glGenVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenVertexArrays", 2).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays)));
 	m_gl.genVertexArrays(n, arrays);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// arrays = " << getPointerStr(arrays, n) << TestLog::EndMessage;
@@ -1679,6 +2145,8 @@ void CallLogWrapper::glGenerateMipmap (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateMipmap(" << getTextureTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenerateMipmap", 1).addHex(target);
 	m_gl.generateMipmap(target);
 }
 
@@ -1686,6 +2154,8 @@ void CallLogWrapper::glGenerateMultiTexMipmapEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateMultiTexMipmapEXT(" << toHex(texunit) << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenerateMultiTexMipmapEXT", 2).addHex(texunit).addHex(target);
 	m_gl.generateMultiTexMipmapEXT(texunit, target);
 }
 
@@ -1693,6 +2163,8 @@ void CallLogWrapper::glGenerateTextureMipmap (glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateTextureMipmap(" << texture << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenerateTextureMipmap", 1).addUint(texture);
 	m_gl.generateTextureMipmap(texture);
 }
 
@@ -1700,6 +2172,8 @@ void CallLogWrapper::glGenerateTextureMipmapEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateTextureMipmapEXT(" << texture << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGenerateTextureMipmapEXT", 2).addUint(texture).addHex(target);
 	m_gl.generateTextureMipmapEXT(texture, target);
 }
 
@@ -1707,6 +2181,8 @@ void CallLogWrapper::glGetActiveAtomicCounterBufferiv (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveAtomicCounterBufferiv(" << program << ", " << bufferIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveAtomicCounterBufferiv", 4).addUint(program).addUint(bufferIndex).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
 }
 
@@ -1714,6 +2190,8 @@ void CallLogWrapper::glGetActiveAttrib (glw::GLuint program, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveAttrib(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveAttrib", 7).addUint(program).addUint(index).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(size))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(type))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.getActiveAttrib(program, index, bufSize, length, size, type, name);
 }
 
@@ -1721,6 +2199,8 @@ void CallLogWrapper::glGetActiveSubroutineName (glw::GLuint program, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveSubroutineName", 6).addUint(program).addHex(shadertype).addUint(index).addInt(bufsize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.getActiveSubroutineName(program, shadertype, index, bufsize, length, name);
 }
 
@@ -1728,6 +2208,8 @@ void CallLogWrapper::glGetActiveSubroutineUniformName (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveSubroutineUniformName", 6).addUint(program).addHex(shadertype).addUint(index).addInt(bufsize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.getActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
 }
 
@@ -1735,6 +2217,8 @@ void CallLogWrapper::glGetActiveSubroutineUniformiv (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformiv(" << program << ", " << toHex(shadertype) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveSubroutineUniformiv", 5).addUint(program).addHex(shadertype).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(values)));
 	m_gl.getActiveSubroutineUniformiv(program, shadertype, index, pname, values);
 }
 
@@ -1742,6 +2226,8 @@ void CallLogWrapper::glGetActiveUniform (glw::GLuint program, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniform(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveUniform", 7).addUint(program).addUint(index).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(size))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(type))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.getActiveUniform(program, index, bufSize, length, size, type, name);
 	if (m_enableLog)
 	{
@@ -1756,6 +2242,8 @@ void CallLogWrapper::glGetActiveUniformBlockName (glw::GLuint program, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformBlockName(" << program << ", " << uniformBlockIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveUniformBlockName", 5).addUint(program).addUint(uniformBlockIndex).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName)));
 	m_gl.getActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
 }
 
@@ -1763,6 +2251,8 @@ void CallLogWrapper::glGetActiveUniformBlockiv (glw::GLuint program, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformBlockiv(" << program << ", " << uniformBlockIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveUniformBlockiv", 4).addUint(program).addUint(uniformBlockIndex).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
 }
 
@@ -1770,6 +2260,8 @@ void CallLogWrapper::glGetActiveUniformName (glw::GLuint program, glw::GLuint un
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformName(" << program << ", " << uniformIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformName))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveUniformName", 5).addUint(program).addUint(uniformIndex).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformName)));
 	m_gl.getActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
 }
 
@@ -1777,6 +2269,8 @@ void CallLogWrapper::glGetActiveUniformsiv (glw::GLuint program, glw::GLsizei un
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformsiv(" << program << ", " << uniformCount << ", " << getPointerStr(uniformIndices, uniformCount) << ", " << getUniformParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetActiveUniformsiv", 5).addUint(program).addInt(uniformCount).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, uniformCount) << TestLog::EndMessage;
@@ -1786,6 +2280,8 @@ void CallLogWrapper::glGetAttachedShaders (glw::GLuint program, glw::GLsizei max
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetAttachedShaders(" << program << ", " << maxCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetAttachedShaders", 4).addUint(program).addInt(maxCount).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(count))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders)));
 	m_gl.getAttachedShaders(program, maxCount, count, shaders);
 }
 
@@ -1793,6 +2289,8 @@ glw::GLint CallLogWrapper::glGetAttribLocation (glw::GLuint program, const glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetAttribLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetAttribLocation", 2).addUint(program).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLint returnValue = m_gl.getAttribLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1803,6 +2301,8 @@ void CallLogWrapper::glGetBooleani_v (glw::GLenum target, glw::GLuint index, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleani_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetBooleani_v", 3).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getBooleani_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -1812,6 +2312,8 @@ void CallLogWrapper::glGetBooleanv (glw::GLenum pname, glw::GLboolean *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleanv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetBooleanv", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getBooleanv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1821,6 +2323,8 @@ void CallLogWrapper::glGetBufferParameteri64v (glw::GLenum target, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferParameteri64v(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetBufferParameteri64v", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getBufferParameteri64v(target, pname, params);
 }
 
@@ -1828,6 +2332,8 @@ void CallLogWrapper::glGetBufferParameteriv (glw::GLenum target, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferParameteriv(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetBufferParameteriv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getBufferParameteriv(target, pname, params);
 }
 
@@ -1835,6 +2341,8 @@ void CallLogWrapper::glGetBufferPointerv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferPointerv(" << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetBufferPointerv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getBufferPointerv(target, pname, params);
 }
 
@@ -1842,6 +2350,8 @@ void CallLogWrapper::glGetBufferSubData (glw::GLenum target, glw::GLintptr offse
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferSubData(" << toHex(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetBufferSubData", 4).addHex(target).addInt(offset).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getBufferSubData(target, offset, size, data);
 }
 
@@ -1849,6 +2359,8 @@ void CallLogWrapper::glGetCompressedMultiTexImageEXT (glw::GLenum texunit, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << lod << ", " << img << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetCompressedMultiTexImageEXT", 4).addHex(texunit).addHex(target).addInt(lod).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(img)));
 	m_gl.getCompressedMultiTexImageEXT(texunit, target, lod, img);
 }
 
@@ -1856,6 +2368,8 @@ void CallLogWrapper::glGetCompressedTexImage (glw::GLenum target, glw::GLint lev
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTexImage(" << toHex(target) << ", " << level << ", " << img << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetCompressedTexImage", 3).addHex(target).addInt(level).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(img)));
 	m_gl.getCompressedTexImage(target, level, img);
 }
 
@@ -1863,6 +2377,8 @@ void CallLogWrapper::glGetCompressedTextureImage (glw::GLuint texture, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureImage(" << texture << ", " << level << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetCompressedTextureImage", 4).addUint(texture).addInt(level).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getCompressedTextureImage(texture, level, bufSize, pixels);
 }
 
@@ -1870,6 +2386,8 @@ void CallLogWrapper::glGetCompressedTextureImageEXT (glw::GLuint texture, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureImageEXT(" << texture << ", " << toHex(target) << ", " << lod << ", " << img << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetCompressedTextureImageEXT", 4).addUint(texture).addHex(target).addInt(lod).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(img)));
 	m_gl.getCompressedTextureImageEXT(texture, target, lod, img);
 }
 
@@ -1877,6 +2395,8 @@ void CallLogWrapper::glGetCompressedTextureSubImage (glw::GLuint texture, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetCompressedTextureSubImage", 10).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
 }
 
@@ -1884,6 +2404,8 @@ glw::GLuint CallLogWrapper::glGetDebugMessageLog (glw::GLuint count, glw::GLsize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDebugMessageLog(" << count << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sources))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(types))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(severities))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(lengths))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(messageLog))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetDebugMessageLog", 8).addUint(count).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(sources))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(types))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(severities))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(lengths))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(messageLog)));
 	glw::GLuint returnValue = m_gl.getDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1894,6 +2416,8 @@ void CallLogWrapper::glGetDoublei_v (glw::GLenum target, glw::GLuint index, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoublei_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetDoublei_v", 3).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getDoublei_v(target, index, data);
 }
 
@@ -1901,6 +2425,8 @@ void CallLogWrapper::glGetDoublev (glw::GLenum pname, glw::GLdouble *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoublev(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetDoublev", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getDoublev(pname, data);
 }
 
@@ -1908,6 +2434,8 @@ glw::GLenum CallLogWrapper::glGetError (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetError(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetError", 0);
 	glw::GLenum returnValue = m_gl.getError();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getErrorStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -1918,6 +2446,8 @@ void CallLogWrapper::glGetFloati_v (glw::GLenum target, glw::GLuint index, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloati_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetFloati_v", 3).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getFloati_v(target, index, data);
 }
 
@@ -1925,6 +2455,8 @@ void CallLogWrapper::glGetFloatv (glw::GLenum pname, glw::GLfloat *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloatv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetFloatv", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getFloatv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1934,6 +2466,8 @@ glw::GLint CallLogWrapper::glGetFragDataIndex (glw::GLuint program, const glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFragDataIndex(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetFragDataIndex", 2).addUint(program).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLint returnValue = m_gl.getFragDataIndex(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1944,6 +2478,8 @@ glw::GLint CallLogWrapper::glGetFragDataLocation (glw::GLuint program, const glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFragDataLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetFragDataLocation", 2).addUint(program).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLint returnValue = m_gl.getFragDataLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1954,6 +2490,8 @@ void CallLogWrapper::glGetFramebufferAttachmentParameteriv (glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferAttachmentParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferAttachmentParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetFramebufferAttachmentParameteriv", 4).addHex(target).addHex(attachment).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getFramebufferAttachmentParameteriv(target, attachment, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getFramebufferAttachmentParameterValueStr(pname, params) << TestLog::EndMessage;
@@ -1963,6 +2501,8 @@ void CallLogWrapper::glGetFramebufferParameteriv (glw::GLenum target, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetFramebufferParameteriv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getFramebufferParameteriv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1972,6 +2512,8 @@ void CallLogWrapper::glGetFramebufferParameterivEXT (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferParameterivEXT(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetFramebufferParameterivEXT", 3).addUint(framebuffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getFramebufferParameterivEXT(framebuffer, pname, params);
 }
 
@@ -1979,6 +2521,8 @@ glw::GLenum CallLogWrapper::glGetGraphicsResetStatus (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetGraphicsResetStatus(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetGraphicsResetStatus", 0);
 	glw::GLenum returnValue = m_gl.getGraphicsResetStatus();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -1989,6 +2533,8 @@ void CallLogWrapper::glGetInteger64i_v (glw::GLenum target, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInteger64i_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetInteger64i_v", 3).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getInteger64i_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -1998,6 +2544,8 @@ void CallLogWrapper::glGetInteger64v (glw::GLenum pname, glw::GLint64 *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInteger64v(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetInteger64v", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getInteger64v(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2007,6 +2555,8 @@ void CallLogWrapper::glGetIntegeri_v (glw::GLenum target, glw::GLuint index, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegeri_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetIntegeri_v", 3).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getIntegeri_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -2016,6 +2566,8 @@ void CallLogWrapper::glGetIntegerv (glw::GLenum pname, glw::GLint *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegerv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetIntegerv", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getIntegerv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2025,6 +2577,8 @@ void CallLogWrapper::glGetInternalformatSampleivNV (glw::GLenum target, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformatSampleivNV(" << toHex(target) << ", " << toHex(internalformat) << ", " << samples << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetInternalformatSampleivNV", 6).addHex(target).addHex(internalformat).addInt(samples).addHex(pname).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getInternalformatSampleivNV(target, internalformat, samples, pname, bufSize, params);
 }
 
@@ -2032,6 +2586,8 @@ void CallLogWrapper::glGetInternalformati64v (glw::GLenum target, glw::GLenum in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformati64v(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetInternalformati64v", 5).addHex(target).addHex(internalformat).addHex(pname).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getInternalformati64v(target, internalformat, pname, bufSize, params);
 }
 
@@ -2039,6 +2595,8 @@ void CallLogWrapper::glGetInternalformativ (glw::GLenum target, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformativ(" << getInternalFormatTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << getInternalFormatParameterStr(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetInternalformativ", 5).addHex(target).addHex(internalformat).addHex(pname).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getInternalformativ(target, internalformat, pname, bufSize, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, bufSize) << TestLog::EndMessage;
@@ -2048,6 +2606,8 @@ void CallLogWrapper::glGetMultiTexEnvfvEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexEnvfvEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexEnvfvEXT(texunit, target, pname, params);
 }
 
@@ -2055,6 +2615,8 @@ void CallLogWrapper::glGetMultiTexEnvivEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexEnvivEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexEnvivEXT(texunit, target, pname, params);
 }
 
@@ -2062,6 +2624,8 @@ void CallLogWrapper::glGetMultiTexGendvEXT (glw::GLenum texunit, glw::GLenum coo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexGendvEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexGendvEXT(texunit, coord, pname, params);
 }
 
@@ -2069,6 +2633,8 @@ void CallLogWrapper::glGetMultiTexGenfvEXT (glw::GLenum texunit, glw::GLenum coo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexGenfvEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexGenfvEXT(texunit, coord, pname, params);
 }
 
@@ -2076,6 +2642,8 @@ void CallLogWrapper::glGetMultiTexGenivEXT (glw::GLenum texunit, glw::GLenum coo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexGenivEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexGenivEXT(texunit, coord, pname, params);
 }
 
@@ -2083,6 +2651,8 @@ void CallLogWrapper::glGetMultiTexImageEXT (glw::GLenum texunit, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexImageEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexImageEXT", 6).addHex(texunit).addHex(target).addInt(level).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getMultiTexImageEXT(texunit, target, level, format, type, pixels);
 }
 
@@ -2090,6 +2660,8 @@ void CallLogWrapper::glGetMultiTexLevelParameterfvEXT (glw::GLenum texunit, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexLevelParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexLevelParameterfvEXT", 5).addHex(texunit).addHex(target).addInt(level).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexLevelParameterfvEXT(texunit, target, level, pname, params);
 }
 
@@ -2097,6 +2669,8 @@ void CallLogWrapper::glGetMultiTexLevelParameterivEXT (glw::GLenum texunit, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexLevelParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexLevelParameterivEXT", 5).addHex(texunit).addHex(target).addInt(level).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexLevelParameterivEXT(texunit, target, level, pname, params);
 }
 
@@ -2104,6 +2678,8 @@ void CallLogWrapper::glGetMultiTexParameterIivEXT (glw::GLenum texunit, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexParameterIivEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexParameterIivEXT(texunit, target, pname, params);
 }
 
@@ -2111,6 +2687,8 @@ void CallLogWrapper::glGetMultiTexParameterIuivEXT (glw::GLenum texunit, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexParameterIuivEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexParameterIuivEXT(texunit, target, pname, params);
 }
 
@@ -2118,6 +2696,8 @@ void CallLogWrapper::glGetMultiTexParameterfvEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexParameterfvEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexParameterfvEXT(texunit, target, pname, params);
 }
 
@@ -2125,6 +2705,8 @@ void CallLogWrapper::glGetMultiTexParameterivEXT (glw::GLenum texunit, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultiTexParameterivEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getMultiTexParameterivEXT(texunit, target, pname, params);
 }
 
@@ -2132,6 +2714,8 @@ void CallLogWrapper::glGetMultisamplefv (glw::GLenum pname, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultisamplefv(" << getMultisampleParameterStr(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(val))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetMultisamplefv", 3).addHex(pname).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(val)));
 	m_gl.getMultisamplefv(pname, index, val);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// val = " << getPointerStr(val, 2) << TestLog::EndMessage;
@@ -2141,6 +2725,8 @@ void CallLogWrapper::glGetNamedBufferParameteri64v (glw::GLuint buffer, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameteri64v(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedBufferParameteri64v", 3).addUint(buffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedBufferParameteri64v(buffer, pname, params);
 }
 
@@ -2148,6 +2734,8 @@ void CallLogWrapper::glGetNamedBufferParameteriv (glw::GLuint buffer, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameteriv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedBufferParameteriv", 3).addUint(buffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedBufferParameteriv(buffer, pname, params);
 }
 
@@ -2155,6 +2743,8 @@ void CallLogWrapper::glGetNamedBufferParameterivEXT (glw::GLuint buffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameterivEXT(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedBufferParameterivEXT", 3).addUint(buffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedBufferParameterivEXT(buffer, pname, params);
 }
 
@@ -2162,6 +2752,8 @@ void CallLogWrapper::glGetNamedBufferPointerv (glw::GLuint buffer, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferPointerv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedBufferPointerv", 3).addUint(buffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedBufferPointerv(buffer, pname, params);
 }
 
@@ -2169,6 +2761,8 @@ void CallLogWrapper::glGetNamedBufferPointervEXT (glw::GLuint buffer, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferPointervEXT(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedBufferPointervEXT", 3).addUint(buffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedBufferPointervEXT(buffer, pname, params);
 }
 
@@ -2176,6 +2770,8 @@ void CallLogWrapper::glGetNamedBufferSubData (glw::GLuint buffer, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedBufferSubData", 4).addUint(buffer).addInt(offset).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getNamedBufferSubData(buffer, offset, size, data);
 }
 
@@ -2183,6 +2779,8 @@ void CallLogWrapper::glGetNamedBufferSubDataEXT (glw::GLuint buffer, glw::GLintp
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferSubDataEXT(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedBufferSubDataEXT", 4).addUint(buffer).addInt(offset).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getNamedBufferSubDataEXT(buffer, offset, size, data);
 }
 
@@ -2190,6 +2788,8 @@ void CallLogWrapper::glGetNamedFramebufferAttachmentParameteriv (glw::GLuint fra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferAttachmentParameteriv(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedFramebufferAttachmentParameteriv", 4).addUint(framebuffer).addHex(attachment).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
 }
 
@@ -2197,6 +2797,8 @@ void CallLogWrapper::glGetNamedFramebufferAttachmentParameterivEXT (glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferAttachmentParameterivEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedFramebufferAttachmentParameterivEXT", 4).addUint(framebuffer).addHex(attachment).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedFramebufferAttachmentParameterivEXT(framebuffer, attachment, pname, params);
 }
 
@@ -2204,6 +2806,8 @@ void CallLogWrapper::glGetNamedFramebufferParameteriv (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferParameteriv(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedFramebufferParameteriv", 3).addUint(framebuffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getNamedFramebufferParameteriv(framebuffer, pname, param);
 }
 
@@ -2211,6 +2815,8 @@ void CallLogWrapper::glGetNamedFramebufferParameterivEXT (glw::GLuint framebuffe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferParameterivEXT(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedFramebufferParameterivEXT", 3).addUint(framebuffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedFramebufferParameterivEXT(framebuffer, pname, params);
 }
 
@@ -2218,6 +2824,8 @@ void CallLogWrapper::glGetNamedProgramLocalParameterIivEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterIivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedProgramLocalParameterIivEXT", 4).addUint(program).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedProgramLocalParameterIivEXT(program, target, index, params);
 }
 
@@ -2225,6 +2833,8 @@ void CallLogWrapper::glGetNamedProgramLocalParameterIuivEXT (glw::GLuint program
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterIuivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedProgramLocalParameterIuivEXT", 4).addUint(program).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedProgramLocalParameterIuivEXT(program, target, index, params);
 }
 
@@ -2232,6 +2842,8 @@ void CallLogWrapper::glGetNamedProgramLocalParameterdvEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterdvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedProgramLocalParameterdvEXT", 4).addUint(program).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedProgramLocalParameterdvEXT(program, target, index, params);
 }
 
@@ -2239,6 +2851,8 @@ void CallLogWrapper::glGetNamedProgramLocalParameterfvEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramLocalParameterfvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedProgramLocalParameterfvEXT", 4).addUint(program).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedProgramLocalParameterfvEXT(program, target, index, params);
 }
 
@@ -2246,6 +2860,8 @@ void CallLogWrapper::glGetNamedProgramStringEXT (glw::GLuint program, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << string << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedProgramStringEXT", 4).addUint(program).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(string)));
 	m_gl.getNamedProgramStringEXT(program, target, pname, string);
 }
 
@@ -2253,6 +2869,8 @@ void CallLogWrapper::glGetNamedProgramivEXT (glw::GLuint program, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedProgramivEXT(" << program << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedProgramivEXT", 4).addUint(program).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedProgramivEXT(program, target, pname, params);
 }
 
@@ -2260,6 +2878,8 @@ void CallLogWrapper::glGetNamedRenderbufferParameteriv (glw::GLuint renderbuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedRenderbufferParameteriv(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedRenderbufferParameteriv", 3).addUint(renderbuffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedRenderbufferParameteriv(renderbuffer, pname, params);
 }
 
@@ -2267,6 +2887,8 @@ void CallLogWrapper::glGetNamedRenderbufferParameterivEXT (glw::GLuint renderbuf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedRenderbufferParameterivEXT(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetNamedRenderbufferParameterivEXT", 3).addUint(renderbuffer).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getNamedRenderbufferParameterivEXT(renderbuffer, pname, params);
 }
 
@@ -2274,6 +2896,8 @@ void CallLogWrapper::glGetObjectLabel (glw::GLenum identifier, glw::GLuint name,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetObjectLabel(" << toHex(identifier) << ", " << name << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetObjectLabel", 5).addHex(identifier).addUint(name).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(label)));
 	m_gl.getObjectLabel(identifier, name, bufSize, length, label);
 }
 
@@ -2281,6 +2905,8 @@ void CallLogWrapper::glGetObjectPtrLabel (const void *ptr, glw::GLsizei bufSize,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetObjectPtrLabel(" << ptr << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetObjectPtrLabel", 4).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ptr))).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(label)));
 	m_gl.getObjectPtrLabel(ptr, bufSize, length, label);
 }
 
@@ -2288,6 +2914,8 @@ void CallLogWrapper::glGetPointerIndexedvEXT (glw::GLenum target, glw::GLuint in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointerIndexedvEXT(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetPointerIndexedvEXT", 3).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.getPointerIndexedvEXT(target, index, data);
 }
 
@@ -2295,6 +2923,8 @@ void CallLogWrapper::glGetPointeri_vEXT (glw::GLenum pname, glw::GLuint index, v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointeri_vEXT(" << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetPointeri_vEXT", 3).addHex(pname).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getPointeri_vEXT(pname, index, params);
 }
 
@@ -2302,6 +2932,8 @@ void CallLogWrapper::glGetPointerv (glw::GLenum pname, void **params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointerv(" << getPointerStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetPointerv", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getPointerv(pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2311,6 +2943,8 @@ void CallLogWrapper::glGetProgramBinary (glw::GLuint program, glw::GLsizei bufSi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramBinary(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binaryFormat))) << ", " << binary << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramBinary", 5).addUint(program).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(binaryFormat))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(binary)));
 	m_gl.getProgramBinary(program, bufSize, length, binaryFormat, binary);
 }
 
@@ -2318,6 +2952,8 @@ void CallLogWrapper::glGetProgramInfoLog (glw::GLuint program, glw::GLsizei bufS
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramInfoLog(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramInfoLog", 4).addUint(program).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog)));
 	m_gl.getProgramInfoLog(program, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -2327,6 +2963,8 @@ void CallLogWrapper::glGetProgramInterfaceiv (glw::GLuint program, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramInterfaceiv(" << program << ", " << toHex(programInterface) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramInterfaceiv", 4).addUint(program).addHex(programInterface).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getProgramInterfaceiv(program, programInterface, pname, params);
 }
 
@@ -2334,6 +2972,8 @@ void CallLogWrapper::glGetProgramPipelineInfoLog (glw::GLuint pipeline, glw::GLs
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramPipelineInfoLog(" << pipeline << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramPipelineInfoLog", 4).addUint(pipeline).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog)));
 	m_gl.getProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -2343,6 +2983,8 @@ void CallLogWrapper::glGetProgramPipelineiv (glw::GLuint pipeline, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramPipelineiv(" << pipeline << ", " << getPipelineParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramPipelineiv", 3).addUint(pipeline).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getProgramPipelineiv(pipeline, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2352,6 +2994,8 @@ glw::GLuint CallLogWrapper::glGetProgramResourceIndex (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceIndex(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramResourceIndex", 3).addUint(program).addHex(programInterface).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLuint returnValue = m_gl.getProgramResourceIndex(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2362,6 +3006,8 @@ glw::GLint CallLogWrapper::glGetProgramResourceLocation (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceLocation(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramResourceLocation", 3).addUint(program).addHex(programInterface).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLint returnValue = m_gl.getProgramResourceLocation(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2372,6 +3018,8 @@ glw::GLint CallLogWrapper::glGetProgramResourceLocationIndex (glw::GLuint progra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceLocationIndex(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramResourceLocationIndex", 3).addUint(program).addHex(programInterface).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLint returnValue = m_gl.getProgramResourceLocationIndex(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2382,6 +3030,8 @@ void CallLogWrapper::glGetProgramResourceName (glw::GLuint program, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceName(" << program << ", " << toHex(programInterface) << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramResourceName", 6).addUint(program).addHex(programInterface).addUint(index).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.getProgramResourceName(program, programInterface, index, bufSize, length, name);
 }
 
@@ -2389,6 +3039,8 @@ void CallLogWrapper::glGetProgramResourceiv (glw::GLuint program, glw::GLenum pr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceiv(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << index << ", " << propCount << ", " << getEnumPointerStr(props, propCount, getProgramResourcePropertyName) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramResourceiv", 8).addUint(program).addHex(programInterface).addUint(index).addInt(propCount).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(props))).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
 	if (m_enableLog)
 	{
@@ -2401,6 +3053,8 @@ void CallLogWrapper::glGetProgramStageiv (glw::GLuint program, glw::GLenum shade
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramStageiv(" << program << ", " << toHex(shadertype) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramStageiv", 4).addUint(program).addHex(shadertype).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(values)));
 	m_gl.getProgramStageiv(program, shadertype, pname, values);
 }
 
@@ -2408,6 +3062,8 @@ void CallLogWrapper::glGetProgramiv (glw::GLuint program, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramiv(" << program << ", " << getProgramParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetProgramiv", 3).addUint(program).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getProgramiv(program, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getProgramQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2417,6 +3073,8 @@ void CallLogWrapper::glGetQueryBufferObjecti64v (glw::GLuint id, glw::GLuint buf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjecti64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryBufferObjecti64v", 4).addUint(id).addUint(buffer).addHex(pname).addInt(offset);
 	m_gl.getQueryBufferObjecti64v(id, buffer, pname, offset);
 }
 
@@ -2424,6 +3082,8 @@ void CallLogWrapper::glGetQueryBufferObjectiv (glw::GLuint id, glw::GLuint buffe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryBufferObjectiv", 4).addUint(id).addUint(buffer).addHex(pname).addInt(offset);
 	m_gl.getQueryBufferObjectiv(id, buffer, pname, offset);
 }
 
@@ -2431,6 +3091,8 @@ void CallLogWrapper::glGetQueryBufferObjectui64v (glw::GLuint id, glw::GLuint bu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectui64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryBufferObjectui64v", 4).addUint(id).addUint(buffer).addHex(pname).addInt(offset);
 	m_gl.getQueryBufferObjectui64v(id, buffer, pname, offset);
 }
 
@@ -2438,6 +3100,8 @@ void CallLogWrapper::glGetQueryBufferObjectuiv (glw::GLuint id, glw::GLuint buff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectuiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryBufferObjectuiv", 4).addUint(id).addUint(buffer).addHex(pname).addInt(offset);
 	m_gl.getQueryBufferObjectuiv(id, buffer, pname, offset);
 }
 
@@ -2445,6 +3109,8 @@ void CallLogWrapper::glGetQueryIndexediv (glw::GLenum target, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryIndexediv(" << toHex(target) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryIndexediv", 4).addHex(target).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getQueryIndexediv(target, index, pname, params);
 }
 
@@ -2452,6 +3118,8 @@ void CallLogWrapper::glGetQueryObjecti64v (glw::GLuint id, glw::GLenum pname, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjecti64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryObjecti64v", 3).addUint(id).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getQueryObjecti64v(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2461,6 +3129,8 @@ void CallLogWrapper::glGetQueryObjectiv (glw::GLuint id, glw::GLenum pname, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryObjectiv", 3).addUint(id).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getQueryObjectiv(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2470,6 +3140,8 @@ void CallLogWrapper::glGetQueryObjectui64v (glw::GLuint id, glw::GLenum pname, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectui64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryObjectui64v", 3).addUint(id).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getQueryObjectui64v(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2479,6 +3151,8 @@ void CallLogWrapper::glGetQueryObjectuiv (glw::GLuint id, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectuiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryObjectuiv", 3).addUint(id).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getQueryObjectuiv(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2488,6 +3162,8 @@ void CallLogWrapper::glGetQueryiv (glw::GLenum target, glw::GLenum pname, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryiv(" << getQueryTargetStr(target) << ", " << getQueryParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetQueryiv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getQueryiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2497,6 +3173,8 @@ void CallLogWrapper::glGetRenderbufferParameteriv (glw::GLenum target, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetRenderbufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getRenderbufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetRenderbufferParameteriv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getRenderbufferParameteriv(target, pname, params);
 }
 
@@ -2504,6 +3182,8 @@ void CallLogWrapper::glGetSamplerParameterIiv (glw::GLuint sampler, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetSamplerParameterIiv", 3).addUint(sampler).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getSamplerParameterIiv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2513,6 +3193,8 @@ void CallLogWrapper::glGetSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetSamplerParameterIuiv", 3).addUint(sampler).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getSamplerParameterIuiv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2522,6 +3204,8 @@ void CallLogWrapper::glGetSamplerParameterfv (glw::GLuint sampler, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetSamplerParameterfv", 3).addUint(sampler).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getSamplerParameterfv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2531,6 +3215,8 @@ void CallLogWrapper::glGetSamplerParameteriv (glw::GLuint sampler, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetSamplerParameteriv", 3).addUint(sampler).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getSamplerParameteriv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2540,6 +3226,8 @@ void CallLogWrapper::glGetShaderInfoLog (glw::GLuint shader, glw::GLsizei bufSiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderInfoLog(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetShaderInfoLog", 4).addUint(shader).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog)));
 	m_gl.getShaderInfoLog(shader, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -2549,6 +3237,8 @@ void CallLogWrapper::glGetShaderPrecisionFormat (glw::GLenum shadertype, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderPrecisionFormat(" << getShaderTypeStr(shadertype) << ", " << getPrecisionFormatTypeStr(precisiontype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(range))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(precision))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetShaderPrecisionFormat", 4).addHex(shadertype).addHex(precisiontype).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(range))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(precision)));
 	m_gl.getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
 }
 
@@ -2556,6 +3246,8 @@ void CallLogWrapper::glGetShaderSource (glw::GLuint shader, glw::GLsizei bufSize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderSource(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(source))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetShaderSource", 4).addUint(shader).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(source)));
 	m_gl.getShaderSource(shader, bufSize, length, source);
 }
 
@@ -2563,6 +3255,8 @@ void CallLogWrapper::glGetShaderiv (glw::GLuint shader, glw::GLenum pname, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderiv(" << shader << ", " << getShaderParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetShaderiv", 3).addUint(shader).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getShaderiv(shader, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2572,6 +3266,8 @@ const glw::GLubyte * CallLogWrapper::glGetString (glw::GLenum name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetString(" << getGettableStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetString", 1).addHex(name);
 	const glw::GLubyte * returnValue = m_gl.getString(name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2582,6 +3278,8 @@ const glw::GLubyte * CallLogWrapper::glGetStringi (glw::GLenum name, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetStringi(" << getGettableStringStr(name) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetStringi", 2).addHex(name).addUint(index);
 	const glw::GLubyte * returnValue = m_gl.getStringi(name, index);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2592,6 +3290,8 @@ glw::GLuint CallLogWrapper::glGetSubroutineIndex (glw::GLuint program, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSubroutineIndex(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetSubroutineIndex", 3).addUint(program).addHex(shadertype).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLuint returnValue = m_gl.getSubroutineIndex(program, shadertype, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2602,6 +3302,8 @@ glw::GLint CallLogWrapper::glGetSubroutineUniformLocation (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSubroutineUniformLocation(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetSubroutineUniformLocation", 3).addUint(program).addHex(shadertype).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLint returnValue = m_gl.getSubroutineUniformLocation(program, shadertype, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2612,6 +3314,8 @@ void CallLogWrapper::glGetSynciv (glw::GLsync sync, glw::GLenum pname, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSynciv(" << sync << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetSynciv", 5).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(sync))).addHex(pname).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(values)));
 	m_gl.getSynciv(sync, pname, bufSize, length, values);
 }
 
@@ -2619,6 +3323,8 @@ void CallLogWrapper::glGetTexImage (glw::GLenum target, glw::GLint level, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTexImage", 5).addHex(target).addInt(level).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getTexImage(target, level, format, type, pixels);
 }
 
@@ -2626,6 +3332,8 @@ void CallLogWrapper::glGetTexLevelParameterfv (glw::GLenum target, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexLevelParameterfv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTexLevelParameterfv", 4).addHex(target).addInt(level).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTexLevelParameterfv(target, level, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2635,6 +3343,8 @@ void CallLogWrapper::glGetTexLevelParameteriv (glw::GLenum target, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexLevelParameteriv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTexLevelParameteriv", 4).addHex(target).addInt(level).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTexLevelParameteriv(target, level, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2644,6 +3354,8 @@ void CallLogWrapper::glGetTexParameterIiv (glw::GLenum target, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTexParameterIiv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTexParameterIiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2653,6 +3365,8 @@ void CallLogWrapper::glGetTexParameterIuiv (glw::GLenum target, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTexParameterIuiv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTexParameterIuiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2662,6 +3376,8 @@ void CallLogWrapper::glGetTexParameterfv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTexParameterfv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTexParameterfv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2671,6 +3387,8 @@ void CallLogWrapper::glGetTexParameteriv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTexParameteriv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTexParameteriv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2680,6 +3398,8 @@ void CallLogWrapper::glGetTextureImage (glw::GLuint texture, glw::GLint level, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureImage", 6).addUint(texture).addInt(level).addHex(format).addHex(type).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getTextureImage(texture, level, format, type, bufSize, pixels);
 }
 
@@ -2687,6 +3407,8 @@ void CallLogWrapper::glGetTextureImageEXT (glw::GLuint texture, glw::GLenum targ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureImageEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureImageEXT", 6).addUint(texture).addHex(target).addInt(level).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getTextureImageEXT(texture, target, level, format, type, pixels);
 }
 
@@ -2694,6 +3416,8 @@ void CallLogWrapper::glGetTextureLevelParameterfv (glw::GLuint texture, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameterfv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureLevelParameterfv", 4).addUint(texture).addInt(level).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureLevelParameterfv(texture, level, pname, params);
 }
 
@@ -2701,6 +3425,8 @@ void CallLogWrapper::glGetTextureLevelParameterfvEXT (glw::GLuint texture, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameterfvEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureLevelParameterfvEXT", 5).addUint(texture).addHex(target).addInt(level).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureLevelParameterfvEXT(texture, target, level, pname, params);
 }
 
@@ -2708,6 +3434,8 @@ void CallLogWrapper::glGetTextureLevelParameteriv (glw::GLuint texture, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameteriv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureLevelParameteriv", 4).addUint(texture).addInt(level).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureLevelParameteriv(texture, level, pname, params);
 }
 
@@ -2715,6 +3443,8 @@ void CallLogWrapper::glGetTextureLevelParameterivEXT (glw::GLuint texture, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameterivEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureLevelParameterivEXT", 5).addUint(texture).addHex(target).addInt(level).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureLevelParameterivEXT(texture, target, level, pname, params);
 }
 
@@ -2722,6 +3452,8 @@ void CallLogWrapper::glGetTextureParameterIiv (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureParameterIiv", 3).addUint(texture).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureParameterIiv(texture, pname, params);
 }
 
@@ -2729,6 +3461,8 @@ void CallLogWrapper::glGetTextureParameterIivEXT (glw::GLuint texture, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureParameterIivEXT", 4).addUint(texture).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureParameterIivEXT(texture, target, pname, params);
 }
 
@@ -2736,6 +3470,8 @@ void CallLogWrapper::glGetTextureParameterIuiv (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureParameterIuiv", 3).addUint(texture).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureParameterIuiv(texture, pname, params);
 }
 
@@ -2743,6 +3479,8 @@ void CallLogWrapper::glGetTextureParameterIuivEXT (glw::GLuint texture, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIuivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureParameterIuivEXT", 4).addUint(texture).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureParameterIuivEXT(texture, target, pname, params);
 }
 
@@ -2750,6 +3488,8 @@ void CallLogWrapper::glGetTextureParameterfv (glw::GLuint texture, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureParameterfv", 3).addUint(texture).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureParameterfv(texture, pname, params);
 }
 
@@ -2757,6 +3497,8 @@ void CallLogWrapper::glGetTextureParameterfvEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterfvEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureParameterfvEXT", 4).addUint(texture).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureParameterfvEXT(texture, target, pname, params);
 }
 
@@ -2764,6 +3506,8 @@ void CallLogWrapper::glGetTextureParameteriv (glw::GLuint texture, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureParameteriv", 3).addUint(texture).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureParameteriv(texture, pname, params);
 }
 
@@ -2771,6 +3515,8 @@ void CallLogWrapper::glGetTextureParameterivEXT (glw::GLuint texture, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureParameterivEXT", 4).addUint(texture).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getTextureParameterivEXT(texture, target, pname, params);
 }
 
@@ -2778,6 +3524,8 @@ void CallLogWrapper::glGetTextureSubImage (glw::GLuint texture, glw::GLint level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTextureSubImage", 12).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addHex(type).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
 }
 
@@ -2785,6 +3533,8 @@ void CallLogWrapper::glGetTransformFeedbackVarying (glw::GLuint program, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbackVarying(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTransformFeedbackVarying", 7).addUint(program).addUint(index).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(size))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(type))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	m_gl.getTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
 }
 
@@ -2792,6 +3542,8 @@ void CallLogWrapper::glGetTransformFeedbacki64_v (glw::GLuint xfb, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbacki64_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTransformFeedbacki64_v", 4).addUint(xfb).addHex(pname).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getTransformFeedbacki64_v(xfb, pname, index, param);
 }
 
@@ -2799,6 +3551,8 @@ void CallLogWrapper::glGetTransformFeedbacki_v (glw::GLuint xfb, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbacki_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTransformFeedbacki_v", 4).addUint(xfb).addHex(pname).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getTransformFeedbacki_v(xfb, pname, index, param);
 }
 
@@ -2806,6 +3560,8 @@ void CallLogWrapper::glGetTransformFeedbackiv (glw::GLuint xfb, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbackiv(" << xfb << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetTransformFeedbackiv", 3).addUint(xfb).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getTransformFeedbackiv(xfb, pname, param);
 }
 
@@ -2813,6 +3569,8 @@ glw::GLuint CallLogWrapper::glGetUniformBlockIndex (glw::GLuint program, const g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformBlockIndex(" << program << ", " << getStringStr(uniformBlockName) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetUniformBlockIndex", 2).addUint(program).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName)));
 	glw::GLuint returnValue = m_gl.getUniformBlockIndex(program, uniformBlockName);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2823,6 +3581,8 @@ void CallLogWrapper::glGetUniformIndices (glw::GLuint program, glw::GLsizei unif
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformIndices(" << program << ", " << uniformCount << ", " << getPointerStr(uniformNames, uniformCount) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetUniformIndices", 4).addUint(program).addInt(uniformCount).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformNames))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices)));
 	m_gl.getUniformIndices(program, uniformCount, uniformNames, uniformIndices);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// uniformIndices = " << getPointerStr(uniformIndices, uniformCount) << TestLog::EndMessage;
@@ -2832,6 +3592,8 @@ glw::GLint CallLogWrapper::glGetUniformLocation (glw::GLuint program, const glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetUniformLocation", 2).addUint(program).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(name)));
 	glw::GLint returnValue = m_gl.getUniformLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2842,6 +3604,8 @@ void CallLogWrapper::glGetUniformSubroutineuiv (glw::GLenum shadertype, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformSubroutineuiv(" << toHex(shadertype) << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetUniformSubroutineuiv", 3).addHex(shadertype).addInt(location).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getUniformSubroutineuiv(shadertype, location, params);
 }
 
@@ -2849,6 +3613,8 @@ void CallLogWrapper::glGetUniformdv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformdv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetUniformdv", 3).addUint(program).addInt(location).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getUniformdv(program, location, params);
 }
 
@@ -2856,6 +3622,8 @@ void CallLogWrapper::glGetUniformfv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformfv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetUniformfv", 3).addUint(program).addInt(location).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getUniformfv(program, location, params);
 }
 
@@ -2863,6 +3631,8 @@ void CallLogWrapper::glGetUniformiv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetUniformiv", 3).addUint(program).addInt(location).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getUniformiv(program, location, params);
 }
 
@@ -2870,6 +3640,8 @@ void CallLogWrapper::glGetUniformuiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformuiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetUniformuiv", 3).addUint(program).addInt(location).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getUniformuiv(program, location, params);
 }
 
@@ -2877,6 +3649,8 @@ void CallLogWrapper::glGetVertexArrayIndexed64iv (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIndexed64iv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexArrayIndexed64iv", 4).addUint(vaobj).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getVertexArrayIndexed64iv(vaobj, index, pname, param);
 }
 
@@ -2884,6 +3658,8 @@ void CallLogWrapper::glGetVertexArrayIndexediv (glw::GLuint vaobj, glw::GLuint i
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIndexediv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexArrayIndexediv", 4).addUint(vaobj).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getVertexArrayIndexediv(vaobj, index, pname, param);
 }
 
@@ -2891,6 +3667,8 @@ void CallLogWrapper::glGetVertexArrayIntegeri_vEXT (glw::GLuint vaobj, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIntegeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexArrayIntegeri_vEXT", 4).addUint(vaobj).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getVertexArrayIntegeri_vEXT(vaobj, index, pname, param);
 }
 
@@ -2898,6 +3676,8 @@ void CallLogWrapper::glGetVertexArrayIntegervEXT (glw::GLuint vaobj, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIntegervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexArrayIntegervEXT", 3).addUint(vaobj).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getVertexArrayIntegervEXT(vaobj, pname, param);
 }
 
@@ -2905,6 +3685,8 @@ void CallLogWrapper::glGetVertexArrayPointeri_vEXT (glw::GLuint vaobj, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayPointeri_vEXT(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexArrayPointeri_vEXT", 4).addUint(vaobj).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getVertexArrayPointeri_vEXT(vaobj, index, pname, param);
 }
 
@@ -2912,6 +3694,8 @@ void CallLogWrapper::glGetVertexArrayPointervEXT (glw::GLuint vaobj, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayPointervEXT(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexArrayPointervEXT", 3).addUint(vaobj).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getVertexArrayPointervEXT(vaobj, pname, param);
 }
 
@@ -2919,6 +3703,8 @@ void CallLogWrapper::glGetVertexArrayiv (glw::GLuint vaobj, glw::GLenum pname, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayiv(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexArrayiv", 3).addUint(vaobj).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.getVertexArrayiv(vaobj, pname, param);
 }
 
@@ -2926,6 +3712,8 @@ void CallLogWrapper::glGetVertexAttribIiv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribIiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexAttribIiv", 3).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getVertexAttribIiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2935,6 +3723,8 @@ void CallLogWrapper::glGetVertexAttribIuiv (glw::GLuint index, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribIuiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexAttribIuiv", 3).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getVertexAttribIuiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2944,6 +3734,8 @@ void CallLogWrapper::glGetVertexAttribLdv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribLdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexAttribLdv", 3).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getVertexAttribLdv(index, pname, params);
 }
 
@@ -2951,6 +3743,8 @@ void CallLogWrapper::glGetVertexAttribPointerv (glw::GLuint index, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribPointerv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexAttribPointerv", 3).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer)));
 	m_gl.getVertexAttribPointerv(index, pname, pointer);
 }
 
@@ -2958,6 +3752,8 @@ void CallLogWrapper::glGetVertexAttribdv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexAttribdv", 3).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getVertexAttribdv(index, pname, params);
 }
 
@@ -2965,6 +3761,8 @@ void CallLogWrapper::glGetVertexAttribfv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribfv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexAttribfv", 3).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getVertexAttribfv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2974,6 +3772,8 @@ void CallLogWrapper::glGetVertexAttribiv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetVertexAttribiv", 3).addUint(index).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getVertexAttribiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2983,6 +3783,8 @@ void CallLogWrapper::glGetnCompressedTexImage (glw::GLenum target, glw::GLint lo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnCompressedTexImage(" << toHex(target) << ", " << lod << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetnCompressedTexImage", 4).addHex(target).addInt(lod).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getnCompressedTexImage(target, lod, bufSize, pixels);
 }
 
@@ -2990,6 +3792,8 @@ void CallLogWrapper::glGetnTexImage (glw::GLenum target, glw::GLint level, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetnTexImage", 6).addHex(target).addInt(level).addHex(format).addHex(type).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.getnTexImage(target, level, format, type, bufSize, pixels);
 }
 
@@ -2997,6 +3801,8 @@ void CallLogWrapper::glGetnUniformdv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformdv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetnUniformdv", 4).addUint(program).addInt(location).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getnUniformdv(program, location, bufSize, params);
 }
 
@@ -3004,6 +3810,8 @@ void CallLogWrapper::glGetnUniformfv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformfv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetnUniformfv", 4).addUint(program).addInt(location).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getnUniformfv(program, location, bufSize, params);
 }
 
@@ -3011,6 +3819,8 @@ void CallLogWrapper::glGetnUniformiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetnUniformiv", 4).addUint(program).addInt(location).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getnUniformiv(program, location, bufSize, params);
 }
 
@@ -3018,6 +3828,8 @@ void CallLogWrapper::glGetnUniformuiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformuiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glGetnUniformuiv", 4).addUint(program).addInt(location).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.getnUniformuiv(program, location, bufSize, params);
 }
 
@@ -3025,6 +3837,8 @@ void CallLogWrapper::glHint (glw::GLenum target, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glHint(" << getHintStr(target) << ", " << getHintModeStr(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glHint", 2).addHex(target).addHex(mode);
 	m_gl.hint(target, mode);
 }
 
@@ -3032,6 +3846,8 @@ void CallLogWrapper::glInsertEventMarkerEXT (glw::GLsizei length, const glw::GLc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInsertEventMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInsertEventMarkerEXT", 2).addInt(length).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(marker)));
 	m_gl.insertEventMarkerEXT(length, marker);
 }
 
@@ -3039,6 +3855,8 @@ void CallLogWrapper::glInvalidateBufferData (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateBufferData(" << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInvalidateBufferData", 1).addUint(buffer);
 	m_gl.invalidateBufferData(buffer);
 }
 
@@ -3046,6 +3864,8 @@ void CallLogWrapper::glInvalidateBufferSubData (glw::GLuint buffer, glw::GLintpt
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateBufferSubData(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInvalidateBufferSubData", 3).addUint(buffer).addInt(offset).addInt(length);
 	m_gl.invalidateBufferSubData(buffer, offset, length);
 }
 
@@ -3053,6 +3873,8 @@ void CallLogWrapper::glInvalidateFramebuffer (glw::GLenum target, glw::GLsizei n
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInvalidateFramebuffer", 3).addHex(target).addInt(numAttachments).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments)));
 	m_gl.invalidateFramebuffer(target, numAttachments, attachments);
 }
 
@@ -3060,6 +3882,8 @@ void CallLogWrapper::glInvalidateNamedFramebufferData (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInvalidateNamedFramebufferData", 3).addUint(framebuffer).addInt(numAttachments).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments)));
 	m_gl.invalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
 }
 
@@ -3067,6 +3891,8 @@ void CallLogWrapper::glInvalidateNamedFramebufferSubData (glw::GLuint framebuffe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferSubData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInvalidateNamedFramebufferSubData", 7).addUint(framebuffer).addInt(numAttachments).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.invalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
 }
 
@@ -3074,6 +3900,8 @@ void CallLogWrapper::glInvalidateSubFramebuffer (glw::GLenum target, glw::GLsize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateSubFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInvalidateSubFramebuffer", 7).addHex(target).addInt(numAttachments).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
 }
 
@@ -3081,6 +3909,8 @@ void CallLogWrapper::glInvalidateTexImage (glw::GLuint texture, glw::GLint level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateTexImage(" << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInvalidateTexImage", 2).addUint(texture).addInt(level);
 	m_gl.invalidateTexImage(texture, level);
 }
 
@@ -3088,6 +3918,8 @@ void CallLogWrapper::glInvalidateTexSubImage (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glInvalidateTexSubImage", 8).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth);
 	m_gl.invalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
 }
 
@@ -3095,6 +3927,8 @@ glw::GLboolean CallLogWrapper::glIsBuffer (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsBuffer(" << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsBuffer", 1).addUint(buffer);
 	glw::GLboolean returnValue = m_gl.isBuffer(buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3105,6 +3939,8 @@ glw::GLboolean CallLogWrapper::glIsEnabled (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabled(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsEnabled", 1).addHex(cap);
 	glw::GLboolean returnValue = m_gl.isEnabled(cap);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3115,6 +3951,8 @@ glw::GLboolean CallLogWrapper::glIsEnabledi (glw::GLenum target, glw::GLuint ind
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabledi(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsEnabledi", 2).addHex(target).addUint(index);
 	glw::GLboolean returnValue = m_gl.isEnabledi(target, index);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3125,6 +3963,8 @@ glw::GLboolean CallLogWrapper::glIsFramebuffer (glw::GLuint framebuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsFramebuffer(" << framebuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsFramebuffer", 1).addUint(framebuffer);
 	glw::GLboolean returnValue = m_gl.isFramebuffer(framebuffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3135,6 +3975,8 @@ glw::GLboolean CallLogWrapper::glIsProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsProgram", 1).addUint(program);
 	glw::GLboolean returnValue = m_gl.isProgram(program);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3145,6 +3987,8 @@ glw::GLboolean CallLogWrapper::glIsProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsProgramPipeline", 1).addUint(pipeline);
 	glw::GLboolean returnValue = m_gl.isProgramPipeline(pipeline);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3155,6 +3999,8 @@ glw::GLboolean CallLogWrapper::glIsQuery (glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsQuery(" << id << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsQuery", 1).addUint(id);
 	glw::GLboolean returnValue = m_gl.isQuery(id);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3165,6 +4011,8 @@ glw::GLboolean CallLogWrapper::glIsRenderbuffer (glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsRenderbuffer(" << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsRenderbuffer", 1).addUint(renderbuffer);
 	glw::GLboolean returnValue = m_gl.isRenderbuffer(renderbuffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3175,6 +4023,8 @@ glw::GLboolean CallLogWrapper::glIsSampler (glw::GLuint sampler)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsSampler(" << sampler << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsSampler", 1).addUint(sampler);
 	glw::GLboolean returnValue = m_gl.isSampler(sampler);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3185,6 +4035,8 @@ glw::GLboolean CallLogWrapper::glIsShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsShader", 1).addUint(shader);
 	glw::GLboolean returnValue = m_gl.isShader(shader);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3195,6 +4047,8 @@ glw::GLboolean CallLogWrapper::glIsSync (glw::GLsync sync)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsSync(" << sync << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsSync", 1).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(sync)));
 	glw::GLboolean returnValue = m_gl.isSync(sync);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3205,6 +4059,8 @@ glw::GLboolean CallLogWrapper::glIsTexture (glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsTexture(" << texture << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsTexture", 1).addUint(texture);
 	glw::GLboolean returnValue = m_gl.isTexture(texture);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3215,6 +4071,8 @@ glw::GLboolean CallLogWrapper::glIsTransformFeedback (glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsTransformFeedback(" << id << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsTransformFeedback", 1).addUint(id);
 	glw::GLboolean returnValue = m_gl.isTransformFeedback(id);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3225,6 +4083,8 @@ glw::GLboolean CallLogWrapper::glIsVertexArray (glw::GLuint array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsVertexArray(" << array << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glIsVertexArray", 1).addUint(array);
 	glw::GLboolean returnValue = m_gl.isVertexArray(array);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -3235,6 +4095,8 @@ void CallLogWrapper::glLineWidth (glw::GLfloat width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLineWidth(" << width << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glLineWidth", 1).addFloat(width);
 	m_gl.lineWidth(width);
 }
 
@@ -3242,6 +4104,8 @@ void CallLogWrapper::glLinkProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLinkProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glLinkProgram", 1).addUint(program);
 	m_gl.linkProgram(program);
 }
 
@@ -3249,6 +4113,8 @@ void CallLogWrapper::glLogicOp (glw::GLenum opcode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLogicOp(" << toHex(opcode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glLogicOp", 1).addHex(opcode);
 	m_gl.logicOp(opcode);
 }
 
@@ -3256,6 +4122,8 @@ void * CallLogWrapper::glMapBuffer (glw::GLenum target, glw::GLenum access)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapBuffer(" << toHex(target) << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMapBuffer", 2).addHex(target).addHex(access);
 	void * returnValue = m_gl.mapBuffer(target, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -3266,6 +4134,8 @@ void * CallLogWrapper::glMapBufferRange (glw::GLenum target, glw::GLintptr offse
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ", " << getBufferMapFlagsStr(access) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMapBufferRange", 4).addHex(target).addInt(offset).addInt(length).addHex(access);
 	void * returnValue = m_gl.mapBufferRange(target, offset, length, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -3276,6 +4146,8 @@ void * CallLogWrapper::glMapNamedBuffer (glw::GLuint buffer, glw::GLenum access)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBuffer(" << buffer << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMapNamedBuffer", 2).addUint(buffer).addHex(access);
 	void * returnValue = m_gl.mapNamedBuffer(buffer, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -3286,6 +4158,8 @@ void * CallLogWrapper::glMapNamedBufferEXT (glw::GLuint buffer, glw::GLenum acce
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBufferEXT(" << buffer << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMapNamedBufferEXT", 2).addUint(buffer).addHex(access);
 	void * returnValue = m_gl.mapNamedBufferEXT(buffer, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -3296,6 +4170,8 @@ void * CallLogWrapper::glMapNamedBufferRange (glw::GLuint buffer, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBufferRange(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMapNamedBufferRange", 4).addUint(buffer).addInt(offset).addInt(length).addHex(access);
 	void * returnValue = m_gl.mapNamedBufferRange(buffer, offset, length, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -3306,6 +4182,8 @@ void * CallLogWrapper::glMapNamedBufferRangeEXT (glw::GLuint buffer, glw::GLintp
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBufferRangeEXT(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMapNamedBufferRangeEXT", 4).addUint(buffer).addInt(offset).addInt(length).addHex(access);
 	void * returnValue = m_gl.mapNamedBufferRangeEXT(buffer, offset, length, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -3316,6 +4194,8 @@ void CallLogWrapper::glMatrixFrustumEXT (glw::GLenum mode, glw::GLdouble left, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixFrustumEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixFrustumEXT", 7).addHex(mode).addDouble(left).addDouble(right).addDouble(bottom).addDouble(top).addDouble(zNear).addDouble(zFar);
 	m_gl.matrixFrustumEXT(mode, left, right, bottom, top, zNear, zFar);
 }
 
@@ -3323,6 +4203,8 @@ void CallLogWrapper::glMatrixLoadIdentityEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadIdentityEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixLoadIdentityEXT", 1).addHex(mode);
 	m_gl.matrixLoadIdentityEXT(mode);
 }
 
@@ -3330,6 +4212,8 @@ void CallLogWrapper::glMatrixLoadTransposedEXT (glw::GLenum mode, const glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixLoadTransposedEXT", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(m)));
 	m_gl.matrixLoadTransposedEXT(mode, m);
 }
 
@@ -3337,6 +4221,8 @@ void CallLogWrapper::glMatrixLoadTransposefEXT (glw::GLenum mode, const glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixLoadTransposefEXT", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(m)));
 	m_gl.matrixLoadTransposefEXT(mode, m);
 }
 
@@ -3344,6 +4230,8 @@ void CallLogWrapper::glMatrixLoaddEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoaddEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixLoaddEXT", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(m)));
 	m_gl.matrixLoaddEXT(mode, m);
 }
 
@@ -3351,6 +4239,8 @@ void CallLogWrapper::glMatrixLoadfEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixLoadfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixLoadfEXT", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(m)));
 	m_gl.matrixLoadfEXT(mode, m);
 }
 
@@ -3358,6 +4248,8 @@ void CallLogWrapper::glMatrixMultTransposedEXT (glw::GLenum mode, const glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultTransposedEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixMultTransposedEXT", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(m)));
 	m_gl.matrixMultTransposedEXT(mode, m);
 }
 
@@ -3365,6 +4257,8 @@ void CallLogWrapper::glMatrixMultTransposefEXT (glw::GLenum mode, const glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultTransposefEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixMultTransposefEXT", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(m)));
 	m_gl.matrixMultTransposefEXT(mode, m);
 }
 
@@ -3372,6 +4266,8 @@ void CallLogWrapper::glMatrixMultdEXT (glw::GLenum mode, const glw::GLdouble *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultdEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixMultdEXT", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(m)));
 	m_gl.matrixMultdEXT(mode, m);
 }
 
@@ -3379,6 +4275,8 @@ void CallLogWrapper::glMatrixMultfEXT (glw::GLenum mode, const glw::GLfloat *m)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixMultfEXT(" << toHex(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(m))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixMultfEXT", 2).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(m)));
 	m_gl.matrixMultfEXT(mode, m);
 }
 
@@ -3386,6 +4284,8 @@ void CallLogWrapper::glMatrixOrthoEXT (glw::GLenum mode, glw::GLdouble left, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixOrthoEXT(" << toHex(mode) << ", " << left << ", " << right << ", " << bottom << ", " << top << ", " << zNear << ", " << zFar << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixOrthoEXT", 7).addHex(mode).addDouble(left).addDouble(right).addDouble(bottom).addDouble(top).addDouble(zNear).addDouble(zFar);
 	m_gl.matrixOrthoEXT(mode, left, right, bottom, top, zNear, zFar);
 }
 
@@ -3393,6 +4293,8 @@ void CallLogWrapper::glMatrixPopEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixPopEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixPopEXT", 1).addHex(mode);
 	m_gl.matrixPopEXT(mode);
 }
 
@@ -3400,6 +4302,8 @@ void CallLogWrapper::glMatrixPushEXT (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixPushEXT(" << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixPushEXT", 1).addHex(mode);
 	m_gl.matrixPushEXT(mode);
 }
 
@@ -3407,6 +4311,8 @@ void CallLogWrapper::glMatrixRotatedEXT (glw::GLenum mode, glw::GLdouble angle,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixRotatedEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixRotatedEXT", 5).addHex(mode).addDouble(angle).addDouble(x).addDouble(y).addDouble(z);
 	m_gl.matrixRotatedEXT(mode, angle, x, y, z);
 }
 
@@ -3414,6 +4320,8 @@ void CallLogWrapper::glMatrixRotatefEXT (glw::GLenum mode, glw::GLfloat angle, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixRotatefEXT(" << toHex(mode) << ", " << angle << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixRotatefEXT", 5).addHex(mode).addFloat(angle).addFloat(x).addFloat(y).addFloat(z);
 	m_gl.matrixRotatefEXT(mode, angle, x, y, z);
 }
 
@@ -3421,6 +4329,8 @@ void CallLogWrapper::glMatrixScaledEXT (glw::GLenum mode, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixScaledEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixScaledEXT", 4).addHex(mode).addDouble(x).addDouble(y).addDouble(z);
 	m_gl.matrixScaledEXT(mode, x, y, z);
 }
 
@@ -3428,6 +4338,8 @@ void CallLogWrapper::glMatrixScalefEXT (glw::GLenum mode, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixScalefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixScalefEXT", 4).addHex(mode).addFloat(x).addFloat(y).addFloat(z);
 	m_gl.matrixScalefEXT(mode, x, y, z);
 }
 
@@ -3435,6 +4347,8 @@ void CallLogWrapper::glMatrixTranslatedEXT (glw::GLenum mode, glw::GLdouble x, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixTranslatedEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixTranslatedEXT", 4).addHex(mode).addDouble(x).addDouble(y).addDouble(z);
 	m_gl.matrixTranslatedEXT(mode, x, y, z);
 }
 
@@ -3442,6 +4356,8 @@ void CallLogWrapper::glMatrixTranslatefEXT (glw::GLenum mode, glw::GLfloat x, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMatrixTranslatefEXT(" << toHex(mode) << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMatrixTranslatefEXT", 4).addHex(mode).addFloat(x).addFloat(y).addFloat(z);
 	m_gl.matrixTranslatefEXT(mode, x, y, z);
 }
 
@@ -3449,6 +4365,8 @@ void CallLogWrapper::glMaxShaderCompilerThreadsKHR (glw::GLuint count)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMaxShaderCompilerThreadsKHR(" << count << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMaxShaderCompilerThreadsKHR", 1).addUint(count);
 	m_gl.maxShaderCompilerThreadsKHR(count);
 }
 
@@ -3456,6 +4374,8 @@ void CallLogWrapper::glMemoryBarrier (glw::GLbitfield barriers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMemoryBarrier(" << getMemoryBarrierFlagsStr(barriers) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMemoryBarrier", 1).addHex(barriers);
 	m_gl.memoryBarrier(barriers);
 }
 
@@ -3463,6 +4383,8 @@ void CallLogWrapper::glMemoryBarrierByRegion (glw::GLbitfield barriers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMemoryBarrierByRegion(" << toHex(barriers) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMemoryBarrierByRegion", 1).addHex(barriers);
 	m_gl.memoryBarrierByRegion(barriers);
 }
 
@@ -3470,6 +4392,8 @@ void CallLogWrapper::glMinSampleShading (glw::GLfloat value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMinSampleShading(" << value << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMinSampleShading", 1).addFloat(value);
 	m_gl.minSampleShading(value);
 }
 
@@ -3477,6 +4401,8 @@ void CallLogWrapper::glMultiDrawArrays (glw::GLenum mode, const glw::GLint *firs
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(first))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << drawcount << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiDrawArrays", 4).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(first))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(count))).addInt(drawcount);
 	m_gl.multiDrawArrays(mode, first, count, drawcount);
 }
 
@@ -3484,6 +4410,8 @@ void CallLogWrapper::glMultiDrawArraysIndirect (glw::GLenum mode, const void *in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArraysIndirect(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiDrawArraysIndirect", 4).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect))).addInt(drawcount).addInt(stride);
 	m_gl.multiDrawArraysIndirect(mode, indirect, drawcount, stride);
 }
 
@@ -3491,6 +4419,8 @@ void CallLogWrapper::glMultiDrawArraysIndirectCount (glw::GLenum mode, const voi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArraysIndirectCount(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << maxdrawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiDrawArraysIndirectCount", 5).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect))).addInt(drawcount).addInt(maxdrawcount).addInt(stride);
 	m_gl.multiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
 }
 
@@ -3498,6 +4428,8 @@ void CallLogWrapper::glMultiDrawElements (glw::GLenum mode, const glw::GLsizei *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElements(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiDrawElements", 5).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(count))).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))).addInt(drawcount);
 	m_gl.multiDrawElements(mode, count, type, indices, drawcount);
 }
 
@@ -3505,6 +4437,8 @@ void CallLogWrapper::glMultiDrawElementsBaseVertex (glw::GLenum mode, const glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(basevertex))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiDrawElementsBaseVertex", 6).addHex(mode).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(count))).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))).addInt(drawcount).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(basevertex)));
 	m_gl.multiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
 }
 
@@ -3512,6 +4446,8 @@ void CallLogWrapper::glMultiDrawElementsIndirect (glw::GLenum mode, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsIndirect(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiDrawElementsIndirect", 5).addHex(mode).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect))).addInt(drawcount).addInt(stride);
 	m_gl.multiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
 }
 
@@ -3519,6 +4455,8 @@ void CallLogWrapper::glMultiDrawElementsIndirectCount (glw::GLenum mode, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsIndirectCount(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << maxdrawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiDrawElementsIndirectCount", 6).addHex(mode).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indirect))).addInt(drawcount).addInt(maxdrawcount).addInt(stride);
 	m_gl.multiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
 }
 
@@ -3526,6 +4464,8 @@ void CallLogWrapper::glMultiTexBufferEXT (glw::GLenum texunit, glw::GLenum targe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexBufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexBufferEXT", 4).addHex(texunit).addHex(target).addHex(internalformat).addUint(buffer);
 	m_gl.multiTexBufferEXT(texunit, target, internalformat, buffer);
 }
 
@@ -3533,6 +4473,8 @@ void CallLogWrapper::glMultiTexCoordPointerEXT (glw::GLenum texunit, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexCoordPointerEXT(" << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexCoordPointerEXT", 5).addHex(texunit).addInt(size).addHex(type).addInt(stride).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer)));
 	m_gl.multiTexCoordPointerEXT(texunit, size, type, stride, pointer);
 }
 
@@ -3540,6 +4482,8 @@ void CallLogWrapper::glMultiTexEnvfEXT (glw::GLenum texunit, glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexEnvfEXT", 4).addHex(texunit).addHex(target).addHex(pname).addFloat(param);
 	m_gl.multiTexEnvfEXT(texunit, target, pname, param);
 }
 
@@ -3547,6 +4491,8 @@ void CallLogWrapper::glMultiTexEnvfvEXT (glw::GLenum texunit, glw::GLenum target
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexEnvfvEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexEnvfvEXT(texunit, target, pname, params);
 }
 
@@ -3554,6 +4500,8 @@ void CallLogWrapper::glMultiTexEnviEXT (glw::GLenum texunit, glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnviEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexEnviEXT", 4).addHex(texunit).addHex(target).addHex(pname).addInt(param);
 	m_gl.multiTexEnviEXT(texunit, target, pname, param);
 }
 
@@ -3561,6 +4509,8 @@ void CallLogWrapper::glMultiTexEnvivEXT (glw::GLenum texunit, glw::GLenum target
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexEnvivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexEnvivEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexEnvivEXT(texunit, target, pname, params);
 }
 
@@ -3568,6 +4518,8 @@ void CallLogWrapper::glMultiTexGendEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGendEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexGendEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addDouble(param);
 	m_gl.multiTexGendEXT(texunit, coord, pname, param);
 }
 
@@ -3575,6 +4527,8 @@ void CallLogWrapper::glMultiTexGendvEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGendvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexGendvEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexGendvEXT(texunit, coord, pname, params);
 }
 
@@ -3582,6 +4536,8 @@ void CallLogWrapper::glMultiTexGenfEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenfEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexGenfEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addFloat(param);
 	m_gl.multiTexGenfEXT(texunit, coord, pname, param);
 }
 
@@ -3589,6 +4545,8 @@ void CallLogWrapper::glMultiTexGenfvEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenfvEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexGenfvEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexGenfvEXT(texunit, coord, pname, params);
 }
 
@@ -3596,6 +4554,8 @@ void CallLogWrapper::glMultiTexGeniEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGeniEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexGeniEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addInt(param);
 	m_gl.multiTexGeniEXT(texunit, coord, pname, param);
 }
 
@@ -3603,6 +4563,8 @@ void CallLogWrapper::glMultiTexGenivEXT (glw::GLenum texunit, glw::GLenum coord,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexGenivEXT(" << toHex(texunit) << ", " << toHex(coord) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexGenivEXT", 4).addHex(texunit).addHex(coord).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexGenivEXT(texunit, coord, pname, params);
 }
 
@@ -3610,6 +4572,8 @@ void CallLogWrapper::glMultiTexImage1DEXT (glw::GLenum texunit, glw::GLenum targ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexImage1DEXT", 9).addHex(texunit).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.multiTexImage1DEXT(texunit, target, level, internalformat, width, border, format, type, pixels);
 }
 
@@ -3617,6 +4581,8 @@ void CallLogWrapper::glMultiTexImage2DEXT (glw::GLenum texunit, glw::GLenum targ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexImage2DEXT", 10).addHex(texunit).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(height).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.multiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -3624,6 +4590,8 @@ void CallLogWrapper::glMultiTexImage3DEXT (glw::GLenum texunit, glw::GLenum targ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexImage3DEXT", 11).addHex(texunit).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(height).addInt(depth).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.multiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -3631,6 +4599,8 @@ void CallLogWrapper::glMultiTexParameterIivEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterIivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexParameterIivEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexParameterIivEXT(texunit, target, pname, params);
 }
 
@@ -3638,6 +4608,8 @@ void CallLogWrapper::glMultiTexParameterIuivEXT (glw::GLenum texunit, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterIuivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexParameterIuivEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexParameterIuivEXT(texunit, target, pname, params);
 }
 
@@ -3645,6 +4617,8 @@ void CallLogWrapper::glMultiTexParameterfEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterfEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexParameterfEXT", 4).addHex(texunit).addHex(target).addHex(pname).addFloat(param);
 	m_gl.multiTexParameterfEXT(texunit, target, pname, param);
 }
 
@@ -3652,6 +4626,8 @@ void CallLogWrapper::glMultiTexParameterfvEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterfvEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexParameterfvEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexParameterfvEXT(texunit, target, pname, params);
 }
 
@@ -3659,6 +4635,8 @@ void CallLogWrapper::glMultiTexParameteriEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameteriEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexParameteriEXT", 4).addHex(texunit).addHex(target).addHex(pname).addInt(param);
 	m_gl.multiTexParameteriEXT(texunit, target, pname, param);
 }
 
@@ -3666,6 +4644,8 @@ void CallLogWrapper::glMultiTexParameterivEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexParameterivEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexParameterivEXT", 4).addHex(texunit).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multiTexParameterivEXT(texunit, target, pname, params);
 }
 
@@ -3673,6 +4653,8 @@ void CallLogWrapper::glMultiTexRenderbufferEXT (glw::GLenum texunit, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexRenderbufferEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexRenderbufferEXT", 3).addHex(texunit).addHex(target).addUint(renderbuffer);
 	m_gl.multiTexRenderbufferEXT(texunit, target, renderbuffer);
 }
 
@@ -3680,6 +4662,8 @@ void CallLogWrapper::glMultiTexSubImage1DEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage1DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexSubImage1DEXT", 8).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(width).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.multiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, type, pixels);
 }
 
@@ -3687,6 +4671,8 @@ void CallLogWrapper::glMultiTexSubImage2DEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage2DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexSubImage2DEXT", 10).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(width).addInt(height).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.multiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -3694,6 +4680,8 @@ void CallLogWrapper::glMultiTexSubImage3DEXT (glw::GLenum texunit, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiTexSubImage3DEXT(" << toHex(texunit) << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMultiTexSubImage3DEXT", 12).addHex(texunit).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.multiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -3701,6 +4689,8 @@ void CallLogWrapper::glMulticastBarrierNV (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastBarrierNV(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastBarrierNV", 0);
 	m_gl.multicastBarrierNV();
 }
 
@@ -3708,6 +4698,8 @@ void CallLogWrapper::glMulticastBlitFramebufferNV (glw::GLuint srcGpu, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastBlitFramebufferNV(" << srcGpu << ", " << dstGpu << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastBlitFramebufferNV", 12).addUint(srcGpu).addUint(dstGpu).addInt(srcX0).addInt(srcY0).addInt(srcX1).addInt(srcY1).addInt(dstX0).addInt(dstY0).addInt(dstX1).addInt(dstY1).addHex(mask).addHex(filter);
 	m_gl.multicastBlitFramebufferNV(srcGpu, dstGpu, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -3715,6 +4707,8 @@ void CallLogWrapper::glMulticastBufferSubDataNV (glw::GLbitfield gpuMask, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastBufferSubDataNV(" << toHex(gpuMask) << ", " << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastBufferSubDataNV", 5).addHex(gpuMask).addUint(buffer).addInt(offset).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.multicastBufferSubDataNV(gpuMask, buffer, offset, size, data);
 }
 
@@ -3722,6 +4716,8 @@ void CallLogWrapper::glMulticastCopyBufferSubDataNV (glw::GLuint readGpu, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastCopyBufferSubDataNV(" << readGpu << ", " << toHex(writeGpuMask) << ", " << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastCopyBufferSubDataNV", 7).addUint(readGpu).addHex(writeGpuMask).addUint(readBuffer).addUint(writeBuffer).addInt(readOffset).addInt(writeOffset).addInt(size);
 	m_gl.multicastCopyBufferSubDataNV(readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
@@ -3729,6 +4725,8 @@ void CallLogWrapper::glMulticastCopyImageSubDataNV (glw::GLuint srcGpu, glw::GLb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastCopyImageSubDataNV(" << srcGpu << ", " << toHex(dstGpuMask) << ", " << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastCopyImageSubDataNV", 17).addUint(srcGpu).addHex(dstGpuMask).addUint(srcName).addHex(srcTarget).addInt(srcLevel).addInt(srcX).addInt(srcY).addInt(srcZ).addUint(dstName).addHex(dstTarget).addInt(dstLevel).addInt(dstX).addInt(dstY).addInt(dstZ).addInt(srcWidth).addInt(srcHeight).addInt(srcDepth);
 	m_gl.multicastCopyImageSubDataNV(srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
@@ -3736,6 +4734,8 @@ void CallLogWrapper::glMulticastFramebufferSampleLocationsfvNV (glw::GLuint gpu,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastFramebufferSampleLocationsfvNV(" << gpu << ", " << framebuffer << ", " << start << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastFramebufferSampleLocationsfvNV", 5).addUint(gpu).addUint(framebuffer).addUint(start).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.multicastFramebufferSampleLocationsfvNV(gpu, framebuffer, start, count, v);
 }
 
@@ -3743,6 +4743,8 @@ void CallLogWrapper::glMulticastGetQueryObjecti64vNV (glw::GLuint gpu, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastGetQueryObjecti64vNV(" << gpu << ", " << id << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastGetQueryObjecti64vNV", 4).addUint(gpu).addUint(id).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multicastGetQueryObjecti64vNV(gpu, id, pname, params);
 }
 
@@ -3750,6 +4752,8 @@ void CallLogWrapper::glMulticastGetQueryObjectivNV (glw::GLuint gpu, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastGetQueryObjectivNV(" << gpu << ", " << id << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastGetQueryObjectivNV", 4).addUint(gpu).addUint(id).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multicastGetQueryObjectivNV(gpu, id, pname, params);
 }
 
@@ -3757,6 +4761,8 @@ void CallLogWrapper::glMulticastGetQueryObjectui64vNV (glw::GLuint gpu, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastGetQueryObjectui64vNV(" << gpu << ", " << id << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastGetQueryObjectui64vNV", 4).addUint(gpu).addUint(id).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multicastGetQueryObjectui64vNV(gpu, id, pname, params);
 }
 
@@ -3764,6 +4770,8 @@ void CallLogWrapper::glMulticastGetQueryObjectuivNV (glw::GLuint gpu, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastGetQueryObjectuivNV(" << gpu << ", " << id << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastGetQueryObjectuivNV", 4).addUint(gpu).addUint(id).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.multicastGetQueryObjectuivNV(gpu, id, pname, params);
 }
 
@@ -3771,6 +4779,8 @@ void CallLogWrapper::glMulticastWaitSyncNV (glw::GLuint signalGpu, glw::GLbitfie
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMulticastWaitSyncNV(" << signalGpu << ", " << toHex(waitGpuMask) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glMulticastWaitSyncNV", 2).addUint(signalGpu).addHex(waitGpuMask);
 	m_gl.multicastWaitSyncNV(signalGpu, waitGpuMask);
 }
 
@@ -3778,6 +4788,8 @@ void CallLogWrapper::glNamedBufferData (glw::GLuint buffer, glw::GLsizeiptr size
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferData(" << buffer << ", " << size << ", " << data << ", " << toHex(usage) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedBufferData", 4).addUint(buffer).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data))).addHex(usage);
 	m_gl.namedBufferData(buffer, size, data, usage);
 }
 
@@ -3785,6 +4797,8 @@ void CallLogWrapper::glNamedBufferDataEXT (glw::GLuint buffer, glw::GLsizeiptr s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferDataEXT(" << buffer << ", " << size << ", " << data << ", " << toHex(usage) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedBufferDataEXT", 4).addUint(buffer).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data))).addHex(usage);
 	m_gl.namedBufferDataEXT(buffer, size, data, usage);
 }
 
@@ -3792,6 +4806,8 @@ void CallLogWrapper::glNamedBufferPageCommitmentARB (glw::GLuint buffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferPageCommitmentARB(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedBufferPageCommitmentARB", 4).addUint(buffer).addInt(offset).addInt(size).addBoolean(commit);
 	m_gl.namedBufferPageCommitmentARB(buffer, offset, size, commit);
 }
 
@@ -3799,6 +4815,8 @@ void CallLogWrapper::glNamedBufferPageCommitmentEXT (glw::GLuint buffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferPageCommitmentEXT(" << buffer << ", " << offset << ", " << size << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedBufferPageCommitmentEXT", 4).addUint(buffer).addInt(offset).addInt(size).addBoolean(commit);
 	m_gl.namedBufferPageCommitmentEXT(buffer, offset, size, commit);
 }
 
@@ -3806,6 +4824,8 @@ void CallLogWrapper::glNamedBufferStorage (glw::GLuint buffer, glw::GLsizeiptr s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferStorage(" << buffer << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedBufferStorage", 4).addUint(buffer).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data))).addHex(flags);
 	m_gl.namedBufferStorage(buffer, size, data, flags);
 }
 
@@ -3813,6 +4833,8 @@ void CallLogWrapper::glNamedBufferSubData (glw::GLuint buffer, glw::GLintptr off
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedBufferSubData", 4).addUint(buffer).addInt(offset).addInt(size).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.namedBufferSubData(buffer, offset, size, data);
 }
 
@@ -3820,6 +4842,8 @@ void CallLogWrapper::glNamedCopyBufferSubDataEXT (glw::GLuint readBuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedCopyBufferSubDataEXT(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedCopyBufferSubDataEXT", 5).addUint(readBuffer).addUint(writeBuffer).addInt(readOffset).addInt(writeOffset).addInt(size);
 	m_gl.namedCopyBufferSubDataEXT(readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
@@ -3827,6 +4851,8 @@ void CallLogWrapper::glNamedFramebufferDrawBuffer (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffer(" << framebuffer << ", " << toHex(buf) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferDrawBuffer", 2).addUint(framebuffer).addHex(buf);
 	m_gl.namedFramebufferDrawBuffer(framebuffer, buf);
 }
 
@@ -3834,6 +4860,8 @@ void CallLogWrapper::glNamedFramebufferDrawBuffers (glw::GLuint framebuffer, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffers(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferDrawBuffers", 3).addUint(framebuffer).addInt(n).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs)));
 	m_gl.namedFramebufferDrawBuffers(framebuffer, n, bufs);
 }
 
@@ -3841,6 +4869,8 @@ void CallLogWrapper::glNamedFramebufferParameteri (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferParameteri(" << framebuffer << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferParameteri", 3).addUint(framebuffer).addHex(pname).addInt(param);
 	m_gl.namedFramebufferParameteri(framebuffer, pname, param);
 }
 
@@ -3848,6 +4878,8 @@ void CallLogWrapper::glNamedFramebufferParameteriEXT (glw::GLuint framebuffer, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferParameteriEXT(" << framebuffer << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferParameteriEXT", 3).addUint(framebuffer).addHex(pname).addInt(param);
 	m_gl.namedFramebufferParameteriEXT(framebuffer, pname, param);
 }
 
@@ -3855,6 +4887,8 @@ void CallLogWrapper::glNamedFramebufferReadBuffer (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferReadBuffer(" << framebuffer << ", " << toHex(src) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferReadBuffer", 2).addUint(framebuffer).addHex(src);
 	m_gl.namedFramebufferReadBuffer(framebuffer, src);
 }
 
@@ -3862,6 +4896,8 @@ void CallLogWrapper::glNamedFramebufferRenderbuffer (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferRenderbuffer(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferRenderbuffer", 4).addUint(framebuffer).addHex(attachment).addHex(renderbuffertarget).addUint(renderbuffer);
 	m_gl.namedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -3869,6 +4905,8 @@ void CallLogWrapper::glNamedFramebufferRenderbufferEXT (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferRenderbufferEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferRenderbufferEXT", 4).addUint(framebuffer).addHex(attachment).addHex(renderbuffertarget).addUint(renderbuffer);
 	m_gl.namedFramebufferRenderbufferEXT(framebuffer, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -3876,6 +4914,8 @@ void CallLogWrapper::glNamedFramebufferTexture (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferTexture", 4).addUint(framebuffer).addHex(attachment).addUint(texture).addInt(level);
 	m_gl.namedFramebufferTexture(framebuffer, attachment, texture, level);
 }
 
@@ -3883,6 +4923,8 @@ void CallLogWrapper::glNamedFramebufferTexture1DEXT (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture1DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferTexture1DEXT", 5).addUint(framebuffer).addHex(attachment).addHex(textarget).addUint(texture).addInt(level);
 	m_gl.namedFramebufferTexture1DEXT(framebuffer, attachment, textarget, texture, level);
 }
 
@@ -3890,6 +4932,8 @@ void CallLogWrapper::glNamedFramebufferTexture2DEXT (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture2DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferTexture2DEXT", 5).addUint(framebuffer).addHex(attachment).addHex(textarget).addUint(texture).addInt(level);
 	m_gl.namedFramebufferTexture2DEXT(framebuffer, attachment, textarget, texture, level);
 }
 
@@ -3897,6 +4941,8 @@ void CallLogWrapper::glNamedFramebufferTexture3DEXT (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture3DEXT(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferTexture3DEXT", 6).addUint(framebuffer).addHex(attachment).addHex(textarget).addUint(texture).addInt(level).addInt(zoffset);
 	m_gl.namedFramebufferTexture3DEXT(framebuffer, attachment, textarget, texture, level, zoffset);
 }
 
@@ -3904,6 +4950,8 @@ void CallLogWrapper::glNamedFramebufferTextureEXT (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferTextureEXT", 4).addUint(framebuffer).addHex(attachment).addUint(texture).addInt(level);
 	m_gl.namedFramebufferTextureEXT(framebuffer, attachment, texture, level);
 }
 
@@ -3911,6 +4959,8 @@ void CallLogWrapper::glNamedFramebufferTextureFaceEXT (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureFaceEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << toHex(face) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferTextureFaceEXT", 5).addUint(framebuffer).addHex(attachment).addUint(texture).addInt(level).addHex(face);
 	m_gl.namedFramebufferTextureFaceEXT(framebuffer, attachment, texture, level, face);
 }
 
@@ -3918,6 +4968,8 @@ void CallLogWrapper::glNamedFramebufferTextureLayer (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureLayer(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferTextureLayer", 5).addUint(framebuffer).addHex(attachment).addUint(texture).addInt(level).addInt(layer);
 	m_gl.namedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
 }
 
@@ -3925,6 +4977,8 @@ void CallLogWrapper::glNamedFramebufferTextureLayerEXT (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureLayerEXT(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedFramebufferTextureLayerEXT", 5).addUint(framebuffer).addHex(attachment).addUint(texture).addInt(level).addInt(layer);
 	m_gl.namedFramebufferTextureLayerEXT(framebuffer, attachment, texture, level, layer);
 }
 
@@ -3932,6 +4986,8 @@ void CallLogWrapper::glNamedProgramLocalParameter4dEXT (glw::GLuint program, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4dEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameter4dEXT", 7).addUint(program).addHex(target).addUint(index).addDouble(x).addDouble(y).addDouble(z).addDouble(w);
 	m_gl.namedProgramLocalParameter4dEXT(program, target, index, x, y, z, w);
 }
 
@@ -3939,6 +4995,8 @@ void CallLogWrapper::glNamedProgramLocalParameter4dvEXT (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4dvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameter4dvEXT", 4).addUint(program).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.namedProgramLocalParameter4dvEXT(program, target, index, params);
 }
 
@@ -3946,6 +5004,8 @@ void CallLogWrapper::glNamedProgramLocalParameter4fEXT (glw::GLuint program, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4fEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameter4fEXT", 7).addUint(program).addHex(target).addUint(index).addFloat(x).addFloat(y).addFloat(z).addFloat(w);
 	m_gl.namedProgramLocalParameter4fEXT(program, target, index, x, y, z, w);
 }
 
@@ -3953,6 +5013,8 @@ void CallLogWrapper::glNamedProgramLocalParameter4fvEXT (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameter4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameter4fvEXT", 4).addUint(program).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.namedProgramLocalParameter4fvEXT(program, target, index, params);
 }
 
@@ -3960,6 +5022,8 @@ void CallLogWrapper::glNamedProgramLocalParameterI4iEXT (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4iEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameterI4iEXT", 7).addUint(program).addHex(target).addUint(index).addInt(x).addInt(y).addInt(z).addInt(w);
 	m_gl.namedProgramLocalParameterI4iEXT(program, target, index, x, y, z, w);
 }
 
@@ -3967,6 +5031,8 @@ void CallLogWrapper::glNamedProgramLocalParameterI4ivEXT (glw::GLuint program, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameterI4ivEXT", 4).addUint(program).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.namedProgramLocalParameterI4ivEXT(program, target, index, params);
 }
 
@@ -3974,6 +5040,8 @@ void CallLogWrapper::glNamedProgramLocalParameterI4uiEXT (glw::GLuint program, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4uiEXT(" << program << ", " << toHex(target) << ", " << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameterI4uiEXT", 7).addUint(program).addHex(target).addUint(index).addUint(x).addUint(y).addUint(z).addUint(w);
 	m_gl.namedProgramLocalParameterI4uiEXT(program, target, index, x, y, z, w);
 }
 
@@ -3981,6 +5049,8 @@ void CallLogWrapper::glNamedProgramLocalParameterI4uivEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameterI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameterI4uivEXT", 4).addUint(program).addHex(target).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.namedProgramLocalParameterI4uivEXT(program, target, index, params);
 }
 
@@ -3988,6 +5058,8 @@ void CallLogWrapper::glNamedProgramLocalParameters4fvEXT (glw::GLuint program, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParameters4fvEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParameters4fvEXT", 5).addUint(program).addHex(target).addUint(index).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.namedProgramLocalParameters4fvEXT(program, target, index, count, params);
 }
 
@@ -3995,6 +5067,8 @@ void CallLogWrapper::glNamedProgramLocalParametersI4ivEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParametersI4ivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParametersI4ivEXT", 5).addUint(program).addHex(target).addUint(index).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.namedProgramLocalParametersI4ivEXT(program, target, index, count, params);
 }
 
@@ -4002,6 +5076,8 @@ void CallLogWrapper::glNamedProgramLocalParametersI4uivEXT (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramLocalParametersI4uivEXT(" << program << ", " << toHex(target) << ", " << index << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramLocalParametersI4uivEXT", 5).addUint(program).addHex(target).addUint(index).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.namedProgramLocalParametersI4uivEXT(program, target, index, count, params);
 }
 
@@ -4009,6 +5085,8 @@ void CallLogWrapper::glNamedProgramStringEXT (glw::GLuint program, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedProgramStringEXT(" << program << ", " << toHex(target) << ", " << toHex(format) << ", " << len << ", " << string << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedProgramStringEXT", 5).addUint(program).addHex(target).addHex(format).addInt(len).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(string)));
 	m_gl.namedProgramStringEXT(program, target, format, len, string);
 }
 
@@ -4016,6 +5094,8 @@ void CallLogWrapper::glNamedRenderbufferStorage (glw::GLuint renderbuffer, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorage(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedRenderbufferStorage", 4).addUint(renderbuffer).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.namedRenderbufferStorage(renderbuffer, internalformat, width, height);
 }
 
@@ -4023,6 +5103,8 @@ void CallLogWrapper::glNamedRenderbufferStorageEXT (glw::GLuint renderbuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageEXT(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedRenderbufferStorageEXT", 4).addUint(renderbuffer).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.namedRenderbufferStorageEXT(renderbuffer, internalformat, width, height);
 }
 
@@ -4030,6 +5112,8 @@ void CallLogWrapper::glNamedRenderbufferStorageMultisample (glw::GLuint renderbu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisample(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedRenderbufferStorageMultisample", 5).addUint(renderbuffer).addInt(samples).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.namedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
 }
 
@@ -4037,6 +5121,8 @@ void CallLogWrapper::glNamedRenderbufferStorageMultisampleCoverageEXT (glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisampleCoverageEXT(" << renderbuffer << ", " << coverageSamples << ", " << colorSamples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedRenderbufferStorageMultisampleCoverageEXT", 6).addUint(renderbuffer).addInt(coverageSamples).addInt(colorSamples).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.namedRenderbufferStorageMultisampleCoverageEXT(renderbuffer, coverageSamples, colorSamples, internalformat, width, height);
 }
 
@@ -4044,6 +5130,8 @@ void CallLogWrapper::glNamedRenderbufferStorageMultisampleEXT (glw::GLuint rende
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisampleEXT(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glNamedRenderbufferStorageMultisampleEXT", 5).addUint(renderbuffer).addInt(samples).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.namedRenderbufferStorageMultisampleEXT(renderbuffer, samples, internalformat, width, height);
 }
 
@@ -4051,6 +5139,8 @@ void CallLogWrapper::glObjectLabel (glw::GLenum identifier, glw::GLuint name, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glObjectLabel(" << toHex(identifier) << ", " << name << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glObjectLabel", 4).addHex(identifier).addUint(name).addInt(length).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(label)));
 	m_gl.objectLabel(identifier, name, length, label);
 }
 
@@ -4058,6 +5148,8 @@ void CallLogWrapper::glObjectPtrLabel (const void *ptr, glw::GLsizei length, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glObjectPtrLabel(" << ptr << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glObjectPtrLabel", 3).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(ptr))).addInt(length).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(label)));
 	m_gl.objectPtrLabel(ptr, length, label);
 }
 
@@ -4065,6 +5157,8 @@ void CallLogWrapper::glPatchParameterfv (glw::GLenum pname, const glw::GLfloat *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPatchParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPatchParameterfv", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(values)));
 	m_gl.patchParameterfv(pname, values);
 }
 
@@ -4072,6 +5166,8 @@ void CallLogWrapper::glPatchParameteri (glw::GLenum pname, glw::GLint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPatchParameteri(" << getPatchParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPatchParameteri", 2).addHex(pname).addInt(value);
 	m_gl.patchParameteri(pname, value);
 }
 
@@ -4079,6 +5175,8 @@ void CallLogWrapper::glPauseTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPauseTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPauseTransformFeedback", 0);
 	m_gl.pauseTransformFeedback();
 }
 
@@ -4086,6 +5184,8 @@ void CallLogWrapper::glPixelStoref (glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPixelStoref(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPixelStoref", 2).addHex(pname).addFloat(param);
 	m_gl.pixelStoref(pname, param);
 }
 
@@ -4093,6 +5193,8 @@ void CallLogWrapper::glPixelStorei (glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPixelStorei(" << getPixelStoreParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPixelStorei", 2).addHex(pname).addInt(param);
 	m_gl.pixelStorei(pname, param);
 }
 
@@ -4100,6 +5202,8 @@ void CallLogWrapper::glPointParameterf (glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameterf(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPointParameterf", 2).addHex(pname).addFloat(param);
 	m_gl.pointParameterf(pname, param);
 }
 
@@ -4107,6 +5211,8 @@ void CallLogWrapper::glPointParameterfv (glw::GLenum pname, const glw::GLfloat *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPointParameterfv", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.pointParameterfv(pname, params);
 }
 
@@ -4114,6 +5220,8 @@ void CallLogWrapper::glPointParameteri (glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameteri(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPointParameteri", 2).addHex(pname).addInt(param);
 	m_gl.pointParameteri(pname, param);
 }
 
@@ -4121,6 +5229,8 @@ void CallLogWrapper::glPointParameteriv (glw::GLenum pname, const glw::GLint *pa
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameteriv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPointParameteriv", 2).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.pointParameteriv(pname, params);
 }
 
@@ -4128,6 +5238,8 @@ void CallLogWrapper::glPointSize (glw::GLfloat size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointSize(" << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPointSize", 1).addFloat(size);
 	m_gl.pointSize(size);
 }
 
@@ -4135,6 +5247,8 @@ void CallLogWrapper::glPolygonMode (glw::GLenum face, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonMode(" << toHex(face) << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPolygonMode", 2).addHex(face).addHex(mode);
 	m_gl.polygonMode(face, mode);
 }
 
@@ -4142,6 +5256,8 @@ void CallLogWrapper::glPolygonOffset (glw::GLfloat factor, glw::GLfloat units)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonOffset(" << factor << ", " << units << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPolygonOffset", 2).addFloat(factor).addFloat(units);
 	m_gl.polygonOffset(factor, units);
 }
 
@@ -4149,6 +5265,8 @@ void CallLogWrapper::glPolygonOffsetClamp (glw::GLfloat factor, glw::GLfloat uni
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonOffsetClamp(" << factor << ", " << units << ", " << clamp << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPolygonOffsetClamp", 3).addFloat(factor).addFloat(units).addFloat(clamp);
 	m_gl.polygonOffsetClamp(factor, units, clamp);
 }
 
@@ -4156,6 +5274,8 @@ void CallLogWrapper::glPopDebugGroup (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPopDebugGroup(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPopDebugGroup", 0);
 	m_gl.popDebugGroup();
 }
 
@@ -4163,6 +5283,8 @@ void CallLogWrapper::glPopGroupMarkerEXT (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPopGroupMarkerEXT(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPopGroupMarkerEXT", 0);
 	m_gl.popGroupMarkerEXT();
 }
 
@@ -4170,6 +5292,8 @@ void CallLogWrapper::glPrimitiveBoundingBox (glw::GLfloat minX, glw::GLfloat min
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPrimitiveBoundingBox(" << minX << ", " << minY << ", " << minZ << ", " << minW << ", " << maxX << ", " << maxY << ", " << maxZ << ", " << maxW << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPrimitiveBoundingBox", 8).addFloat(minX).addFloat(minY).addFloat(minZ).addFloat(minW).addFloat(maxX).addFloat(maxY).addFloat(maxZ).addFloat(maxW);
 	m_gl.primitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
 }
 
@@ -4177,6 +5301,8 @@ void CallLogWrapper::glPrimitiveRestartIndex (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPrimitiveRestartIndex(" << index << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPrimitiveRestartIndex", 1).addUint(index);
 	m_gl.primitiveRestartIndex(index);
 }
 
@@ -4184,6 +5310,8 @@ void CallLogWrapper::glProgramBinary (glw::GLuint program, glw::GLenum binaryFor
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramBinary(" << program << ", " << toHex(binaryFormat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramBinary", 4).addUint(program).addHex(binaryFormat).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(binary))).addInt(length);
 	m_gl.programBinary(program, binaryFormat, binary, length);
 }
 
@@ -4191,6 +5319,8 @@ void CallLogWrapper::glProgramParameteri (glw::GLuint program, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramParameteri(" << program << ", " << getProgramParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramParameteri", 3).addUint(program).addHex(pname).addInt(value);
 	m_gl.programParameteri(program, pname, value);
 }
 
@@ -4198,6 +5328,8 @@ void CallLogWrapper::glProgramUniform1d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1d(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1d", 3).addUint(program).addInt(location).addDouble(v0);
 	m_gl.programUniform1d(program, location, v0);
 }
 
@@ -4205,6 +5337,8 @@ void CallLogWrapper::glProgramUniform1dEXT (glw::GLuint program, glw::GLint loca
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1dEXT(" << program << ", " << location << ", " << x << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1dEXT", 3).addUint(program).addInt(location).addDouble(x);
 	m_gl.programUniform1dEXT(program, location, x);
 }
 
@@ -4212,6 +5346,8 @@ void CallLogWrapper::glProgramUniform1dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1dv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform1dv(program, location, count, value);
 }
 
@@ -4219,6 +5355,8 @@ void CallLogWrapper::glProgramUniform1dvEXT (glw::GLuint program, glw::GLint loc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1dvEXT(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1dvEXT", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform1dvEXT(program, location, count, value);
 }
 
@@ -4226,6 +5364,8 @@ void CallLogWrapper::glProgramUniform1f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1f(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1f", 3).addUint(program).addInt(location).addFloat(v0);
 	m_gl.programUniform1f(program, location, v0);
 }
 
@@ -4233,6 +5373,8 @@ void CallLogWrapper::glProgramUniform1fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1fv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform1fv(program, location, count, value);
 }
 
@@ -4240,6 +5382,8 @@ void CallLogWrapper::glProgramUniform1i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1i(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1i", 3).addUint(program).addInt(location).addInt(v0);
 	m_gl.programUniform1i(program, location, v0);
 }
 
@@ -4247,6 +5391,8 @@ void CallLogWrapper::glProgramUniform1iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1iv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform1iv(program, location, count, value);
 }
 
@@ -4254,6 +5400,8 @@ void CallLogWrapper::glProgramUniform1ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1ui(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1ui", 3).addUint(program).addInt(location).addUint(v0);
 	m_gl.programUniform1ui(program, location, v0);
 }
 
@@ -4261,6 +5409,8 @@ void CallLogWrapper::glProgramUniform1uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform1uiv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform1uiv(program, location, count, value);
 }
 
@@ -4268,6 +5418,8 @@ void CallLogWrapper::glProgramUniform2d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2d(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2d", 4).addUint(program).addInt(location).addDouble(v0).addDouble(v1);
 	m_gl.programUniform2d(program, location, v0, v1);
 }
 
@@ -4275,6 +5427,8 @@ void CallLogWrapper::glProgramUniform2dEXT (glw::GLuint program, glw::GLint loca
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2dEXT(" << program << ", " << location << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2dEXT", 4).addUint(program).addInt(location).addDouble(x).addDouble(y);
 	m_gl.programUniform2dEXT(program, location, x, y);
 }
 
@@ -4282,6 +5436,8 @@ void CallLogWrapper::glProgramUniform2dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2dv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform2dv(program, location, count, value);
 }
 
@@ -4289,6 +5445,8 @@ void CallLogWrapper::glProgramUniform2dvEXT (glw::GLuint program, glw::GLint loc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2dvEXT(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2dvEXT", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform2dvEXT(program, location, count, value);
 }
 
@@ -4296,6 +5454,8 @@ void CallLogWrapper::glProgramUniform2f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2f(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2f", 4).addUint(program).addInt(location).addFloat(v0).addFloat(v1);
 	m_gl.programUniform2f(program, location, v0, v1);
 }
 
@@ -4303,6 +5463,8 @@ void CallLogWrapper::glProgramUniform2fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2fv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform2fv(program, location, count, value);
 }
 
@@ -4310,6 +5472,8 @@ void CallLogWrapper::glProgramUniform2i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2i(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2i", 4).addUint(program).addInt(location).addInt(v0).addInt(v1);
 	m_gl.programUniform2i(program, location, v0, v1);
 }
 
@@ -4317,6 +5481,8 @@ void CallLogWrapper::glProgramUniform2iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2iv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform2iv(program, location, count, value);
 }
 
@@ -4324,6 +5490,8 @@ void CallLogWrapper::glProgramUniform2ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2ui", 4).addUint(program).addInt(location).addUint(v0).addUint(v1);
 	m_gl.programUniform2ui(program, location, v0, v1);
 }
 
@@ -4331,6 +5499,8 @@ void CallLogWrapper::glProgramUniform2uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform2uiv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform2uiv(program, location, count, value);
 }
 
@@ -4338,6 +5508,8 @@ void CallLogWrapper::glProgramUniform3d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3d", 5).addUint(program).addInt(location).addDouble(v0).addDouble(v1).addDouble(v2);
 	m_gl.programUniform3d(program, location, v0, v1, v2);
 }
 
@@ -4345,6 +5517,8 @@ void CallLogWrapper::glProgramUniform3dEXT (glw::GLuint program, glw::GLint loca
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3dEXT(" << program << ", " << location << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3dEXT", 5).addUint(program).addInt(location).addDouble(x).addDouble(y).addDouble(z);
 	m_gl.programUniform3dEXT(program, location, x, y, z);
 }
 
@@ -4352,6 +5526,8 @@ void CallLogWrapper::glProgramUniform3dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3dv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform3dv(program, location, count, value);
 }
 
@@ -4359,6 +5535,8 @@ void CallLogWrapper::glProgramUniform3dvEXT (glw::GLuint program, glw::GLint loc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3dvEXT(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3dvEXT", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform3dvEXT(program, location, count, value);
 }
 
@@ -4366,6 +5544,8 @@ void CallLogWrapper::glProgramUniform3f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3f", 5).addUint(program).addInt(location).addFloat(v0).addFloat(v1).addFloat(v2);
 	m_gl.programUniform3f(program, location, v0, v1, v2);
 }
 
@@ -4373,6 +5553,8 @@ void CallLogWrapper::glProgramUniform3fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3fv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform3fv(program, location, count, value);
 }
 
@@ -4380,6 +5562,8 @@ void CallLogWrapper::glProgramUniform3i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3i", 5).addUint(program).addInt(location).addInt(v0).addInt(v1).addInt(v2);
 	m_gl.programUniform3i(program, location, v0, v1, v2);
 }
 
@@ -4387,6 +5571,8 @@ void CallLogWrapper::glProgramUniform3iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3iv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform3iv(program, location, count, value);
 }
 
@@ -4394,6 +5580,8 @@ void CallLogWrapper::glProgramUniform3ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3ui", 5).addUint(program).addInt(location).addUint(v0).addUint(v1).addUint(v2);
 	m_gl.programUniform3ui(program, location, v0, v1, v2);
 }
 
@@ -4401,6 +5589,8 @@ void CallLogWrapper::glProgramUniform3uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform3uiv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform3uiv(program, location, count, value);
 }
 
@@ -4408,6 +5598,8 @@ void CallLogWrapper::glProgramUniform4d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4d", 6).addUint(program).addInt(location).addDouble(v0).addDouble(v1).addDouble(v2).addDouble(v3);
 	m_gl.programUniform4d(program, location, v0, v1, v2, v3);
 }
 
@@ -4415,6 +5607,8 @@ void CallLogWrapper::glProgramUniform4dEXT (glw::GLuint program, glw::GLint loca
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4dEXT(" << program << ", " << location << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4dEXT", 6).addUint(program).addInt(location).addDouble(x).addDouble(y).addDouble(z).addDouble(w);
 	m_gl.programUniform4dEXT(program, location, x, y, z, w);
 }
 
@@ -4422,6 +5616,8 @@ void CallLogWrapper::glProgramUniform4dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4dv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform4dv(program, location, count, value);
 }
 
@@ -4429,6 +5625,8 @@ void CallLogWrapper::glProgramUniform4dvEXT (glw::GLuint program, glw::GLint loc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4dvEXT(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4dvEXT", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform4dvEXT(program, location, count, value);
 }
 
@@ -4436,6 +5634,8 @@ void CallLogWrapper::glProgramUniform4f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4f", 6).addUint(program).addInt(location).addFloat(v0).addFloat(v1).addFloat(v2).addFloat(v3);
 	m_gl.programUniform4f(program, location, v0, v1, v2, v3);
 }
 
@@ -4443,6 +5643,8 @@ void CallLogWrapper::glProgramUniform4fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4fv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform4fv(program, location, count, value);
 }
 
@@ -4450,6 +5652,8 @@ void CallLogWrapper::glProgramUniform4i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4i", 6).addUint(program).addInt(location).addInt(v0).addInt(v1).addInt(v2).addInt(v3);
 	m_gl.programUniform4i(program, location, v0, v1, v2, v3);
 }
 
@@ -4457,6 +5661,8 @@ void CallLogWrapper::glProgramUniform4iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4iv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform4iv(program, location, count, value);
 }
 
@@ -4464,6 +5670,8 @@ void CallLogWrapper::glProgramUniform4ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4ui", 6).addUint(program).addInt(location).addUint(v0).addUint(v1).addUint(v2).addUint(v3);
 	m_gl.programUniform4ui(program, location, v0, v1, v2, v3);
 }
 
@@ -4471,6 +5679,8 @@ void CallLogWrapper::glProgramUniform4uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniform4uiv", 4).addUint(program).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniform4uiv(program, location, count, value);
 }
 
@@ -4478,6 +5688,8 @@ void CallLogWrapper::glProgramUniformMatrix2dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2dv(program, location, count, transpose, value);
 }
 
@@ -4485,6 +5697,8 @@ void CallLogWrapper::glProgramUniformMatrix2dvEXT (glw::GLuint program, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2dvEXT(program, location, count, transpose, value);
 }
 
@@ -4492,6 +5706,8 @@ void CallLogWrapper::glProgramUniformMatrix2fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2fv(program, location, count, transpose, value);
 }
 
@@ -4499,6 +5715,8 @@ void CallLogWrapper::glProgramUniformMatrix2x3dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2x3dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2x3dv(program, location, count, transpose, value);
 }
 
@@ -4506,6 +5724,8 @@ void CallLogWrapper::glProgramUniformMatrix2x3dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2x3dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2x3dvEXT(program, location, count, transpose, value);
 }
 
@@ -4513,6 +5733,8 @@ void CallLogWrapper::glProgramUniformMatrix2x3fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2x3fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2x3fv(program, location, count, transpose, value);
 }
 
@@ -4520,6 +5742,8 @@ void CallLogWrapper::glProgramUniformMatrix2x4dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2x4dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2x4dv(program, location, count, transpose, value);
 }
 
@@ -4527,6 +5751,8 @@ void CallLogWrapper::glProgramUniformMatrix2x4dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2x4dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2x4dvEXT(program, location, count, transpose, value);
 }
 
@@ -4534,6 +5760,8 @@ void CallLogWrapper::glProgramUniformMatrix2x4fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix2x4fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix2x4fv(program, location, count, transpose, value);
 }
 
@@ -4541,6 +5769,8 @@ void CallLogWrapper::glProgramUniformMatrix3dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3dv(program, location, count, transpose, value);
 }
 
@@ -4548,6 +5778,8 @@ void CallLogWrapper::glProgramUniformMatrix3dvEXT (glw::GLuint program, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3dvEXT(program, location, count, transpose, value);
 }
 
@@ -4555,6 +5787,8 @@ void CallLogWrapper::glProgramUniformMatrix3fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3fv(program, location, count, transpose, value);
 }
 
@@ -4562,6 +5796,8 @@ void CallLogWrapper::glProgramUniformMatrix3x2dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3x2dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3x2dv(program, location, count, transpose, value);
 }
 
@@ -4569,6 +5805,8 @@ void CallLogWrapper::glProgramUniformMatrix3x2dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3x2dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3x2dvEXT(program, location, count, transpose, value);
 }
 
@@ -4576,6 +5814,8 @@ void CallLogWrapper::glProgramUniformMatrix3x2fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3x2fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3x2fv(program, location, count, transpose, value);
 }
 
@@ -4583,6 +5823,8 @@ void CallLogWrapper::glProgramUniformMatrix3x4dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3x4dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3x4dv(program, location, count, transpose, value);
 }
 
@@ -4590,6 +5832,8 @@ void CallLogWrapper::glProgramUniformMatrix3x4dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3x4dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3x4dvEXT(program, location, count, transpose, value);
 }
 
@@ -4597,6 +5841,8 @@ void CallLogWrapper::glProgramUniformMatrix3x4fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix3x4fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix3x4fv(program, location, count, transpose, value);
 }
 
@@ -4604,6 +5850,8 @@ void CallLogWrapper::glProgramUniformMatrix4dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4dv(program, location, count, transpose, value);
 }
 
@@ -4611,6 +5859,8 @@ void CallLogWrapper::glProgramUniformMatrix4dvEXT (glw::GLuint program, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4dvEXT(program, location, count, transpose, value);
 }
 
@@ -4618,6 +5868,8 @@ void CallLogWrapper::glProgramUniformMatrix4fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4fv(program, location, count, transpose, value);
 }
 
@@ -4625,6 +5877,8 @@ void CallLogWrapper::glProgramUniformMatrix4x2dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4x2dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4x2dv(program, location, count, transpose, value);
 }
 
@@ -4632,6 +5886,8 @@ void CallLogWrapper::glProgramUniformMatrix4x2dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4x2dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4x2dvEXT(program, location, count, transpose, value);
 }
 
@@ -4639,6 +5895,8 @@ void CallLogWrapper::glProgramUniformMatrix4x2fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4x2fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4x2fv(program, location, count, transpose, value);
 }
 
@@ -4646,6 +5904,8 @@ void CallLogWrapper::glProgramUniformMatrix4x3dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4x3dv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4x3dv(program, location, count, transpose, value);
 }
 
@@ -4653,6 +5913,8 @@ void CallLogWrapper::glProgramUniformMatrix4x3dvEXT (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3dvEXT(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4x3dvEXT", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4x3dvEXT(program, location, count, transpose, value);
 }
 
@@ -4660,6 +5922,8 @@ void CallLogWrapper::glProgramUniformMatrix4x3fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProgramUniformMatrix4x3fv", 5).addUint(program).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.programUniformMatrix4x3fv(program, location, count, transpose, value);
 }
 
@@ -4667,6 +5931,8 @@ void CallLogWrapper::glProvokingVertex (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProvokingVertex(" << getProvokingVertexStr(mode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glProvokingVertex", 1).addHex(mode);
 	m_gl.provokingVertex(mode);
 }
 
@@ -4674,6 +5940,8 @@ void CallLogWrapper::glPushClientAttribDefaultEXT (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushClientAttribDefaultEXT(" << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPushClientAttribDefaultEXT", 1).addHex(mask);
 	m_gl.pushClientAttribDefaultEXT(mask);
 }
 
@@ -4681,6 +5949,8 @@ void CallLogWrapper::glPushDebugGroup (glw::GLenum source, glw::GLuint id, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushDebugGroup(" << getDebugMessageSourceStr(source) << ", " << id << ", " << length << ", " << getStringStr(message) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPushDebugGroup", 4).addHex(source).addUint(id).addInt(length).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(message)));
 	m_gl.pushDebugGroup(source, id, length, message);
 }
 
@@ -4688,6 +5958,8 @@ void CallLogWrapper::glPushGroupMarkerEXT (glw::GLsizei length, const glw::GLcha
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushGroupMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glPushGroupMarkerEXT", 2).addInt(length).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(marker)));
 	m_gl.pushGroupMarkerEXT(length, marker);
 }
 
@@ -4695,6 +5967,8 @@ void CallLogWrapper::glQueryCounter (glw::GLuint id, glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glQueryCounter(" << id << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glQueryCounter", 2).addUint(id).addHex(target);
 	m_gl.queryCounter(id, target);
 }
 
@@ -4702,6 +5976,8 @@ void CallLogWrapper::glReadBuffer (glw::GLenum src)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadBuffer(" << getDrawReadBufferStr(src) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glReadBuffer", 1).addHex(src);
 	m_gl.readBuffer(src);
 }
 
@@ -4709,6 +5985,8 @@ void CallLogWrapper::glReadPixels (glw::GLint x, glw::GLint y, glw::GLsizei widt
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glReadPixels", 7).addInt(x).addInt(y).addInt(width).addInt(height).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.readPixels(x, y, width, height, format, type, pixels);
 }
 
@@ -4716,6 +5994,8 @@ void CallLogWrapper::glReadnPixels (glw::GLint x, glw::GLint y, glw::GLsizei wid
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadnPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glReadnPixels", 8).addInt(x).addInt(y).addInt(width).addInt(height).addHex(format).addHex(type).addInt(bufSize).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(data)));
 	m_gl.readnPixels(x, y, width, height, format, type, bufSize, data);
 }
 
@@ -4723,6 +6003,8 @@ void CallLogWrapper::glReleaseShaderCompiler (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReleaseShaderCompiler(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glReleaseShaderCompiler", 0);
 	m_gl.releaseShaderCompiler();
 }
 
@@ -4730,6 +6012,8 @@ void CallLogWrapper::glRenderGpuMaskNV (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderGpuMaskNV(" << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glRenderGpuMaskNV", 1).addHex(mask);
 	m_gl.renderGpuMaskNV(mask);
 }
 
@@ -4737,6 +6021,8 @@ void CallLogWrapper::glRenderbufferStorage (glw::GLenum target, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorage(" << getFramebufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glRenderbufferStorage", 4).addHex(target).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.renderbufferStorage(target, internalformat, width, height);
 }
 
@@ -4744,6 +6030,8 @@ void CallLogWrapper::glRenderbufferStorageMultisample (glw::GLenum target, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorageMultisample(" << getFramebufferTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glRenderbufferStorageMultisample", 5).addHex(target).addInt(samples).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.renderbufferStorageMultisample(target, samples, internalformat, width, height);
 }
 
@@ -4751,6 +6039,8 @@ void CallLogWrapper::glRenderbufferStorageMultisampleEXT (glw::GLenum target, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorageMultisampleEXT(" << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glRenderbufferStorageMultisampleEXT", 5).addHex(target).addInt(samples).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.renderbufferStorageMultisampleEXT(target, samples, internalformat, width, height);
 }
 
@@ -4758,6 +6048,8 @@ void CallLogWrapper::glResumeTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glResumeTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glResumeTransformFeedback", 0);
 	m_gl.resumeTransformFeedback();
 }
 
@@ -4765,6 +6057,8 @@ void CallLogWrapper::glSampleCoverage (glw::GLfloat value, glw::GLboolean invert
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSampleCoverage(" << value << ", " << getBooleanStr(invert) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSampleCoverage", 2).addFloat(value).addBoolean(invert);
 	m_gl.sampleCoverage(value, invert);
 }
 
@@ -4772,6 +6066,8 @@ void CallLogWrapper::glSampleMaski (glw::GLuint maskNumber, glw::GLbitfield mask
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSampleMaski(" << maskNumber << ", " << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSampleMaski", 2).addUint(maskNumber).addHex(mask);
 	m_gl.sampleMaski(maskNumber, mask);
 }
 
@@ -4779,6 +6075,8 @@ void CallLogWrapper::glSamplerParameterIiv (glw::GLuint sampler, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSamplerParameterIiv", 3).addUint(sampler).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.samplerParameterIiv(sampler, pname, param);
 }
 
@@ -4786,6 +6084,8 @@ void CallLogWrapper::glSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSamplerParameterIuiv", 3).addUint(sampler).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.samplerParameterIuiv(sampler, pname, param);
 }
 
@@ -4793,6 +6093,8 @@ void CallLogWrapper::glSamplerParameterf (glw::GLuint sampler, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterf(" << sampler << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSamplerParameterf", 3).addUint(sampler).addHex(pname).addFloat(param);
 	m_gl.samplerParameterf(sampler, pname, param);
 }
 
@@ -4800,6 +6102,8 @@ void CallLogWrapper::glSamplerParameterfv (glw::GLuint sampler, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSamplerParameterfv", 3).addUint(sampler).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.samplerParameterfv(sampler, pname, param);
 }
 
@@ -4807,6 +6111,8 @@ void CallLogWrapper::glSamplerParameteri (glw::GLuint sampler, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameteri(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSamplerParameteri", 3).addUint(sampler).addHex(pname).addInt(param);
 	m_gl.samplerParameteri(sampler, pname, param);
 }
 
@@ -4814,6 +6120,8 @@ void CallLogWrapper::glSamplerParameteriv (glw::GLuint sampler, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSamplerParameteriv", 3).addUint(sampler).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.samplerParameteriv(sampler, pname, param);
 }
 
@@ -4821,6 +6129,8 @@ void CallLogWrapper::glScissor (glw::GLint x, glw::GLint y, glw::GLsizei width,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissor(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glScissor", 4).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.scissor(x, y, width, height);
 }
 
@@ -4828,6 +6138,8 @@ void CallLogWrapper::glScissorArrayv (glw::GLuint first, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glScissorArrayv", 3).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.scissorArrayv(first, count, v);
 }
 
@@ -4835,6 +6147,8 @@ void CallLogWrapper::glScissorIndexed (glw::GLuint index, glw::GLint left, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorIndexed(" << index << ", " << left << ", " << bottom << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glScissorIndexed", 5).addUint(index).addInt(left).addInt(bottom).addInt(width).addInt(height);
 	m_gl.scissorIndexed(index, left, bottom, width, height);
 }
 
@@ -4842,6 +6156,8 @@ void CallLogWrapper::glScissorIndexedv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorIndexedv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glScissorIndexedv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.scissorIndexedv(index, v);
 }
 
@@ -4849,6 +6165,8 @@ void CallLogWrapper::glShaderBinary (glw::GLsizei count, const glw::GLuint *shad
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderBinary(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ", " << toHex(binaryformat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glShaderBinary", 5).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))).addHex(binaryformat).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(binary))).addInt(length);
 	m_gl.shaderBinary(count, shaders, binaryformat, binary, length);
 }
 
@@ -4856,6 +6174,8 @@ void CallLogWrapper::glShaderSource (glw::GLuint shader, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderSource(" << shader << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glShaderSource", 4).addUint(shader).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(string))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(length)));
 	m_gl.shaderSource(shader, count, string, length);
 }
 
@@ -4863,6 +6183,8 @@ void CallLogWrapper::glShaderStorageBlockBinding (glw::GLuint program, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderStorageBlockBinding(" << program << ", " << storageBlockIndex << ", " << storageBlockBinding << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glShaderStorageBlockBinding", 3).addUint(program).addUint(storageBlockIndex).addUint(storageBlockBinding);
 	m_gl.shaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
 }
 
@@ -4870,6 +6192,8 @@ void CallLogWrapper::glSpecializeShader (glw::GLuint shader, const glw::GLchar *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSpecializeShader(" << shader << ", " << getStringStr(pEntryPoint) << ", " << numSpecializationConstants << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pConstantIndex))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pConstantValue))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glSpecializeShader", 5).addUint(shader).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pEntryPoint))).addUint(numSpecializationConstants).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pConstantIndex))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pConstantValue)));
 	m_gl.specializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
 }
 
@@ -4877,6 +6201,8 @@ void CallLogWrapper::glStencilFunc (glw::GLenum func, glw::GLint ref, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilFunc(" << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glStencilFunc", 3).addHex(func).addInt(ref).addUint(mask);
 	m_gl.stencilFunc(func, ref, mask);
 }
 
@@ -4884,6 +6210,8 @@ void CallLogWrapper::glStencilFuncSeparate (glw::GLenum face, glw::GLenum func,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilFuncSeparate(" << getFaceStr(face) << ", " << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glStencilFuncSeparate", 4).addHex(face).addHex(func).addInt(ref).addUint(mask);
 	m_gl.stencilFuncSeparate(face, func, ref, mask);
 }
 
@@ -4891,6 +6219,8 @@ void CallLogWrapper::glStencilMask (glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilMask(" << mask << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glStencilMask", 1).addUint(mask);
 	m_gl.stencilMask(mask);
 }
 
@@ -4898,6 +6228,8 @@ void CallLogWrapper::glStencilMaskSeparate (glw::GLenum face, glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilMaskSeparate(" << getFaceStr(face) << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glStencilMaskSeparate", 2).addHex(face).addUint(mask);
 	m_gl.stencilMaskSeparate(face, mask);
 }
 
@@ -4905,6 +6237,8 @@ void CallLogWrapper::glStencilOp (glw::GLenum fail, glw::GLenum zfail, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilOp(" << getStencilOpStr(fail) << ", " << getStencilOpStr(zfail) << ", " << getStencilOpStr(zpass) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glStencilOp", 3).addHex(fail).addHex(zfail).addHex(zpass);
 	m_gl.stencilOp(fail, zfail, zpass);
 }
 
@@ -4912,6 +6246,8 @@ void CallLogWrapper::glStencilOpSeparate (glw::GLenum face, glw::GLenum sfail, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilOpSeparate(" << getFaceStr(face) << ", " << getStencilOpStr(sfail) << ", " << getStencilOpStr(dpfail) << ", " << getStencilOpStr(dppass) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glStencilOpSeparate", 4).addHex(face).addHex(sfail).addHex(dpfail).addHex(dppass);
 	m_gl.stencilOpSeparate(face, sfail, dpfail, dppass);
 }
 
@@ -4919,6 +6255,8 @@ void CallLogWrapper::glTexBuffer (glw::GLenum target, glw::GLenum internalformat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexBuffer(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexBuffer", 3).addHex(target).addHex(internalformat).addUint(buffer);
 	m_gl.texBuffer(target, internalformat, buffer);
 }
 
@@ -4926,6 +6264,8 @@ void CallLogWrapper::glTexBufferRange (glw::GLenum target, glw::GLenum internalf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexBufferRange(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexBufferRange", 5).addHex(target).addHex(internalformat).addUint(buffer).addInt(offset).addInt(size);
 	m_gl.texBufferRange(target, internalformat, buffer, offset, size);
 }
 
@@ -4933,6 +6273,8 @@ void CallLogWrapper::glTexImage1D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexImage1D", 8).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.texImage1D(target, level, internalformat, width, border, format, type, pixels);
 }
 
@@ -4940,6 +6282,8 @@ void CallLogWrapper::glTexImage2D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexImage2D", 9).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(height).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.texImage2D(target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -4947,6 +6291,8 @@ void CallLogWrapper::glTexImage2DMultisample (glw::GLenum target, glw::GLsizei s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexImage2DMultisample", 6).addHex(target).addInt(samples).addHex(internalformat).addInt(width).addInt(height).addBoolean(fixedsamplelocations);
 	m_gl.texImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -4954,6 +6300,8 @@ void CallLogWrapper::glTexImage3D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexImage3D", 10).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(height).addInt(depth).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.texImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -4961,6 +6309,8 @@ void CallLogWrapper::glTexImage3DMultisample (glw::GLenum target, glw::GLsizei s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3DMultisample(" << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexImage3DMultisample", 7).addHex(target).addInt(samples).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addBoolean(fixedsamplelocations);
 	m_gl.texImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -4968,6 +6318,8 @@ void CallLogWrapper::glTexImage3DOES (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3DOES(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexImage3DOES", 10).addHex(target).addInt(level).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.texImage3DOES(target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -4975,6 +6327,8 @@ void CallLogWrapper::glTexPageCommitmentARB (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexPageCommitmentARB(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexPageCommitmentARB", 9).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addBoolean(commit);
 	m_gl.texPageCommitmentARB(target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
 }
 
@@ -4982,6 +6336,8 @@ void CallLogWrapper::glTexParameterIiv (glw::GLenum target, glw::GLenum pname, c
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexParameterIiv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.texParameterIiv(target, pname, params);
 }
 
@@ -4989,6 +6345,8 @@ void CallLogWrapper::glTexParameterIuiv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexParameterIuiv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.texParameterIuiv(target, pname, params);
 }
 
@@ -4996,6 +6354,8 @@ void CallLogWrapper::glTexParameterf (glw::GLenum target, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterf(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexParameterf", 3).addHex(target).addHex(pname).addFloat(param);
 	m_gl.texParameterf(target, pname, param);
 }
 
@@ -5003,6 +6363,8 @@ void CallLogWrapper::glTexParameterfv (glw::GLenum target, glw::GLenum pname, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexParameterfv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.texParameterfv(target, pname, params);
 }
 
@@ -5010,6 +6372,8 @@ void CallLogWrapper::glTexParameteri (glw::GLenum target, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameteri(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexParameteri", 3).addHex(target).addHex(pname).addInt(param);
 	m_gl.texParameteri(target, pname, param);
 }
 
@@ -5017,6 +6381,8 @@ void CallLogWrapper::glTexParameteriv (glw::GLenum target, glw::GLenum pname, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexParameteriv", 3).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.texParameteriv(target, pname, params);
 }
 
@@ -5024,6 +6390,8 @@ void CallLogWrapper::glTexStorage1D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage1D(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexStorage1D", 4).addHex(target).addInt(levels).addHex(internalformat).addInt(width);
 	m_gl.texStorage1D(target, levels, internalformat, width);
 }
 
@@ -5031,6 +6399,8 @@ void CallLogWrapper::glTexStorage2D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexStorage2D", 5).addHex(target).addInt(levels).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.texStorage2D(target, levels, internalformat, width, height);
 }
 
@@ -5038,6 +6408,8 @@ void CallLogWrapper::glTexStorage2DMultisample (glw::GLenum target, glw::GLsizei
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexStorage2DMultisample", 6).addHex(target).addInt(samples).addHex(internalformat).addInt(width).addInt(height).addBoolean(fixedsamplelocations);
 	m_gl.texStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -5045,6 +6417,8 @@ void CallLogWrapper::glTexStorage3D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexStorage3D", 6).addHex(target).addInt(levels).addHex(internalformat).addInt(width).addInt(height).addInt(depth);
 	m_gl.texStorage3D(target, levels, internalformat, width, height, depth);
 }
 
@@ -5052,6 +6426,8 @@ void CallLogWrapper::glTexStorage3DMultisample (glw::GLenum target, glw::GLsizei
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexStorage3DMultisample", 7).addHex(target).addInt(samples).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addBoolean(fixedsamplelocations);
 	m_gl.texStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -5059,6 +6435,8 @@ void CallLogWrapper::glTexSubImage1D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << width << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexSubImage1D", 7).addHex(target).addInt(level).addInt(xoffset).addInt(width).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.texSubImage1D(target, level, xoffset, width, format, type, pixels);
 }
 
@@ -5066,6 +6444,8 @@ void CallLogWrapper::glTexSubImage2D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexSubImage2D", 9).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(width).addInt(height).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -5073,6 +6453,8 @@ void CallLogWrapper::glTexSubImage3D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexSubImage3D", 11).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.texSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -5080,6 +6462,8 @@ void CallLogWrapper::glTexSubImage3DOES (glw::GLenum target, glw::GLint level, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage3DOES(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexSubImage3DOES", 11).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.texSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -5087,6 +6471,8 @@ void CallLogWrapper::glTextureBarrier (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBarrier(" << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureBarrier", 0);
 	m_gl.textureBarrier();
 }
 
@@ -5094,6 +6480,8 @@ void CallLogWrapper::glTextureBuffer (glw::GLuint texture, glw::GLenum internalf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBuffer(" << texture << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureBuffer", 3).addUint(texture).addHex(internalformat).addUint(buffer);
 	m_gl.textureBuffer(texture, internalformat, buffer);
 }
 
@@ -5101,6 +6489,8 @@ void CallLogWrapper::glTextureBufferEXT (glw::GLuint texture, glw::GLenum target
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBufferEXT(" << texture << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureBufferEXT", 4).addUint(texture).addHex(target).addHex(internalformat).addUint(buffer);
 	m_gl.textureBufferEXT(texture, target, internalformat, buffer);
 }
 
@@ -5108,6 +6498,8 @@ void CallLogWrapper::glTextureBufferRange (glw::GLuint texture, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBufferRange(" << texture << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureBufferRange", 5).addUint(texture).addHex(internalformat).addUint(buffer).addInt(offset).addInt(size);
 	m_gl.textureBufferRange(texture, internalformat, buffer, offset, size);
 }
 
@@ -5115,6 +6507,8 @@ void CallLogWrapper::glTextureBufferRangeEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBufferRangeEXT(" << texture << ", " << toHex(target) << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureBufferRangeEXT", 6).addUint(texture).addHex(target).addHex(internalformat).addUint(buffer).addInt(offset).addInt(size);
 	m_gl.textureBufferRangeEXT(texture, target, internalformat, buffer, offset, size);
 }
 
@@ -5122,6 +6516,8 @@ void CallLogWrapper::glTextureImage1DEXT (glw::GLuint texture, glw::GLenum targe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureImage1DEXT", 9).addUint(texture).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureImage1DEXT(texture, target, level, internalformat, width, border, format, type, pixels);
 }
 
@@ -5129,6 +6525,8 @@ void CallLogWrapper::glTextureImage2DEXT (glw::GLuint texture, glw::GLenum targe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureImage2DEXT", 10).addUint(texture).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(height).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureImage2DEXT(texture, target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -5136,6 +6534,8 @@ void CallLogWrapper::glTextureImage3DEXT (glw::GLuint texture, glw::GLenum targe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << internalformat << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureImage3DEXT", 11).addUint(texture).addHex(target).addInt(level).addInt(internalformat).addInt(width).addInt(height).addInt(depth).addInt(border).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -5143,6 +6543,8 @@ void CallLogWrapper::glTexturePageCommitmentEXT (glw::GLuint texture, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexturePageCommitmentEXT(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(commit) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTexturePageCommitmentEXT", 9).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addBoolean(commit);
 	m_gl.texturePageCommitmentEXT(texture, level, xoffset, yoffset, zoffset, width, height, depth, commit);
 }
 
@@ -5150,6 +6552,8 @@ void CallLogWrapper::glTextureParameterIiv (glw::GLuint texture, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterIiv", 3).addUint(texture).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.textureParameterIiv(texture, pname, params);
 }
 
@@ -5157,6 +6561,8 @@ void CallLogWrapper::glTextureParameterIivEXT (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterIivEXT", 4).addUint(texture).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.textureParameterIivEXT(texture, target, pname, params);
 }
 
@@ -5164,6 +6570,8 @@ void CallLogWrapper::glTextureParameterIuiv (glw::GLuint texture, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterIuiv", 3).addUint(texture).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.textureParameterIuiv(texture, pname, params);
 }
 
@@ -5171,6 +6579,8 @@ void CallLogWrapper::glTextureParameterIuivEXT (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIuivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterIuivEXT", 4).addUint(texture).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.textureParameterIuivEXT(texture, target, pname, params);
 }
 
@@ -5178,6 +6588,8 @@ void CallLogWrapper::glTextureParameterf (glw::GLuint texture, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterf(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterf", 3).addUint(texture).addHex(pname).addFloat(param);
 	m_gl.textureParameterf(texture, pname, param);
 }
 
@@ -5185,6 +6597,8 @@ void CallLogWrapper::glTextureParameterfEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterfEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterfEXT", 4).addUint(texture).addHex(target).addHex(pname).addFloat(param);
 	m_gl.textureParameterfEXT(texture, target, pname, param);
 }
 
@@ -5192,6 +6606,8 @@ void CallLogWrapper::glTextureParameterfv (glw::GLuint texture, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterfv", 3).addUint(texture).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.textureParameterfv(texture, pname, param);
 }
 
@@ -5199,6 +6615,8 @@ void CallLogWrapper::glTextureParameterfvEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterfvEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterfvEXT", 4).addUint(texture).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.textureParameterfvEXT(texture, target, pname, params);
 }
 
@@ -5206,6 +6624,8 @@ void CallLogWrapper::glTextureParameteri (glw::GLuint texture, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteri(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameteri", 3).addUint(texture).addHex(pname).addInt(param);
 	m_gl.textureParameteri(texture, pname, param);
 }
 
@@ -5213,6 +6633,8 @@ void CallLogWrapper::glTextureParameteriEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteriEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameteriEXT", 4).addUint(texture).addHex(target).addHex(pname).addInt(param);
 	m_gl.textureParameteriEXT(texture, target, pname, param);
 }
 
@@ -5220,6 +6642,8 @@ void CallLogWrapper::glTextureParameteriv (glw::GLuint texture, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameteriv", 3).addUint(texture).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(param)));
 	m_gl.textureParameteriv(texture, pname, param);
 }
 
@@ -5227,6 +6651,8 @@ void CallLogWrapper::glTextureParameterivEXT (glw::GLuint texture, glw::GLenum t
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterivEXT(" << texture << ", " << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureParameterivEXT", 4).addUint(texture).addHex(target).addHex(pname).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(params)));
 	m_gl.textureParameterivEXT(texture, target, pname, params);
 }
 
@@ -5234,6 +6660,8 @@ void CallLogWrapper::glTextureRenderbufferEXT (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureRenderbufferEXT(" << texture << ", " << toHex(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureRenderbufferEXT", 3).addUint(texture).addHex(target).addUint(renderbuffer);
 	m_gl.textureRenderbufferEXT(texture, target, renderbuffer);
 }
 
@@ -5241,6 +6669,8 @@ void CallLogWrapper::glTextureStorage1D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage1D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage1D", 4).addUint(texture).addInt(levels).addHex(internalformat).addInt(width);
 	m_gl.textureStorage1D(texture, levels, internalformat, width);
 }
 
@@ -5248,6 +6678,8 @@ void CallLogWrapper::glTextureStorage1DEXT (glw::GLuint texture, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage1DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage1DEXT", 5).addUint(texture).addHex(target).addInt(levels).addHex(internalformat).addInt(width);
 	m_gl.textureStorage1DEXT(texture, target, levels, internalformat, width);
 }
 
@@ -5255,6 +6687,8 @@ void CallLogWrapper::glTextureStorage2D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage2D", 5).addUint(texture).addInt(levels).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.textureStorage2D(texture, levels, internalformat, width, height);
 }
 
@@ -5262,6 +6696,8 @@ void CallLogWrapper::glTextureStorage2DEXT (glw::GLuint texture, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage2DEXT", 6).addUint(texture).addHex(target).addInt(levels).addHex(internalformat).addInt(width).addInt(height);
 	m_gl.textureStorage2DEXT(texture, target, levels, internalformat, width, height);
 }
 
@@ -5269,6 +6705,8 @@ void CallLogWrapper::glTextureStorage2DMultisample (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage2DMultisample", 6).addUint(texture).addInt(samples).addHex(internalformat).addInt(width).addInt(height).addBoolean(fixedsamplelocations);
 	m_gl.textureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -5276,6 +6714,8 @@ void CallLogWrapper::glTextureStorage2DMultisampleEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DMultisampleEXT(" << texture << ", " << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage2DMultisampleEXT", 7).addUint(texture).addHex(target).addInt(samples).addHex(internalformat).addInt(width).addInt(height).addBoolean(fixedsamplelocations);
 	m_gl.textureStorage2DMultisampleEXT(texture, target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -5283,6 +6723,8 @@ void CallLogWrapper::glTextureStorage3D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage3D", 6).addUint(texture).addInt(levels).addHex(internalformat).addInt(width).addInt(height).addInt(depth);
 	m_gl.textureStorage3D(texture, levels, internalformat, width, height, depth);
 }
 
@@ -5290,6 +6732,8 @@ void CallLogWrapper::glTextureStorage3DEXT (glw::GLuint texture, glw::GLenum tar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DEXT(" << texture << ", " << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage3DEXT", 7).addUint(texture).addHex(target).addInt(levels).addHex(internalformat).addInt(width).addInt(height).addInt(depth);
 	m_gl.textureStorage3DEXT(texture, target, levels, internalformat, width, height, depth);
 }
 
@@ -5297,6 +6741,8 @@ void CallLogWrapper::glTextureStorage3DMultisample (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage3DMultisample", 7).addUint(texture).addInt(samples).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addBoolean(fixedsamplelocations);
 	m_gl.textureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -5304,6 +6750,8 @@ void CallLogWrapper::glTextureStorage3DMultisampleEXT (glw::GLuint texture, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DMultisampleEXT(" << texture << ", " << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureStorage3DMultisampleEXT", 8).addUint(texture).addHex(target).addInt(samples).addHex(internalformat).addInt(width).addInt(height).addInt(depth).addBoolean(fixedsamplelocations);
 	m_gl.textureStorage3DMultisampleEXT(texture, target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -5311,6 +6759,8 @@ void CallLogWrapper::glTextureSubImage1D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureSubImage1D", 7).addUint(texture).addInt(level).addInt(xoffset).addInt(width).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureSubImage1D(texture, level, xoffset, width, format, type, pixels);
 }
 
@@ -5318,6 +6768,8 @@ void CallLogWrapper::glTextureSubImage1DEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage1DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureSubImage1DEXT", 8).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(width).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureSubImage1DEXT(texture, target, level, xoffset, width, format, type, pixels);
 }
 
@@ -5325,6 +6777,8 @@ void CallLogWrapper::glTextureSubImage2D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureSubImage2D", 9).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(width).addInt(height).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -5332,6 +6786,8 @@ void CallLogWrapper::glTextureSubImage2DEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage2DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureSubImage2DEXT", 10).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(width).addInt(height).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -5339,6 +6795,8 @@ void CallLogWrapper::glTextureSubImage3D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureSubImage3D", 11).addUint(texture).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -5346,6 +6804,8 @@ void CallLogWrapper::glTextureSubImage3DEXT (glw::GLuint texture, glw::GLenum ta
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage3DEXT(" << texture << ", " << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureSubImage3DEXT", 12).addUint(texture).addHex(target).addInt(level).addInt(xoffset).addInt(yoffset).addInt(zoffset).addInt(width).addInt(height).addInt(depth).addHex(format).addHex(type).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pixels)));
 	m_gl.textureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -5353,6 +6813,8 @@ void CallLogWrapper::glTextureView (glw::GLuint texture, glw::GLenum target, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureView(" << texture << ", " << toHex(target) << ", " << origtexture << ", " << toHex(internalformat) << ", " << minlevel << ", " << numlevels << ", " << minlayer << ", " << numlayers << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTextureView", 8).addUint(texture).addHex(target).addUint(origtexture).addHex(internalformat).addUint(minlevel).addUint(numlevels).addUint(minlayer).addUint(numlayers);
 	m_gl.textureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
 }
 
@@ -5360,6 +6822,8 @@ void CallLogWrapper::glTransformFeedbackBufferBase (glw::GLuint xfb, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackBufferBase(" << xfb << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTransformFeedbackBufferBase", 3).addUint(xfb).addUint(index).addUint(buffer);
 	m_gl.transformFeedbackBufferBase(xfb, index, buffer);
 }
 
@@ -5367,6 +6831,8 @@ void CallLogWrapper::glTransformFeedbackBufferRange (glw::GLuint xfb, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackBufferRange(" << xfb << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTransformFeedbackBufferRange", 5).addUint(xfb).addUint(index).addUint(buffer).addInt(offset).addInt(size);
 	m_gl.transformFeedbackBufferRange(xfb, index, buffer, offset, size);
 }
 
@@ -5374,6 +6840,8 @@ void CallLogWrapper::glTransformFeedbackVaryings (glw::GLuint program, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackVaryings(" << program << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))) << ", " << toHex(bufferMode) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glTransformFeedbackVaryings", 4).addUint(program).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))).addHex(bufferMode);
 	m_gl.transformFeedbackVaryings(program, count, varyings, bufferMode);
 }
 
@@ -5381,6 +6849,8 @@ void CallLogWrapper::glUniform1d (glw::GLint location, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1d(" << location << ", " << x << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform1d", 2).addInt(location).addDouble(x);
 	m_gl.uniform1d(location, x);
 }
 
@@ -5388,6 +6858,8 @@ void CallLogWrapper::glUniform1dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform1dv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform1dv(location, count, value);
 }
 
@@ -5395,6 +6867,8 @@ void CallLogWrapper::glUniform1f (glw::GLint location, glw::GLfloat v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1f(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform1f", 2).addInt(location).addFloat(v0);
 	m_gl.uniform1f(location, v0);
 }
 
@@ -5402,6 +6876,8 @@ void CallLogWrapper::glUniform1fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform1fv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform1fv(location, count, value);
 }
 
@@ -5409,6 +6885,8 @@ void CallLogWrapper::glUniform1i (glw::GLint location, glw::GLint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1i(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform1i", 2).addInt(location).addInt(v0);
 	m_gl.uniform1i(location, v0);
 }
 
@@ -5416,6 +6894,8 @@ void CallLogWrapper::glUniform1iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform1iv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform1iv(location, count, value);
 }
 
@@ -5423,6 +6903,8 @@ void CallLogWrapper::glUniform1ui (glw::GLint location, glw::GLuint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1ui(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform1ui", 2).addInt(location).addUint(v0);
 	m_gl.uniform1ui(location, v0);
 }
 
@@ -5430,6 +6912,8 @@ void CallLogWrapper::glUniform1uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform1uiv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform1uiv(location, count, value);
 }
 
@@ -5437,6 +6921,8 @@ void CallLogWrapper::glUniform2d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2d(" << location << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform2d", 3).addInt(location).addDouble(x).addDouble(y);
 	m_gl.uniform2d(location, x, y);
 }
 
@@ -5444,6 +6930,8 @@ void CallLogWrapper::glUniform2dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform2dv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform2dv(location, count, value);
 }
 
@@ -5451,6 +6939,8 @@ void CallLogWrapper::glUniform2f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2f(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform2f", 3).addInt(location).addFloat(v0).addFloat(v1);
 	m_gl.uniform2f(location, v0, v1);
 }
 
@@ -5458,6 +6948,8 @@ void CallLogWrapper::glUniform2fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform2fv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform2fv(location, count, value);
 }
 
@@ -5465,6 +6957,8 @@ void CallLogWrapper::glUniform2i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2i(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform2i", 3).addInt(location).addInt(v0).addInt(v1);
 	m_gl.uniform2i(location, v0, v1);
 }
 
@@ -5472,6 +6966,8 @@ void CallLogWrapper::glUniform2iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform2iv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform2iv(location, count, value);
 }
 
@@ -5479,6 +6975,8 @@ void CallLogWrapper::glUniform2ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2ui(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform2ui", 3).addInt(location).addUint(v0).addUint(v1);
 	m_gl.uniform2ui(location, v0, v1);
 }
 
@@ -5486,6 +6984,8 @@ void CallLogWrapper::glUniform2uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform2uiv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform2uiv(location, count, value);
 }
 
@@ -5493,6 +6993,8 @@ void CallLogWrapper::glUniform3d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3d(" << location << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform3d", 4).addInt(location).addDouble(x).addDouble(y).addDouble(z);
 	m_gl.uniform3d(location, x, y, z);
 }
 
@@ -5500,6 +7002,8 @@ void CallLogWrapper::glUniform3dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform3dv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform3dv(location, count, value);
 }
 
@@ -5507,6 +7011,8 @@ void CallLogWrapper::glUniform3f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform3f", 4).addInt(location).addFloat(v0).addFloat(v1).addFloat(v2);
 	m_gl.uniform3f(location, v0, v1, v2);
 }
 
@@ -5514,6 +7020,8 @@ void CallLogWrapper::glUniform3fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform3fv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform3fv(location, count, value);
 }
 
@@ -5521,6 +7029,8 @@ void CallLogWrapper::glUniform3i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform3i", 4).addInt(location).addInt(v0).addInt(v1).addInt(v2);
 	m_gl.uniform3i(location, v0, v1, v2);
 }
 
@@ -5528,6 +7038,8 @@ void CallLogWrapper::glUniform3iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform3iv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform3iv(location, count, value);
 }
 
@@ -5535,6 +7047,8 @@ void CallLogWrapper::glUniform3ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform3ui", 4).addInt(location).addUint(v0).addUint(v1).addUint(v2);
 	m_gl.uniform3ui(location, v0, v1, v2);
 }
 
@@ -5542,6 +7056,8 @@ void CallLogWrapper::glUniform3uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform3uiv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform3uiv(location, count, value);
 }
 
@@ -5549,6 +7065,8 @@ void CallLogWrapper::glUniform4d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4d(" << location << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform4d", 5).addInt(location).addDouble(x).addDouble(y).addDouble(z).addDouble(w);
 	m_gl.uniform4d(location, x, y, z, w);
 }
 
@@ -5556,6 +7074,8 @@ void CallLogWrapper::glUniform4dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform4dv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform4dv(location, count, value);
 }
 
@@ -5563,6 +7083,8 @@ void CallLogWrapper::glUniform4f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform4f", 5).addInt(location).addFloat(v0).addFloat(v1).addFloat(v2).addFloat(v3);
 	m_gl.uniform4f(location, v0, v1, v2, v3);
 }
 
@@ -5570,6 +7092,8 @@ void CallLogWrapper::glUniform4fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform4fv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform4fv(location, count, value);
 }
 
@@ -5577,6 +7101,8 @@ void CallLogWrapper::glUniform4i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform4i", 5).addInt(location).addInt(v0).addInt(v1).addInt(v2).addInt(v3);
 	m_gl.uniform4i(location, v0, v1, v2, v3);
 }
 
@@ -5584,6 +7110,8 @@ void CallLogWrapper::glUniform4iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform4iv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform4iv(location, count, value);
 }
 
@@ -5591,6 +7119,8 @@ void CallLogWrapper::glUniform4ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform4ui", 5).addInt(location).addUint(v0).addUint(v1).addUint(v2).addUint(v3);
 	m_gl.uniform4ui(location, v0, v1, v2, v3);
 }
 
@@ -5598,6 +7128,8 @@ void CallLogWrapper::glUniform4uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniform4uiv", 3).addInt(location).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniform4uiv(location, count, value);
 }
 
@@ -5605,6 +7137,8 @@ void CallLogWrapper::glUniformBlockBinding (glw::GLuint program, glw::GLuint uni
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformBlockBinding(" << program << ", " << uniformBlockIndex << ", " << uniformBlockBinding << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformBlockBinding", 3).addUint(program).addUint(uniformBlockIndex).addUint(uniformBlockBinding);
 	m_gl.uniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
 }
 
@@ -5612,6 +7146,8 @@ void CallLogWrapper::glUniformMatrix2dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix2dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix2dv(location, count, transpose, value);
 }
 
@@ -5619,6 +7155,8 @@ void CallLogWrapper::glUniformMatrix2fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix2fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix2fv(location, count, transpose, value);
 }
 
@@ -5626,6 +7164,8 @@ void CallLogWrapper::glUniformMatrix2x3dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix2x3dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix2x3dv(location, count, transpose, value);
 }
 
@@ -5633,6 +7173,8 @@ void CallLogWrapper::glUniformMatrix2x3fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix2x3fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix2x3fv(location, count, transpose, value);
 }
 
@@ -5640,6 +7182,8 @@ void CallLogWrapper::glUniformMatrix2x4dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix2x4dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix2x4dv(location, count, transpose, value);
 }
 
@@ -5647,6 +7191,8 @@ void CallLogWrapper::glUniformMatrix2x4fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix2x4fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix2x4fv(location, count, transpose, value);
 }
 
@@ -5654,6 +7200,8 @@ void CallLogWrapper::glUniformMatrix3dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix3dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix3dv(location, count, transpose, value);
 }
 
@@ -5661,6 +7209,8 @@ void CallLogWrapper::glUniformMatrix3fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix3fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix3fv(location, count, transpose, value);
 }
 
@@ -5668,6 +7218,8 @@ void CallLogWrapper::glUniformMatrix3x2dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix3x2dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix3x2dv(location, count, transpose, value);
 }
 
@@ -5675,6 +7227,8 @@ void CallLogWrapper::glUniformMatrix3x2fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix3x2fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix3x2fv(location, count, transpose, value);
 }
 
@@ -5682,6 +7236,8 @@ void CallLogWrapper::glUniformMatrix3x4dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix3x4dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix3x4dv(location, count, transpose, value);
 }
 
@@ -5689,6 +7245,8 @@ void CallLogWrapper::glUniformMatrix3x4fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix3x4fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix3x4fv(location, count, transpose, value);
 }
 
@@ -5696,6 +7254,8 @@ void CallLogWrapper::glUniformMatrix4dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix4dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix4dv(location, count, transpose, value);
 }
 
@@ -5703,6 +7263,8 @@ void CallLogWrapper::glUniformMatrix4fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix4fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix4fv(location, count, transpose, value);
 }
 
@@ -5710,6 +7272,8 @@ void CallLogWrapper::glUniformMatrix4x2dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix4x2dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix4x2dv(location, count, transpose, value);
 }
 
@@ -5717,6 +7281,8 @@ void CallLogWrapper::glUniformMatrix4x2fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix4x2fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix4x2fv(location, count, transpose, value);
 }
 
@@ -5724,6 +7290,8 @@ void CallLogWrapper::glUniformMatrix4x3dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix4x3dv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix4x3dv(location, count, transpose, value);
 }
 
@@ -5731,6 +7299,8 @@ void CallLogWrapper::glUniformMatrix4x3fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformMatrix4x3fv", 4).addInt(location).addInt(count).addBoolean(transpose).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.uniformMatrix4x3fv(location, count, transpose, value);
 }
 
@@ -5738,6 +7308,8 @@ void CallLogWrapper::glUniformSubroutinesuiv (glw::GLenum shadertype, glw::GLsiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformSubroutinesuiv(" << toHex(shadertype) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUniformSubroutinesuiv", 3).addHex(shadertype).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(indices)));
 	m_gl.uniformSubroutinesuiv(shadertype, count, indices);
 }
 
@@ -5745,6 +7317,8 @@ glw::GLboolean CallLogWrapper::glUnmapBuffer (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapBuffer(" << getBufferTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUnmapBuffer", 1).addHex(target);
 	glw::GLboolean returnValue = m_gl.unmapBuffer(target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -5755,6 +7329,8 @@ glw::GLboolean CallLogWrapper::glUnmapNamedBuffer (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapNamedBuffer(" << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUnmapNamedBuffer", 1).addUint(buffer);
 	glw::GLboolean returnValue = m_gl.unmapNamedBuffer(buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -5765,6 +7341,8 @@ glw::GLboolean CallLogWrapper::glUnmapNamedBufferEXT (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapNamedBufferEXT(" << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUnmapNamedBufferEXT", 1).addUint(buffer);
 	glw::GLboolean returnValue = m_gl.unmapNamedBufferEXT(buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -5775,6 +7353,8 @@ void CallLogWrapper::glUseProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUseProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUseProgram", 1).addUint(program);
 	m_gl.useProgram(program);
 }
 
@@ -5782,6 +7362,8 @@ void CallLogWrapper::glUseProgramStages (glw::GLuint pipeline, glw::GLbitfield s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUseProgramStages(" << pipeline << ", " << getShaderTypeMaskStr(stages) << ", " << program << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glUseProgramStages", 3).addUint(pipeline).addHex(stages).addUint(program);
 	m_gl.useProgramStages(pipeline, stages, program);
 }
 
@@ -5789,6 +7371,8 @@ void CallLogWrapper::glValidateProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glValidateProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glValidateProgram", 1).addUint(program);
 	m_gl.validateProgram(program);
 }
 
@@ -5796,6 +7380,8 @@ void CallLogWrapper::glValidateProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glValidateProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glValidateProgramPipeline", 1).addUint(pipeline);
 	m_gl.validateProgramPipeline(pipeline);
 }
 
@@ -5803,6 +7389,8 @@ void CallLogWrapper::glVertexArrayAttribBinding (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribBinding(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayAttribBinding", 3).addUint(vaobj).addUint(attribindex).addUint(bindingindex);
 	m_gl.vertexArrayAttribBinding(vaobj, attribindex, bindingindex);
 }
 
@@ -5810,6 +7398,8 @@ void CallLogWrapper::glVertexArrayAttribFormat (glw::GLuint vaobj, glw::GLuint a
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayAttribFormat", 6).addUint(vaobj).addUint(attribindex).addInt(size).addHex(type).addBoolean(normalized).addUint(relativeoffset);
 	m_gl.vertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -5817,6 +7407,8 @@ void CallLogWrapper::glVertexArrayAttribIFormat (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribIFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayAttribIFormat", 5).addUint(vaobj).addUint(attribindex).addInt(size).addHex(type).addUint(relativeoffset);
 	m_gl.vertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -5824,6 +7416,8 @@ void CallLogWrapper::glVertexArrayAttribLFormat (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribLFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayAttribLFormat", 5).addUint(vaobj).addUint(attribindex).addInt(size).addHex(type).addUint(relativeoffset);
 	m_gl.vertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -5831,6 +7425,8 @@ void CallLogWrapper::glVertexArrayBindVertexBufferEXT (glw::GLuint vaobj, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayBindVertexBufferEXT(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayBindVertexBufferEXT", 5).addUint(vaobj).addUint(bindingindex).addUint(buffer).addInt(offset).addInt(stride);
 	m_gl.vertexArrayBindVertexBufferEXT(vaobj, bindingindex, buffer, offset, stride);
 }
 
@@ -5838,6 +7434,8 @@ void CallLogWrapper::glVertexArrayBindingDivisor (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayBindingDivisor(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayBindingDivisor", 3).addUint(vaobj).addUint(bindingindex).addUint(divisor);
 	m_gl.vertexArrayBindingDivisor(vaobj, bindingindex, divisor);
 }
 
@@ -5845,6 +7443,8 @@ void CallLogWrapper::glVertexArrayColorOffsetEXT (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayColorOffsetEXT", 6).addUint(vaobj).addUint(buffer).addInt(size).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
 }
 
@@ -5852,6 +7452,8 @@ void CallLogWrapper::glVertexArrayEdgeFlagOffsetEXT (glw::GLuint vaobj, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayEdgeFlagOffsetEXT(" << vaobj << ", " << buffer << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayEdgeFlagOffsetEXT", 4).addUint(vaobj).addUint(buffer).addInt(stride).addInt(offset);
 	m_gl.vertexArrayEdgeFlagOffsetEXT(vaobj, buffer, stride, offset);
 }
 
@@ -5859,6 +7461,8 @@ void CallLogWrapper::glVertexArrayElementBuffer (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayElementBuffer(" << vaobj << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayElementBuffer", 2).addUint(vaobj).addUint(buffer);
 	m_gl.vertexArrayElementBuffer(vaobj, buffer);
 }
 
@@ -5866,6 +7470,8 @@ void CallLogWrapper::glVertexArrayFogCoordOffsetEXT (glw::GLuint vaobj, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayFogCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayFogCoordOffsetEXT", 5).addUint(vaobj).addUint(buffer).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayFogCoordOffsetEXT(vaobj, buffer, type, stride, offset);
 }
 
@@ -5873,6 +7479,8 @@ void CallLogWrapper::glVertexArrayIndexOffsetEXT (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayIndexOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayIndexOffsetEXT", 5).addUint(vaobj).addUint(buffer).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayIndexOffsetEXT(vaobj, buffer, type, stride, offset);
 }
 
@@ -5880,6 +7488,8 @@ void CallLogWrapper::glVertexArrayMultiTexCoordOffsetEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayMultiTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(texunit) << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayMultiTexCoordOffsetEXT", 7).addUint(vaobj).addUint(buffer).addHex(texunit).addInt(size).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayMultiTexCoordOffsetEXT(vaobj, buffer, texunit, size, type, stride, offset);
 }
 
@@ -5887,6 +7497,8 @@ void CallLogWrapper::glVertexArrayNormalOffsetEXT (glw::GLuint vaobj, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayNormalOffsetEXT(" << vaobj << ", " << buffer << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayNormalOffsetEXT", 5).addUint(vaobj).addUint(buffer).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayNormalOffsetEXT(vaobj, buffer, type, stride, offset);
 }
 
@@ -5894,6 +7506,8 @@ void CallLogWrapper::glVertexArraySecondaryColorOffsetEXT (glw::GLuint vaobj, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArraySecondaryColorOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArraySecondaryColorOffsetEXT", 6).addUint(vaobj).addUint(buffer).addInt(size).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArraySecondaryColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
 }
 
@@ -5901,6 +7515,8 @@ void CallLogWrapper::glVertexArrayTexCoordOffsetEXT (glw::GLuint vaobj, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayTexCoordOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayTexCoordOffsetEXT", 6).addUint(vaobj).addUint(buffer).addInt(size).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayTexCoordOffsetEXT(vaobj, buffer, size, type, stride, offset);
 }
 
@@ -5908,6 +7524,8 @@ void CallLogWrapper::glVertexArrayVertexAttribBindingEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribBindingEXT(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexAttribBindingEXT", 3).addUint(vaobj).addUint(attribindex).addUint(bindingindex);
 	m_gl.vertexArrayVertexAttribBindingEXT(vaobj, attribindex, bindingindex);
 }
 
@@ -5915,6 +7533,8 @@ void CallLogWrapper::glVertexArrayVertexAttribDivisorEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribDivisorEXT(" << vaobj << ", " << index << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexAttribDivisorEXT", 3).addUint(vaobj).addUint(index).addUint(divisor);
 	m_gl.vertexArrayVertexAttribDivisorEXT(vaobj, index, divisor);
 }
 
@@ -5922,6 +7542,8 @@ void CallLogWrapper::glVertexArrayVertexAttribFormatEXT (glw::GLuint vaobj, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexAttribFormatEXT", 6).addUint(vaobj).addUint(attribindex).addInt(size).addHex(type).addBoolean(normalized).addUint(relativeoffset);
 	m_gl.vertexArrayVertexAttribFormatEXT(vaobj, attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -5929,6 +7551,8 @@ void CallLogWrapper::glVertexArrayVertexAttribIFormatEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribIFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexAttribIFormatEXT", 5).addUint(vaobj).addUint(attribindex).addInt(size).addHex(type).addUint(relativeoffset);
 	m_gl.vertexArrayVertexAttribIFormatEXT(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -5936,6 +7560,8 @@ void CallLogWrapper::glVertexArrayVertexAttribIOffsetEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribIOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexAttribIOffsetEXT", 7).addUint(vaobj).addUint(buffer).addUint(index).addInt(size).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayVertexAttribIOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
 }
 
@@ -5943,6 +7569,8 @@ void CallLogWrapper::glVertexArrayVertexAttribLFormatEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribLFormatEXT(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexAttribLFormatEXT", 5).addUint(vaobj).addUint(attribindex).addInt(size).addHex(type).addUint(relativeoffset);
 	m_gl.vertexArrayVertexAttribLFormatEXT(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -5950,6 +7578,8 @@ void CallLogWrapper::glVertexArrayVertexAttribLOffsetEXT (glw::GLuint vaobj, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribLOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexAttribLOffsetEXT", 7).addUint(vaobj).addUint(buffer).addUint(index).addInt(size).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayVertexAttribLOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
 }
 
@@ -5957,6 +7587,8 @@ void CallLogWrapper::glVertexArrayVertexAttribOffsetEXT (glw::GLuint vaobj, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexAttribOffsetEXT(" << vaobj << ", " << buffer << ", " << index << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexAttribOffsetEXT", 8).addUint(vaobj).addUint(buffer).addUint(index).addInt(size).addHex(type).addBoolean(normalized).addInt(stride).addInt(offset);
 	m_gl.vertexArrayVertexAttribOffsetEXT(vaobj, buffer, index, size, type, normalized, stride, offset);
 }
 
@@ -5964,6 +7596,8 @@ void CallLogWrapper::glVertexArrayVertexBindingDivisorEXT (glw::GLuint vaobj, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBindingDivisorEXT(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexBindingDivisorEXT", 3).addUint(vaobj).addUint(bindingindex).addUint(divisor);
 	m_gl.vertexArrayVertexBindingDivisorEXT(vaobj, bindingindex, divisor);
 }
 
@@ -5971,6 +7605,8 @@ void CallLogWrapper::glVertexArrayVertexBuffer (glw::GLuint vaobj, glw::GLuint b
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffer(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexBuffer", 5).addUint(vaobj).addUint(bindingindex).addUint(buffer).addInt(offset).addInt(stride);
 	m_gl.vertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
 }
 
@@ -5978,6 +7614,8 @@ void CallLogWrapper::glVertexArrayVertexBuffers (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffers(" << vaobj << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexBuffers", 6).addUint(vaobj).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(strides)));
 	m_gl.vertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
 }
 
@@ -5985,6 +7623,8 @@ void CallLogWrapper::glVertexArrayVertexOffsetEXT (glw::GLuint vaobj, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexOffsetEXT(" << vaobj << ", " << buffer << ", " << size << ", " << toHex(type) << ", " << stride << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexArrayVertexOffsetEXT", 6).addUint(vaobj).addUint(buffer).addInt(size).addHex(type).addInt(stride).addInt(offset);
 	m_gl.vertexArrayVertexOffsetEXT(vaobj, buffer, size, type, stride, offset);
 }
 
@@ -5992,6 +7632,8 @@ void CallLogWrapper::glVertexAttrib1d (glw::GLuint index, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1d(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib1d", 2).addUint(index).addDouble(x);
 	m_gl.vertexAttrib1d(index, x);
 }
 
@@ -5999,6 +7641,8 @@ void CallLogWrapper::glVertexAttrib1dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1dv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib1dv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib1dv(index, v);
 }
 
@@ -6006,6 +7650,8 @@ void CallLogWrapper::glVertexAttrib1f (glw::GLuint index, glw::GLfloat x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1f(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib1f", 2).addUint(index).addFloat(x);
 	m_gl.vertexAttrib1f(index, x);
 }
 
@@ -6013,6 +7659,8 @@ void CallLogWrapper::glVertexAttrib1fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1fv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib1fv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib1fv(index, v);
 }
 
@@ -6020,6 +7668,8 @@ void CallLogWrapper::glVertexAttrib1s (glw::GLuint index, glw::GLshort x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1s(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib1s", 2).addUint(index).addInt(x);
 	m_gl.vertexAttrib1s(index, x);
 }
 
@@ -6027,6 +7677,8 @@ void CallLogWrapper::glVertexAttrib1sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1sv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib1sv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib1sv(index, v);
 }
 
@@ -6034,6 +7686,8 @@ void CallLogWrapper::glVertexAttrib2d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib2d", 3).addUint(index).addDouble(x).addDouble(y);
 	m_gl.vertexAttrib2d(index, x, y);
 }
 
@@ -6041,6 +7695,8 @@ void CallLogWrapper::glVertexAttrib2dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2dv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib2dv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib2dv(index, v);
 }
 
@@ -6048,6 +7704,8 @@ void CallLogWrapper::glVertexAttrib2f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2f(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib2f", 3).addUint(index).addFloat(x).addFloat(y);
 	m_gl.vertexAttrib2f(index, x, y);
 }
 
@@ -6055,6 +7713,8 @@ void CallLogWrapper::glVertexAttrib2fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2fv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib2fv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib2fv(index, v);
 }
 
@@ -6062,6 +7722,8 @@ void CallLogWrapper::glVertexAttrib2s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2s(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib2s", 3).addUint(index).addInt(x).addInt(y);
 	m_gl.vertexAttrib2s(index, x, y);
 }
 
@@ -6069,6 +7731,8 @@ void CallLogWrapper::glVertexAttrib2sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2sv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib2sv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib2sv(index, v);
 }
 
@@ -6076,6 +7740,8 @@ void CallLogWrapper::glVertexAttrib3d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib3d", 4).addUint(index).addDouble(x).addDouble(y).addDouble(z);
 	m_gl.vertexAttrib3d(index, x, y, z);
 }
 
@@ -6083,6 +7749,8 @@ void CallLogWrapper::glVertexAttrib3dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3dv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib3dv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib3dv(index, v);
 }
 
@@ -6090,6 +7758,8 @@ void CallLogWrapper::glVertexAttrib3f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3f(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib3f", 4).addUint(index).addFloat(x).addFloat(y).addFloat(z);
 	m_gl.vertexAttrib3f(index, x, y, z);
 }
 
@@ -6097,6 +7767,8 @@ void CallLogWrapper::glVertexAttrib3fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3fv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib3fv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib3fv(index, v);
 }
 
@@ -6104,6 +7776,8 @@ void CallLogWrapper::glVertexAttrib3s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3s(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib3s", 4).addUint(index).addInt(x).addInt(y).addInt(z);
 	m_gl.vertexAttrib3s(index, x, y, z);
 }
 
@@ -6111,6 +7785,8 @@ void CallLogWrapper::glVertexAttrib3sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3sv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib3sv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib3sv(index, v);
 }
 
@@ -6118,6 +7794,8 @@ void CallLogWrapper::glVertexAttrib4Nbv (glw::GLuint index, const glw::GLbyte *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nbv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4Nbv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4Nbv(index, v);
 }
 
@@ -6125,6 +7803,8 @@ void CallLogWrapper::glVertexAttrib4Niv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Niv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4Niv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4Niv(index, v);
 }
 
@@ -6132,6 +7812,8 @@ void CallLogWrapper::glVertexAttrib4Nsv (glw::GLuint index, const glw::GLshort *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nsv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4Nsv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4Nsv(index, v);
 }
 
@@ -6139,6 +7821,8 @@ void CallLogWrapper::glVertexAttrib4Nub (glw::GLuint index, glw::GLubyte x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nub(" << index << ", " << toHex(x) << ", " << toHex(y) << ", " << toHex(z) << ", " << toHex(w) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4Nub", 5).addUint(index).addHex(x).addHex(y).addHex(z).addHex(w);
 	m_gl.vertexAttrib4Nub(index, x, y, z, w);
 }
 
@@ -6146,6 +7830,8 @@ void CallLogWrapper::glVertexAttrib4Nubv (glw::GLuint index, const glw::GLubyte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4Nubv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4Nubv(index, v);
 }
 
@@ -6153,6 +7839,8 @@ void CallLogWrapper::glVertexAttrib4Nuiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nuiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4Nuiv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4Nuiv(index, v);
 }
 
@@ -6160,6 +7848,8 @@ void CallLogWrapper::glVertexAttrib4Nusv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nusv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4Nusv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4Nusv(index, v);
 }
 
@@ -6167,6 +7857,8 @@ void CallLogWrapper::glVertexAttrib4bv (glw::GLuint index, const glw::GLbyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4bv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4bv(index, v);
 }
 
@@ -6174,6 +7866,8 @@ void CallLogWrapper::glVertexAttrib4d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4d", 5).addUint(index).addDouble(x).addDouble(y).addDouble(z).addDouble(w);
 	m_gl.vertexAttrib4d(index, x, y, z, w);
 }
 
@@ -6181,6 +7875,8 @@ void CallLogWrapper::glVertexAttrib4dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4dv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4dv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4dv(index, v);
 }
 
@@ -6188,6 +7884,8 @@ void CallLogWrapper::glVertexAttrib4f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4f(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4f", 5).addUint(index).addFloat(x).addFloat(y).addFloat(z).addFloat(w);
 	m_gl.vertexAttrib4f(index, x, y, z, w);
 }
 
@@ -6195,6 +7893,8 @@ void CallLogWrapper::glVertexAttrib4fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4fv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4fv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4fv(index, v);
 }
 
@@ -6202,6 +7902,8 @@ void CallLogWrapper::glVertexAttrib4iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4iv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4iv(index, v);
 }
 
@@ -6209,6 +7911,8 @@ void CallLogWrapper::glVertexAttrib4s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4s(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4s", 5).addUint(index).addInt(x).addInt(y).addInt(z).addInt(w);
 	m_gl.vertexAttrib4s(index, x, y, z, w);
 }
 
@@ -6216,6 +7920,8 @@ void CallLogWrapper::glVertexAttrib4sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4sv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4sv(index, v);
 }
 
@@ -6223,6 +7929,8 @@ void CallLogWrapper::glVertexAttrib4ubv (glw::GLuint index, const glw::GLubyte *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4ubv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4ubv(index, v);
 }
 
@@ -6230,6 +7938,8 @@ void CallLogWrapper::glVertexAttrib4uiv (glw::GLuint index, const glw::GLuint *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4uiv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4uiv(index, v);
 }
 
@@ -6237,6 +7947,8 @@ void CallLogWrapper::glVertexAttrib4usv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttrib4usv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttrib4usv(index, v);
 }
 
@@ -6244,6 +7956,8 @@ void CallLogWrapper::glVertexAttribBinding (glw::GLuint attribindex, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribBinding(" << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribBinding", 2).addUint(attribindex).addUint(bindingindex);
 	m_gl.vertexAttribBinding(attribindex, bindingindex);
 }
 
@@ -6251,6 +7965,8 @@ void CallLogWrapper::glVertexAttribDivisor (glw::GLuint index, glw::GLuint divis
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribDivisor(" << index << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribDivisor", 2).addUint(index).addUint(divisor);
 	m_gl.vertexAttribDivisor(index, divisor);
 }
 
@@ -6258,6 +7974,8 @@ void CallLogWrapper::glVertexAttribFormat (glw::GLuint attribindex, glw::GLint s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribFormat", 5).addUint(attribindex).addInt(size).addHex(type).addBoolean(normalized).addUint(relativeoffset);
 	m_gl.vertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -6265,6 +7983,8 @@ void CallLogWrapper::glVertexAttribI1i (glw::GLuint index, glw::GLint x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1i(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI1i", 2).addUint(index).addInt(x);
 	m_gl.vertexAttribI1i(index, x);
 }
 
@@ -6272,6 +7992,8 @@ void CallLogWrapper::glVertexAttribI1iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1iv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI1iv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI1iv(index, v);
 }
 
@@ -6279,6 +8001,8 @@ void CallLogWrapper::glVertexAttribI1ui (glw::GLuint index, glw::GLuint x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1ui(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI1ui", 2).addUint(index).addUint(x);
 	m_gl.vertexAttribI1ui(index, x);
 }
 
@@ -6286,6 +8010,8 @@ void CallLogWrapper::glVertexAttribI1uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1uiv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI1uiv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI1uiv(index, v);
 }
 
@@ -6293,6 +8019,8 @@ void CallLogWrapper::glVertexAttribI2i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2i(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI2i", 3).addUint(index).addInt(x).addInt(y);
 	m_gl.vertexAttribI2i(index, x, y);
 }
 
@@ -6300,6 +8028,8 @@ void CallLogWrapper::glVertexAttribI2iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2iv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI2iv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI2iv(index, v);
 }
 
@@ -6307,6 +8037,8 @@ void CallLogWrapper::glVertexAttribI2ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2ui(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI2ui", 3).addUint(index).addUint(x).addUint(y);
 	m_gl.vertexAttribI2ui(index, x, y);
 }
 
@@ -6314,6 +8046,8 @@ void CallLogWrapper::glVertexAttribI2uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2uiv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI2uiv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI2uiv(index, v);
 }
 
@@ -6321,6 +8055,8 @@ void CallLogWrapper::glVertexAttribI3i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3i(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI3i", 4).addUint(index).addInt(x).addInt(y).addInt(z);
 	m_gl.vertexAttribI3i(index, x, y, z);
 }
 
@@ -6328,6 +8064,8 @@ void CallLogWrapper::glVertexAttribI3iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3iv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI3iv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI3iv(index, v);
 }
 
@@ -6335,6 +8073,8 @@ void CallLogWrapper::glVertexAttribI3ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3ui(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI3ui", 4).addUint(index).addUint(x).addUint(y).addUint(z);
 	m_gl.vertexAttribI3ui(index, x, y, z);
 }
 
@@ -6342,6 +8082,8 @@ void CallLogWrapper::glVertexAttribI3uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3uiv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI3uiv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI3uiv(index, v);
 }
 
@@ -6349,6 +8091,8 @@ void CallLogWrapper::glVertexAttribI4bv (glw::GLuint index, const glw::GLbyte *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI4bv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI4bv(index, v);
 }
 
@@ -6356,6 +8100,8 @@ void CallLogWrapper::glVertexAttribI4i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4i(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI4i", 5).addUint(index).addInt(x).addInt(y).addInt(z).addInt(w);
 	m_gl.vertexAttribI4i(index, x, y, z, w);
 }
 
@@ -6363,6 +8109,8 @@ void CallLogWrapper::glVertexAttribI4iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI4iv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI4iv(index, v);
 }
 
@@ -6370,6 +8118,8 @@ void CallLogWrapper::glVertexAttribI4sv (glw::GLuint index, const glw::GLshort *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI4sv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI4sv(index, v);
 }
 
@@ -6377,6 +8127,8 @@ void CallLogWrapper::glVertexAttribI4ubv (glw::GLuint index, const glw::GLubyte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI4ubv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI4ubv(index, v);
 }
 
@@ -6384,6 +8136,8 @@ void CallLogWrapper::glVertexAttribI4ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4ui(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI4ui", 5).addUint(index).addUint(x).addUint(y).addUint(z).addUint(w);
 	m_gl.vertexAttribI4ui(index, x, y, z, w);
 }
 
@@ -6391,6 +8145,8 @@ void CallLogWrapper::glVertexAttribI4uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI4uiv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI4uiv(index, v);
 }
 
@@ -6398,6 +8154,8 @@ void CallLogWrapper::glVertexAttribI4usv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribI4usv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribI4usv(index, v);
 }
 
@@ -6405,6 +8163,8 @@ void CallLogWrapper::glVertexAttribIFormat (glw::GLuint attribindex, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribIFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribIFormat", 4).addUint(attribindex).addInt(size).addHex(type).addUint(relativeoffset);
 	m_gl.vertexAttribIFormat(attribindex, size, type, relativeoffset);
 }
 
@@ -6412,6 +8172,8 @@ void CallLogWrapper::glVertexAttribIPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribIPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribIPointer", 5).addUint(index).addInt(size).addHex(type).addInt(stride).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer)));
 	m_gl.vertexAttribIPointer(index, size, type, stride, pointer);
 }
 
@@ -6419,6 +8181,8 @@ void CallLogWrapper::glVertexAttribL1d (glw::GLuint index, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL1d(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribL1d", 2).addUint(index).addDouble(x);
 	m_gl.vertexAttribL1d(index, x);
 }
 
@@ -6426,6 +8190,8 @@ void CallLogWrapper::glVertexAttribL1dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL1dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribL1dv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribL1dv(index, v);
 }
 
@@ -6433,6 +8199,8 @@ void CallLogWrapper::glVertexAttribL2d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribL2d", 3).addUint(index).addDouble(x).addDouble(y);
 	m_gl.vertexAttribL2d(index, x, y);
 }
 
@@ -6440,6 +8208,8 @@ void CallLogWrapper::glVertexAttribL2dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL2dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribL2dv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribL2dv(index, v);
 }
 
@@ -6447,6 +8217,8 @@ void CallLogWrapper::glVertexAttribL3d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribL3d", 4).addUint(index).addDouble(x).addDouble(y).addDouble(z);
 	m_gl.vertexAttribL3d(index, x, y, z);
 }
 
@@ -6454,6 +8226,8 @@ void CallLogWrapper::glVertexAttribL3dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL3dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribL3dv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribL3dv(index, v);
 }
 
@@ -6461,6 +8235,8 @@ void CallLogWrapper::glVertexAttribL4d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribL4d", 5).addUint(index).addDouble(x).addDouble(y).addDouble(z).addDouble(w);
 	m_gl.vertexAttribL4d(index, x, y, z, w);
 }
 
@@ -6468,6 +8244,8 @@ void CallLogWrapper::glVertexAttribL4dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL4dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribL4dv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.vertexAttribL4dv(index, v);
 }
 
@@ -6475,6 +8253,8 @@ void CallLogWrapper::glVertexAttribLFormat (glw::GLuint attribindex, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribLFormat(" << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribLFormat", 4).addUint(attribindex).addInt(size).addHex(type).addUint(relativeoffset);
 	m_gl.vertexAttribLFormat(attribindex, size, type, relativeoffset);
 }
 
@@ -6482,6 +8262,8 @@ void CallLogWrapper::glVertexAttribLPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribLPointer(" << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribLPointer", 5).addUint(index).addInt(size).addHex(type).addInt(stride).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer)));
 	m_gl.vertexAttribLPointer(index, size, type, stride, pointer);
 }
 
@@ -6489,6 +8271,8 @@ void CallLogWrapper::glVertexAttribP1ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP1ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribP1ui", 4).addUint(index).addHex(type).addBoolean(normalized).addUint(value);
 	m_gl.vertexAttribP1ui(index, type, normalized, value);
 }
 
@@ -6496,6 +8280,8 @@ void CallLogWrapper::glVertexAttribP1uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP1uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribP1uiv", 4).addUint(index).addHex(type).addBoolean(normalized).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.vertexAttribP1uiv(index, type, normalized, value);
 }
 
@@ -6503,6 +8289,8 @@ void CallLogWrapper::glVertexAttribP2ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP2ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribP2ui", 4).addUint(index).addHex(type).addBoolean(normalized).addUint(value);
 	m_gl.vertexAttribP2ui(index, type, normalized, value);
 }
 
@@ -6510,6 +8298,8 @@ void CallLogWrapper::glVertexAttribP2uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP2uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribP2uiv", 4).addUint(index).addHex(type).addBoolean(normalized).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.vertexAttribP2uiv(index, type, normalized, value);
 }
 
@@ -6517,6 +8307,8 @@ void CallLogWrapper::glVertexAttribP3ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP3ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribP3ui", 4).addUint(index).addHex(type).addBoolean(normalized).addUint(value);
 	m_gl.vertexAttribP3ui(index, type, normalized, value);
 }
 
@@ -6524,6 +8316,8 @@ void CallLogWrapper::glVertexAttribP3uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP3uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribP3uiv", 4).addUint(index).addHex(type).addBoolean(normalized).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.vertexAttribP3uiv(index, type, normalized, value);
 }
 
@@ -6531,6 +8325,8 @@ void CallLogWrapper::glVertexAttribP4ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP4ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribP4ui", 4).addUint(index).addHex(type).addBoolean(normalized).addUint(value);
 	m_gl.vertexAttribP4ui(index, type, normalized, value);
 }
 
@@ -6538,6 +8334,8 @@ void CallLogWrapper::glVertexAttribP4uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP4uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribP4uiv", 4).addUint(index).addHex(type).addBoolean(normalized).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(value)));
 	m_gl.vertexAttribP4uiv(index, type, normalized, value);
 }
 
@@ -6545,6 +8343,8 @@ void CallLogWrapper::glVertexAttribPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexAttribPointer", 6).addUint(index).addInt(size).addHex(type).addBoolean(normalized).addInt(stride).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer)));
 	m_gl.vertexAttribPointer(index, size, type, normalized, stride, pointer);
 }
 
@@ -6552,6 +8352,8 @@ void CallLogWrapper::glVertexBindingDivisor (glw::GLuint bindingindex, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexBindingDivisor(" << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glVertexBindingDivisor", 2).addUint(bindingindex).addUint(divisor);
 	m_gl.vertexBindingDivisor(bindingindex, divisor);
 }
 
@@ -6559,6 +8361,8 @@ void CallLogWrapper::glViewport (glw::GLint x, glw::GLint y, glw::GLsizei width,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewport(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glViewport", 4).addInt(x).addInt(y).addInt(width).addInt(height);
 	m_gl.viewport(x, y, width, height);
 }
 
@@ -6566,6 +8370,8 @@ void CallLogWrapper::glViewportArrayv (glw::GLuint first, glw::GLsizei count, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glViewportArrayv", 3).addUint(first).addInt(count).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.viewportArrayv(first, count, v);
 }
 
@@ -6573,6 +8379,8 @@ void CallLogWrapper::glViewportIndexedf (glw::GLuint index, glw::GLfloat x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportIndexedf(" << index << ", " << x << ", " << y << ", " << w << ", " << h << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glViewportIndexedf", 5).addUint(index).addFloat(x).addFloat(y).addFloat(w).addFloat(h);
 	m_gl.viewportIndexedf(index, x, y, w, h);
 }
 
@@ -6580,6 +8388,8 @@ void CallLogWrapper::glViewportIndexedfv (glw::GLuint index, const glw::GLfloat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportIndexedfv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glViewportIndexedfv", 2).addUint(index).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(v)));
 	m_gl.viewportIndexedfv(index, v);
 }
 
@@ -6587,5 +8397,7 @@ void CallLogWrapper::glWaitSync (glw::GLsync sync, glw::GLbitfield flags, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
+	if (m_enableTrace)
+		m_trace.beginCall("glWaitSync", 3).addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(sync))).addHex(flags).addUint(timeout);
 	m_gl.waitSync(sync, flags, timeout);
 }
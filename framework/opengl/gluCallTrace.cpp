@@ -0,0 +1,269 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary GL call trace.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluCallTrace.hpp"
+#include "gluStrUtil.hpp"
+#include "tcuFormatUtil.hpp"
+#include "deRandom.hpp"
+
+#include <sstream>
+#include <deque>
+
+namespace glu
+{
+
+// \note Name word of zero marks the point where the writer wrapped around.
+
+CallTrace::CallTrace (void)
+	: m_readPos			(0)
+	, m_writePos		(0)
+	, m_numCalls		(0)
+	, m_curHeaderPos	(0)
+	, m_curArgPos		(0)
+{
+}
+
+CallTrace::~CallTrace (void)
+{
+}
+
+void CallTrace::setSize (size_t numWords)
+{
+	DE_ASSERT(numWords == 0 || numWords >= MIN_BUFFER_SIZE);
+
+	m_buffer.resize(numWords);
+	clear();
+}
+
+void CallTrace::clear (void)
+{
+	m_readPos		= 0;
+	m_writePos		= 0;
+	m_numCalls		= 0;
+	m_curHeaderPos	= 0;
+	m_curArgPos		= 0;
+}
+
+void CallTrace::dropOldest (void)
+{
+	DE_ASSERT(m_numCalls > 0);
+
+	m_readPos	+= HEADER_SIZE + (size_t)(m_buffer[m_readPos + 1] & ((1u << ARG_COUNT_BITS) - 1));
+	m_numCalls	-= 1;
+
+	if (m_numCalls > 0 && (m_readPos == m_buffer.size() || m_buffer[m_readPos] == 0))
+		m_readPos = 0;
+}
+
+void CallTrace::makeRoom (size_t callSize)
+{
+	if (m_writePos + callSize > m_buffer.size())
+	{
+		// Drop calls between write position and end of buffer, then wrap.
+		while (m_numCalls > 0 && m_readPos >= m_writePos)
+			dropOldest();
+
+		if (m_writePos < m_buffer.size())
+			m_buffer[m_writePos] = 0;
+
+		m_writePos = 0;
+	}
+
+	while (m_numCalls > 0 && m_readPos >= m_writePos && m_readPos < m_writePos + callSize)
+		dropOldest();
+}
+
+void CallTrace::decode (std::vector<std::string>& dst) const
+{
+	size_t pos = m_readPos;
+
+	for (size_t callNdx = 0; callNdx < m_numCalls; callNdx++)
+	{
+		if (pos == m_buffer.size() || m_buffer[pos] == 0)
+			pos = 0;
+
+		const char*			name		= (const char*)(deUintptr)m_buffer[pos];
+		const deUint64		header		= m_buffer[pos + 1];
+		const int			numArgs		= (int)(header & ((1u << ARG_COUNT_BITS) - 1));
+		std::ostringstream	str;
+
+		str << name << "(";
+
+		for (int argNdx = 0; argNdx < numArgs; argNdx++)
+		{
+			const ArgType	type	= (ArgType)((header >> (ARG_COUNT_BITS + argNdx*ARG_TYPE_BITS)) & ((1u << ARG_TYPE_BITS) - 1));
+			const deUint64	value	= m_buffer[pos + HEADER_SIZE + argNdx];
+
+			if (argNdx > 0)
+				str << ", ";
+
+			switch (type)
+			{
+				case ARGTYPE_INT:		str << (deInt64)value;											break;
+				case ARGTYPE_UINT:		str << value;													break;
+				case ARGTYPE_HEX:		str << tcu::toHex((deUint32)value).toString();					break;
+				case ARGTYPE_BOOLEAN:	str << getBooleanStr((int)value);								break;
+				case ARGTYPE_POINTER:	str << tcu::toHex((deUintptr)value).toString();					break;
+
+				case ARGTYPE_FLOAT:
+				{
+					const deUint32	bits	= (deUint32)value;
+					float			fValue;
+					deMemcpy(&fValue, &bits, sizeof(fValue));
+					str << fValue;
+					break;
+				}
+
+				case ARGTYPE_DOUBLE:
+				{
+					double dValue;
+					deMemcpy(&dValue, &value, sizeof(dValue));
+					str << dValue;
+					break;
+				}
+
+				default:
+					DE_ASSERT(false);
+			}
+		}
+
+		str << ");";
+		dst.push_back(str.str());
+
+		pos += HEADER_SIZE + (size_t)numArgs;
+	}
+}
+
+namespace
+{
+
+struct RefCall
+{
+	size_t		pos;
+	size_t		size;
+	std::string	text;
+};
+
+bool overlaps (const RefCall& call, size_t pos, size_t size)
+{
+	return call.pos < pos + size && pos < call.pos + call.size;
+}
+
+} // anonymous
+
+void CallTrace_selfTest (void)
+{
+	// Formatting of argument types.
+	{
+		CallTrace					trace;
+		std::vector<std::string>	calls;
+
+		trace.setSize(CallTrace::MIN_BUFFER_SIZE);
+		trace.beginCall("glFoo", 5).addInt(-3).addUint(7).addHex(0x1f).addBoolean(1).addFloat(0.5f);
+		trace.decode(calls);
+
+		TCU_CHECK(calls.size() == 1);
+		TCU_CHECK(calls[0] == "glFoo(-3, 7, 0x0000001f, GL_TRUE, 0.5);");
+	}
+
+	// Wrap-around and dropping of oldest calls, compared against a model that tracks call placement.
+	{
+		static const char* const	names[]			= { "glA", "glB", "glC", "glD" };
+		static const size_t			bufferSizes[]	= { CallTrace::MIN_BUFFER_SIZE, 37, 64, 1000 };
+		de::Random					rnd				(0x3a9c21f);
+
+		for (int sizeNdx = 0; sizeNdx < DE_LENGTH_OF_ARRAY(bufferSizes); sizeNdx++)
+		{
+			const size_t				bufferSize	= bufferSizes[sizeNdx];
+			CallTrace					trace;
+			std::deque<RefCall>			reference;
+			size_t						writePos	= 0;
+			std::vector<std::string>	calls;
+
+			trace.setSize(bufferSize);
+
+			for (int iterNdx = 0; iterNdx < 5000; iterNdx++)
+			{
+				if (rnd.getInt(0, 999) == 0)
+				{
+					trace.clear();
+					reference.clear();
+					writePos = 0;
+				}
+
+				const int			numArgs	= rnd.getInt(0, CallTrace::MAX_ARGS);
+				const char* const	name	= rnd.choose<const char*>(DE_ARRAY_BEGIN(names), DE_ARRAY_END(names));
+				std::ostringstream	text;
+				RefCall				call;
+
+				call.size	= CallTrace::HEADER_SIZE + (size_t)numArgs;
+				call.pos	= writePos + call.size > bufferSize ? 0 : writePos;
+
+				// Calls overwritten by this one, or left behind at the end of the buffer when wrapping, are dropped.
+				while (!reference.empty() && (overlaps(reference.front(), call.pos, call.size) || (call.pos != writePos && reference.front().pos >= writePos)))
+					reference.pop_front();
+
+				for (size_t refNdx = 0; refNdx < reference.size(); refNdx++)
+					TCU_CHECK(!overlaps(reference[refNdx], call.pos, call.size));
+
+				trace.beginCall(name, numArgs);
+				text << name << "(";
+
+				for (int argNdx = 0; argNdx < numArgs; argNdx++)
+				{
+					if (argNdx > 0)
+						text << ", ";
+
+					if (rnd.getBool())
+					{
+						const deInt64 value = (deInt64)rnd.getInt(-1000, 1000);
+						trace.addInt(value);
+						text << value;
+					}
+					else
+					{
+						const deUint64 value = rnd.getUint64();
+						trace.addUint(value);
+						text << value;
+					}
+				}
+
+				text << ");";
+				call.text	= text.str();
+				writePos	= call.pos + call.size;
+				reference.push_back(call);
+
+				calls.clear();
+				trace.decode(calls);
+
+				TCU_CHECK(trace.getNumCalls() == reference.size());
+				TCU_CHECK(calls.size() == reference.size());
+
+				for (size_t callNdx = 0; callNdx < calls.size(); callNdx++)
+					TCU_CHECK(calls[callNdx] == reference[callNdx].text);
+			}
+		}
+	}
+}
+
+} // glu
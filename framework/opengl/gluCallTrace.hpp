@@ -0,0 +1,152 @@
+#ifndef _GLUCALLTRACE_HPP
+#define _GLUCALLTRACE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary GL call trace.
+ *//*--------------------------------------------------------------------*/
+
+#include "gluDefs.hpp"
+#include "deMemory.h"
+
+#include <string>
+#include <vector>
+
+namespace glu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Ring buffer of recent calls with raw arguments
+ *
+ * Each call takes two words for the function name and argument types
+ * plus a word per argument. Once the buffer is full the oldest calls are
+ * dropped. Recording does no formatting; calls are turned into text only
+ * when decode() is called.
+ *
+ * Pointer arguments are recorded by address only, so the data they point
+ * to is not available when decoding.
+ *//*--------------------------------------------------------------------*/
+class CallTrace
+{
+public:
+	enum ArgType
+	{
+		ARGTYPE_INT = 0,
+		ARGTYPE_UINT,
+		ARGTYPE_HEX,
+		ARGTYPE_BOOLEAN,
+		ARGTYPE_FLOAT,
+		ARGTYPE_DOUBLE,
+		ARGTYPE_POINTER,
+
+		ARGTYPE_LAST
+	};
+
+	enum
+	{
+		ARG_TYPE_BITS		= 3,
+		ARG_COUNT_BITS		= 8,
+		MAX_ARGS			= (64 - ARG_COUNT_BITS) / ARG_TYPE_BITS,
+		HEADER_SIZE			= 2,									//!< Name and argument count & types.
+		MIN_BUFFER_SIZE		= HEADER_SIZE + MAX_ARGS
+	};
+
+							CallTrace			(void);
+							~CallTrace			(void);
+
+	//! Set buffer size in 64-bit words, clears recorded calls.
+	void					setSize				(size_t numWords);
+	void					clear				(void);
+
+	size_t					getSize				(void) const { return m_buffer.size();	}
+	size_t					getNumCalls			(void) const { return m_numCalls;		}
+
+	//! Start recording a call, followed by exactly numArgs add*() calls. Name must be a string literal.
+	inline CallTrace&		beginCall			(const char* name, int numArgs);
+
+	CallTrace&				addInt				(deInt64 value)		{ return addArg(ARGTYPE_INT, (deUint64)value);					}
+	CallTrace&				addUint				(deUint64 value)	{ return addArg(ARGTYPE_UINT, value);							}
+	CallTrace&				addHex				(deUint32 value)	{ return addArg(ARGTYPE_HEX, value);							}
+	CallTrace&				addBoolean			(deUint8 value)		{ return addArg(ARGTYPE_BOOLEAN, value);						}
+	CallTrace&				addFloat			(float value)		{ deUint32 bits; deMemcpy(&bits, &value, sizeof(bits)); return addArg(ARGTYPE_FLOAT, bits);		}
+	CallTrace&				addDouble			(double value)		{ deUint64 bits; deMemcpy(&bits, &value, sizeof(bits)); return addArg(ARGTYPE_DOUBLE, bits);	}
+	CallTrace&				addPointer			(deUintptr value)	{ return addArg(ARGTYPE_POINTER, (deUint64)value);				}
+
+	//! Append recorded calls as text, oldest first.
+	void					decode				(std::vector<std::string>& dst) const;
+
+private:
+							CallTrace			(const CallTrace& other);
+	CallTrace&				operator=			(const CallTrace& other);
+
+	inline CallTrace&		addArg				(ArgType type, deUint64 value);
+	void					makeRoom			(size_t callSize);
+	void					dropOldest			(void);
+
+	std::vector<deUint64>	m_buffer;
+	size_t					m_readPos;			//!< Start of oldest call.
+	size_t					m_writePos;			//!< Start of next call.
+	size_t					m_numCalls;
+	size_t					m_curHeaderPos;
+	size_t					m_curArgPos;
+};
+
+inline CallTrace& CallTrace::beginCall (const char* name, int numArgs)
+{
+	const size_t callSize = HEADER_SIZE + (size_t)numArgs;
+
+	DE_ASSERT(name && de::inBounds(numArgs, 0, (int)MAX_ARGS + 1));
+	DE_ASSERT(m_buffer.size() >= MIN_BUFFER_SIZE);
+	DE_ASSERT(m_curArgPos == m_writePos); // Previous call must be complete.
+
+	// Slow path: wrap around or drop calls overwritten by this one.
+	if (m_writePos + callSize > m_buffer.size() || (m_numCalls > 0 && m_readPos >= m_writePos && m_readPos < m_writePos + callSize))
+		makeRoom(callSize);
+
+	if (m_numCalls == 0)
+		m_readPos = m_writePos;
+
+	m_buffer[m_writePos]		= (deUint64)(deUintptr)name;
+	m_buffer[m_writePos + 1]	= (deUint64)numArgs;
+	m_curHeaderPos				= m_writePos + 1;
+	m_curArgPos					= m_writePos + HEADER_SIZE;
+	m_writePos					+= callSize;
+	m_numCalls					+= 1;
+
+	return *this;
+}
+
+inline CallTrace& CallTrace::addArg (ArgType type, deUint64 value)
+{
+	const int argNdx = (int)(m_curArgPos - m_curHeaderPos - 1);
+
+	DE_ASSERT(m_curArgPos < m_writePos);
+
+	m_buffer[m_curHeaderPos]	|= (deUint64)type << (ARG_COUNT_BITS + argNdx*ARG_TYPE_BITS);
+	m_buffer[m_curArgPos++]		= value;
+
+	return *this;
+}
+
+void CallTrace_selfTest (void);
+
+} // glu
+
+#endif // _GLUCALLTRACE_HPP
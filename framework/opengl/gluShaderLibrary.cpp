@@ -26,10 +26,14 @@
 #include "tcuStringTemplate.hpp"
 #include "tcuResource.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuCommandLine.hpp"
 
 #include "deStringUtil.hpp"
 #include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
 #include "deFilePath.hpp"
+#include "deMutex.hpp"
+#include "deThread.hpp"
 
 #include "glwEnums.hpp"
 
@@ -56,6 +60,7 @@ using std::map;
 using std::ostringstream;
 using std::pair;
 using de::UniquePtr;
+using de::SharedPtr;
 
 // Specification
 
@@ -275,13 +280,48 @@ DE_INLINE deBool isCaseNameChar (char c)
 	return deInRange32(c, 'a', 'z') || deInRange32(c, 'A', 'Z') || deInRange32(c, '0', '9') || (c == '_') || (c == '-') || (c == '.');
 }
 
+struct ParsedNode;
+
+typedef vector<SharedPtr<const ParsedNode> > ParsedNodeList;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Parsed shader library node
+ *
+ * Parser produces a tree of plain specifications instead of test nodes, so
+ * that parsing doesn't depend on the case factory and can be done ahead of
+ * time on any thread.
+ *//*--------------------------------------------------------------------*/
+struct ParsedNode
+{
+	enum Type
+	{
+		TYPE_GROUP = 0,
+		TYPE_CASE,
+
+		TYPE_LAST
+	};
+
+	Type						type;
+	string						name;
+	string						description;
+	ShaderCaseSpecification		spec;		//!< Valid for TYPE_CASE only
+	ParsedNodeList				children;	//!< Valid for TYPE_GROUP only
+
+	ParsedNode (Type type_, const string& name_, const string& description_)
+		: type			(type_)
+		, name			(name_)
+		, description	(description_)
+	{
+	}
+};
+
 class ShaderParser
 {
 public:
-							ShaderParser			(const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory);
+							ShaderParser			(const tcu::Archive& archive, const std::string& filename);
 							~ShaderParser			(void);
 
-	vector<tcu::TestNode*>	parse					(void);
+	ParsedNodeList			parse					(void);
 
 private:
 	enum Token
@@ -387,15 +427,15 @@ private:
 	void						parseFormat					(DataType& format);
 	void						parseGLSLVersion			(glu::GLSLVersion& version);
 	void						parsePipelineProgram		(ProgramSpecification& program);
-	void						parseShaderCase				(vector<tcu::TestNode*>& shaderNodeList);
-	void						parseShaderGroup			(vector<tcu::TestNode*>& shaderNodeList);
-	void						parseImport					(vector<tcu::TestNode*>& shaderNodeList);
+	void						parseShaderCase				(ParsedNodeList& shaderNodeList);
+	void						parseShaderGroup			(ParsedNodeList& shaderNodeList);
+	void						parseImport					(ParsedNodeList& shaderNodeList);
+
+	static void					addCase						(ParsedNodeList& shaderNodeList, const string& name, const string& description, const ShaderCaseSpecification& spec);
 
 	const tcu::Archive&			m_archive;
 	const string				m_filename;
-	ShaderCaseFactory* const	m_caseFactory;
 
-	UniquePtr<tcu::Resource>	m_resource;
 	vector<char>				m_input;
 
 	const char*					m_curPtr;
@@ -403,14 +443,20 @@ private:
 	std::string					m_curTokenStr;
 };
 
-ShaderParser::ShaderParser (const tcu::Archive& archive, const string& filename, ShaderCaseFactory* caseFactroy)
+ShaderParser::ShaderParser (const tcu::Archive& archive, const string& filename)
 	: m_archive			(archive)
 	, m_filename		(filename)
-	, m_caseFactory		(caseFactroy)
-	, m_resource		(archive.getResource(m_filename.c_str()))
 	, m_curPtr			(DE_NULL)
 	, m_curToken		(TOKEN_LAST)
 {
+	const UniquePtr<tcu::Resource>	resource	(archive.getResource(m_filename.c_str()));
+	const int						dataLen		= resource->getSize();
+
+	m_input.resize(dataLen+1);
+	resource->setPosition(0);
+	resource->read((deUint8*)&m_input[0], dataLen);
+	m_input[dataLen] = '\0';
+
 }
 
 ShaderParser::~ShaderParser (void)
@@ -1328,7 +1374,15 @@ void ShaderParser::parsePipelineProgram (ProgramSpecification& program)
 		parseError("program pipeline object must have active stages");
 }
 
-void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
+void ShaderParser::addCase (ParsedNodeList& shaderNodeList, const string& name, const string& description, const ShaderCaseSpecification& spec)
+{
+	ParsedNode* const node = new ParsedNode(ParsedNode::TYPE_CASE, name, description);
+
+	shaderNodeList.push_back(SharedPtr<const ParsedNode>(node));
+	node->spec = spec;
+}
+
+void ShaderParser::parseShaderCase (ParsedNodeList& shaderNodeList)
 {
 	// Parse 'case'.
 	PARSE_DBG(("  parseShaderCase()\n"));
@@ -1468,7 +1522,7 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 			spec.programs[0].sources << VertexSource(bothSource);
 			spec.programs[0].requiredExtensions	= requiredExts;
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName + "_vertex", description, ShaderCaseSpecification(spec)));
+			addCase(shaderNodeList, caseName + "_vertex", description, spec);
 		}
 
 		// fragment
@@ -1484,7 +1538,7 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 			spec.programs[0].sources << FragmentSource(bothSource);
 			spec.programs[0].requiredExtensions	= requiredExts;
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName + "_fragment", description, ShaderCaseSpecification(spec)));
+			addCase(shaderNodeList, caseName + "_fragment", description, spec);
 		}
 	}
 	else if (pipelinePrograms.empty())
@@ -1506,7 +1560,7 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 		spec.programs[0].sources.sources[SHADERTYPE_GEOMETRY].swap(geometrySources);
 		spec.programs[0].requiredExtensions.swap(requiredExts);
 
-		shaderNodeList.push_back(m_caseFactory->createCase(caseName, description, ShaderCaseSpecification(spec)));
+		addCase(shaderNodeList, caseName, description, spec);
 	}
 	else
 	{
@@ -1533,12 +1587,12 @@ void ShaderParser::parseShaderCase (vector<tcu::TestNode*>& shaderNodeList)
 
 			spec.programs.swap(pipelinePrograms);
 
-			shaderNodeList.push_back(m_caseFactory->createCase(caseName, description, ShaderCaseSpecification(spec)));
+			addCase(shaderNodeList, caseName, description, spec);
 		}
 	}
 }
 
-void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
+void ShaderParser::parseShaderGroup (ParsedNodeList& shaderNodeList)
 {
 	// Parse 'case'.
 	PARSE_DBG(("  parseShaderGroup()\n"));
@@ -1553,7 +1607,10 @@ void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
 	string description = parseStringLiteral(m_curTokenStr.c_str());
 	advanceToken(TOKEN_STRING);
 
-	std::vector<tcu::TestNode*> children;
+	ParsedNode* const	groupNode	= new ParsedNode(ParsedNode::TYPE_GROUP, name, description);
+	ParsedNodeList&		children	= groupNode->children;
+
+	shaderNodeList.push_back(SharedPtr<const ParsedNode>(groupNode));
 
 	// Parse group children.
 	for (;;)
@@ -1571,13 +1628,9 @@ void ShaderParser::parseShaderGroup (vector<tcu::TestNode*>& shaderNodeList)
 	}
 
 	advanceToken(TOKEN_END); // group end
-
-	// Create group node.
-	tcu::TestCaseGroup* groupNode = m_caseFactory->createGroup(name, description, children);
-	shaderNodeList.push_back(groupNode);
 }
 
-void ShaderParser::parseImport (vector<tcu::TestNode*>& shaderNodeList)
+void ShaderParser::parseImport (ParsedNodeList& shaderNodeList)
 {
 	std::string	importFileName;
 
@@ -1588,30 +1641,22 @@ void ShaderParser::parseImport (vector<tcu::TestNode*>& shaderNodeList)
 	advanceToken(TOKEN_STRING);
 
 	{
-		ShaderParser					subParser		(m_archive, de::FilePath::join(de::FilePath(m_filename).getDirName(), importFileName).getPath(), m_caseFactory);
-		const vector<tcu::TestNode*>	importedCases = subParser.parse();
+		ShaderParser			subParser		(m_archive, de::FilePath::join(de::FilePath(m_filename).getDirName(), importFileName).getPath());
+		const ParsedNodeList	importedCases	= subParser.parse();
 
-		// \todo [2015-08-03 pyry] Not exception safe
 		shaderNodeList.insert(shaderNodeList.end(), importedCases.begin(), importedCases.end());
 	}
 }
 
-vector<tcu::TestNode*> ShaderParser::parse (void)
+ParsedNodeList ShaderParser::parse (void)
 {
-	const int	dataLen		= m_resource->getSize();
-
-	m_input.resize(dataLen+1);
-	m_resource->setPosition(0);
-	m_resource->read((deUint8*)&m_input[0], dataLen);
-	m_input[dataLen] = '\0';
-
 	// Initialize parser.
 	m_curPtr		= &m_input[0];
 	m_curToken		= TOKEN_INVALID;
 	m_curTokenStr	= "";
 	advanceToken();
 
-	vector<tcu::TestNode*> nodeList;
+	ParsedNodeList nodeList;
 
 	// Parse all cases.
 	PARSE_DBG(("parse()\n"));
@@ -1634,11 +1679,191 @@ vector<tcu::TestNode*> ShaderParser::parse (void)
 	return nodeList;
 }
 
+// Parsed file cache
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Cache of files parsed ahead of time
+ *
+ * Entries are keyed by file name. An entry is handed out and removed when
+ * the group created from the file is initialized; afterwards the test
+ * nodes own copies of the specifications and the parse tree is released.
+ *//*--------------------------------------------------------------------*/
+class ParsedFileCache
+{
+public:
+	static ParsedFileCache&			getInstance		(void);
+
+	void							store			(const string& filename, const ParsedNodeList& nodes);
+	bool							take			(const string& filename, ParsedNodeList& dst);
+	bool							contains		(const string& filename);
+
+private:
+									ParsedFileCache	(void) {}
+
+	typedef map<string, ParsedNodeList> EntryMap;
+
+	de::Mutex						m_lock;
+	EntryMap						m_entries;
+};
+
+ParsedFileCache& ParsedFileCache::getInstance (void)
+{
+	static ParsedFileCache s_instance;
+	return s_instance;
+}
+
+void ParsedFileCache::store (const string& filename, const ParsedNodeList& nodes)
+{
+	const de::ScopedLock lock (m_lock);
+	m_entries[filename] = nodes;
+}
+
+bool ParsedFileCache::take (const string& filename, ParsedNodeList& dst)
+{
+	const de::ScopedLock	lock	(m_lock);
+	EntryMap::iterator		pos		= m_entries.find(filename);
+
+	if (pos == m_entries.end())
+		return false;
+
+	dst.swap(pos->second);
+	m_entries.erase(pos);
+
+	return true;
+}
+
+bool ParsedFileCache::contains (const string& filename)
+{
+	const de::ScopedLock lock (m_lock);
+	return m_entries.find(filename) != m_entries.end();
+}
+
+class ParseThread : public de::Thread
+{
+public:
+	ParseThread (const tcu::Archive& archive, const vector<string>& filenames, de::Mutex& queueLock, size_t& nextNdx)
+		: m_archive		(archive)
+		, m_filenames	(filenames)
+		, m_queueLock	(queueLock)
+		, m_nextNdx		(nextNdx)
+	{
+	}
+
+	void run (void)
+	{
+		for (;;)
+		{
+			size_t fileNdx;
+
+			{
+				const de::ScopedLock lock (m_queueLock);
+
+				if (m_nextNdx >= m_filenames.size())
+					break;
+
+				fileNdx = m_nextNdx++;
+			}
+
+			// \note Errors are not reported here. Failed files are simply not
+			//		 cached and parseFile() will re-parse and report them.
+			try
+			{
+				ShaderParser			parser	(m_archive, m_filenames[fileNdx]);
+				const ParsedNodeList	nodes	= parser.parse();
+
+				ParsedFileCache::getInstance().store(m_filenames[fileNdx], nodes);
+			}
+			catch (const std::exception&)
+			{
+			}
+		}
+	}
+
+private:
+	const tcu::Archive&		m_archive;
+	const vector<string>&	m_filenames;
+	de::Mutex&				m_queueLock;
+	size_t&					m_nextNdx;
+};
+
+static tcu::TestNode* createNode (const ParsedNode& node, ShaderCaseFactory* caseFactory);
+
+static vector<tcu::TestNode*> createNodes (const ParsedNodeList& nodes, ShaderCaseFactory* caseFactory)
+{
+	vector<tcu::TestNode*> testNodes;
+
+	testNodes.reserve(nodes.size());
+
+	try
+	{
+		for (size_t ndx = 0; ndx < nodes.size(); ++ndx)
+			testNodes.push_back(createNode(*nodes[ndx], caseFactory));
+	}
+	catch (...)
+	{
+		for (size_t ndx = 0; ndx < testNodes.size(); ++ndx)
+			delete testNodes[ndx];
+		throw;
+	}
+
+	return testNodes;
+}
+
+static tcu::TestNode* createNode (const ParsedNode& node, ShaderCaseFactory* caseFactory)
+{
+	if (node.type == ParsedNode::TYPE_CASE)
+		return caseFactory->createCase(node.name, node.description, node.spec);
+	else
+	{
+		DE_ASSERT(node.type == ParsedNode::TYPE_GROUP);
+		return caseFactory->createGroup(node.name, node.description, createNodes(node.children, caseFactory));
+	}
+}
+
+void prefetchFiles (tcu::TestContext& testCtx, const std::vector<LibraryFile>& files)
+{
+	const tcu::Archive&							archive	= testCtx.getArchive();
+	const de::MovePtr<tcu::CaseListFilter>		filter	(testCtx.getCommandLine().createCaseListFilter(archive));
+	vector<string>								pending;
+
+	// Groups filtered out are never initialized, and their entries would never be released.
+	for (size_t ndx = 0; ndx < files.size(); ++ndx)
+	{
+		if (filter->checkTestGroupName(files[ndx].groupPath.c_str()) && !ParsedFileCache::getInstance().contains(files[ndx].filename))
+			pending.push_back(files[ndx].filename);
+	}
+
+	if (pending.empty())
+		return;
+
+	{
+		const size_t					numThreads	= de::min<size_t>(pending.size(), (size_t)deGetNumAvailableLogicalCores());
+		de::Mutex						queueLock;
+		size_t							nextNdx		= 0;
+		vector<SharedPtr<ParseThread> >	threads;
+
+		for (size_t ndx = 0; ndx < numThreads; ++ndx)
+		{
+			threads.push_back(SharedPtr<ParseThread>(new ParseThread(archive, pending, queueLock, nextNdx)));
+			threads.back()->start();
+		}
+
+		for (size_t ndx = 0; ndx < threads.size(); ++ndx)
+			threads[ndx]->join();
+	}
+}
+
 std::vector<tcu::TestNode*> parseFile (const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory)
 {
-	sl::ShaderParser	parser	(archive, filename, caseFactory);
+	ParsedNodeList nodes;
+
+	if (!ParsedFileCache::getInstance().take(filename, nodes))
+	{
+		sl::ShaderParser parser (archive, filename);
+		nodes = parser.parse();
+	}
 
-	return parser.parse();
+	return createNodes(nodes, caseFactory);
 }
 
 // Execution utilities
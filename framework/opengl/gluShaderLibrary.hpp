@@ -200,7 +200,19 @@ public:
 	virtual tcu::TestCase*		createCase	(const std::string& name, const std::string& description, const ShaderCaseSpecification& spec) = 0;
 };
 
-std::vector<tcu::TestNode*>		parseFile	(const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory);
+std::vector<tcu::TestNode*>		parseFile		(const tcu::Archive& archive, const std::string& filename, ShaderCaseFactory* caseFactory);
+
+struct LibraryFile
+{
+	std::string		filename;
+	std::string		groupPath;	//!< Full path of the test group created from the file.
+
+	LibraryFile (const std::string& filename_, const std::string& groupPath_) : filename(filename_), groupPath(groupPath_) {}
+};
+
+// Parse files concurrently ahead of time. Files whose groups don't pass the case list filter are skipped.
+// Subsequent parseFile() call for each file takes the result without reading the file again.
+void							prefetchFiles	(tcu::TestContext& testCtx, const std::vector<LibraryFile>& files);
 
 // Specialization utilties
 
@@ -386,6 +386,8 @@ ReferenceContext::ReferenceContext (const ReferenceContextLimits& limits, const
 	, m_primitiveRestartIndex			(0)
 
 	, m_lastError						(GL_NO_ERROR)
+
+	, m_fragOpsStateDirty				(true)
 {
 	// Create empty textures to be used when texture objects are incomplete.
 	m_emptyTex1D.getSampler().wrapS		= tcu::Sampler::CLAMP_TO_EDGE;
@@ -2611,10 +2613,13 @@ void ReferenceContext::scissor (int x, int y, int width, int height)
 {
 	RC_IF_ERROR(width < 0 || height < 0, GL_INVALID_VALUE, RC_RET_VOID);
 	m_scissorBox = IVec4(x, y, width, height);
+	m_fragOpsStateDirty = true;
 }
 
 void ReferenceContext::enable (deUint32 cap)
 {
+	m_fragOpsStateDirty = true;
+
 	switch (cap)
 	{
 		case GL_BLEND:					m_blendEnabled				= true;	break;
@@ -2671,6 +2676,8 @@ void ReferenceContext::enable (deUint32 cap)
 
 void ReferenceContext::disable (deUint32 cap)
 {
+	m_fragOpsStateDirty = true;
+
 	switch (cap)
 	{
 		case GL_BLEND:					m_blendEnabled				= false;	break;
@@ -2785,6 +2792,8 @@ void ReferenceContext::stencilFuncSeparate (deUint32 face, deUint32 func, int re
 			m_stencil[type].opMask	= mask;
 		}
 	}
+
+	m_fragOpsStateDirty = true;
 }
 
 void ReferenceContext::stencilOp (deUint32 sfail, deUint32 dpfail, deUint32 dppass)
@@ -2813,12 +2822,15 @@ void ReferenceContext::stencilOpSeparate (deUint32 face, deUint32 sfail, deUint3
 			m_stencil[type].opDepthPass		= dppass;
 		}
 	}
+
+	m_fragOpsStateDirty = true;
 }
 
 void ReferenceContext::depthFunc (deUint32 func)
 {
 	RC_IF_ERROR(!isValidCompareFunc(func), GL_INVALID_ENUM, RC_RET_VOID);
 	m_depthFunc = func;
+	m_fragOpsStateDirty = true;
 }
 
 void ReferenceContext::depthRangef (float n, float f)
@@ -2901,6 +2913,7 @@ void ReferenceContext::blendEquation (deUint32 mode)
 
 	m_blendModeRGB		= mode;
 	m_blendModeAlpha	= mode;
+	m_fragOpsStateDirty	= true;
 }
 
 void ReferenceContext::blendEquationSeparate (deUint32 modeRGB, deUint32 modeAlpha)
@@ -2911,6 +2924,7 @@ void ReferenceContext::blendEquationSeparate (deUint32 modeRGB, deUint32 modeAlp
 
 	m_blendModeRGB		= modeRGB;
 	m_blendModeAlpha	= modeAlpha;
+	m_fragOpsStateDirty	= true;
 }
 
 void ReferenceContext::blendFunc (deUint32 src, deUint32 dst)
@@ -2923,6 +2937,7 @@ void ReferenceContext::blendFunc (deUint32 src, deUint32 dst)
 	m_blendFactorSrcAlpha	= src;
 	m_blendFactorDstRGB		= dst;
 	m_blendFactorDstAlpha	= dst;
+	m_fragOpsStateDirty		= true;
 }
 
 void ReferenceContext::blendFuncSeparate (deUint32 srcRGB, deUint32 dstRGB, deUint32 srcAlpha, deUint32 dstAlpha)
@@ -2937,6 +2952,7 @@ void ReferenceContext::blendFuncSeparate (deUint32 srcRGB, deUint32 dstRGB, deUi
 	m_blendFactorSrcAlpha	= srcAlpha;
 	m_blendFactorDstRGB		= dstRGB;
 	m_blendFactorDstAlpha	= dstAlpha;
+	m_fragOpsStateDirty		= true;
 }
 
 void ReferenceContext::blendColor (float red, float green, float blue, float alpha)
@@ -2945,16 +2961,19 @@ void ReferenceContext::blendColor (float red, float green, float blue, float alp
 						de::clamp(green,	0.0f, 1.0f),
 						de::clamp(blue,	0.0f, 1.0f),
 						de::clamp(alpha,	0.0f, 1.0f));
+	m_fragOpsStateDirty = true;
 }
 
 void ReferenceContext::colorMask (deBool r, deBool g, deBool b, deBool a)
 {
 	m_colorMask = tcu::BVec4(!!r, !!g, !!b, !!a);
+	m_fragOpsStateDirty = true;
 }
 
 void ReferenceContext::depthMask (deBool mask)
 {
 	m_depthMask = !!mask;
+	m_fragOpsStateDirty = true;
 }
 
 void ReferenceContext::stencilMask (deUint32 mask)
@@ -2971,6 +2990,8 @@ void ReferenceContext::stencilMaskSeparate (deUint32 face, deUint32 mask)
 
 	if (setFront)	m_stencil[rr::FACETYPE_FRONT].writeMask	= mask;
 	if (setBack)	m_stencil[rr::FACETYPE_BACK].writeMask	= mask;
+
+	m_fragOpsStateDirty = true;
 }
 
 static int getNumStencilBits (const tcu::TextureFormat& format)
@@ -4294,51 +4315,56 @@ void ReferenceContext::drawWithReference (const rr::PrimitiveList& primitives, i
 													 (m_currentProgram->m_program->m_hasGeometryShader) ? (m_currentProgram->m_program->getGeometryShader()) : (DE_NULL));
 	rr::RenderState						state		((rr::ViewportState)(colorBuf0), m_limits.subpixelBits);
 
-	const rr::Renderer					referenceRenderer;
-	std::vector<rr::VertexAttrib>		vertexAttribs;
-
-	// Gen state
+	// Rebuild fragment operation state only if it has changed since the last draw
+	if (m_fragOpsStateDirty)
 	{
-		const rr::PrimitiveType	baseType							= getPrimitiveBaseType(primitives.getPrimitiveType());
-		const bool				polygonOffsetEnabled				= (baseType == rr::PRIMITIVETYPE_TRIANGLES) ? (m_polygonOffsetFillEnabled) : (false);
+		m_fragOpsState.scissorTestEnabled							= m_scissorEnabled;
+		m_fragOpsState.scissorRectangle								= rr::WindowRectangle(m_scissorBox.x(), m_scissorBox.y(), m_scissorBox.z(), m_scissorBox.w());
 
-		//state.cullMode											= m_cullMode
-
-		state.fragOps.scissorTestEnabled							= m_scissorEnabled;
-		state.fragOps.scissorRectangle								= rr::WindowRectangle(m_scissorBox.x(), m_scissorBox.y(), m_scissorBox.z(), m_scissorBox.w());
-
-		state.fragOps.numStencilBits								= stencilBits;
-		state.fragOps.stencilTestEnabled							= m_stencilTestEnabled;
+		m_fragOpsState.stencilTestEnabled							= m_stencilTestEnabled;
 
 		for (int faceType = 0; faceType < rr::FACETYPE_LAST; faceType++)
 		{
-			state.fragOps.stencilStates[faceType].compMask	= m_stencil[faceType].opMask;
-			state.fragOps.stencilStates[faceType].writeMask	= m_stencil[faceType].writeMask;
-			state.fragOps.stencilStates[faceType].ref		= m_stencil[faceType].ref;
-			state.fragOps.stencilStates[faceType].func		= sglr::rr_util::mapGLTestFunc(m_stencil[faceType].func);
-			state.fragOps.stencilStates[faceType].sFail		= sglr::rr_util::mapGLStencilOp(m_stencil[faceType].opStencilFail);
-			state.fragOps.stencilStates[faceType].dpFail	= sglr::rr_util::mapGLStencilOp(m_stencil[faceType].opDepthFail);
-			state.fragOps.stencilStates[faceType].dpPass	= sglr::rr_util::mapGLStencilOp(m_stencil[faceType].opDepthPass);
+			m_fragOpsState.stencilStates[faceType].compMask		= m_stencil[faceType].opMask;
+			m_fragOpsState.stencilStates[faceType].writeMask	= m_stencil[faceType].writeMask;
+			m_fragOpsState.stencilStates[faceType].ref			= m_stencil[faceType].ref;
+			m_fragOpsState.stencilStates[faceType].func			= sglr::rr_util::mapGLTestFunc(m_stencil[faceType].func);
+			m_fragOpsState.stencilStates[faceType].sFail		= sglr::rr_util::mapGLStencilOp(m_stencil[faceType].opStencilFail);
+			m_fragOpsState.stencilStates[faceType].dpFail		= sglr::rr_util::mapGLStencilOp(m_stencil[faceType].opDepthFail);
+			m_fragOpsState.stencilStates[faceType].dpPass		= sglr::rr_util::mapGLStencilOp(m_stencil[faceType].opDepthPass);
 		}
 
-		state.fragOps.depthTestEnabled								= m_depthTestEnabled;
-		state.fragOps.depthFunc										= sglr::rr_util::mapGLTestFunc(m_depthFunc);
-		state.fragOps.depthMask										= m_depthMask;
+		m_fragOpsState.depthTestEnabled								= m_depthTestEnabled;
+		m_fragOpsState.depthFunc									= sglr::rr_util::mapGLTestFunc(m_depthFunc);
+		m_fragOpsState.depthMask									= m_depthMask;
+
+		m_fragOpsState.blendMode									= m_blendEnabled ? rr::BLENDMODE_STANDARD : rr::BLENDMODE_NONE;
+		m_fragOpsState.blendRGBState.equation						= sglr::rr_util::mapGLBlendEquation(m_blendModeRGB);
+		m_fragOpsState.blendRGBState.srcFunc						= sglr::rr_util::mapGLBlendFunc(m_blendFactorSrcRGB);
+		m_fragOpsState.blendRGBState.dstFunc						= sglr::rr_util::mapGLBlendFunc(m_blendFactorDstRGB);
+		m_fragOpsState.blendAState.equation							= sglr::rr_util::mapGLBlendEquation(m_blendModeAlpha);
+		m_fragOpsState.blendAState.srcFunc							= sglr::rr_util::mapGLBlendFunc(m_blendFactorSrcAlpha);
+		m_fragOpsState.blendAState.dstFunc							= sglr::rr_util::mapGLBlendFunc(m_blendFactorDstAlpha);
+		m_fragOpsState.blendColor									= m_blendColor;
+
+		m_fragOpsState.sRGBEnabled									= m_sRGBUpdateEnabled;
 
-		state.fragOps.blendMode										= m_blendEnabled ? rr::BLENDMODE_STANDARD : rr::BLENDMODE_NONE;
-		state.fragOps.blendRGBState.equation						= sglr::rr_util::mapGLBlendEquation(m_blendModeRGB);
-		state.fragOps.blendRGBState.srcFunc							= sglr::rr_util::mapGLBlendFunc(m_blendFactorSrcRGB);
-		state.fragOps.blendRGBState.dstFunc							= sglr::rr_util::mapGLBlendFunc(m_blendFactorDstRGB);
-		state.fragOps.blendAState.equation							= sglr::rr_util::mapGLBlendEquation(m_blendModeAlpha);
-		state.fragOps.blendAState.srcFunc							= sglr::rr_util::mapGLBlendFunc(m_blendFactorSrcAlpha);
-		state.fragOps.blendAState.dstFunc							= sglr::rr_util::mapGLBlendFunc(m_blendFactorDstAlpha);
-		state.fragOps.blendColor									= m_blendColor;
+		m_fragOpsState.colorMask									= m_colorMask;
+
+		m_fragOpsState.depthClampEnabled							= m_depthClampEnabled;
+
+		m_fragOpsStateDirty											= false;
+	}
 
-		state.fragOps.sRGBEnabled									= m_sRGBUpdateEnabled;
+	// Gen state
+	{
+		const rr::PrimitiveType	baseType							= getPrimitiveBaseType(primitives.getPrimitiveType());
+		const bool				polygonOffsetEnabled				= (baseType == rr::PRIMITIVETYPE_TRIANGLES) ? (m_polygonOffsetFillEnabled) : (false);
 
-		state.fragOps.colorMask										= m_colorMask;
+		//state.cullMode											= m_cullMode
 
-		state.fragOps.depthClampEnabled								= m_depthClampEnabled;
+		state.fragOps												= m_fragOpsState;
+		state.fragOps.numStencilBits								= stencilBits;
 
 		state.viewport.rect											= rr::WindowRectangle(m_viewport.x(), m_viewport.y(), m_viewport.z(), m_viewport.w());
 		state.viewport.zn											= m_depthRangeNear;
@@ -4376,9 +4402,11 @@ void ReferenceContext::drawWithReference (const rr::PrimitiveList& primitives, i
 
 	// gen attributes
 	{
-		rc::VertexArray& vao = (m_vertexArrayBinding) ? (*m_vertexArrayBinding) : (m_clientVertexArray);
+		rc::VertexArray&				vao				= (m_vertexArrayBinding) ? (*m_vertexArrayBinding) : (m_clientVertexArray);
+		std::vector<rr::VertexAttrib>&	vertexAttribs	= m_vertexAttribs;
 
-		vertexAttribs.resize(vao.m_arrays.size());
+		// \note assign() reuses the storage from previous draws
+		vertexAttribs.assign(vao.m_arrays.size(), rr::VertexAttrib());
 		for (size_t ndx = 0; ndx < vao.m_arrays.size(); ++ndx)
 		{
 			if (!vao.m_arrays[ndx].enabled)
@@ -4532,7 +4560,7 @@ void ReferenceContext::drawWithReference (const rr::PrimitiveList& primitives, i
 		}
 	}
 
-	referenceRenderer.drawInstanced(rr::DrawCommand(state, renderTarget, program, (int)vertexAttribs.size(), &vertexAttribs[0], primitives), instanceCount);
+	m_renderer.drawInstanced(rr::DrawCommand(state, renderTarget, program, (int)m_vertexAttribs.size(), &m_vertexAttribs[0], primitives), instanceCount);
 }
 
 deUint32 ReferenceContext::createProgram (ShaderProgram* program)
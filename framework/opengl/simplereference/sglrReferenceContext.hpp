@@ -966,6 +966,13 @@ private:
 	rr::FragmentProcessor						m_fragmentProcessor;
 	std::vector<rr::Fragment>					m_fragmentBuffer;
 	std::vector<float>							m_fragmentDepths;
+
+	// Draw state kept between draws. m_fragOpsState is rebuilt only after
+	// a state setter has marked it dirty.
+	rr::Renderer								m_renderer;
+	std::vector<rr::VertexAttrib>				m_vertexAttribs;
+	rr::FragmentOperationState					m_fragOpsState;
+	bool										m_fragOpsStateDirty;
 } DE_WARN_UNUSED_TYPE;
 
 } // sglr
@@ -48,7 +48,7 @@ int main (int argc, char** argv)
 	{
 		tcu::CommandLine				cmdLine		(argc, argv);
 		tcu::DirArchive					archive		(cmdLine.getArchiveDir());
-		tcu::TestLog					log			(cmdLine.getLogFileName(), cmdLine.getLogFlags());
+		tcu::TestLog					log			(cmdLine.getLogFileName(), cmdLine.getLogSharedRingName(), cmdLine.getLogFlags());
 		de::UniquePtr<tcu::Platform>	platform	(createPlatform());
 		de::UniquePtr<tcu::App>			app			(new tcu::App(*platform, archive, log, cmdLine));
 
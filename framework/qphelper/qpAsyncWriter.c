@@ -0,0 +1,269 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Helper Library
+ * -------------------------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Asynchronous file writer.
+ *//*--------------------------------------------------------------------*/
+
+#include "qpAsyncWriter.h"
+
+#include "deThread.h"
+#include "deSemaphore.h"
+#include "deClock.h"
+#include "deMemory.h"
+
+enum
+{
+	BLOCK_SIZE			= 64*1024,
+	NUM_BLOCKS			= 64,		/* At most 4MiB is queued before the producer stalls.				*/
+	SUBMIT_INTERVAL_US	= 100000	/* Max time data may sit in a partially filled producer block.		*/
+};
+
+typedef enum BlockType_e
+{
+	BLOCKTYPE_DATA = 0,
+	BLOCKTYPE_SYNC,					/* Flush the file and signal syncDone after writing the block.	*/
+	BLOCKTYPE_STOP,					/* Flush the file and terminate the I/O thread.					*/
+
+	BLOCKTYPE_LAST
+} BlockType;
+
+struct qpAsyncWriter_s
+{
+	FILE*				outputFile;
+	deThread			thread;
+
+	deUint8*			blockData;
+	size_t				blockSize[NUM_BLOCKS];
+	BlockType			blockType[NUM_BLOCKS];
+
+	deSemaphore			emptyCount;			/*!< Blocks available to the producer.				*/
+	deSemaphore			fullCount;			/*!< Blocks submitted to the I/O thread.			*/
+	deSemaphore			syncDone;
+
+	/* Producer state. */
+	int					inBlock;
+	deBool				inBlockAcquired;
+	deUint64			inBlockAcquireTime;
+
+	/* I/O thread state. */
+	int					outBlock;
+	volatile deBool		writeFailed;
+};
+
+static void ioThreadFunc (void* arg)
+{
+	qpAsyncWriter*	writer	= (qpAsyncWriter*)arg;
+	deBool			isDirty	= DE_FALSE;
+
+	for (;;)
+	{
+		BlockType	type;
+		size_t		size;
+
+		/* Flush whenever the queue runs dry so that everything submitted so far survives a crash. */
+		if (!deSemaphore_tryDecrement(writer->fullCount))
+		{
+			if (isDirty && fflush(writer->outputFile) != 0)
+				writer->writeFailed = DE_TRUE;
+
+			isDirty = DE_FALSE;
+			deSemaphore_decrement(writer->fullCount);
+		}
+
+		type	= writer->blockType[writer->outBlock];
+		size	= writer->blockSize[writer->outBlock];
+
+		if (size > 0)
+		{
+			if (fwrite(writer->blockData + (size_t)writer->outBlock * BLOCK_SIZE, 1, size, writer->outputFile) != size)
+				writer->writeFailed = DE_TRUE;
+
+			isDirty = DE_TRUE;
+		}
+
+		if (type != BLOCKTYPE_DATA)
+		{
+			if (fflush(writer->outputFile) != 0)
+				writer->writeFailed = DE_TRUE;
+
+			isDirty = DE_FALSE;
+		}
+
+		writer->outBlock = (writer->outBlock + 1) % NUM_BLOCKS;
+		deSemaphore_increment(writer->emptyCount);
+
+		if (type == BLOCKTYPE_SYNC)
+			deSemaphore_increment(writer->syncDone);
+		else if (type == BLOCKTYPE_STOP)
+			break;
+	}
+}
+
+static void acquireBlock (qpAsyncWriter* writer)
+{
+	DE_ASSERT(!writer->inBlockAcquired);
+
+	deSemaphore_decrement(writer->emptyCount);
+
+	writer->blockSize[writer->inBlock]	= 0;
+	writer->inBlockAcquired				= DE_TRUE;
+	writer->inBlockAcquireTime			= deGetMicroseconds();
+}
+
+static void submitBlock (qpAsyncWriter* writer, BlockType type)
+{
+	if (!writer->inBlockAcquired)
+		acquireBlock(writer);
+
+	writer->blockType[writer->inBlock]	= type;
+	writer->inBlock						= (writer->inBlock + 1) % NUM_BLOCKS;
+	writer->inBlockAcquired				= DE_FALSE;
+
+	deSemaphore_increment(writer->fullCount);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Create asynchronous writer for a file
+ * \param outputFile File to write to. Must stay open until the writer
+ *					 has been destroyed and must not be written to directly.
+ * \return Writer instance, or DE_NULL if creation failed
+ *//*--------------------------------------------------------------------*/
+qpAsyncWriter* qpAsyncWriter_create (FILE* outputFile)
+{
+	qpAsyncWriter* writer = (qpAsyncWriter*)deCalloc(sizeof(qpAsyncWriter));
+	if (!writer)
+		return DE_NULL;
+
+	DE_ASSERT(outputFile);
+
+	writer->outputFile	= outputFile;
+	writer->blockData	= (deUint8*)deMalloc((size_t)BLOCK_SIZE * NUM_BLOCKS);
+	writer->emptyCount	= deSemaphore_create(NUM_BLOCKS, DE_NULL);
+	writer->fullCount	= deSemaphore_create(0, DE_NULL);
+	writer->syncDone	= deSemaphore_create(0, DE_NULL);
+
+	if (!writer->blockData || !writer->emptyCount || !writer->fullCount || !writer->syncDone)
+	{
+		qpAsyncWriter_destroy(writer);
+		return DE_NULL;
+	}
+
+	writer->thread = deThread_create(ioThreadFunc, writer, DE_NULL);
+
+	if (!writer->thread)
+	{
+		qpAsyncWriter_destroy(writer);
+		return DE_NULL;
+	}
+
+	return writer;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Write out all pending data and destroy the writer
+ *//*--------------------------------------------------------------------*/
+void qpAsyncWriter_destroy (qpAsyncWriter* writer)
+{
+	DE_ASSERT(writer);
+
+	if (writer->thread)
+	{
+		submitBlock(writer, BLOCKTYPE_STOP);
+		deThread_join(writer->thread);
+		deThread_destroy(writer->thread);
+	}
+
+	if (writer->emptyCount)
+		deSemaphore_destroy(writer->emptyCount);
+
+	if (writer->fullCount)
+		deSemaphore_destroy(writer->fullCount);
+
+	if (writer->syncDone)
+		deSemaphore_destroy(writer->syncDone);
+
+	deFree(writer->blockData);
+	deFree(writer);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Queue data for writing
+ *
+ * Blocks only if the I/O thread has fallen behind by the whole queue.
+ * \return false if the I/O thread has failed to write earlier data
+ *//*--------------------------------------------------------------------*/
+deBool qpAsyncWriter_write (qpAsyncWriter* writer, const void* data, size_t numBytes)
+{
+	const deUint8* src = (const deUint8*)data;
+
+	DE_ASSERT(writer && (data || numBytes == 0));
+
+	while (numBytes > 0)
+	{
+		size_t*	blockSize;
+		size_t	copySize;
+
+		if (!writer->inBlockAcquired)
+			acquireBlock(writer);
+
+		blockSize	= &writer->blockSize[writer->inBlock];
+		copySize	= (numBytes < BLOCK_SIZE - *blockSize) ? numBytes : BLOCK_SIZE - *blockSize;
+
+		deMemcpy(writer->blockData + (size_t)writer->inBlock * BLOCK_SIZE + *blockSize, src, copySize);
+
+		*blockSize	+= copySize;
+		src			+= copySize;
+		numBytes	-= copySize;
+
+		if (*blockSize == BLOCK_SIZE)
+			submitBlock(writer, BLOCKTYPE_DATA);
+	}
+
+	/* Don't let a slowly filling block hold back data for long. */
+	if (writer->inBlockAcquired && deGetMicroseconds() - writer->inBlockAcquireTime >= SUBMIT_INTERVAL_US)
+		submitBlock(writer, BLOCKTYPE_DATA);
+
+	return !writer->writeFailed;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Hand all queued data to the I/O thread without waiting
+ *//*--------------------------------------------------------------------*/
+void qpAsyncWriter_flush (qpAsyncWriter* writer)
+{
+	DE_ASSERT(writer);
+
+	if (writer->inBlockAcquired && writer->blockSize[writer->inBlock] > 0)
+		submitBlock(writer, BLOCKTYPE_DATA);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Wait until all queued data has been written and flushed
+ * \return false if writing any data failed
+ *//*--------------------------------------------------------------------*/
+deBool qpAsyncWriter_sync (qpAsyncWriter* writer)
+{
+	DE_ASSERT(writer);
+
+	submitBlock(writer, BLOCKTYPE_SYNC);
+	deSemaphore_decrement(writer->syncDone);
+
+	return !writer->writeFailed;
+}
@@ -0,0 +1,51 @@
+#ifndef _QPASYNCWRITER_H
+#define _QPASYNCWRITER_H
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Helper Library
+ * -------------------------------------------
+ *
+ * Copyright 2020 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Asynchronous file writer.
+ *
+ * Data written by the producer is collected into fixed-size blocks that
+ * are handed to a dedicated I/O thread. The I/O thread flushes the file
+ * every time it runs out of work, so the file lags behind the producer
+ * only by the I/O still in flight.
+ *
+ * The writer is not thread safe; the producer side must be externally
+ * synchronized.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.h"
+
+#include <stdio.h>
+
+DE_BEGIN_EXTERN_C
+
+typedef struct qpAsyncWriter_s	qpAsyncWriter;
+
+qpAsyncWriter*	qpAsyncWriter_create	(FILE* outputFile);
+void			qpAsyncWriter_destroy	(qpAsyncWriter* writer);
+
+deBool			qpAsyncWriter_write		(qpAsyncWriter* writer, const void* data, size_t numBytes);
+void			qpAsyncWriter_flush		(qpAsyncWriter* writer);
+deBool			qpAsyncWriter_sync		(qpAsyncWriter* writer);
+
+DE_END_EXTERN_C
+
+#endif /* _QPASYNCWRITER_H */
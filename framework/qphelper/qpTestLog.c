@@ -23,6 +23,7 @@
 
 #include "qpTestLog.h"
 #include "qpXmlWriter.h"
+#include "qpAsyncWriter.h"
 #include "qpInfo.h"
 #include "qpDebugOut.h"
 
@@ -31,6 +32,7 @@
 #include "deString.h"
 
 #include "deMutex.h"
+#include "deSharedRing.h"
 
 #if defined(QP_SUPPORT_PNG)
 #	include <png.h>
@@ -128,6 +130,9 @@ struct qpTestLog_s
 
 	/* State protected by lock. */
 	FILE*					outputFile;
+	qpAsyncWriter*			asyncWriter;		/*!< Non-null if log is written by an I/O thread.	*/
+	deSharedRing*			sharedRing;			/*!< Non-null if log is streamed to another process.	*/
+	char*					fallbackFileName;	/*!< Where the log continues if the ring is abandoned.	*/
 	qpXmlWriter*			writer;
 	deBool					isSessionOpen;
 	deBool					isCaseOpen;
@@ -146,6 +151,9 @@ typedef struct qpKeyStringMap_s
 
 static const char* LOG_FORMAT_VERSION = "0.3.4";
 
+/* How long a full shared ring may go unread before the log continues in the fallback file. */
+static const deUint32 SHARED_RING_WRITE_TIMEOUT_MS = 5000;
+
 /* Mapping enum to above strings... */
 static const qpKeyStringMap s_qpTestTypeMap[] =
 {
@@ -257,7 +265,19 @@ DE_STATIC_ASSERT(DE_LENGTH_OF_ARRAY(s_qpShaderTypeMap) == QP_SHADER_TYPE_LAST +
 
 static void qpTestLog_flushFile (qpTestLog* log)
 {
-	DE_ASSERT(log && log->outputFile);
+	DE_ASSERT(log && (log->outputFile || log->sharedRing));
+
+	/* Shared ring data is visible to the consumer as soon as it has been written. */
+	if (log->sharedRing)
+		return;
+
+	/* I/O thread flushes the file once it has written everything handed to it. */
+	if (log->asyncWriter)
+	{
+		qpAsyncWriter_flush(log->asyncWriter);
+		return;
+	}
+
 	fflush(log->outputFile);
 #if (DE_OS == DE_OS_WIN32) && (DE_COMPILER == DE_COMPILER_MSC)
 	/* \todo [petri] Is this really necessary? */
@@ -265,6 +285,108 @@ static void qpTestLog_flushFile (qpTestLog* log)
 #endif
 }
 
+/* Like qpTestLog_flushFile() but also waits for the I/O thread to catch up. */
+static void qpTestLog_syncFile (qpTestLog* log)
+{
+	if (log->sharedRing)
+		return;
+	else if (log->asyncWriter)
+		qpAsyncWriter_sync(log->asyncWriter);
+	else
+		qpTestLog_flushFile(log);
+}
+
+/* Continue the log in the fallback file after the consumer stopped reading the ring. */
+static void qpTestLog_switchToFallbackFile (qpTestLog* log)
+{
+	FILE* outputFile;
+
+	DE_ASSERT(log->sharedRing && !log->outputFile);
+
+	outputFile = log->fallbackFileName ? fopen(log->fallbackFileName, "wb") : DE_NULL;
+	if (!outputFile)
+	{
+		/* Keep the abandoned ring, further writes are dropped. */
+		qpPrintf("ERROR: Unable to open fallback test log file '%s'.\n", log->fallbackFileName ? log->fallbackFileName : "");
+		return;
+	}
+
+	qpPrintf("WARNING: Shared memory log is not being read, continuing log in %s\n", log->fallbackFileName);
+
+	deSharedRing_destroy(log->sharedRing);
+	log->sharedRing	= DE_NULL;
+	log->outputFile	= outputFile;
+}
+
+/* Output callback for XML writer when not writing to file directly. */
+static void qpTestLog_writeOutput (void* userPtr, const char* data, size_t numBytes)
+{
+	qpTestLog* log = (qpTestLog*)userPtr;
+
+	if (log->sharedRing)
+	{
+		const size_t numWritten = deSharedRing_write(log->sharedRing, data, numBytes, SHARED_RING_WRITE_TIMEOUT_MS);
+
+		if (numWritten < numBytes)
+		{
+			qpTestLog_switchToFallbackFile(log);
+
+			if (log->outputFile)
+				fwrite(data + numWritten, 1, numBytes - numWritten, log->outputFile);
+		}
+	}
+	else if (log->asyncWriter)
+		qpAsyncWriter_write(log->asyncWriter, data, numBytes);
+	else
+		fwrite(data, 1, numBytes, log->outputFile);
+}
+
+static void qpTestLog_printf (qpTestLog* log, const char* format, ...)
+{
+	va_list args;
+
+	if (!log->asyncWriter && !log->sharedRing)
+	{
+		va_start(args, format);
+		vfprintf(log->outputFile, format, args);
+		va_end(args);
+	}
+	else
+	{
+		char	buf[256];
+		char*	str		= &buf[0];
+		size_t	strSize	= sizeof(buf);
+
+		for (;;)
+		{
+			int len;
+
+			va_start(args, format);
+			len = deVsprintf(str, strSize, format, args);
+			va_end(args);
+
+			if (len >= 0 && (size_t)len < strSize)
+			{
+				qpTestLog_writeOutput(log, str, (size_t)len);
+				break;
+			}
+
+			/* Truncated, retry with a larger buffer. */
+			if (str != &buf[0])
+				deFree(str);
+
+			strSize	= (len >= 0) ? (size_t)len + 1 : strSize * 2;
+			str		= (char*)deMalloc(strSize);
+
+			if (!str)
+				return;
+		}
+
+		if (str != &buf[0])
+			deFree(str);
+	}
+}
+
 #define QP_LOOKUP_STRING(KEYMAP, KEY)	qpLookupString(KEYMAP, DE_LENGTH_OF_ARRAY(KEYMAP), (int)(KEY))
 
 static const char* qpLookupString (const qpKeyStringMap* keyMap, int keyMapSize, int key)
@@ -305,51 +427,59 @@ static deBool endSession (qpTestLog* log)
 	qpXmlWriter_flush(log->writer);
 
 	/* Write out #endSession. */
-	fprintf(log->outputFile, "\n#endSession\n");
-	qpTestLog_flushFile(log);
+	qpTestLog_printf(log, "\n#endSession\n");
+	qpTestLog_syncFile(log);
 
 	log->isSessionOpen = DE_FALSE;
 
 	return DE_TRUE;
 }
 
-/*--------------------------------------------------------------------*//*!
- * \brief Create a file based logger instance
- * \param fileName Name of the file where to put logs
- * \return qpTestLog instance, or DE_NULL if cannot create file
- *//*--------------------------------------------------------------------*/
-qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
+/* Common part of logger creation. Takes ownership of the output file or ring. */
+static qpTestLog* qpTestLog_create (FILE* outputFile, deSharedRing* sharedRing, deUint32 flags)
 {
 	qpTestLog* log = (qpTestLog*)deCalloc(sizeof(qpTestLog));
 	if (!log)
+	{
+		if (outputFile)
+			fclose(outputFile);
+
+		if (sharedRing)
+			deSharedRing_destroy(sharedRing);
+
 		return DE_NULL;
+	}
 
-	DE_ASSERT(fileName && fileName[0]); /* must have filename. */
+	DE_ASSERT(!outputFile != !sharedRing);
 
 #if defined(DE_DEBUG)
 	ContainerStack_reset(&log->containerStack);
 #endif
 
-	qpPrintf("Writing test log into %s\n", fileName);
+	log->outputFile	= outputFile;
+	log->sharedRing	= sharedRing;
 
-	/* Create output file. */
-	log->outputFile = fopen(fileName, "wb");
-	if (!log->outputFile)
+	if (outputFile && (flags & QP_TEST_LOG_ASYNC))
 	{
-		qpPrintf("ERROR: Unable to open test log output file '%s'.\n", fileName);
-		qpTestLog_destroy(log);
-		return DE_NULL;
+		log->asyncWriter = qpAsyncWriter_create(log->outputFile);
+		if (!log->asyncWriter)
+		{
+			qpPrintf("ERROR: Unable to create asynchronous writer.\n");
+			qpTestLog_destroy(log);
+			return DE_NULL;
+		}
 	}
 
 	log->flags			= flags;
-	log->writer			= qpXmlWriter_createFileWriter(log->outputFile, 0, !(flags & QP_TEST_LOG_NO_FLUSH));
+	log->writer			= (outputFile && !log->asyncWriter) ? qpXmlWriter_createFileWriter(log->outputFile, 0, !(flags & QP_TEST_LOG_NO_FLUSH))
+															: qpXmlWriter_createStreamWriter(qpTestLog_writeOutput, log);
 	log->lock			= deMutex_create(DE_NULL);
 	log->isSessionOpen	= DE_FALSE;
 	log->isCaseOpen		= DE_FALSE;
 
 	if (!log->writer)
 	{
-		qpPrintf("ERROR: Unable to create output XML writer to file '%s'.\n", fileName);
+		qpPrintf("ERROR: Unable to create output XML writer.\n");
 		qpTestLog_destroy(log);
 		return DE_NULL;
 	}
@@ -364,6 +494,65 @@ qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
 	return log;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Create a file based logger instance
+ * \param fileName Name of the file where to put logs
+ * \return qpTestLog instance, or DE_NULL if cannot create file
+ *//*--------------------------------------------------------------------*/
+qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
+{
+	FILE* outputFile;
+
+	DE_ASSERT(fileName && fileName[0]); /* must have filename. */
+
+	qpPrintf("Writing test log into %s\n", fileName);
+
+	/* Create output file. */
+	outputFile = fopen(fileName, "wb");
+	if (!outputFile)
+	{
+		qpPrintf("ERROR: Unable to open test log output file '%s'.\n", fileName);
+		return DE_NULL;
+	}
+
+	return qpTestLog_create(outputFile, DE_NULL, flags);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Create a logger instance streaming to another process
+ * \param ringName Name of a shared ring created by the consuming process
+ * \param fallbackFileName Log file to use if ring is not available
+ * \return qpTestLog instance, or DE_NULL if neither output can be opened
+ *
+ * Log data is readable by the consumer as soon as it has been written,
+ * including after a crash. Flushing flags have no effect on a ring. If
+ * the consumer stops reading, the rest of the log is written to the
+ * fallback file instead.
+ *//*--------------------------------------------------------------------*/
+qpTestLog* qpTestLog_createSharedRingLog (const char* ringName, const char* fallbackFileName, deUint32 flags)
+{
+	deSharedRing*	ring;
+	qpTestLog*		log;
+
+	DE_ASSERT(ringName && ringName[0]);
+
+	ring = deSharedRing_open(ringName);
+	if (!ring)
+	{
+		qpPrintf("WARNING: Unable to attach to shared memory log '%s', falling back to file.\n", ringName);
+		return qpTestLog_createFileLog(fallbackFileName, flags);
+	}
+
+	qpPrintf("Writing test log into shared memory %s\n", ringName);
+
+	log = qpTestLog_create(DE_NULL, ring, flags);
+
+	if (log && fallbackFileName)
+		log->fallbackFileName = deStrdup(fallbackFileName);
+
+	return log;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Log information about test session
  * \param log qpTestLog instance
@@ -378,15 +567,15 @@ deBool qpTestLog_beginSession(qpTestLog* log, const char* additionalSessionInfo)
 		return DE_TRUE;
 
 	/* Write session info. */
-	fprintf(log->outputFile, "#sessionInfo releaseName %s\n", qpGetReleaseName());
-	fprintf(log->outputFile, "#sessionInfo releaseId 0x%08x\n", qpGetReleaseId());
-	fprintf(log->outputFile, "#sessionInfo targetName \"%s\"\n", qpGetTargetName());
+	qpTestLog_printf(log, "#sessionInfo releaseName %s\n", qpGetReleaseName());
+	qpTestLog_printf(log, "#sessionInfo releaseId 0x%08x\n", qpGetReleaseId());
+	qpTestLog_printf(log, "#sessionInfo targetName \"%s\"\n", qpGetTargetName());
 
 	if (strlen(additionalSessionInfo) > 1)
-		fprintf(log->outputFile, "%s\n", additionalSessionInfo);
+		qpTestLog_printf(log, "%s\n", additionalSessionInfo);
 
 	/* Write out #beginSession. */
-	fprintf(log->outputFile, "#beginSession\n");
+	qpTestLog_printf(log, "#beginSession\n");
 	qpTestLog_flushFile(log);
 
 	log->isSessionOpen = DE_TRUE;
@@ -408,12 +597,19 @@ void qpTestLog_destroy (qpTestLog* log)
 	if (log->writer)
 		qpXmlWriter_destroy(log->writer);
 
+	if (log->asyncWriter)
+		qpAsyncWriter_destroy(log->asyncWriter);
+
+	if (log->sharedRing)
+		deSharedRing_destroy(log->sharedRing);
+
 	if (log->outputFile)
 		fclose(log->outputFile);
 
 	if (log->lock)
 		deMutex_destroy(log->lock);
 
+	deFree(log->fallbackFileName);
 	deFree(log);
 }
 
@@ -438,7 +634,7 @@ deBool qpTestLog_startCase (qpTestLog* log, const char* testCasePath, qpTestCase
 
 	/* Flush XML and write out #beginTestCaseResult. */
 	qpXmlWriter_flush(log->writer);
-	fprintf(log->outputFile, "\n#beginTestCaseResult %s\n", testCasePath);
+	qpTestLog_printf(log, "\n#beginTestCaseResult %s\n", testCasePath);
 	if (!(log->flags & QP_TEST_LOG_NO_FLUSH))
 		qpTestLog_flushFile(log);
 
@@ -494,7 +690,7 @@ deBool qpTestLog_endCase (qpTestLog* log, qpTestResult result, const char* resul
 
 	/* Flush XML and write #endTestCaseResult. */
 	qpXmlWriter_flush(log->writer);
-	fprintf(log->outputFile, "\n#endTestCaseResult\n");
+	qpTestLog_printf(log, "\n#endTestCaseResult\n");
 	if (!(log->flags & QP_TEST_LOG_NO_FLUSH))
 		qpTestLog_flushFile(log);
 
@@ -511,7 +707,7 @@ deBool qpTestLog_startTestsCasesTime (qpTestLog* log)
 
 	/* Flush XML and write out #beginTestCaseResult. */
 	qpXmlWriter_flush(log->writer);
-	fprintf(log->outputFile, "\n#beginTestsCasesTime\n");
+	qpTestLog_printf(log, "\n#beginTestsCasesTime\n");
 
 	log->isCaseOpen = DE_TRUE;
 
@@ -544,7 +740,7 @@ deBool qpTestLog_endTestsCasesTime (qpTestLog* log)
 
 	qpXmlWriter_flush(log->writer);
 
-	fprintf(log->outputFile, "\n#endTestsCasesTime\n");
+	qpTestLog_printf(log, "\n#endTestsCasesTime\n");
 
 	log->isCaseOpen = DE_FALSE;
 
@@ -576,8 +772,8 @@ deBool qpTestLog_terminateCase (qpTestLog* log, qpTestResult result)
 
 	/* Flush XML and write #terminateTestCaseResult. */
 	qpXmlWriter_flush(log->writer);
-	fprintf(log->outputFile, "\n#terminateTestCaseResult %s\n", resultStr);
-	qpTestLog_flushFile(log);
+	qpTestLog_printf(log, "\n#terminateTestCaseResult %s\n", resultStr);
+	qpTestLog_syncFile(log);
 
 	log->isCaseOpen = DE_FALSE;
 
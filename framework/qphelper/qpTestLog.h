@@ -135,7 +135,8 @@ typedef enum qpTestLogFlag_e
 {
 	QP_TEST_LOG_EXCLUDE_IMAGES			= (1<<0),		/*!< Do not log images. This reduces log size considerably.			*/
 	QP_TEST_LOG_EXCLUDE_SHADER_SOURCES	= (1<<1),		/*!< Do not log shader sources. Helps to reduce log size further.	*/
-	QP_TEST_LOG_NO_FLUSH				= (1<<2)		/*!< Do not do a fflush after writing the log.						*/
+	QP_TEST_LOG_NO_FLUSH				= (1<<2),		/*!< Do not do a fflush after writing the log.						*/
+	QP_TEST_LOG_ASYNC					= (1<<3)		/*!< Write the log file from a separate I/O thread.				*/
 } qpTestLogFlag;
 
 /* Shader type. */
@@ -196,6 +197,7 @@ typedef struct qpEglConfigInfo_s
 
 
 qpTestLog*		qpTestLog_createFileLog			(const char* fileName, deUint32 flags);
+qpTestLog*		qpTestLog_createSharedRingLog	(const char* ringName, const char* fallbackFileName, deUint32 flags);
 deBool			qpTestLog_beginSession			(qpTestLog* log, const char* additionalSessionInfo);
 void			qpTestLog_destroy				(qpTestLog* log);
 
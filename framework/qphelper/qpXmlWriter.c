@@ -36,6 +36,8 @@
 struct qpXmlWriter_s
 {
 	FILE*				outputFile;
+	qpXmlWriteFunc		writeFunc;			/*!< If set, output goes here instead of outputFile. */
+	void*				writeFuncUserPtr;
 	deBool				flushAfterWrite;
 
 	deBool				xmlPrevIsStartElement;
@@ -43,6 +45,14 @@ struct qpXmlWriter_s
 	int					xmlElementDepth;
 };
 
+static void writeStr (qpXmlWriter* writer, const char* str)
+{
+	if (writer->writeFunc)
+		writer->writeFunc(writer->writeFuncUserPtr, str, strlen(str));
+	else
+		fputs(str, writer->outputFile);
+}
+
 static deBool writeEscaped (qpXmlWriter* writer, const char* str)
 {
 	char		buf[256 + 10];
@@ -107,10 +117,10 @@ static deBool writeEscaped (qpXmlWriter* writer, const char* str)
 			*d++ = *s++;
 
 		/* Write buffer if EOS or buffer full. */
-		if (isEOS || ((d - &buf[0]) >= 4))
+		if (isEOS || ((d - &buf[0]) >= (int)sizeof(buf) - 16))
 		{
 			*d = 0;
-			fprintf(writer->outputFile, "%s", buf);
+			writeStr(writer, buf);
 			d = &buf[0];
 		}
 	} while (!isEOS);
@@ -135,6 +145,20 @@ qpXmlWriter* qpXmlWriter_createFileWriter (FILE* outputFile, deBool useCompressi
 	return writer;
 }
 
+qpXmlWriter* qpXmlWriter_createStreamWriter (qpXmlWriteFunc writeFunc, void* userPtr)
+{
+	qpXmlWriter* writer = (qpXmlWriter*)deCalloc(sizeof(qpXmlWriter));
+	if (!writer)
+		return DE_NULL;
+
+	DE_ASSERT(writeFunc);
+
+	writer->writeFunc			= writeFunc;
+	writer->writeFuncUserPtr	= userPtr;
+
+	return writer;
+}
+
 void qpXmlWriter_destroy (qpXmlWriter* writer)
 {
 	DE_ASSERT(writer);
@@ -146,7 +170,7 @@ static deBool closePending (qpXmlWriter* writer)
 {
 	if (writer->xmlPrevIsStartElement)
 	{
-		fprintf(writer->outputFile, ">\n");
+		writeStr(writer, ">\n");
 		writer->xmlPrevIsStartElement = DE_FALSE;
 	}
 
@@ -164,7 +188,7 @@ deBool qpXmlWriter_startDocument (qpXmlWriter* writer)
 	writer->xmlIsWriting			= DE_TRUE;
 	writer->xmlElementDepth			= 0;
 	writer->xmlPrevIsStartElement	= DE_FALSE;
-	fprintf(writer->outputFile, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+	writeStr(writer, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
 	return DE_TRUE;
 }
 
@@ -189,7 +213,7 @@ deBool qpXmlWriter_writeString (qpXmlWriter* writer, const char* str)
 {
 	if (writer->xmlPrevIsStartElement)
 	{
-		fprintf(writer->outputFile, ">");
+		writeStr(writer, ">");
 		writer->xmlPrevIsStartElement = DE_FALSE;
 	}
 
@@ -202,12 +226,16 @@ deBool qpXmlWriter_startElement(qpXmlWriter* writer, const char* elementName, in
 
 	closePending(writer);
 
-	fprintf(writer->outputFile, "%s<%s", getIndentStr(writer->xmlElementDepth), elementName);
+	writeStr(writer, getIndentStr(writer->xmlElementDepth));
+	writeStr(writer, "<");
+	writeStr(writer, elementName);
 
 	for (ndx = 0; ndx < numAttribs; ndx++)
 	{
 		const qpXmlAttribute* attrib = &attribs[ndx];
-		fprintf(writer->outputFile, " %s=\"", attrib->name);
+		writeStr(writer, " ");
+		writeStr(writer, attrib->name);
+		writeStr(writer, "=\"");
 		switch (attrib->type)
 		{
 			case QP_XML_ATTRIBUTE_STRING:
@@ -229,7 +257,7 @@ deBool qpXmlWriter_startElement(qpXmlWriter* writer, const char* elementName, in
 			default:
 				DE_ASSERT(DE_FALSE);
 		}
-		fprintf(writer->outputFile, "\"");
+		writeStr(writer, "\"");
 	}
 
 	writer->xmlElementDepth++;
@@ -244,11 +272,15 @@ deBool qpXmlWriter_endElement (qpXmlWriter* writer, const char* elementName)
 
 	if (writer->xmlPrevIsStartElement) /* leave flag as-is */
 	{
-		fprintf(writer->outputFile, " />\n");
+		writeStr(writer, " />\n");
 		writer->xmlPrevIsStartElement = DE_FALSE;
 	}
 	else
-		fprintf(writer->outputFile, "</%s>\n", /*getIndentStr(writer->xmlElementDepth),*/ elementName);
+	{
+		writeStr(writer, "</");
+		writeStr(writer, /*getIndentStr(writer->xmlElementDepth),*/ elementName);
+		writeStr(writer, ">\n");
+	}
 
 	return DE_TRUE;
 }
@@ -264,60 +296,51 @@ deBool qpXmlWriter_writeBase64 (qpXmlWriter* writer, const deUint8* data, size_t
 		'0','1','2','3','4','5','6','7','8','9','+','/'
 	};
 
-	int			numWritten	= 0;
 	size_t		srcNdx		= 0;
-	deBool		writeIndent	= DE_TRUE;
 	const char*	indentStr	= getIndentStr(writer->xmlElementDepth);
+	const size_t	indentLen	= strlen(indentStr);
+	char		line[32 + 64 + 2];	/* Indent, 64 chars of data, EOL and terminator. */
 
 	DE_ASSERT(writer && data && (numBytes > 0));
+	DE_ASSERT(indentLen <= 32);
 
 	/* Close and pending writes. */
 	closePending(writer);
 
-	/* Loop all input chars. */
+	deMemcpy(&line[0], indentStr, indentLen);
+
+	/* Write output a line at a time. */
 	while (srcNdx < numBytes)
 	{
-		size_t	numRead = (size_t)deMin32(3, (int)(numBytes - srcNdx));
-		deUint8	s0 = data[srcNdx];
-		deUint8	s1 = (numRead >= 2) ? data[srcNdx+1] : 0;
-		deUint8	s2 = (numRead >= 3) ? data[srcNdx+2] : 0;
-		char	d[5];
+		char* d = &line[indentLen];
 
-		srcNdx += numRead;
+		/* Loop input chars until line is full. */
+		while (srcNdx < numBytes && d < &line[indentLen + 64])
+		{
+			size_t	numRead = (size_t)deMin32(3, (int)(numBytes - srcNdx));
+			deUint8	s0 = data[srcNdx];
+			deUint8	s1 = (numRead >= 2) ? data[srcNdx+1] : 0;
+			deUint8	s2 = (numRead >= 3) ? data[srcNdx+2] : 0;
 
-		d[0] = s_base64Table[s0 >> 2];
-		d[1] = s_base64Table[((s0&0x3)<<4) | (s1>>4)];
-		d[2] = s_base64Table[((s1&0xF)<<2) | (s2>>6)];
-		d[3] = s_base64Table[s2&0x3F];
-		d[4] = 0;
+			srcNdx += numRead;
 
-		if (numRead < 3) d[3] = '=';
-		if (numRead < 2) d[2] = '=';
+			d[0] = s_base64Table[s0 >> 2];
+			d[1] = s_base64Table[((s0&0x3)<<4) | (s1>>4)];
+			d[2] = s_base64Table[((s1&0xF)<<2) | (s2>>6)];
+			d[3] = s_base64Table[s2&0x3F];
 
-		/* Write indent (if needed). */
-		if (writeIndent)
-		{
-			fprintf(writer->outputFile, "%s", indentStr);
-			writeIndent = DE_FALSE;
+			if (numRead < 3) d[3] = '=';
+			if (numRead < 2) d[2] = '=';
+
+			d += 4;
 		}
 
-		/* Write data. */
-		fprintf(writer->outputFile, "%s", &d[0]);
+		d[0] = '\n';
+		d[1] = 0;
 
-		/* EOL every now and then. */
-		numWritten += 4;
-		if (numWritten >= 64)
-		{
-			fprintf(writer->outputFile, "\n");
-			numWritten = 0;
-			writeIndent = DE_TRUE;
-		}
+		writeStr(writer, &line[0]);
 	}
 
-	/* Last EOL. */
-	if (numWritten > 0)
-		fprintf(writer->outputFile, "\n");
-
 	DE_ASSERT(srcNdx == numBytes);
 	return DE_TRUE;
 }
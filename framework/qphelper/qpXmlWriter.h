@@ -31,6 +31,8 @@ DE_BEGIN_EXTERN_C
 
 typedef struct qpXmlWriter_s	qpXmlWriter;
 
+typedef void					(*qpXmlWriteFunc)	(void* userPtr, const char* data, size_t numBytes);
+
 typedef enum qpXmlAttributeType_e
 {
 	QP_XML_ATTRIBUTE_STRING = 0,
@@ -90,6 +92,14 @@ DE_INLINE qpXmlAttribute qpSetBoolAttrib (const char* name, deBool value)
  *//*--------------------------------------------------------------------*/
 qpXmlWriter*	qpXmlWriter_createFileWriter (FILE* outFile, deBool useCompression, deBool flushAfterWrite);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Create an XML Writer instance that hands output to a callback
+ * \param writeFunc Function called with each piece of output
+ * \param userPtr User pointer passed to writeFunc
+ * \return qpXmlWriter instance, or DE_NULL if out of memory
+ *//*--------------------------------------------------------------------*/
+qpXmlWriter*	qpXmlWriter_createStreamWriter (qpXmlWriteFunc writeFunc, void* userPtr);
+
 /*--------------------------------------------------------------------*//*!
  * \brief XML Writer instance
  * \param a	qpXmlWriter instance
@@ -24,6 +24,7 @@
 #include "rrFragmentOperations.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuTextureUtil.hpp"
+#include "deFloat16.h"
 #include <limits>
 
 using tcu::IVec2;
@@ -789,6 +790,233 @@ void FragmentProcessor::executeUnsignedValueWrite (int fragNdxOffset, int numSam
 	}
 }
 
+namespace specialized
+{
+
+// Specialized fragment pipelines for the common state combinations: no stencil or depth
+// bounds test, all color channels written, no blending or the usual src alpha blend, an
+// optional depth test against a D32F buffer and an RGBA8, RGBA16F or RGBA32F color buffer.
+// The state and format are selected once per render() call and the per-fragment code has
+// no state or format dispatch left. Results match the generic path exactly.
+
+struct ColorRGBA8
+{
+	static bool		clampResult	(void)	{ return true; }
+	static Vec4		minValue	(void)	{ return Vec4(0.0f); }
+	static Vec4		maxValue	(void)	{ return Vec4(1.0f); }
+
+	static Vec4 read (const deUint8* ptr)
+	{
+		return Vec4(ptr[0]/255.0f, ptr[1]/255.0f, ptr[2]/255.0f, ptr[3]/255.0f);
+	}
+
+	static void write (deUint8* ptr, const Vec4& value)
+	{
+		ptr[0] = tcu::floatToU8(value[0]);
+		ptr[1] = tcu::floatToU8(value[1]);
+		ptr[2] = tcu::floatToU8(value[2]);
+		ptr[3] = tcu::floatToU8(value[3]);
+	}
+};
+
+struct ColorRGBA16F
+{
+	static bool		clampResult	(void)	{ return false; }
+	static Vec4		minValue	(void)	{ return Vec4(-std::numeric_limits<float>::infinity()); }
+	static Vec4		maxValue	(void)	{ return Vec4(std::numeric_limits<float>::infinity()); }
+
+	static Vec4 read (const deUint8* ptr)
+	{
+		const deFloat16* const src = (const deFloat16*)ptr;
+		return Vec4(deFloat16To32(src[0]), deFloat16To32(src[1]), deFloat16To32(src[2]), deFloat16To32(src[3]));
+	}
+
+	static void write (deUint8* ptr, const Vec4& value)
+	{
+		deFloat16* const dst = (deFloat16*)ptr;
+
+		for (int ndx = 0; ndx < 4; ndx++)
+			dst[ndx] = deFloat32To16(value[ndx]);
+	}
+};
+
+struct ColorRGBA32F
+{
+	static bool		clampResult	(void)	{ return false; }
+	static Vec4		minValue	(void)	{ return Vec4(-std::numeric_limits<float>::infinity()); }
+	static Vec4		maxValue	(void)	{ return Vec4(std::numeric_limits<float>::infinity()); }
+
+	static Vec4 read (const deUint8* ptr)
+	{
+		const float* const src = (const float*)ptr;
+		return Vec4(src[0], src[1], src[2], src[3]);
+	}
+
+	static void write (deUint8* ptr, const Vec4& value)
+	{
+		float* const dst = (float*)ptr;
+
+		for (int ndx = 0; ndx < 4; ndx++)
+			dst[ndx] = value[ndx];
+	}
+};
+
+//! TESTFUNC_LAST means depth test is disabled.
+template<TestFunc DepthFunc>
+inline bool depthCompare (float sampleDepth, float bufferDepth)
+{
+	switch (DepthFunc)
+	{
+		case TESTFUNC_NEVER:	return false;
+		case TESTFUNC_ALWAYS:	return true;
+		case TESTFUNC_LESS:		return sampleDepth <  bufferDepth;
+		case TESTFUNC_LEQUAL:	return sampleDepth <= bufferDepth;
+		case TESTFUNC_GREATER:	return sampleDepth >  bufferDepth;
+		case TESTFUNC_GEQUAL:	return sampleDepth >= bufferDepth;
+		case TESTFUNC_EQUAL:	return sampleDepth == bufferDepth;
+		case TESTFUNC_NOTEQUAL:	return sampleDepth != bufferDepth;
+		default:
+			DE_ASSERT(false);
+			return false;
+	}
+}
+
+typedef void (*RenderFunc) (const tcu::PixelBufferAccess& colorBuffer, const tcu::PixelBufferAccess& depthBuffer, const Fragment* fragments, int numFragments, const FragmentOperationState& state);
+
+template<class ColorFormat, TestFunc DepthFunc, bool Blend>
+void render (const tcu::PixelBufferAccess& colorBuffer, const tcu::PixelBufferAccess& depthBuffer, const Fragment* fragments, int numFragments, const FragmentOperationState& state)
+{
+	const int			numSamplesPerFragment	= colorBuffer.getWidth();
+	const tcu::IVec3	colorPitch				= colorBuffer.getPitch();
+	const tcu::IVec3	depthPitch				= depthBuffer.getPitch();
+	deUint8* const		colorBasePtr			= (deUint8*)colorBuffer.getDataPtr();
+	deUint8* const		depthBasePtr			= (deUint8*)depthBuffer.getDataPtr();
+	const Vec4			minValue				= ColorFormat::minValue();
+	const Vec4			maxValue				= ColorFormat::maxValue();
+
+	for (int fragNdx = 0; fragNdx < numFragments; fragNdx++)
+	{
+		const Fragment&	frag	= fragments[fragNdx];
+		const int		x		= frag.pixelCoord.x();
+		const int		y		= frag.pixelCoord.y();
+
+		if (state.scissorTestEnabled && !isInsideRect(frag.pixelCoord, state.scissorRectangle))
+			continue;
+
+		for (int sampleNdx = 0; sampleNdx < numSamplesPerFragment; sampleNdx++)
+		{
+			if ((frag.coverage & (1u << sampleNdx)) == 0)
+				continue;
+
+			if (DepthFunc != TESTFUNC_LAST)
+			{
+				float* const	depthPtr	= (float*)(depthBasePtr + sampleNdx*depthPitch.x() + x*depthPitch.y() + y*depthPitch.z());
+				const float		sampleDepth	= de::clamp(frag.sampleDepths[sampleNdx], 0.0f, 1.0f);
+
+				if (!depthCompare<DepthFunc>(sampleDepth, *depthPtr))
+					continue;
+
+				if (state.depthMask)
+					*depthPtr = sampleDepth;
+			}
+
+			{
+				deUint8* const	colorPtr	= colorBasePtr + sampleNdx*colorPitch.x() + x*colorPitch.y() + y*colorPitch.z();
+				Vec4			color;
+
+				if (Blend)
+				{
+					// GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA with GL_FUNC_ADD for both RGB and alpha.
+					const Vec4	src			= clamp(frag.value.get<float>(), minValue, maxValue);
+					const Vec4	dst			= clamp(ColorFormat::read(colorPtr), minValue, maxValue);
+					const Vec3	srcFactor	= Vec3(src.w());
+					const Vec3	dstFactor	= Vec3(1.0f - src.w());
+
+					color.xyz()	= src.swizzle(0,1,2)*srcFactor + dst.swizzle(0,1,2)*dstFactor;
+					color.w()	= src.w()*src.w() + dst.w()*(1.0f - src.w());
+				}
+				else
+					color = frag.value.get<float>();
+
+				if (ColorFormat::clampResult())
+					color = clamp(color, minValue, maxValue);
+
+				ColorFormat::write(colorPtr, color);
+			}
+		}
+	}
+}
+
+template<class ColorFormat, bool Blend>
+RenderFunc selectDepthFunc (bool depthTest, TestFunc depthFunc)
+{
+	if (!depthTest)
+		return render<ColorFormat, TESTFUNC_LAST, Blend>;
+
+	switch (depthFunc)
+	{
+		case TESTFUNC_NEVER:	return render<ColorFormat, TESTFUNC_NEVER,		Blend>;
+		case TESTFUNC_ALWAYS:	return render<ColorFormat, TESTFUNC_ALWAYS,		Blend>;
+		case TESTFUNC_LESS:		return render<ColorFormat, TESTFUNC_LESS,		Blend>;
+		case TESTFUNC_LEQUAL:	return render<ColorFormat, TESTFUNC_LEQUAL,		Blend>;
+		case TESTFUNC_GREATER:	return render<ColorFormat, TESTFUNC_GREATER,	Blend>;
+		case TESTFUNC_GEQUAL:	return render<ColorFormat, TESTFUNC_GEQUAL,		Blend>;
+		case TESTFUNC_EQUAL:	return render<ColorFormat, TESTFUNC_EQUAL,		Blend>;
+		case TESTFUNC_NOTEQUAL:	return render<ColorFormat, TESTFUNC_NOTEQUAL,	Blend>;
+		default:
+			return DE_NULL;
+	}
+}
+
+template<class ColorFormat>
+RenderFunc selectBlend (bool blend, bool depthTest, TestFunc depthFunc)
+{
+	return blend ? selectDepthFunc<ColorFormat, true>(depthTest, depthFunc)
+				 : selectDepthFunc<ColorFormat, false>(depthTest, depthFunc);
+}
+
+static bool isSrcAlphaBlend (const BlendState& state)
+{
+	return state.equation	== BLENDEQUATION_ADD			&&
+		   state.srcFunc	== BLENDFUNC_SRC_ALPHA			&&
+		   state.dstFunc	== BLENDFUNC_ONE_MINUS_SRC_ALPHA;
+}
+
+//! Returns DE_NULL if state or buffer formats require the generic path.
+RenderFunc getRenderFunc (const tcu::PixelBufferAccess& colorBuffer, const tcu::PixelBufferAccess& depthBuffer, bool doDepthTest, bool doStencilTest, bool doDepthBoundsTest, const FragmentOperationState& state)
+{
+	const tcu::TextureFormat&	colorFormat	= colorBuffer.getFormat();
+	bool						blend		= false;
+
+	if (doStencilTest || doDepthBoundsTest)
+		return DE_NULL;
+
+	if (!(state.colorMask[0] && state.colorMask[1] && state.colorMask[2] && state.colorMask[3]))
+		return DE_NULL;
+
+	if (state.blendMode == BLENDMODE_STANDARD && isSrcAlphaBlend(state.blendRGBState) && isSrcAlphaBlend(state.blendAState))
+		blend = true;
+	else if (state.blendMode != BLENDMODE_NONE)
+		return DE_NULL;
+
+	if (doDepthTest && depthBuffer.getFormat() != tcu::TextureFormat(tcu::TextureFormat::D, tcu::TextureFormat::FLOAT))
+		return DE_NULL;
+
+	if (colorFormat.order != tcu::TextureFormat::RGBA)
+		return DE_NULL;
+
+	switch (colorFormat.type)
+	{
+		case tcu::TextureFormat::UNORM_INT8:	return selectBlend<ColorRGBA8>(blend, doDepthTest, state.depthFunc);
+		case tcu::TextureFormat::HALF_FLOAT:	return selectBlend<ColorRGBA16F>(blend, doDepthTest, state.depthFunc);
+		case tcu::TextureFormat::FLOAT:			return selectBlend<ColorRGBA32F>(blend, doDepthTest, state.depthFunc);
+		default:
+			return DE_NULL;
+	}
+}
+
+} // specialized
+
 void FragmentProcessor::render (const rr::MultisamplePixelBufferAccess&		msColorBuffer,
 								const rr::MultisamplePixelBufferAccess&		msDepthBuffer,
 								const rr::MultisamplePixelBufferAccess&		msStencilBuffer,
@@ -796,6 +1024,34 @@ void FragmentProcessor::render (const rr::MultisamplePixelBufferAccess&		msColor
 								int											numFragments,
 								FaceType									fragmentFacing,
 								const FragmentOperationState&				state)
+{
+	const tcu::PixelBufferAccess&	colorBuffer			= msColorBuffer.raw();
+	const tcu::PixelBufferAccess&	depthBuffer			= msDepthBuffer.raw();
+	const tcu::PixelBufferAccess&	stencilBuffer		= msStencilBuffer.raw();
+
+	bool							hasDepth			= depthBuffer.getWidth() > 0	&& depthBuffer.getHeight() > 0		&& depthBuffer.getDepth() > 0;
+	bool							hasStencil			= stencilBuffer.getWidth() > 0	&& stencilBuffer.getHeight() > 0	&& stencilBuffer.getDepth() > 0;
+	bool							doDepthBoundsTest	= hasDepth		&& state.depthBoundsTestEnabled;
+	bool							doDepthTest			= hasDepth		&& state.depthTestEnabled;
+	bool							doStencilTest		= hasStencil	&& state.stencilTestEnabled;
+
+	// Use a specialized pipeline if one exists for this state.
+
+	const specialized::RenderFunc	renderFunc			= specialized::getRenderFunc(colorBuffer, depthBuffer, doDepthTest, doStencilTest, doDepthBoundsTest, state);
+
+	if (renderFunc)
+		renderFunc(colorBuffer, depthBuffer, inputFragments, numFragments, state);
+	else
+		renderGeneric(msColorBuffer, msDepthBuffer, msStencilBuffer, inputFragments, numFragments, fragmentFacing, state);
+}
+
+void FragmentProcessor::renderGeneric (const rr::MultisamplePixelBufferAccess&	msColorBuffer,
+									  const rr::MultisamplePixelBufferAccess&	msDepthBuffer,
+									  const rr::MultisamplePixelBufferAccess&	msStencilBuffer,
+									  const Fragment*							inputFragments,
+									  int										numFragments,
+									  FaceType									fragmentFacing,
+									  const FragmentOperationState&			state)
 {
 	DE_ASSERT(fragmentFacing < FACETYPE_LAST);
 	DE_ASSERT(state.numStencilBits < 32); // code bitshifts numStencilBits, avoid undefined behavior
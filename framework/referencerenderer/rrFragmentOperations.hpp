@@ -106,6 +106,15 @@ public:
 									 FaceType									fragmentFacing,
 									 const FragmentOperationState&				state);
 
+	//! Same as render() but never uses the state-specialized pipelines.
+	void		renderGeneric		(const rr::MultisamplePixelBufferAccess&	colorMultisampleBuffer,
+									 const rr::MultisamplePixelBufferAccess&	depthMultisampleBuffer,
+									 const rr::MultisamplePixelBufferAccess&	stencilMultisampleBuffer,
+									 const Fragment*							fragments,
+									 int										numFragments,
+									 FaceType									fragmentFacing,
+									 const FragmentOperationState&				state);
+
 private:
 	enum
 	{
@@ -29,6 +29,7 @@
 #include "rrFragmentOperations.hpp"
 #include "rrRasterizer.hpp"
 #include "deMemory.h"
+#include "deUniquePtr.hpp"
 
 #include <set>
 #include <limits>
@@ -48,7 +49,13 @@ struct RasterizationInternalBuffers
 	std::vector<GenericVec4>		shaderOutputs;
 	std::vector<GenericVec4>		shaderOutputsSrc1;
 	std::vector<Fragment>			shadedFragments;
+	std::vector<float>				fragmentDepthValues;
 	float*							fragmentDepthBuffer;
+
+	RasterizationInternalBuffers (void)
+		: fragmentDepthBuffer	(DE_NULL)
+	{
+	}
 };
 
 deUint32 readIndexArray (const IndexType type, const void* ptr, size_t ndx)
@@ -92,10 +99,12 @@ bool isEmpty (const rr::MultisampleConstPixelBufferAccess& access)
 
 struct DrawContext
 {
-	int primitiveID;
+	int								primitiveID;
+	RasterizationInternalBuffers*	rasterizationBuffers;
 
-	DrawContext (void)
-		: primitiveID(0)
+	DrawContext (RasterizationInternalBuffers* rasterizationBuffers_)
+		: primitiveID			(0)
+		, rasterizationBuffers	(rasterizationBuffers_)
 	{
 	}
 };
@@ -1291,7 +1300,8 @@ template <typename ContainerType>
 void rasterize (const RenderState&					state,
 				const RenderTarget&					renderTarget,
 				const Program&						program,
-				const ContainerType&				list)
+				const ContainerType&				list,
+				RasterizationInternalBuffers&		buffers)
 {
 	const int						numSamples			= renderTarget.getNumSamples();
 	const int						numFragmentOutputs	= (int)program.fragmentShader->getOutputs().size();
@@ -1301,29 +1311,28 @@ void rasterize (const RenderState&					state,
 	const tcu::IVec4				bufferRect			= getBufferSize(renderTarget.getColorBuffer(0));
 	const tcu::IVec4				renderTargetRect	= rectIntersection(viewportRect, bufferRect);
 
-	// shared buffers for all primitives
-	std::vector<FragmentPacket>		fragmentPackets		(maxFragmentPackets);
-	std::vector<GenericVec4>		shaderOutputs		(maxFragmentPackets*4*numFragmentOutputs);
-	std::vector<GenericVec4>		shaderOutputsSrc1	(maxFragmentPackets*4*numFragmentOutputs);
-	std::vector<Fragment>			shadedFragments		(maxFragmentPackets*4);
-	std::vector<float>				depthValues			(0);
-	float*							depthBufferPointer	= DE_NULL;
+	// shared buffers for all primitives, kept by the renderer between draws and only grown when needed
+	buffers.fragmentPackets.resize(maxFragmentPackets);
+
+	if (buffers.shaderOutputs.size() < maxFragmentPackets*4*numFragmentOutputs)
+	{
+		buffers.shaderOutputs.resize(maxFragmentPackets*4*numFragmentOutputs);
+		buffers.shaderOutputsSrc1.resize(maxFragmentPackets*4*numFragmentOutputs);
+	}
 
-	RasterizationInternalBuffers	buffers;
+	if (buffers.shadedFragments.size() < maxFragmentPackets*4)
+		buffers.shadedFragments.resize(maxFragmentPackets*4);
 
 	// calculate depth only if we have a depth buffer
 	if (!isEmpty(renderTarget.getDepthBuffer()))
 	{
-		depthValues.resize(maxFragmentPackets*4*numSamples);
-		depthBufferPointer = &depthValues[0];
-	}
+		if (buffers.fragmentDepthValues.size() < maxFragmentPackets*4*numSamples)
+			buffers.fragmentDepthValues.resize(maxFragmentPackets*4*numSamples);
 
-	// set buffers
-	buffers.fragmentPackets.swap(fragmentPackets);
-	buffers.shaderOutputs.swap(shaderOutputs);
-	buffers.shaderOutputsSrc1.swap(shaderOutputsSrc1);
-	buffers.shadedFragments.swap(shadedFragments);
-	buffers.fragmentDepthBuffer = depthBufferPointer;
+		buffers.fragmentDepthBuffer = &buffers.fragmentDepthValues[0];
+	}
+	else
+		buffers.fragmentDepthBuffer = DE_NULL;
 
 	// rasterize
 	for (typename ContainerType::const_iterator it = list.begin(); it != list.end(); ++it)
@@ -1334,7 +1343,7 @@ void rasterize (const RenderState&					state,
  * Draws transformed triangles, lines or points to render target
  *//*--------------------------------------------------------------------*/
 template <typename ContainerType>
-void drawBasicPrimitives (const RenderState& state, const RenderTarget& renderTarget, const Program& program, ContainerType& primList, VertexPacketAllocator& vpalloc)
+void drawBasicPrimitives (const RenderState& state, const RenderTarget& renderTarget, const Program& program, ContainerType& primList, DrawContext& drawContext, VertexPacketAllocator& vpalloc)
 {
 	const bool clipZ = !state.fragOps.depthClampEnabled;
 
@@ -1351,7 +1360,7 @@ void drawBasicPrimitives (const RenderState& state, const RenderTarget& renderTa
 	transformClipCoordsToWindowCoords(state, primList);
 
 	// Rasterize and paint
-	rasterize(state, renderTarget, program, primList);
+	rasterize(state, renderTarget, program, primList, *drawContext.rasterizationBuffers);
 }
 
 void copyVertexPacketPointers(const VertexPacket** dst, const pa::Point& in)
@@ -1391,7 +1400,7 @@ void copyVertexPacketPointers(const VertexPacket** dst, const pa::TriangleAdjace
 }
 
 template <PrimitiveType DrawPrimitiveType> // \note DrawPrimitiveType  can only be Points, line_strip, or triangle_strip
-void drawGeometryShaderOutputAsPrimitives (const RenderState& state, const RenderTarget& renderTarget, const Program& program, VertexPacket* const* vertices, size_t numVertices, VertexPacketAllocator& vpalloc)
+void drawGeometryShaderOutputAsPrimitives (const RenderState& state, const RenderTarget& renderTarget, const Program& program, VertexPacket* const* vertices, size_t numVertices, DrawContext& drawContext, VertexPacketAllocator& vpalloc)
 {
 	// Run primitive assembly for generated stream
 
@@ -1406,7 +1415,7 @@ void drawGeometryShaderOutputAsPrimitives (const RenderState& state, const Rende
 
 	// Draw assembled primitives
 
-	drawBasicPrimitives(state, renderTarget, program, inputPrimitives, vpalloc);
+	drawBasicPrimitives(state, renderTarget, program, inputPrimitives, drawContext, vpalloc);
 }
 
 template <PrimitiveType DrawPrimitiveType>
@@ -1461,9 +1470,9 @@ void drawWithGeometryShader(const RenderState& state, const RenderTarget& render
 
 			switch (program.geometryShader->getOutputType())
 			{
-				case rr::GEOMETRYSHADEROUTPUTTYPE_POINTS:			drawGeometryShaderOutputAsPrimitives<PRIMITIVETYPE_POINTS>			(state, renderTarget, program, &emitted[primitiveBegin], primitiveEnd-primitiveBegin, vpalloc); break;
-				case rr::GEOMETRYSHADEROUTPUTTYPE_LINE_STRIP:		drawGeometryShaderOutputAsPrimitives<PRIMITIVETYPE_LINE_STRIP>		(state, renderTarget, program, &emitted[primitiveBegin], primitiveEnd-primitiveBegin, vpalloc); break;
-				case rr::GEOMETRYSHADEROUTPUTTYPE_TRIANGLE_STRIP:	drawGeometryShaderOutputAsPrimitives<PRIMITIVETYPE_TRIANGLE_STRIP>	(state, renderTarget, program, &emitted[primitiveBegin], primitiveEnd-primitiveBegin, vpalloc); break;
+				case rr::GEOMETRYSHADEROUTPUTTYPE_POINTS:			drawGeometryShaderOutputAsPrimitives<PRIMITIVETYPE_POINTS>			(state, renderTarget, program, &emitted[primitiveBegin], primitiveEnd-primitiveBegin, drawContext, vpalloc); break;
+				case rr::GEOMETRYSHADEROUTPUTTYPE_LINE_STRIP:		drawGeometryShaderOutputAsPrimitives<PRIMITIVETYPE_LINE_STRIP>		(state, renderTarget, program, &emitted[primitiveBegin], primitiveEnd-primitiveBegin, drawContext, vpalloc); break;
+				case rr::GEOMETRYSHADEROUTPUTTYPE_TRIANGLE_STRIP:	drawGeometryShaderOutputAsPrimitives<PRIMITIVETYPE_TRIANGLE_STRIP>	(state, renderTarget, program, &emitted[primitiveBegin], primitiveEnd-primitiveBegin, drawContext, vpalloc); break;
 				default:
 					DE_ASSERT(DE_FALSE);
 			}
@@ -1510,7 +1519,7 @@ void drawAsPrimitives (const RenderState& state, const RenderTarget& renderTarge
 		generatePrimitiveIDs(basePrimitives, drawContext);
 
 		// Draw as a basic type
-		drawBasicPrimitives(state, renderTarget, program, basePrimitives, vpalloc);
+		drawBasicPrimitives(state, renderTarget, program, basePrimitives, drawContext, vpalloc);
 	}
 }
 
@@ -1739,12 +1748,21 @@ bool PrimitiveList::isRestartIndex (size_t elementNdx, deUint32 restartIndex) co
 		return elementNdx == (size_t)restartIndex;
 }
 
+struct Renderer::DrawBuffers
+{
+	de::MovePtr<VertexPacketAllocator>	vertexPacketAllocator;
+	std::vector<VertexPacket*>			vertexPackets;
+	RasterizationInternalBuffers		rasterizationBuffers;
+};
+
 Renderer::Renderer (void)
+	: m_drawBuffers	(new DrawBuffers())
 {
 }
 
 Renderer::~Renderer (void)
 {
+	delete m_drawBuffers;
 }
 
 void Renderer::draw (const DrawCommand& command) const
@@ -1772,10 +1790,23 @@ void Renderer::drawInstanced (const DrawCommand& command, int numInstances) cons
 
 	// Prepare transformation
 
-	const size_t				numVaryings = command.program.vertexShader->getOutputs().size();
-	VertexPacketAllocator		vpalloc(numVaryings);
-	std::vector<VertexPacket*>	vertexPackets = vpalloc.allocArray(command.primitives.getNumElements());
-	DrawContext					drawContext;
+	const size_t				numVaryings		= command.program.vertexShader->getOutputs().size();
+	const size_t				numElements		= command.primitives.getNumElements();
+	VertexPacketAllocator		vpalloc			(numVaryings);
+	DrawContext					drawContext		(&m_drawBuffers->rasterizationBuffers);
+
+	// Vertex packets for shading are reused from earlier draws if they are large enough. Packets
+	// created during clipping and geometry shading are allocated from the per-draw vpalloc.
+	if (!m_drawBuffers->vertexPacketAllocator									||
+		m_drawBuffers->vertexPacketAllocator->getNumVertexOutputs() != numVaryings	||
+		m_drawBuffers->vertexPackets.size() < numElements)
+	{
+		m_drawBuffers->vertexPackets.clear();
+		m_drawBuffers->vertexPacketAllocator	= de::MovePtr<VertexPacketAllocator>(new VertexPacketAllocator(numVaryings));
+		m_drawBuffers->vertexPackets			= m_drawBuffers->vertexPacketAllocator->allocArray(numElements);
+	}
+
+	std::vector<VertexPacket*>&	vertexPackets	= m_drawBuffers->vertexPackets;
 
 	for (int instanceID = 0; instanceID < numInstances; ++instanceID)
 	{
@@ -129,6 +129,13 @@ public:
 	const PrimitiveList&		primitives;
 } DE_WARN_UNUSED_TYPE;
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Reference renderer
+ *
+ * Renderer keeps vertex packet and rasterization buffers between draws, so
+ * reusing one instance for repeated draws avoids per-draw allocations.
+ * A single Renderer must not be used from multiple threads at the same time.
+ *//*--------------------------------------------------------------------*/
 class Renderer
 {
 public:
@@ -137,6 +144,14 @@ public:
 
 	void			draw			(const DrawCommand& command) const;
 	void			drawInstanced	(const DrawCommand& command, int numInstances) const;
+
+private:
+					Renderer		(const Renderer&);	// not allowed!
+	Renderer&		operator=		(const Renderer&);	// not allowed!
+
+	struct DrawBuffers;
+
+	DrawBuffers*	m_drawBuffers;
 } DE_WARN_UNUSED_TYPE;
 
 } // rr
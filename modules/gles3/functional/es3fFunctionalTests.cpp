@@ -140,6 +140,7 @@
 #include "es3fReadPixelsTests.hpp"
 
 #include "glsShaderLibrary.hpp"
+#include "gluShaderLibrary.hpp"
 
 namespace deqp
 {
@@ -193,23 +194,44 @@ public:
 
 	void init (void)
 	{
-		addChild(new ShaderLibraryTest			(m_context, "preprocessor",					"Preprocessor Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "constants",					"Constant Literal Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "linkage",						"Linkage Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "conversions",					"Type Conversion Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "conditionals",					"Conditionals Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "declarations",					"Declarations Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "swizzles",						"Swizzle Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "swizzle_math_operations",		"Swizzle Math Operations Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "functions",					"Function Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "arrays",						"Array Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "large_constant_arrays",		"Large Constant Array Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "keywords",						"Keyword Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "qualification_order",			"Order Of Qualification Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "scoping",						"Scoping of Declarations"));
-		addChild(new ShaderLibraryTest			(m_context, "negative",						"Miscellaneous Negative Shader Compilation Tests"));
-		addChild(new ShaderLibraryTest			(m_context, "uniform_block",				"Uniform block tests"));
-		addChild(new ShaderLibraryTest			(m_context, "invalid_implicit_conversions",	"Invalid Implicit Conversions"));
+		static const struct
+		{
+			const char*		name;
+			const char*		description;
+		} s_libraryTests[] =
+		{
+			{ "preprocessor",					"Preprocessor Tests"								},
+			{ "constants",						"Constant Literal Tests"							},
+			{ "linkage",						"Linkage Tests"										},
+			{ "conversions",					"Type Conversion Tests"								},
+			{ "conditionals",					"Conditionals Tests"								},
+			{ "declarations",					"Declarations Tests"								},
+			{ "swizzles",						"Swizzle Tests"										},
+			{ "swizzle_math_operations",		"Swizzle Math Operations Tests"						},
+			{ "functions",						"Function Tests"									},
+			{ "arrays",							"Array Tests"										},
+			{ "large_constant_arrays",			"Large Constant Array Tests"						},
+			{ "keywords",						"Keyword Tests"										},
+			{ "qualification_order",			"Order Of Qualification Tests"						},
+			{ "scoping",						"Scoping of Declarations"							},
+			{ "negative",						"Miscellaneous Negative Shader Compilation Tests"	},
+			{ "uniform_block",					"Uniform block tests"								},
+			{ "invalid_implicit_conversions",	"Invalid Implicit Conversions"						},
+		};
+
+		// Parse all library files concurrently up front, groups pick up the results on init
+		{
+			std::vector<glu::sl::LibraryFile> files;
+
+			for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_libraryTests); ndx++)
+				files.push_back(glu::sl::LibraryFile(std::string("shaders/") + s_libraryTests[ndx].name + ".test",
+													 std::string("dEQP-GLES3.functional.shaders.") + s_libraryTests[ndx].name));
+
+			glu::sl::prefetchFiles(m_testCtx, files);
+		}
+
+		for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_libraryTests); ndx++)
+			addChild(new ShaderLibraryTest		(m_context, s_libraryTests[ndx].name, s_libraryTests[ndx].description));
 
 		addChild(new ShaderDiscardTests			(m_context));
 		addChild(new ShaderIndexingTests		(m_context));
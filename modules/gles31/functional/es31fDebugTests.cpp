@@ -543,6 +543,7 @@ bool BaseCase::verifyMessageExists (const MessageData& message, GLenum source, G
 		{
 			m_results.addResult(QP_TEST_RESULT_FAIL, "Message was not reported as expected");
 			log << TestLog::Message << "A message was expected but none was reported" << TestLog::EndMessage;
+			logCallTrace();
 		}
 		else
 		{
@@ -564,6 +565,7 @@ void BaseCase::verifyMessageGroup (const MessageData& message, GLenum source, GL
 		m_results.addResult(QP_TEST_RESULT_FAIL, "Incorrect message source");
 		log << TestLog::Message << "Message source was " << glu::getDebugMessageSourceStr(message.id.source)
 			<< " when it should have been "  << glu::getDebugMessageSourceStr(source) << TestLog::EndMessage;
+		logCallTrace();
 	}
 
 	if (message.id.type != type)
@@ -571,6 +573,7 @@ void BaseCase::verifyMessageGroup (const MessageData& message, GLenum source, GL
 		m_results.addResult(QP_TEST_RESULT_FAIL, "Incorrect message type");
 		log << TestLog::Message << "Message type was " << glu::getDebugMessageTypeStr(message.id.type)
 			<< " when it should have been " << glu::getDebugMessageTypeStr(type) << TestLog::EndMessage;
+		logCallTrace();
 	}
 }
 
@@ -610,6 +613,7 @@ void BaseCase::verifyMessage (const MessageData& message, GLenum source, GLenum
 			m_results.addResult(QP_TEST_RESULT_FAIL, "Incorrect message id");
 			log << TestLog::Message << "Message id was " << message.id.id
 				<< " when it should have been " << id << TestLog::EndMessage;
+			logCallTrace();
 		}
 
 		if (message.severity != severity)
@@ -617,6 +621,7 @@ void BaseCase::verifyMessage (const MessageData& message, GLenum source, GLenum
 			m_results.addResult(QP_TEST_RESULT_FAIL, "Incorrect message severity");
 			log << TestLog::Message << "Message severity was " << glu::getDebugMessageSeverityStr(message.severity)
 				<< " when it should have been " << glu::getDebugMessageSeverityStr(severity) << TestLog::EndMessage;
+			logCallTrace();
 		}
 	}
 }
@@ -662,7 +667,7 @@ CallbackErrorCase::IterateResult CallbackErrorCase::iterate (void)
 
 	const glw::Functions&	gl		= m_context.getRenderContext().getFunctions();
 	tcu::TestLog&			log		= m_testCtx.getLog();
-	DebugMessageTestContext	context	= DebugMessageTestContext(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, true);
+	DebugMessageTestContext	context	(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, false);
 
 	gl.enable(GL_DEBUG_OUTPUT);
 	gl.enable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
@@ -731,7 +736,7 @@ LogErrorCase::IterateResult LogErrorCase::iterate (void)
 
 	const glw::Functions&	gl		= m_context.getRenderContext().getFunctions();
 	tcu::TestLog&			log		= m_testCtx.getLog();
-	DebugMessageTestContext	context	= DebugMessageTestContext(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, true);
+	DebugMessageTestContext	context	(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, false);
 	GLint					numMsg	= 0;
 
 	gl.enable(GL_DEBUG_OUTPUT);
@@ -768,6 +773,7 @@ void LogErrorCase::expectMessage (GLenum source, GLenum type)
 		{
 			m_results.addResult(QP_TEST_RESULT_FAIL, "Error was not reported as expected");
 			log << TestLog::Message << "A message was expected but none was reported (empty message log)" << TestLog::EndMessage;
+			logCallTrace();
 		}
 		else
 		{
@@ -836,7 +842,7 @@ GetErrorCase::GetErrorCase (Context&			ctx,
 GetErrorCase::IterateResult GetErrorCase::iterate (void)
 {
 	tcu::TestLog&			log		= m_testCtx.getLog();
-	DebugMessageTestContext	context	= DebugMessageTestContext(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, true);
+	DebugMessageTestContext	context	(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, false);
 
 	m_errorFunc.call(context);
 
@@ -873,6 +879,7 @@ void GetErrorCase::expectError (glw::GLenum error0, glw::GLenum error1)
 				<< glu::getErrorStr(error1) << " was expected but got "
 				<< glu::getErrorStr(result)
 				<< TestLog::EndMessage;
+		logCallTrace();
 		return;
 	}
 }
@@ -993,7 +1000,7 @@ void FilterCase::callback (GLenum source, GLenum type, GLuint id, GLenum severit
 vector<MessageData> FilterCase::genMessages (bool uselog, const string& desc)
 {
 	tcu::TestLog&			log			= m_testCtx.getLog();
-	DebugMessageTestContext	context		= DebugMessageTestContext(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, uselog);
+	DebugMessageTestContext	context		(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, uselog);
 	tcu::ScopedLogSection	section		(log, "message gen", desc);
 	vector<MessageData>		messages;
 
@@ -1471,7 +1478,7 @@ AsyncCase::IterateResult AsyncCase::iterate (void)
 
 	const glw::Functions&	gl			= m_context.getRenderContext().getFunctions();
 	tcu::TestLog&			log			= m_testCtx.getLog();
-	DebugMessageTestContext	context		= DebugMessageTestContext(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, true);
+	DebugMessageTestContext	context		(*this, m_context.getRenderContext(), m_context.getContextInfo(), log, m_results, false);
 	const int				maxWait		= 10000; // ms
 	const int				warnWait	= 100;
 
@@ -1557,6 +1564,7 @@ AsyncCase::IterateResult AsyncCase::iterate (void)
 
 				log << TestLog::Message << "Waited for ~" << waited << "ms without getting all expected messages" << TestLog::EndMessage;
 				m_results.addResult(QP_TEST_RESULT_FAIL, "Async messages were not returned to application within a reasonable timeframe");
+				logCallTrace();
 				break;
 			}
 
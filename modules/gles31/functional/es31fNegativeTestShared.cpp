@@ -43,10 +43,17 @@ using tcu::TestLog;
 using std::string;
 
 ErrorCase::ErrorCase (Context& ctx, const char* name, const char* desc)
-	: TestCase(ctx, name, desc)
+	: TestCase			(ctx, name, desc)
+	, m_activeContext	(DE_NULL)
 {
 }
 
+void ErrorCase::logCallTrace (void)
+{
+	if (m_activeContext && m_activeContext->isCallTraceEnabled())
+		m_activeContext->logCallTrace();
+}
+
 NegativeTestContext::NegativeTestContext (ErrorCase&				host,
 										  glu::RenderContext&		renderCtx,
 										  const glu::ContextInfo&	ctxInfo,
@@ -61,16 +68,26 @@ NegativeTestContext::NegativeTestContext (ErrorCase&				host,
 	, m_openSections		(0)
 {
 	enableLogging(enableLogging_);
+	// Without the text log, keep a cheap record of recent calls to dump on failure.
+	enableCallTrace(!enableLogging_);
+
+	DE_ASSERT(!m_host.m_activeContext);
+	m_host.m_activeContext = this;
 }
 
 NegativeTestContext::~NegativeTestContext ()
 {
+	m_host.m_activeContext = DE_NULL;
+
 	while (m_openSections--)
 		getLog() << TestLog::EndSection;
 }
 
 void NegativeTestContext::fail (const string& msg)
 {
+	if (isCallTraceEnabled())
+		logCallTrace();
+
 	m_results.addResult(QP_TEST_RESULT_FAIL, msg);
 }
 
@@ -45,6 +45,8 @@ namespace Functional
 namespace NegativeTestShared
 {
 
+class NegativeTestContext;
+
 class ErrorCase : public TestCase
 {
 public:
@@ -52,6 +54,15 @@ public:
 	virtual						~ErrorCase		(void) {}
 
 	virtual void				expectError		(glw::GLenum error0, glw::GLenum error1) = 0;
+
+protected:
+	//! Write the call trace of the running NegativeTestContext to the log. Call after reporting a failure.
+	void						logCallTrace	(void);
+
+private:
+	friend class NegativeTestContext;
+
+	NegativeTestContext*		m_activeContext;
 };
 
 class NegativeTestContext : public glu::CallLogWrapper
@@ -25,6 +25,7 @@
 
 #include "tcuCompressedTexture.hpp"
 #include "tcuAstcUtil.hpp"
+#include "tcuTestLog.hpp"
 
 #include "deUniquePtr.hpp"
 #include "deStringUtil.hpp"
@@ -180,6 +181,55 @@ AstcCase::IterateResult AstcCase::iterate (void)
 	return STOP;
 }
 
+class AstcDecompressErrorCase : public tcu::TestCase
+{
+public:
+	AstcDecompressErrorCase (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "hdr_void_extent_inf", "Error from an invalid block in a texture large enough to be decompressed on multiple threads")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const CompressedTexFormat		format			= COMPRESSEDTEXFORMAT_ASTC_4x4_RGBA;
+		const int						size			= 256;
+		const int						numBlocks		= (size/4) * (size/4);
+		const TexDecompressionParams	params			(TexDecompressionParams::ASTCMODE_HDR);
+		TextureLevel					texture			(getUncompressedFormat(format), size, size);
+		vector<deUint8>					data			(numBlocks*astc::BLOCK_SIZE_BYTES);
+
+		// HDR void extent blocks with all extent coordinates set, color is given as fp16 values.
+		for (int blockNdx = 0; blockNdx < numBlocks; blockNdx++)
+		{
+			const deUint16	color		= blockNdx == numBlocks/2+3 ? 0x7c00 : 0x3c00; // One block with infinity, others 1.0.
+			deUint8* const	blockPtr	= &data[blockNdx*astc::BLOCK_SIZE_BYTES];
+
+			blockPtr[0] = 0xfc;
+			for (int byteNdx = 1; byteNdx < 8; byteNdx++)
+				blockPtr[byteNdx] = 0xff;
+
+			for (int compNdx = 0; compNdx < 4; compNdx++)
+			{
+				blockPtr[8 + compNdx*2 + 0]	= (deUint8)(color & 0xff);
+				blockPtr[8 + compNdx*2 + 1]	= (deUint8)(color >> 8);
+			}
+		}
+
+		try
+		{
+			decompress(texture.getAccess(), format, &data[0], params);
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Decompression of invalid block didn't throw");
+		}
+		catch (const tcu::InternalError& e)
+		{
+			m_testCtx.getLog() << TestLog::Message << "Got expected error: " << e.what() << TestLog::EndMessage;
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		}
+
+		return STOP;
+	}
+};
+
 } // anonymous
 
 tcu::TestCaseGroup* createAstcTests (tcu::TestContext& testCtx)
@@ -194,6 +244,8 @@ tcu::TestCaseGroup* createAstcTests (tcu::TestContext& testCtx)
 			astcTests->addChild(new AstcCase(testCtx, format));
 	}
 
+	astcTests->addChild(new AstcDecompressErrorCase(testCtx));
+
 	return astcTests.release();
 }
 
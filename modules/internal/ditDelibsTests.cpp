@@ -40,6 +40,7 @@
 // deutil
 #include "deTimerTest.h"
 #include "deCommandLine.h"
+#include "deSharedRing.h"
 
 // debase
 #include "deInt32.h"
@@ -129,6 +130,7 @@ public:
 		addChild(new SelfCheckCase(m_testCtx, "semaphore",					"deSemaphore_selfTest()",			deSemaphore_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "atomic",						"deAtomic_selfTest()",				deAtomic_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "singleton",					"deSingleton_selfTest()",			deSingleton_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "concurrent_mem_pool",		"deMemPoolConcurrent_selfTest()",	deMemPoolConcurrent_selfTest));
 		addChild(new GetUint32Case(m_testCtx, "total_physical_cores",		"deGetNumTotalPhysicalCores()",		deGetNumTotalPhysicalCores));
 		addChild(new GetUint32Case(m_testCtx, "total_logical_cores",		"deGetNumTotalLogicalCores()",		deGetNumTotalLogicalCores));
 		addChild(new GetUint32Case(m_testCtx, "available_logical_cores",	"deGetNumAvailableLogicalCores()",	deGetNumAvailableLogicalCores));
@@ -147,6 +149,7 @@ public:
 	{
 		addChild(new SelfCheckCase(m_testCtx, "timer",			"deTimer_selfTest()",		deTimer_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "command_line",	"deCommandLine_selfTest()",	deCommandLine_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "shared_ring",	"deSharedRing_selfTest()",	deSharedRing_selfTest));
 	}
 };
 
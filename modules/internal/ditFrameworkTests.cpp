@@ -31,7 +31,10 @@
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
 
+#include "gluCallTrace.hpp"
+
 #include "rrRenderer.hpp"
+#include "rrFragmentOperations.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuFloat.hpp"
@@ -40,6 +43,7 @@
 #include "deArrayUtil.hpp"
 
 #include <stdexcept>
+#include <sstream>
 
 namespace dit
 {
@@ -556,6 +560,95 @@ public:
 	}
 };
 
+class CaseFractionHistoryCase : public tcu::TestCase
+{
+public:
+	CaseFractionHistoryCase (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "fraction_history", "Test case fraction balancing with duration history")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		struct GroupFraction
+		{
+			const char*	group;
+			int			fraction;
+		};
+
+		// Duration column is found by name; the trailing column must not be used.
+		static const char* const	csvHistory		= "CasePath,StatusCode,TestDuration,Ratio\n"
+													  "pkg.a.case0,Pass,10,100\n"
+													  "pkg.a.case1,Pass,10,100\n"
+													  "pkg.b.case0,Pass,15,1\r\n"
+													  "pkg.c.case0,Fail,5,1\n"
+													  "pkg.d.case0,Pass,4,1\n"
+													  "invalid,Pass,3,1\n"
+													  "pkg.e.case0,Pass,,1\n";
+		static const char* const	plainHistory	= "pkg.a.case0 10\n"
+													  "pkg.a.case1 10\n"
+													  "pkg.b.case0 15\r\n"
+													  "pkg.c.case0\t5\n"
+													  "pkg.d.case0 4\n"
+													  "invalid 3\n"
+													  "pkg.e.case0\n"
+													  "pkg.f.case0 1 2\n";
+		static const char* const	histories[]		= { csvHistory, plainHistory };
+		static const GroupFraction	expected[]		=
+		{
+			{ "pkg.a",	0 },
+			{ "pkg.b",	1 },
+			{ "pkg.c",	1 },
+			{ "pkg.d",	0 },
+		};
+		TestLog&					log				= m_testCtx.getLog();
+		bool						allOk			= true;
+
+		for (int historyNdx = 0; historyNdx < DE_LENGTH_OF_ARRAY(histories); historyNdx++)
+		{
+			std::istringstream					in			(histories[historyNdx]);
+			const std::map<std::string, int>	fractions	= tcu::assignCaseFractionGroups(in, 2);
+
+			log << TestLog::Message << "History " << historyNdx << TestLog::EndMessage;
+
+			if (fractions.size() != DE_LENGTH_OF_ARRAY(expected))
+				allOk = false;
+
+			for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(expected); ndx++)
+			{
+				const std::map<std::string, int>::const_iterator	fraction	= fractions.find(expected[ndx].group);
+				const int											result		= fraction != fractions.end() ? fraction->second : -1;
+
+				log << TestLog::Message << expected[ndx].group << ": fraction " << result << ", expected " << expected[ndx].fraction << TestLog::EndMessage;
+
+				if (result != expected[ndx].fraction)
+					allOk = false;
+			}
+		}
+
+		// CSV without durations, such as the testlog-stats baseline comparison, is rejected.
+		try
+		{
+			std::istringstream in ("CasePath,Baseline,Current,Difference,Ratio\n"
+								   "pkg.a.case0,10,20,10,2\n");
+
+			tcu::assignCaseFractionGroups(in, 2);
+
+			log << TestLog::Message << "CSV without TestDuration column was accepted" << TestLog::EndMessage;
+			allOk = false;
+		}
+		catch (const tcu::Exception& e)
+		{
+			log << TestLog::Message << "Got expected error: " << e.what() << TestLog::EndMessage;
+		}
+
+		m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS	: QP_TEST_RESULT_FAIL,
+								allOk ? "All passed"		: "Unexpected fraction assignment");
+
+		return STOP;
+	}
+};
+
 class CaseListParserTests : public tcu::TestCaseGroup
 {
 public:
@@ -568,6 +661,7 @@ public:
 	{
 		addChild(new TrieParserTests(m_testCtx));
 		addChild(new ListParserTests(m_testCtx));
+		addChild(new CaseFractionHistoryCase(m_testCtx));
 	}
 };
 
@@ -880,6 +974,202 @@ protected:
 	vector<SubCase>::const_iterator	m_caseIter;
 };
 
+class FragmentPipelineSpecializationTest : public tcu::TestCase
+{
+public:
+	FragmentPipelineSpecializationTest (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "fragment_pipeline_specialization", "Specialized fragment pipelines match the generic path")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const int	numIterations	= 500;
+		int			numFailed		= 0;
+
+		for (int iterNdx = 0; iterNdx < numIterations; iterNdx++)
+		{
+			if (!runIteration(iterNdx))
+				numFailed += 1;
+		}
+
+		m_testCtx.getLog() << TestLog::Message << (numIterations-numFailed) << " / " << numIterations << " iterations passed" << TestLog::EndMessage;
+
+		if (numFailed == 0)
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Specialized and generic paths differ");
+
+		return STOP;
+	}
+
+private:
+	static bool bufferEquals (const tcu::ConstPixelBufferAccess& a, const tcu::ConstPixelBufferAccess& b)
+	{
+		const size_t size = (size_t)(a.getWidth()*a.getHeight()*a.getDepth()*a.getFormat().getPixelSize());
+
+		DE_ASSERT(a.getFormat() == b.getFormat() && a.getSize() == b.getSize());
+
+		return deMemCmp(a.getDataPtr(), b.getDataPtr(), size) == 0;
+	}
+
+	static rr::TestFunc randomTestFunc (de::Random& rnd)
+	{
+		static const rr::TestFunc funcs[] =
+		{
+			rr::TESTFUNC_NEVER,
+			rr::TESTFUNC_ALWAYS,
+			rr::TESTFUNC_LESS,
+			rr::TESTFUNC_LEQUAL,
+			rr::TESTFUNC_GREATER,
+			rr::TESTFUNC_GEQUAL,
+			rr::TESTFUNC_EQUAL,
+			rr::TESTFUNC_NOTEQUAL,
+		};
+
+		return rnd.choose<rr::TestFunc>(DE_ARRAY_BEGIN(funcs), DE_ARRAY_END(funcs));
+	}
+
+	bool runIteration (int iterNdx)
+	{
+		using namespace tcu;
+
+		static const TextureFormat::ChannelType	colorTypes[]	= { TextureFormat::UNORM_INT8, TextureFormat::HALF_FLOAT, TextureFormat::FLOAT };
+		static const int						sampleCounts[]	= { 1, 2, 4 };
+
+		de::Random						rnd				(deInt32Hash(iterNdx) ^ 0x5e1f2a);
+		const int						width			= rnd.getInt(1, 16);
+		const int						height			= rnd.getInt(1, 16);
+		const int						numSamples		= rnd.choose<int>(DE_ARRAY_BEGIN(sampleCounts), DE_ARRAY_END(sampleCounts));
+		const TextureFormat				colorFormat		(TextureFormat::RGBA, rnd.choose<TextureFormat::ChannelType>(DE_ARRAY_BEGIN(colorTypes), DE_ARRAY_END(colorTypes)));
+		const TextureFormat				depthFormat		(TextureFormat::D, TextureFormat::FLOAT);
+		const TextureFormat				stencilFormat	(TextureFormat::S, TextureFormat::UNSIGNED_INT8);
+		const bool						hasDepth		= rnd.getFloat() < 0.8f;
+		const bool						hasStencil		= rnd.getBool();
+		TextureLevel					colorBuffers[2];
+		TextureLevel					depthBuffers[2];
+		TextureLevel					stencilBuffers[2];
+		rr::FragmentOperationState		state;
+		vector<rr::Fragment>			fragments;
+		vector<float>					sampleDepths;
+		vector<IVec2>					pixels;
+
+		// State restricted to what the specialized pipelines handle.
+
+		state.scissorTestEnabled	= rnd.getBool();
+		state.scissorRectangle		= rr::WindowRectangle(rnd.getInt(0, width-1), rnd.getInt(0, height-1), rnd.getInt(1, width), rnd.getInt(1, height));
+		state.depthTestEnabled		= rnd.getBool();
+		state.depthFunc				= randomTestFunc(rnd);
+		state.depthMask				= rnd.getBool();
+		state.stencilTestEnabled	= false;
+
+		if (rnd.getBool())
+		{
+			state.blendMode					= rr::BLENDMODE_STANDARD;
+			state.blendRGBState.equation	= rr::BLENDEQUATION_ADD;
+			state.blendRGBState.srcFunc		= rr::BLENDFUNC_SRC_ALPHA;
+			state.blendRGBState.dstFunc		= rr::BLENDFUNC_ONE_MINUS_SRC_ALPHA;
+			state.blendAState				= state.blendRGBState;
+		}
+		else
+			state.blendMode = rr::BLENDMODE_NONE;
+
+		// Random initial buffer contents, with depth values from a small set so that equal depths occur.
+
+		for (int bufNdx = 0; bufNdx < 2; bufNdx++)
+		{
+			colorBuffers[bufNdx].setStorage(colorFormat, numSamples, width, height);
+
+			if (hasDepth)
+				depthBuffers[bufNdx].setStorage(depthFormat, numSamples, width, height);
+
+			if (hasStencil)
+				stencilBuffers[bufNdx].setStorage(stencilFormat, numSamples, width, height);
+		}
+
+		for (int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
+		{
+			for (int sampleNdx = 0; sampleNdx < numSamples; sampleNdx++)
+			{
+				const Vec4	color	= randomColor(rnd);
+				const float	depth	= (float)rnd.getInt(0, 8) / 8.0f;
+				const int	stencil	= rnd.getInt(0, 255);
+
+				for (int bufNdx = 0; bufNdx < 2; bufNdx++)
+				{
+					colorBuffers[bufNdx].getAccess().setPixel(color, sampleNdx, x, y);
+
+					if (hasDepth)
+						depthBuffers[bufNdx].getAccess().setPixDepth(depth, sampleNdx, x, y);
+
+					if (hasStencil)
+						stencilBuffers[bufNdx].getAccess().setPixStencil(stencil, sampleNdx, x, y);
+				}
+			}
+
+			pixels.push_back(IVec2(x, y));
+		}
+
+		// At most one fragment per pixel, with random coverage and depths partly outside [0, 1].
+
+		rnd.shuffle(pixels.begin(), pixels.end());
+		pixels.resize((size_t)rnd.getInt(1, (int)pixels.size()));
+		sampleDepths.resize(pixels.size()*numSamples);
+
+		for (size_t sampleNdx = 0; sampleNdx < sampleDepths.size(); sampleNdx++)
+			sampleDepths[sampleNdx] = (float)rnd.getInt(-2, 10) / 8.0f;
+
+		for (size_t fragNdx = 0; fragNdx < pixels.size(); fragNdx++)
+		{
+			const deUint32 coverage = rnd.getUint32() & ((1u << numSamples) - 1u);
+
+			fragments.push_back(rr::Fragment(pixels[fragNdx], rr::GenericVec4(randomColor(rnd)), coverage, &sampleDepths[fragNdx*numSamples]));
+		}
+
+		{
+			const rr::FaceType		facing		= rnd.getBool() ? rr::FACETYPE_FRONT : rr::FACETYPE_BACK;
+			rr::FragmentProcessor	processor;
+
+			processor.render(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(colorBuffers[0].getAccess()),
+							 rr::MultisamplePixelBufferAccess::fromMultisampleAccess(depthBuffers[0].getAccess()),
+							 rr::MultisamplePixelBufferAccess::fromMultisampleAccess(stencilBuffers[0].getAccess()),
+							 &fragments[0], (int)fragments.size(), facing, state);
+
+			processor.renderGeneric(rr::MultisamplePixelBufferAccess::fromMultisampleAccess(colorBuffers[1].getAccess()),
+									rr::MultisamplePixelBufferAccess::fromMultisampleAccess(depthBuffers[1].getAccess()),
+									rr::MultisamplePixelBufferAccess::fromMultisampleAccess(stencilBuffers[1].getAccess()),
+									&fragments[0], (int)fragments.size(), facing, state);
+		}
+
+		{
+			const bool colorOk		= bufferEquals(colorBuffers[0].getAccess(), colorBuffers[1].getAccess());
+			const bool depthOk		= !hasDepth || bufferEquals(depthBuffers[0].getAccess(), depthBuffers[1].getAccess());
+			const bool stencilOk	= !hasStencil || bufferEquals(stencilBuffers[0].getAccess(), stencilBuffers[1].getAccess());
+
+			if (!colorOk || !depthOk || !stencilOk)
+			{
+				m_testCtx.getLog() << TestLog::Message
+								   << "FAIL: iteration " << iterNdx << ": " << colorFormat << ", " << numSamples << " samples, "
+								   << "depth test " << (state.depthTestEnabled && hasDepth ? "on" : "off") << ", "
+								   << "blend " << (state.blendMode == rr::BLENDMODE_STANDARD ? "on" : "off") << ", "
+								   << "scissor " << (state.scissorTestEnabled ? "on" : "off") << ": "
+								   << (colorOk ? "" : "color ") << (depthOk ? "" : "depth ") << (stencilOk ? "" : "stencil ")
+								   << "buffer differs"
+								   << TestLog::EndMessage;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static tcu::Vec4 randomColor (de::Random& rnd)
+	{
+		return tcu::Vec4(rnd.getFloat(-0.5f, 1.5f), rnd.getFloat(-0.5f, 1.5f), rnd.getFloat(-0.5f, 1.5f), rnd.getFloat(-0.25f, 1.25f));
+	}
+};
+
 class CommonFrameworkTests : public tcu::TestCaseGroup
 {
 public:
@@ -897,6 +1187,21 @@ public:
 	}
 };
 
+class OpenGLFrameworkTests : public tcu::TestCaseGroup
+{
+public:
+	OpenGLFrameworkTests (tcu::TestContext& testCtx)
+		: tcu::TestCaseGroup(testCtx, "opengl", "Tests for the OpenGL utility framework")
+	{
+	}
+
+	void init (void)
+	{
+		addChild(new SelfCheckCase(m_testCtx, "call_trace", "glu::CallTrace_selfTest()",
+								   glu::CallTrace_selfTest));
+	}
+};
+
 class ReferenceRendererTests : public tcu::TestCaseGroup
 {
 public:
@@ -908,6 +1213,7 @@ public:
 	void init (void)
 	{
 		addChild(new ConstantInterpolationTest(m_testCtx));
+		addChild(new FragmentPipelineSpecializationTest(m_testCtx));
 	}
 };
 
@@ -926,6 +1232,7 @@ void FrameworkTests::init (void)
 {
 	addChild(new CommonFrameworkTests	(m_testCtx));
 	addChild(new CaseListParserTests	(m_testCtx));
+	addChild(new OpenGLFrameworkTests	(m_testCtx));
 	addChild(new ReferenceRendererTests	(m_testCtx));
 	addChild(createTextureFormatTests	(m_testCtx));
 	addChild(createAstcTests			(m_testCtx));
@@ -27,6 +27,7 @@ import sys
 
 from build.common import *
 from build.build import *
+from log.log_parser import BatchResultParser, StatusCode
 
 pythonExecutable = sys.executable or "python"
 
@@ -114,6 +115,53 @@ class Build(BuildTestStep):
 
 		build(curConfig, self.generator)
 
+class RunVulkanTests(BuildTestStep):
+	ACCEPTED_STATUS_CODES = set([
+		StatusCode.PASS,
+		StatusCode.NOT_SUPPORTED,
+		StatusCode.QUALITY_WARNING,
+		StatusCode.COMPATIBILITY_WARNING
+	])
+
+	def __init__ (self, buildStep, caseFilter):
+		self.buildStep	= buildStep
+		self.caseFilter	= caseFilter
+
+	def getName (self):
+		return "%s: %s" % (self.buildStep.getName(), self.caseFilter)
+
+	def isAvailable (self, env):
+		return self.buildStep.isAvailable(env)
+
+	def run (self, env):
+		buildDir	= os.path.join(env.tmpDir, self.buildStep.buildDir)
+		workDir		= os.path.join(buildDir, "external", "vulkancts", "modules", "vulkan")
+		logPath		= os.path.join(buildDir, "%s.qpa" % self.caseFilter.replace("*", "all"))
+
+		if os.path.exists(logPath):
+			os.remove(logPath)
+
+		pushWorkingDir(workDir)
+		try:
+			execute([os.path.join(".", "deqp-vk"),
+					 "--deqp-case=%s" % self.caseFilter,
+					 "--deqp-log-filename=%s" % logPath,
+					 "--deqp-log-images=disable",
+					 "--deqp-log-shader-sources=disable"])
+		finally:
+			popWorkingDir()
+
+		results		= BatchResultParser().parseFile(logPath)
+		failures	= [result for result in results if result.statusCode not in RunVulkanTests.ACCEPTED_STATUS_CODES]
+
+		if len(results) == 0:
+			die("No test results for %s" % self.caseFilter)
+
+		if len(failures) > 0:
+			for result in failures:
+				print(str(result))
+			die("%d of %d cases in %s failed" % (len(failures), len(results), self.caseFilter))
+
 class CheckSrcChanges(BuildTestStep):
 	def getName (self):
 		return "check for changes"
@@ -184,6 +232,15 @@ BUILD_TARGETS		= [
 		  ANY_VS_X64_GENERATOR),
 ]
 
+# Performance harness runs against the null driver, so it is checked without a GPU
+VULKAN_NULL_BUILD	= Build("vulkan-null-release",
+							UnixConfig("null",
+									   "Release",
+									   "gcc",
+									   "g++",
+									   GCC_64BIT_CFLAGS),
+							ANY_UNIX_GENERATOR)
+
 EARLY_SPECIAL_RECIPES	= [
 	('gen-inl-files', [
 			RunScript(os.path.join("scripts", "gen_egl.py")),
@@ -209,6 +266,10 @@ LATE_SPECIAL_RECIPES	= [
 					  lambda env: ["--build-dir", os.path.join(env.tmpDir, "spirv-binaries"),
 									"--dst-path", os.path.join(env.tmpDir, "spirv-binaries")]),
 		]),
+	('vulkan-perf-null', [
+			VULKAN_NULL_BUILD,
+			RunVulkanTests(VULKAN_NULL_BUILD, "dEQP-VK-perf.*"),
+		]),
 	('check-all', [
 			RunScript(os.path.join("scripts", "src_util", "check_all.py")),
 		])
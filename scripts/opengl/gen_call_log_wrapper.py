@@ -380,6 +380,25 @@ def getVarDefaultPrint (type, varName):
 	else:
 		return varName
 
+def getVarTraceArg (type, varName):
+	if re.match(r'^.*\*$', type) or type in ['GLsync', 'GLeglImageOES']:
+		return "addPointer(reinterpret_cast<deUintptr>(static_cast<const void*>(%s)))" % varName
+	elif type == 'GLDEBUGPROC':
+		return "addPointer(reinterpret_cast<deUintptr>(%s))" % varName
+	elif type in ['GLfloat', 'GLclampf']:
+		return "addFloat(%s)" % varName
+	elif type in ['GLdouble', 'GLclampd']:
+		return "addDouble(%s)" % varName
+	elif type == 'GLboolean':
+		return "addBoolean(%s)" % varName
+	elif type in ['GLubyte', 'GLbyte', 'GLenum', 'GLushort', 'GLbitfield']:
+		# same types that are printed in hex in text log
+		return "addHex(%s)" % varName
+	elif type in ['GLuint', 'GLuint64']:
+		return "addUint(%s)" % varName
+	else:
+		return "addInt(%s)" % varName
+
 def commandLogWrapperMemberDef (command):
 	src = ""
 	try:
@@ -406,6 +425,13 @@ def commandLogWrapperMemberDef (command):
 	src += "\tif (m_enableLog)\n"
 	src += "\t\tm_log << TestLog::Message << %s;\n" % " << ".join(callPrintItems)
 
+	# Record call in binary trace
+	traceItems = ["beginCall(\"%s\", %d)" % (command.name, len(command.params))]
+	traceItems += [getVarTraceArg(param.type, param.name) for param in command.params]
+
+	src += "\tif (m_enableTrace)\n"
+	src += "\t\tm_trace.%s;\n" % ".".join(traceItems)
+
 	callStr = "m_gl.%s(%s)" % (getFunctionMemberName(command.name), ", ".join([p.name for p in command.params]))
 
 	isVoid	= command.type == 'void'